@@ -776,7 +776,7 @@ class _CppHeaderFileWriter(_CppFileWriterBase):
             common.template_args('// Map: fieldName -> ${should_forward_name}',
                                  should_forward_name=field_list_info.get_should_forward_name()))
         self._writer.write_line(
-            "static const stdx::unordered_map<std::string, bool> _genericFields;")
+            "static const StringMap<bool> _genericFields;")
         self.write_empty_line()
 
     def gen_known_fields_declaration(self):
@@ -1023,6 +1023,7 @@ class _CppHeaderFileWriter(_CppFileWriterBase):
             'mongo/idl/idl_parser.h',
             'mongo/rpc/op_msg.h',
             'mongo/stdx/unordered_map.h',
+            'mongo/util/string_map.h',
         ] + spec.globals.cpp_includes
 
         if spec.configs:
@@ -1478,13 +1479,13 @@ class _CppSourceFileWriter(_CppFileWriterBase):
         defn = field_list_info.get_has_field_method().get_definition()
         with self._block('%s {' % (defn, ), '}'):
             self._writer.write_line(
-                'return _genericFields.find(fieldName.toString()) != _genericFields.end();')
+                'return _genericFields.find(fieldName) != _genericFields.end();')
 
         self._writer.write_empty_line()
 
         defn = field_list_info.get_should_forward_method().get_definition()
         with self._block('%s {' % (defn, ), '}'):
-            self._writer.write_line('auto it = _genericFields.find(fieldName.toString());')
+            self._writer.write_line('auto it = _genericFields.find(fieldName);')
             self._writer.write_line('return (it == _genericFields.end() || it->second);')
 
         self._writer.write_empty_line()
@@ -2105,7 +2106,7 @@ class _CppSourceFileWriter(_CppFileWriterBase):
             common.template_args('// Map: fieldName -> ${should_forward_name}',
                                  should_forward_name=field_list_info.get_should_forward_name()))
         block_name = common.template_args(
-            'const stdx::unordered_map<std::string, bool> ${klass}::_genericFields {', klass=klass)
+            'const StringMap<bool> ${klass}::_genericFields {', klass=klass)
         with self._block(block_name, "};"):
             sorted_entries = sorted(field_list.fields, key=lambda f: f.name)
             for entry in sorted_entries:
@@ -764,4 +764,33 @@ TEST(BSONObj, sizeChecks) {
         ErrorCodes::BSONObjectTooLarge);
 }
 
+TEST(IndexedBSONObj, GetFieldBeforeAndAfterIndexBuild) {
+    auto obj = BSON("a" << 1 << "b"
+                        << "str"
+                        << "c" << BSON("x" << 1));
+    IndexedBSONObj indexed(obj);
+
+    // Probe enough times to cross the lazy index build threshold and verify lookups agree with
+    // the linear scan both before and after the table is built.
+    for (int i = 0; i < IndexedBSONObj::kIndexThreshold + 2; ++i) {
+        ASSERT_BSONELT_EQ(indexed.getField("a"), obj.getField("a"));
+        ASSERT_BSONELT_EQ(indexed.getField("c"), obj.getField("c"));
+        ASSERT(indexed.getField("missing").eoo());
+        ASSERT(indexed.hasField("b"));
+        ASSERT_FALSE(indexed.hasField("missing"));
+    }
+}
+
+TEST(IndexedBSONObj, DuplicateFieldNamesReturnFirstOccurrence) {
+    BSONObjBuilder bob;
+    bob.append("a", 1);
+    bob.append("a", 2);
+    auto obj = bob.obj();
+
+    IndexedBSONObj indexed(obj);
+    for (int i = 0; i < IndexedBSONObj::kIndexThreshold + 2; ++i) {
+        ASSERT_EQ(indexed.getField("a").numberInt(), 1);
+    }
+}
+
 }  // unnamed namespace
@@ -31,11 +31,16 @@
 #include <cstring>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "mongo/base/data_view.h"
 #include "mongo/bson/bson_depth.h"
 #include "mongo/bson/bson_validate.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/bits.h"
 
 namespace mongo {
 namespace {
@@ -149,10 +154,27 @@ private:
         size_t strlen() const {
             // This is actually by far the hottest code in all of BSON validation.
             dassert(ptr < end);
+#if defined(__SSE2__)
+            // Scan 16 bytes at a time as long as a full vector fits in the buffer. The last byte
+            // of the buffer is the EOO byte of the outermost object, which is zero, so the scalar
+            // tail loop below always terminates before running off the end.
+            const char* cur = ptr;
+            const __m128i zero = _mm_setzero_si128();
+            while (end - cur >= 16) {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cur));
+                if (uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero)))
+                    return cur - ptr + countTrailingZeros64(mask);
+                cur += 16;
+            }
+            while (*cur)
+                ++cur;
+            return cur - ptr;
+#else
             size_t len = 0;
             while (ptr[len])
                 ++len;
             return len;
+#endif
         }
 
         const char* ptr;
@@ -469,6 +469,15 @@ std::vector<BSONElement> BSONElement::Array() const {
 int BSONElement::woCompare(const BSONElement& elem,
                            ComparisonRulesSet rules,
                            const StringData::ComparatorInterface* comparator) const {
+    // Under simple (binary) string comparison, bytewise-identical elements always compare equal,
+    // so ties can be resolved with a single memcmp over the raw element bytes rather than the
+    // per-type dispatch below. memcmp compiles down to wide loads and stops at the first
+    // mismatching byte, so differing elements pay at most one extra scan of their shared prefix.
+    // Sort keys and index keys contain long runs of ties, which makes this the common case for
+    // in-memory sorts and index maintenance.
+    if (!comparator && binaryEqual(elem))
+        return 0;
+
     if (type() != elem.type()) {
         int lt = (int)canonicalType();
         int rt = (int)elem.canonicalType();
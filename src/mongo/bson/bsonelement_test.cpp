@@ -43,6 +43,18 @@ namespace {
 
 using namespace fmt::literals;
 
+TEST(BSONElement, WoCompareBinaryIdenticalElementsInDistinctBuffers) {
+    // Binary-identical elements must compare equal through the bytewise fast path even when they
+    // live in different buffers, including NaN values, which are not equal to themselves under
+    // IEEE semantics but are under BSON ordering.
+    BSONObj lhs = BSON("a" << std::numeric_limits<double>::quiet_NaN() << "b"
+                           << "hello");
+    BSONObj rhs = lhs.copy();
+    ASSERT_EQ(lhs["a"].woCompare(rhs["a"]), 0);
+    ASSERT_EQ(lhs["b"].woCompare(rhs["b"]), 0);
+    ASSERT_EQ(lhs.woCompare(rhs), 0);
+}
+
 TEST(BSONElement, BinDataToString) {
     BSONObjBuilder builder;
     unsigned char bintype0[] = {0xDE, 0xEA, 0xBE, 0xEF, 0x01};  // Random BinData shorter than UUID
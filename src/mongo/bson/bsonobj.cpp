@@ -574,6 +574,27 @@ BSONElement BSONObj::getField(StringData name) const {
     return BSONElement();
 }
 
+BSONElement IndexedBSONObj::getField(StringData name) const {
+    if (!_indexed) {
+        if (++_probes <= kIndexThreshold)
+            return _obj.getField(name);
+        _buildIndex();
+    }
+    auto it = _index.find(name);
+    if (it == _index.end())
+        return BSONElement();
+    return BSONElement(_obj.objdata() + it->second);
+}
+
+void IndexedBSONObj::_buildIndex() const {
+    for (auto&& e : _obj) {
+        // On duplicate field names keep the first occurrence, matching the linear scan behavior
+        // of BSONObj::getField().
+        _index.try_emplace(e.fieldName(), e.rawdata() - _obj.objdata());
+    }
+    _indexed = true;
+}
+
 int BSONObj::getIntField(StringData name) const {
     BSONElement e = getField(name);
     return e.isNumber() ? (int)e.number() : std::numeric_limits<int>::min();
@@ -888,6 +888,45 @@ public:
     BSONArrayIteratorSorted(const BSONArray& array);
 };
 
+/**
+ * Wraps a BSONObj with a lazily-built field name to offset table so that repeated field lookups
+ * on the same (typically wide) document become O(1) instead of a linear scan per probe. The table
+ * is only built once the same object has been probed more than kIndexThreshold times, so callers
+ * that look up just a field or two never pay for it. Intended for code that probes the same
+ * document many times, such as projection or the update system.
+ *
+ * Holds a copy of the given BSONObj (a cheap view); as usual, the underlying buffer must stay
+ * valid for the lifetime of this object unless the BSONObj is owned.
+ */
+class IndexedBSONObj {
+public:
+    // Number of linear probes after which building the offset table is assumed to be cheaper than
+    // continuing to scan the object on every lookup.
+    static constexpr int kIndexThreshold = 3;
+
+    explicit IndexedBSONObj(BSONObj obj) : _obj(std::move(obj)) {}
+
+    const BSONObj& obj() const {
+        return _obj;
+    }
+
+    /** Same as BSONObj::getField(), but amortized O(1) for repeated probes. */
+    BSONElement getField(StringData name) const;
+
+    bool hasField(StringData name) const {
+        return !getField(name).eoo();
+    }
+
+private:
+    void _buildIndex() const;
+
+    BSONObj _obj;
+    mutable int _probes = 0;
+    mutable bool _indexed = false;
+    // Offset of each element from objdata(), keyed by field name. Empty until built.
+    mutable StringMap<int> _index;
+};
+
 inline BSONObj::iterator BSONObj::begin() const {
     return BSONObj::iterator(*this);
 }
@@ -107,6 +107,20 @@ public:
         _b.reserveBytes(1);
     }
 
+    // Tag for constructing the internal buffer builder in place from arbitrary arguments. Used by
+    // builders whose buffer allocator needs more than a size hint, such as PooledFragmentBuilder.
+    struct InPlaceBufferTag {};
+
+    template <typename... BufBuilderArgs>
+    BSONObjBuilderBase(InPlaceBufferTag, BufBuilderArgs&&... args)
+        : _b(_buf), _buf(std::forward<BufBuilderArgs>(args)...) {
+        // See the comments in the first constructor for details.
+        _b.skip(sizeof(int));
+
+        // Reserve space for the EOO byte. This means _done() can't fail.
+        _b.reserveBytes(1);
+    }
+
     BSONObjBuilderBase(const BSONSizeTracker& tracker)
         : _b(_buf), _buf(tracker.getSize()), _tracker(const_cast<BSONSizeTracker*>(&tracker)) {
         // See the comments in the first constructor for details.
@@ -881,6 +895,67 @@ private:
     }
 };
 
+/**
+ * Alternative to BSONObjBuilder which builds the object inside a fragment of a larger refcounted
+ * buffer managed by a SharedBufferFragmentBuilder. This lets all the documents built for one
+ * operation (e.g. the reply documents of a request) share a single arena allocation instead of
+ * paying a malloc/realloc/free cycle per document. The arena block stays alive until every object
+ * built from it has been destroyed.
+ *
+ * Only one PooledBSONObjBuilder may be building on a given SharedBufferFragmentBuilder at a time;
+ * finish each object with obj() (or destroy the builder) before starting the next one.
+ */
+class PooledBSONArrayBuilder;
+class PooledBSONObjBuilder : public BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder> {
+private:
+    using Super = BSONObjBuilderBase<PooledBSONObjBuilder, PooledFragmentBuilder>;
+    friend Super;
+
+public:
+    using ArrayBuilder = PooledBSONArrayBuilder;
+
+    explicit PooledBSONObjBuilder(SharedBufferFragmentBuilder& fragmentBuilder)
+        : Super(Super::InPlaceBufferTag{}, fragmentBuilder) {}
+
+    /** Constructs a sub-object builder appending into an existing pooled buffer builder. */
+    PooledBSONObjBuilder(PooledFragmentBuilder& baseBuilder) : Super(baseBuilder) {}
+
+    PooledBSONObjBuilder(PooledBSONObjBuilder&&) = default;
+    PooledBSONObjBuilder(const PooledBSONObjBuilder&) = delete;
+    PooledBSONObjBuilder& operator=(PooledBSONObjBuilder&&) = delete;
+    PooledBSONObjBuilder& operator=(const PooledBSONObjBuilder&) = delete;
+
+    ~PooledBSONObjBuilder() {
+        Super::_destruct();
+    }
+
+    /**
+     * destructive
+     * The returned BSONObj shares ownership of the arena buffer, which is freed once the last
+     * object built from it goes away.
+     */
+    template <typename BSONTraits = BSONObj::DefaultSizeTrait>
+    BSONObj obj() {
+        massert(5837100, "builder does not own memory", owned());
+        auto out = done<BSONTraits>();
+        // Finish the fragment so the arena can start the next object, and keep the underlying
+        // arena buffer alive for as long as the returned object is.
+        SharedBufferFragment fragment = _b.done();
+        out.shareOwnershipWith(fragment.underlyingBuffer());
+        return out;
+    }
+
+private:
+    // Compile-time "virtual" methods which must be provided to satisfy the base class.
+    void doDone() {
+        // Intentionally left empty.
+    }
+
+    void doResetToEmpty() {
+        // Intentionally left empty.
+    }
+};
+
 /**
  * Base class for building BSON arrays. Similar to BSONObjBuilderBase.
  */
@@ -1067,6 +1142,20 @@ public:
         : BSONArrayBuilderBase<UniqueBSONArrayBuilder, UniqueBSONObjBuilder>(bufBuilder) {}
 };
 
+/**
+ * Alternative to BSONArrayBuilder. This class is analogous to PooledBSONObjBuilder.
+ */
+class PooledBSONArrayBuilder
+    : public BSONArrayBuilderBase<PooledBSONArrayBuilder, PooledBSONObjBuilder> {
+public:
+    using ObjBuilder = PooledBSONObjBuilder;
+
+    explicit PooledBSONArrayBuilder(SharedBufferFragmentBuilder& fragmentBuilder)
+        : BSONArrayBuilderBase<PooledBSONArrayBuilder, PooledBSONObjBuilder>(fragmentBuilder) {}
+    PooledBSONArrayBuilder(PooledFragmentBuilder& bufBuilder)
+        : BSONArrayBuilderBase<PooledBSONArrayBuilder, PooledBSONObjBuilder>(bufBuilder) {}
+};
+
 template <class Derived, class B>
 template <class T>
 inline Derived& BSONObjBuilderBase<Derived, B>::append(StringData fieldName,
@@ -579,5 +579,75 @@ TEST(BSONObjBuilderTest, UniqueArrayBuilderReleaseToBuffer) {
         auto tmp = UniqueBuffer::reclaim(rawData);
     }
 }
+TEST(BSONObjBuilderTest, PooledBuilderReleaseToObj) {
+    SharedBufferFragmentBuilder arena(1024);
+
+    PooledBSONObjBuilder bob(arena);
+    bob.append("a", 1);
+    bob.append("b", 2);
+
+    BSONObj obj = bob.obj();
+    ASSERT(obj.isOwned());
+    ASSERT_BSONOBJ_EQ(obj, BSON("a" << 1 << "b" << 2));
+}
+
+TEST(BSONObjBuilderTest, PooledBuildersShareArenaBuffer) {
+    SharedBufferFragmentBuilder arena(1024);
+
+    BSONObj first = [&] {
+        PooledBSONObjBuilder bob(arena);
+        bob.append("a", 1);
+        return bob.obj();
+    }();
+    BSONObj second = [&] {
+        PooledBSONObjBuilder bob(arena);
+        bob.append("b", 2);
+        return bob.obj();
+    }();
+
+    // Both objects come out of the same underlying arena block.
+    ASSERT_EQ(first.sharedBuffer().get(), second.sharedBuffer().get());
+    ASSERT_BSONOBJ_EQ(first, BSON("a" << 1));
+    ASSERT_BSONOBJ_EQ(second, BSON("b" << 2));
+}
+
+TEST(BSONObjBuilderTest, PooledBuilderDiscardsOnDestructionWithoutDone) {
+    SharedBufferFragmentBuilder arena(1024);
+    {
+        PooledBSONObjBuilder bob(arena);
+        bob.append("a", 1);
+        // Destroying the builder without finishing must return the fragment to the arena.
+    }
+    ASSERT(!arena.building());
+
+    PooledBSONObjBuilder bob(arena);
+    bob.append("b", 2);
+    ASSERT_BSONOBJ_EQ(bob.obj(), BSON("b" << 2));
+}
+
+TEST(BSONObjBuilderTest, PooledBuilderSubObject) {
+    SharedBufferFragmentBuilder arena(1024);
+
+    PooledBSONObjBuilder bob(arena);
+    {
+        PooledBSONObjBuilder inner(bob.subobjStart("nested"));
+        inner.append("a", 1);
+    }
+    bob.append("b", 2);
+
+    ASSERT_BSONOBJ_EQ(bob.obj(), BSON("nested" << BSON("a" << 1) << "b" << 2));
+}
+
+TEST(BSONObjBuilderTest, PooledArrayBuilderReleaseToObj) {
+    SharedBufferFragmentBuilder arena(1024);
+
+    PooledBSONArrayBuilder bab(arena);
+    bab.append(1);
+    bab.append("hello");
+
+    BSONArray arr = bab.arr();
+    ASSERT_BSONOBJ_EQ(arr, BSON_ARRAY(1 << "hello"));
+}
+
 }  // namespace
 }  // namespace mongo
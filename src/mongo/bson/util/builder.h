@@ -128,11 +128,15 @@ class SharedBufferFragmentAllocator {
     SharedBufferFragmentAllocator& operator=(const SharedBufferFragmentAllocator&) = delete;
 
 public:
+    // Creates an allocator that is not attached to any fragment builder and thus cannot allocate.
+    // Used as the placeholder buffer of pooled BSON builders that append into an externally
+    // provided buffer builder.
+    SharedBufferFragmentAllocator() = default;
     SharedBufferFragmentAllocator(SharedBufferFragmentBuilder& fragmentBuilder)
-        : _fragmentBuilder(fragmentBuilder) {}
+        : _fragmentBuilder(&fragmentBuilder) {}
     ~SharedBufferFragmentAllocator() {
         // Discard if the build was not finished at the time of destruction.
-        if (_fragmentBuilder.building()) {
+        if (_fragmentBuilder && _fragmentBuilder->building()) {
             free();
         }
     }
@@ -147,33 +151,37 @@ public:
     }
 
     void realloc(size_t sz) {
-        auto capacity = _fragmentBuilder.capacity();
+        invariant(_fragmentBuilder);
+        auto capacity = _fragmentBuilder->capacity();
         if (capacity < sz)
-            _fragmentBuilder.grow(sz);
+            _fragmentBuilder->grow(sz);
     }
 
     void free() {
-        _fragmentBuilder.discard();
+        if (_fragmentBuilder)
+            _fragmentBuilder->discard();
     }
 
     void start(size_t sz) {
-        _fragmentBuilder.start(sz);
+        invariant(_fragmentBuilder);
+        _fragmentBuilder->start(sz);
     }
 
     SharedBufferFragment finish(int sz) {
-        return _fragmentBuilder.finish(sz);
+        invariant(_fragmentBuilder);
+        return _fragmentBuilder->finish(sz);
     }
 
     size_t capacity() const {
-        return _fragmentBuilder.capacity();
+        return _fragmentBuilder ? _fragmentBuilder->capacity() : 0;
     }
 
     char* get() const {
-        return _fragmentBuilder.get();
+        return _fragmentBuilder ? _fragmentBuilder->get() : nullptr;
     }
 
 private:
-    SharedBufferFragmentBuilder& _fragmentBuilder;
+    SharedBufferFragmentBuilder* _fragmentBuilder = nullptr;
 };
 
 class UniqueBufferAllocator {
@@ -496,6 +504,11 @@ public:
         _buf.start(0);
     }
 
+    // Creates a builder that is not attached to any fragment builder and cannot allocate. Exists
+    // so that pooled BSON builders can construct their unused placeholder buffer when appending
+    // into an externally provided builder; the size hint is ignored.
+    explicit PooledFragmentBuilder(size_t) : BasicBufBuilder() {}
+
     SharedBufferFragment done() {
         return _buf.finish(l);
     }
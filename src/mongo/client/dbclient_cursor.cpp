@@ -327,7 +327,12 @@ BSONObj DBClientCursor::commandDataReceived(const Message& reply) {
         wasError = true;
     }
 
-    return commandReply->getCommandReply().getOwned();
+    // The reply body views the message buffer, so rather than copying it out, share ownership
+    // with the (refcounted) buffer. Documents later extracted from the batch share the same
+    // buffer, making the path from the wire to the consumer copy-free. The whole message buffer
+    // stays alive until the last such document is gone, but batch consumers generally hold on to
+    // all documents in the batch for the same length of time anyway.
+    return BSONObj(commandReply->getCommandReply()).shareOwnershipWith(reply.sharedBuffer());
 }
 
 void DBClientCursor::dataReceived(const Message& reply, bool& retry, string& host) {
@@ -56,12 +56,14 @@ void AuthorizationSessionForTest::assumePrivilegesForDB(PrivilegeVector privileg
     userHandle->addPrivileges(privileges);
 
     _authenticatedUsers.add(userHandle);
+    _resolvedPrivilegeCache.clear();
     _testUsers.emplace_back(std::move(userHandle));
     _buildAuthenticatedRolesVector();
 }
 
 void AuthorizationSessionForTest::revokePrivilegesForDB(StringData dbName) {
     _authenticatedUsers.removeByDBName(dbName);
+    _resolvedPrivilegeCache.clear();
     _testUsers.erase(
         std::remove_if(_testUsers.begin(),
                        _testUsers.end(),
@@ -74,6 +76,7 @@ void AuthorizationSessionForTest::revokeAllPrivileges() {
                                     _testUsers.end(),
                                     [&](const auto& user) {
                                         _authenticatedUsers.removeByDBName(user->getName().getDB());
+                                        _resolvedPrivilegeCache.clear();
                                         return true;
                                     }),
                      _testUsers.end());
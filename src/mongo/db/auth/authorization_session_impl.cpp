@@ -153,6 +153,7 @@ Status AuthorizationSessionImpl::addAndAuthorizeUser(OperationContext* opCtx,
 
     stdx::lock_guard<Client> lk(*opCtx->getClient());
     _authenticatedUsers.add(std::move(user));
+    _resolvedPrivilegeCache.clear();
 
     // If there are any users and roles in the impersonation data, clear it out.
     clearImpersonatedUserData();
@@ -198,6 +199,7 @@ void AuthorizationSessionImpl::logoutDatabase(OperationContext* opCtx, StringDat
                          updatedUsers.toBSON());
     }
     std::swap(_authenticatedUsers, updatedUsers);
+    _resolvedPrivilegeCache.clear();
 
     clearImpersonatedUserData();
     _buildAuthenticatedRolesVector();
@@ -214,6 +216,7 @@ RoleNameIterator AuthorizationSessionImpl::getAuthenticatedRoleNames() {
 void AuthorizationSessionImpl::grantInternalAuthorization(Client* client) {
     stdx::lock_guard<Client> lk(*client);
     _authenticatedUsers.add(internalSecurity.user);
+    _resolvedPrivilegeCache.clear();
     _buildAuthenticatedRolesVector();
 }
 
@@ -628,6 +631,11 @@ bool AuthorizationSessionImpl::isAuthorizedForActionsOnNamespace(const Namespace
 }
 
 static const int resourceSearchListCapacity = 5;
+
+// Bound on the number of distinct resource patterns whose privilege resolutions are remembered
+// per session, so that long-lived connections on many-collection deployments do not accumulate
+// unbounded state.
+static const size_t kResolvedPrivilegeCacheMaxSize = 512;
 /**
  * Builds from "target" an exhaustive list of all ResourcePatterns that match "target".
  *
@@ -770,7 +778,10 @@ void AuthorizationSessionImpl::_refreshUserInfoAsNeeded(OperationContext* opCtx)
 
             // The user is invalid, so make sure that we erase it from _authenticateUsers at the
             // end of this block.
-            auto removeGuard = makeGuard([&] { _authenticatedUsers.removeAt(it++); });
+            auto removeGuard = makeGuard([&] {
+                _authenticatedUsers.removeAt(it++);
+                _resolvedPrivilegeCache.clear();
+            });
 
             switch (status.code()) {
                 case ErrorCodes::OK: {
@@ -797,6 +808,7 @@ void AuthorizationSessionImpl::_refreshUserInfoAsNeeded(OperationContext* opCtx)
                     // Success! Replace the old User object with the updated one.
                     removeGuard.dismiss();
                     _authenticatedUsers.replaceAt(it, std::move(updatedUser));
+                    _resolvedPrivilegeCache.clear();
                     LOGV2_DEBUG(20244,
                                 1,
                                 "Updated session cache of user information for user",
@@ -919,10 +931,22 @@ bool AuthorizationSessionImpl::isAuthorizedForAnyActionOnResource(const Resource
 bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privilege) {
     const ResourcePattern& target(privilege.getResourcePattern());
 
+    // While the localhost exception is inactive, the actions granted for a target depend only on
+    // the set of authenticated users, so the resolution from an earlier check against the same
+    // pattern can be answered with a lookup and a bit test. The cache is cleared whenever the
+    // authenticated user set changes.
+    const bool cacheable = !_externalState->shouldAllowLocalhost();
+    if (cacheable) {
+        auto it = _resolvedPrivilegeCache.find(target);
+        if (it != _resolvedPrivilegeCache.end()) {
+            return it->second.isSupersetOf(privilege.getActions());
+        }
+    }
+
     ResourcePattern resourceSearchList[resourceSearchListCapacity];
     const int resourceSearchListLength = buildResourceSearchList(target, resourceSearchList);
 
-    ActionSet unmetRequirements = privilege.getActions();
+    ActionSet grantedActions;
 
     PrivilegeVector defaultPrivileges = getDefaultPrivileges();
     for (PrivilegeVector::iterator it = defaultPrivileges.begin(); it != defaultPrivileges.end();
@@ -931,26 +955,24 @@ bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privil
             if (!(it->getResourcePattern() == resourceSearchList[i]))
                 continue;
 
-            ActionSet userActions = it->getActions();
-            unmetRequirements.removeAllActionsFromSet(userActions);
-
-            if (unmetRequirements.empty())
-                return true;
+            grantedActions.addAllActionsFromSet(it->getActions());
         }
     }
 
     for (const auto& user : _authenticatedUsers) {
         for (int i = 0; i < resourceSearchListLength; ++i) {
-            ActionSet userActions = user->getActionsForResource(resourceSearchList[i]);
-            unmetRequirements.removeAllActionsFromSet(userActions);
+            grantedActions.addAllActionsFromSet(user->getActionsForResource(resourceSearchList[i]));
+        }
+    }
 
-            if (unmetRequirements.empty()) {
-                return true;
-            }
+    if (cacheable) {
+        if (_resolvedPrivilegeCache.size() >= kResolvedPrivilegeCacheMaxSize) {
+            _resolvedPrivilegeCache.clear();
         }
+        _resolvedPrivilegeCache.emplace(target, grantedActions);
     }
 
-    return false;
+    return grantedActions.isSupersetOf(privilege.getActions());
 }
 
 void AuthorizationSessionImpl::setImpersonatedUserData(std::vector<UserName> usernames,
@@ -43,6 +43,7 @@
 #include "mongo/db/auth/user_set.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/pipeline/aggregate_command_gen.h"
+#include "mongo/stdx/unordered_map.h"
 
 namespace mongo {
 
@@ -198,6 +199,12 @@ protected:
     // All Users who have been authenticated on this connection.
     UserSet _authenticatedUsers;
 
+    // Resolved action sets for resource patterns which have already been checked against the
+    // current set of authenticated users. Must be cleared whenever _authenticatedUsers changes.
+    // Only consulted while the localhost exception is inactive, since that exception grants
+    // privileges which are not derived from the authenticated users.
+    stdx::unordered_map<ResourcePattern, ActionSet> _resolvedPrivilegeCache;
+
     // The roles of the authenticated users. This vector is generated when the authenticated
     // users set is changed.
     std::vector<RoleName> _authenticatedRoleNames;
@@ -220,10 +220,9 @@ StatusWith<std::tuple<bool, std::string>> SaslSCRAMServerMechanism<Policy>::_fir
         }
     }
 
-    _secrets.push_back(scram::Secrets<HashBlock, scram::UnlockedSecretsPolicy>(
-        "",
-        base64::decode(scramCredentials.storedKey),
-        base64::decode(scramCredentials.serverKey)));
+    // The keys were decoded from the stored credentials when the user was loaded into the user
+    // cache, so reconnect storms do not re-derive them for every conversation.
+    _secrets.push_back(userObj->getScramSecrets<HashBlock>());
 
     if (userName == internalSecurity.user->getName() && internalSecurity.alternateCredentials) {
         auto altCredentials = internalSecurity.alternateCredentials->scram<HashBlock>();
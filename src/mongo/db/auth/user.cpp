@@ -40,6 +40,7 @@
 #include "mongo/db/auth/user_name.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/base64.h"
 #include "mongo/util/sequence_util.h"
 
 namespace mongo {
@@ -73,6 +74,17 @@ const User::SCRAMCredentials<SHA256Block>& User::CredentialData::scram<SHA256Blo
     return scram_sha256;
 }
 
+template <>
+const scram::Secrets<SHA1Block, scram::UnlockedSecretsPolicy>& User::getScramSecrets<SHA1Block>()
+    const {
+    return _sha1Secrets;
+}
+template <>
+const scram::Secrets<SHA256Block, scram::UnlockedSecretsPolicy>&
+User::getScramSecrets<SHA256Block>() const {
+    return _sha256Secrets;
+}
+
 RoleNameIterator User::getRoles() const {
     return makeRoleNameIteratorForContainer(_roles);
 }
@@ -103,6 +115,25 @@ bool User::hasActionsForResource(const ResourcePattern& resource) const {
 
 void User::setCredentials(const CredentialData& credentials) {
     _credentials = credentials;
+
+    // Decode the SCRAM keys up front so that each authentication attempt can share them
+    // instead of re-deriving them from their base64 form per conversation.
+    if (_credentials.scram_sha1.isValid()) {
+        _sha1Secrets = scram::Secrets<SHA1Block, scram::UnlockedSecretsPolicy>(
+            "",
+            base64::decode(_credentials.scram_sha1.storedKey),
+            base64::decode(_credentials.scram_sha1.serverKey));
+    } else {
+        _sha1Secrets = {};
+    }
+    if (_credentials.scram_sha256.isValid()) {
+        _sha256Secrets = scram::Secrets<SHA256Block, scram::UnlockedSecretsPolicy>(
+            "",
+            base64::decode(_credentials.scram_sha256.storedKey),
+            base64::decode(_credentials.scram_sha256.serverKey));
+    } else {
+        _sha256Secrets = {};
+    }
 }
 
 void User::setRoles(RoleNameIterator roles) {
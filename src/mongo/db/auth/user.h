@@ -32,6 +32,7 @@
 #include <string>
 #include <vector>
 
+#include "mongo/crypto/mechanism_scram.h"
 #include "mongo/crypto/sha1_block.h"
 #include "mongo/crypto/sha256_block.h"
 #include "mongo/db/auth/privilege.h"
@@ -163,6 +164,15 @@ public:
      */
     const CredentialData& getCredentials() const;
 
+    /**
+     * Returns the SCRAM secrets decoded from this user's stored credentials, or an unpopulated
+     * Secrets object if the user has no valid credentials for the mechanism. The secrets are
+     * decoded once, when the credentials are set, so that authentication attempts can share
+     * them rather than rebuild them per SCRAM conversation.
+     */
+    template <typename HashBlock>
+    const scram::Secrets<HashBlock, scram::UnlockedSecretsPolicy>& getScramSecrets() const;
+
     /**
      * Gets the set of actions this user is allowed to perform on the given resource.
      */
@@ -267,6 +277,10 @@ private:
     // Credential information.
     CredentialData _credentials;
 
+    // SCRAM secrets decoded from _credentials, computed when the credentials are set.
+    scram::Secrets<SHA1Block, scram::UnlockedSecretsPolicy> _sha1Secrets;
+    scram::Secrets<SHA256Block, scram::UnlockedSecretsPolicy> _sha256Secrets;
+
     // Restrictions which must be met by a Client in order to authenticate as this user.
     RestrictionDocuments _restrictions;
 
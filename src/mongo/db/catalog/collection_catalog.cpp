@@ -51,6 +51,25 @@ struct LatestCollectionCatalog {
 const ServiceContext::Decoration<LatestCollectionCatalog> getCatalog =
     ServiceContext::declareDecoration<LatestCollectionCatalog>();
 
+// Supplies the generation numbers that uniquely identify each committed catalog instance. The
+// initial catalog keeps generation 0, so real generations start at 1.
+AtomicWord<uint64_t> nextCatalogGeneration{1};
+
+/**
+ * A single-entry memo of the last committed-catalog namespace lookup an operation performed.
+ * Operations that hit the same namespace repeatedly, oplog application in particular, avoid
+ * re-running the namespace hash lookup for every document. The memo is valid only against the
+ * catalog instance (generation) it was taken from; the uncommitted, per-operation lookup paths
+ * run before it is consulted and are unaffected.
+ */
+struct NamespaceLookupMemo {
+    uint64_t generation = 0;
+    NamespaceString nss;
+    std::shared_ptr<Collection> collection;
+};
+const OperationContext::Decoration<NamespaceLookupMemo> namespaceLookupMemo =
+    OperationContext::declareDecoration<NamespaceLookupMemo>();
+
 /**
  * Decoration on OperationContext to store cloned Collections until they are committed or rolled
  * back TODO SERVER-51236: This should be merged with UncommittedCollections
@@ -486,6 +505,7 @@ void CollectionCatalog::write(ServiceContext* svcCtx, CatalogWriteFn job) {
     // copy the collection catalog, this could be expensive, but we will only have one pending
     // collection in flight at a given time
     auto clone = std::make_shared<CollectionCatalog>(*base);
+    clone->_generation = nextCatalogGeneration.fetchAndAdd(1);
 
     // Execute jobs until we drain the queue
     while (true) {
@@ -680,14 +700,28 @@ std::shared_ptr<Collection> CollectionCatalog::_lookupCollectionByUUID(Collectio
     return foundIt == _catalog.end() ? nullptr : foundIt->second;
 }
 
+std::shared_ptr<Collection> CollectionCatalog::_lookupCollectionByNamespace(
+    OperationContext* opCtx, const NamespaceString& nss) const {
+    auto& memo = namespaceLookupMemo(opCtx);
+    if (memo.generation == _generation && memo.nss == nss) {
+        return memo.collection;
+    }
+
+    auto it = _collections.find(nss);
+    auto coll = (it == _collections.end() ? nullptr : it->second);
+    memo.generation = _generation;
+    memo.nss = nss;
+    memo.collection = coll;
+    return coll;
+}
+
 std::shared_ptr<const Collection> CollectionCatalog::lookupCollectionByNamespaceForRead(
     OperationContext* opCtx, const NamespaceString& nss) const {
     if (auto coll = UncommittedCollections::getForTxn(opCtx, nss)) {
         return coll;
     }
 
-    auto it = _collections.find(nss);
-    auto coll = (it == _collections.end() ? nullptr : it->second);
+    auto coll = _lookupCollectionByNamespace(opCtx, nss);
     return (coll && coll->isCommitted()) ? coll : nullptr;
 }
 
@@ -754,8 +788,7 @@ CollectionPtr CollectionCatalog::lookupCollectionByNamespace(OperationContext* o
         return nullptr;
     }
 
-    auto it = _collections.find(nss);
-    auto coll = (it == _collections.end() ? nullptr : it->second);
+    auto coll = _lookupCollectionByNamespace(opCtx, nss);
     return (coll && coll->isCommitted())
         ? CollectionPtr(opCtx, coll.get(), LookupCollectionForYieldRestore())
         : nullptr;
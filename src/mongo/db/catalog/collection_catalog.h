@@ -339,6 +339,16 @@ public:
      */
     uint64_t getEpoch() const;
 
+    /**
+     * Returns a number identifying this immutable instance of the catalog. Every copy committed
+     * by write() receives a new, unique generation, so equal generations imply the same instance
+     * with the same contents. Per-operation lookup memos use this to detect catalog changes;
+     * unlike the epoch it changes on every catalog write, not just on close and re-open.
+     */
+    uint64_t getGeneration() const {
+        return _generation;
+    }
+
     iterator begin(OperationContext* opCtx, StringData db) const;
     iterator end(OperationContext* opCtx) const;
 
@@ -365,6 +375,14 @@ private:
 
     std::shared_ptr<Collection> _lookupCollectionByUUID(CollectionUUID uuid) const;
 
+    /**
+     * Looks up 'nss' in the committed catalog, consulting and maintaining the per-operation
+     * namespace lookup memo. Callers remain responsible for the uncommitted lookup paths and for
+     * checking Collection::isCommitted().
+     */
+    std::shared_ptr<Collection> _lookupCollectionByNamespace(OperationContext* opCtx,
+                                                             const NamespaceString& nss) const;
+
     /**
      * When present, indicates that the catalog is in closed state, and contains a map from UUID
      * to pre-close NSS. See also onCloseCatalog.
@@ -397,6 +415,11 @@ private:
     // global lock in at least MODE_IS to read it.
     uint64_t _epoch = 0;
 
+    // Uniquely identifies this immutable instance of the catalog. Assigned by write() when a new
+    // copy is made; copied to the clone and then overwritten, so it is never reused. The initial
+    // catalog keeps generation 0.
+    uint64_t _generation = 0;
+
     // Mapping from ResourceId to a set of strings that contains collection and database namespaces.
     std::map<ResourceId, std::set<std::string>> _resourceInformation;
 
@@ -35,6 +35,7 @@
 #include "mongo/db/catalog/document_validation.h"
 #include "mongo/db/catalog/index_key_validate.h"
 #include "mongo/db/catalog/multi_index_block.h"
+#include "mongo/db/curop.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
@@ -112,10 +113,21 @@ StatusWith<int64_t> compactCollection(OperationContext* opCtx,
     auto oldTotalSize = recordStore->storageSize(opCtx) + collection->getIndexSize(opCtx);
     auto indexCatalog = collection->getIndexCatalog();
 
+    // Surface the current phase in currentOp; compaction passes can run for a long time.
+    {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        CurOp::get(opCtx)->setMessage_inlock("Compact: reclaiming space from the record store");
+    }
+
     Status status = recordStore->compact(opCtx);
     if (!status.isOK())
         return status;
 
+    {
+        stdx::unique_lock<Client> lk(*opCtx->getClient());
+        CurOp::get(opCtx)->setMessage_inlock("Compact: reclaiming space from indexes");
+    }
+
     // Compact all indexes (not including unfinished indexes)
     status = indexCatalog->compactIndexes(opCtx);
     if (!status.isOK())
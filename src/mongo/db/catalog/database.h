@@ -30,6 +30,7 @@
 #pragma once
 
 #include <memory>
+#include <set>
 #include <string>
 
 #include "mongo/base/status.h"
@@ -164,9 +165,13 @@ public:
     /**
      * If we are in a replset, every replicated collection must have an _id index.  As we scan each
      * database, we also gather a list of drop-pending collection namespaces for the
-     * DropPendingCollectionReaper to clean up eventually.
+     * DropPendingCollectionReaper to clean up eventually. If 'idIndexNamespaceFilter' is non-null,
+     * the _id index check is limited to the namespaces it contains; drop-pending collection
+     * namespaces are always gathered.
      */
-    virtual void checkForIdIndexesAndDropPendingCollections(OperationContext* opCtx) const = 0;
+    virtual void checkForIdIndexesAndDropPendingCollections(
+        OperationContext* opCtx,
+        const std::set<NamespaceString>* idIndexNamespaceFilter) const = 0;
 };
 
 }  // namespace mongo
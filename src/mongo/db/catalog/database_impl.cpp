@@ -812,7 +812,8 @@ StatusWith<NamespaceString> DatabaseImpl::makeUniqueCollectionNamespace(
                       << " attempts due to namespace conflicts with existing collections.");
 }
 
-void DatabaseImpl::checkForIdIndexesAndDropPendingCollections(OperationContext* opCtx) const {
+void DatabaseImpl::checkForIdIndexesAndDropPendingCollections(
+    OperationContext* opCtx, const std::set<NamespaceString>* idIndexNamespaceFilter) const {
     if (name() == "local") {
         // Collections in the local database are not replicated, so we do not need an _id index on
         // any collection. For the same reason, it is not possible for the local database to contain
@@ -836,6 +837,9 @@ void DatabaseImpl::checkForIdIndexesAndDropPendingCollections(OperationContext*
         if (nss.isSystem())
             continue;
 
+        if (idIndexNamespaceFilter && !idIndexNamespaceFilter->count(nss))
+            continue;
+
         const CollectionPtr& coll = catalog->lookupCollectionByNamespace(opCtx, nss);
         if (!coll)
             continue;
@@ -110,7 +110,9 @@ public:
     StatusWith<NamespaceString> makeUniqueCollectionNamespace(
         OperationContext* opCtx, StringData collectionNameModel) const final;
 
-    void checkForIdIndexesAndDropPendingCollections(OperationContext* opCtx) const final;
+    void checkForIdIndexesAndDropPendingCollections(
+        OperationContext* opCtx,
+        const std::set<NamespaceString>* idIndexNamespaceFilter) const final;
 
 private:
     /**
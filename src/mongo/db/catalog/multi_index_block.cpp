@@ -922,7 +922,7 @@ BSONObj MultiIndexBlock::_constructStateObject(OperationContext* opCtx,
         if (_phase != IndexBuildPhaseEnum::kDrainWrites) {
             // Persist the data to disk so that we see all of the data that has been inserted into
             // the Sorter.
-            auto state = index.bulk->persistDataForShutdown();
+            auto state = index.bulk->persistDataForShutdown(opCtx);
 
             indexInfo.append("fileName", state.fileName);
             indexInfo.append("numKeys", index.bulk->getKeysInserted());
@@ -1111,7 +1111,7 @@ Status MultiIndexBlock::_scanReferenceIdxInsertAndCommit(OperationContext* opCtx
 
     auto dumpSorter = [&]() {
         std::unique_ptr<IndexAccessMethod::BulkBuilder::Sorter::Iterator> it(
-            _indexes[0].bulk->done());
+            _indexes[0].bulk->done(opCtx));
 
         WriteUnitOfWork wuow(opCtx);
         while (it->more()) {
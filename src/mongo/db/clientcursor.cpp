@@ -93,6 +93,7 @@ ClientCursor::ClientCursor(ClientCursorParams params,
       _writeConcernOptions(std::move(params.writeConcernOptions)),
       _readConcernArgs(std::move(params.readConcernArgs)),
       _originatingCommand(params.originatingCommandObj),
+      _originatingCommandComment(_originatingCommand["comment"]),
       _originatingPrivileges(std::move(params.originatingPrivileges)),
       _queryOptions(params.queryOptions),
       _exec(std::move(params.exec)),
@@ -286,7 +287,7 @@ public:
         while (!globalInShutdownDeprecated()) {
             {
                 const ServiceContext::UniqueOperationContext opCtx = cc().makeOperationContext();
-                auto now = opCtx->getServiceContext()->getPreciseClockSource()->now();
+                auto now = opCtx->getServiceContext()->getFastClockSource()->now();
                 cursorStatsTimedOut.increment(
                     CursorManager::get(opCtx.get())->timeoutCursors(opCtx.get(), now));
             }
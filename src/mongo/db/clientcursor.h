@@ -188,6 +188,14 @@ public:
         return _originatingCommand;
     }
 
+    /**
+     * Returns the 'comment' field of the originating command, or an eoo element if there was none.
+     * Cached at construction so that each getMore need not re-scan the originating command object.
+     */
+    BSONElement getOriginatingCommandComment() const {
+        return _originatingCommandComment;
+    }
+
     /**
      * Returns the privileges required to run a getMore against this cursor. This is the same as the
      * set of privileges which would have been required to create the cursor in the first place.
@@ -382,6 +390,9 @@ private:
     // Holds an owned copy of the command specification received from the client.
     const BSONObj _originatingCommand;
 
+    // The 'comment' field of '_originatingCommand', into which it points. Eoo if absent.
+    const BSONElement _originatingCommandComment;
+
     // The privileges required for the _originatingCommand.
     const PrivilegeVector _originatingPrivileges;
 
@@ -31,6 +31,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include "mongo/bson/json.h"
 #include "mongo/bson/util/bson_extract.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/commands.h"
@@ -45,6 +46,7 @@
 #include "mongo/util/net/socket_utils.h"
 #include "mongo/util/ntservice.h"
 #include "mongo/util/processinfo.h"
+#include "mongo/util/stacktrace.h"
 
 #include <string>
 #include <vector>
@@ -137,6 +139,56 @@ public:
 
 } hostInfoCmd;
 
+#if defined(MONGO_STACKTRACE_CAN_DUMP_ALL_THREADS)
+class GetThreadStacksCmd : public BasicCommand {
+public:
+    GetThreadStacksCmd() : BasicCommand("getThreadStacks") {}
+
+    bool adminOnly() const override {
+        return true;
+    }
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kAlways;
+    }
+
+    bool supportsWriteConcern(const BSONObj& cmd) const override {
+        return false;
+    }
+
+    std::string help() const override {
+        return "capture a stack trace of every thread in the server and return it";
+    }
+
+    void addRequiredPrivileges(const std::string& dbname,
+                               const BSONObj& cmdObj,
+                               std::vector<Privilege>* out) const override {
+        ActionSet actions;
+        actions.addAction(ActionType::serverStatus);
+        out->push_back(Privilege(ResourcePattern::forClusterResource(), actions));
+    }
+
+    bool run(OperationContext* opCtx,
+             const std::string& dbname,
+             const BSONObj& cmdObj,
+             BSONObjBuilder& result) override {
+        std::string jsonStacks;
+        StringStackTraceSink sink{jsonStacks};
+        printAllThreadStacks(sink);
+
+        try {
+            result.append("stacks", fromjson(jsonStacks));
+        } catch (const DBException&) {
+            // Return the raw text if the capture produced JSON we cannot round-trip, rather
+            // than failing the command and discarding the capture.
+            result.append("rawStacks", jsonStacks);
+        }
+        return true;
+    }
+
+} getThreadStacksCmd;
+#endif  // defined(MONGO_STACKTRACE_CAN_DUMP_ALL_THREADS)
+
 class CmdGetCmdLineOpts : public BasicCommand {
 public:
     CmdGetCmdLineOpts() : BasicCommand("getCmdLineOpts") {}
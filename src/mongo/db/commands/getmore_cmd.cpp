@@ -226,7 +226,7 @@ void setUpOperationContextStateForGetMore(OperationContext* opCtx,
 
     // If the originating command had a 'comment' field, we extract it and set it on opCtx. Note
     // that if the 'getMore' command itself has a 'comment' field, we give precedence to it.
-    auto comment = cursor.getOriginatingCommandObj()["comment"];
+    auto comment = cursor.getOriginatingCommandComment();
     if (!opCtx->getComment() && comment) {
         opCtx->setComment(comment.wrap());
     }
@@ -524,7 +524,9 @@ public:
             exec->reattachToOperationContext(opCtx);
             exec->restoreState(readLock ? &readLock->getCollection() : nullptr);
 
-            auto planSummary = exec->getPlanExplainer().getPlanSummary();
+            // The cursor caches the plan summary string at construction, so there is no need to
+            // regenerate it from the explainer for every batch.
+            auto planSummary = cursorPin->getPlanSummary();
             {
                 stdx::lock_guard<Client> lk(*opCtx->getClient());
                 curOp->setPlanSummary_inlock(planSummary);
@@ -38,6 +38,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/logv2/log.h"
+#include "mongo/logv2/log_domain_global.h"
 #include "mongo/util/net/http_client.h"
 #include "mongo/util/net/socket_utils.h"
 #include "mongo/util/version.h"
@@ -280,6 +281,16 @@ public:
     }
 } memBase;
 
+class DroppedAsyncLogRecords : public ServerStatusMetric {
+public:
+    DroppedAsyncLogRecords() : ServerStatusMetric("logging.droppedAsyncLogRecords") {}
+    void appendAtLeaf(BSONObjBuilder& b) const override {
+        b.appendNumber(
+            _leafName,
+            static_cast<long long>(logv2::LogDomainGlobal::droppedAsyncLogRecords()));
+    }
+} droppedAsyncLogRecords;
+
 class HttpClientServerStatus : public ServerStatusSection {
 public:
     HttpClientServerStatus() : ServerStatusSection("http_client") {}
@@ -87,7 +87,18 @@ void FlowControlTicketholder::refreshTo(int numTickets) {
                 "tickets"_attr = _tickets,
                 "numTickets"_attr = numTickets);
     _tickets = numTickets;
-    _cv.notify_all();
+
+    // Wake only as many waiters as this refresh can satisfy. Waking every waiter for a handful of
+    // tickets stampedes the mutex and most of the woken threads go right back to sleep. A waiter
+    // that is woken but interrupted before consuming its ticket is covered by the periodic wait
+    // timeout in getTicket().
+    if (numTickets >= _waiterCount.load()) {
+        _cv.notify_all();
+    } else {
+        for (int i = 0; i < numTickets; ++i) {
+            _cv.notify_one();
+        }
+    }
 }
 
 void FlowControlTicketholder::getTicket(OperationContext* opCtx,
@@ -111,11 +122,13 @@ void FlowControlTicketholder::getTicket(OperationContext* opCtx,
     };
 
     stats->waiting = true;
+    _waiterCount.fetchAndAdd(1);
     ON_BLOCK_EXIT([&] {
         // When this block exits, update the time one last time and note that getTicket() is no
         // longer waiting.
         updateTotalTime();
         stats->waiting = false;
+        _waiterCount.fetchAndSubtract(1);
     });
 
     // getTicket() should block until there are tickets or the Ticketholder is in shutdown
@@ -87,12 +87,23 @@ public:
         return _totalTimeAcquiringMicros.load();
     }
 
+    /**
+     * The number of operations currently blocked in `getTicket`.
+     */
+    int queueSize() const {
+        return _waiterCount.load();
+    }
+
     void setInShutdown();
 
 private:
     // Use an int64_t as this is serialized to bson which does not support unsigned 64-bit numbers.
     AtomicWord<std::int64_t> _totalTimeAcquiringMicros;
 
+    // Only written while holding `_mutex`, but read without it for reporting and for sizing
+    // wakeups in `refreshTo`.
+    AtomicWord<int> _waiterCount{0};
+
     Mutex _mutex = MONGO_MAKE_LATCH("FlowControlTicketHolder::_mutex");
     stdx::condition_variable _cv;
     int _tickets;
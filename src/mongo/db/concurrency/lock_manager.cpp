@@ -46,6 +46,7 @@
 #include "mongo/db/concurrency/locker.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 #include "mongo/util/timer.h"
 
@@ -410,8 +411,20 @@ void LockHead::migratePartitionedLockHeads() {
 // LockManager
 //
 
-// Have more buckets than CPUs to reduce contention on lock and caches
-const unsigned LockManager::_numLockBuckets(128);
+namespace {
+
+// Have more buckets than CPUs to reduce contention on lock and caches. Rounded up to a power
+// of two so the modulo in _getBucket() compiles down to a mask.
+unsigned numHashedLockBuckets() {
+    unsigned buckets = 128;
+    const unsigned target = 4 * static_cast<unsigned>(ProcessInfo::getNumAvailableCores());
+    while (buckets < target) {
+        buckets <<= 1;
+    }
+    return buckets;
+}
+
+}  // namespace
 
 // Balance scalability of intent locks against potential added cost of conflicting locks.
 // The exact value doesn't appear very important, but should be power of two
@@ -443,15 +456,15 @@ std::map<LockerId, BSONObj> LockManager::getLockToClientMap(ServiceContext* serv
     return lockToClientMap;
 }
 
-LockManager::LockManager() {
-    _lockBuckets = new LockBucket[_numLockBuckets];
+LockManager::LockManager() : _numHashedLockBuckets(numHashedLockBuckets()) {
+    _lockBuckets = new LockBucket[_numLockBuckets()];
     _partitions = new Partition[_numPartitions];
 }
 
 LockManager::~LockManager() {
     cleanupUnusedLocks();
 
-    for (unsigned i = 0; i < _numLockBuckets; i++) {
+    for (unsigned i = 0; i < _numLockBuckets(); i++) {
         // TODO: dump more information about the non-empty bucket to see what locks were leaked
         invariant(_lockBuckets[i].data.empty());
     }
@@ -487,7 +500,7 @@ LockResult LockManager::lock(ResourceId resId, LockRequest* request, LockMode mo
 
     // Use regular LockHead, maybe start partitioning
     LockBucket* bucket = _getBucket(resId);
-    stdx::lock_guard<SimpleMutex> scopedLock(bucket->mutex);
+    auto scopedLock = bucket->lockWithStats();
     invariant(request->status == LockRequest::STATUS_NEW);
 
     LockHead* lock = bucket->findOrInsert(resId);
@@ -535,7 +548,7 @@ LockResult LockManager::convert(ResourceId resId, LockRequest* request, LockMode
               LockConflictsTable[newMode]);
 
     LockBucket* bucket = _getBucket(resId);
-    stdx::lock_guard<SimpleMutex> scopedLock(bucket->mutex);
+    auto scopedLock = bucket->lockWithStats();
     invariant(request->status == LockRequest::STATUS_GRANTED);
 
     LockBucket::Map::iterator it = bucket->data.find(resId);
@@ -614,7 +627,7 @@ bool LockManager::unlock(LockRequest* request) {
 
     LockHead* lock = request->lock;
     LockBucket* bucket = _getBucket(lock->resourceId);
-    stdx::lock_guard<SimpleMutex> scopedLock(bucket->mutex);
+    auto scopedLock = bucket->lockWithStats();
 
     if (request->status == LockRequest::STATUS_GRANTED) {
         if (request->recursiveCount > 0)
@@ -678,7 +691,7 @@ void LockManager::downgrade(LockRequest* request, LockMode newMode) {
     LockHead* lock = request->lock;
 
     LockBucket* bucket = _getBucket(lock->resourceId);
-    stdx::lock_guard<SimpleMutex> scopedLock(bucket->mutex);
+    auto scopedLock = bucket->lockWithStats();
     invariant(request->status == LockRequest::STATUS_GRANTED);
 
     lock->incGrantedModeCount(newMode);
@@ -689,7 +702,7 @@ void LockManager::downgrade(LockRequest* request, LockMode newMode) {
 }
 
 void LockManager::cleanupUnusedLocks() {
-    for (unsigned i = 0; i < _numLockBuckets; i++) {
+    for (unsigned i = 0; i < _numLockBuckets(); i++) {
         LockBucket* bucket = &_lockBuckets[i];
         stdx::lock_guard<SimpleMutex> scopedLock(bucket->mutex);
         _cleanupUnusedLocksInBucket(bucket);
@@ -835,8 +848,22 @@ void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
     invariant((lock->conflictModes == 0) ^ (lock->conflictList._front != nullptr));
 }
 
+bool LockManager::hasConflictingRequests(const LockRequest* request) const {
+    // A granted request holds its LockHead alive, so the pointer is safe to follow; the
+    // fields themselves are read racily, which is fine for an advisory answer. Requests
+    // granted through a partition have no LockHead and by construction no conflicts.
+    const LockHead* lock = request->lock;
+    return lock && (lock->conflictList._front != nullptr || lock->conversionsCount > 0);
+}
+
 LockManager::LockBucket* LockManager::_getBucket(ResourceId resId) const {
-    return &_lockBuckets[resId % _numLockBuckets];
+    // The process-wide singleton resources are locked by nearly every operation, so each gets
+    // a dedicated bucket rather than sharing a hashed one with unrelated resources.
+    const auto type = resId.getType();
+    if (type == RESOURCE_PBWM || type == RESOURCE_RSTL || type == RESOURCE_GLOBAL) {
+        return &_lockBuckets[type];
+    }
+    return &_lockBuckets[kNumDedicatedLockBuckets + resId % _numHashedLockBuckets];
 }
 
 LockManager::Partition* LockManager::_getPartition(LockRequest* request) const {
@@ -855,15 +882,35 @@ void LockManager::dump() const {
 
 void LockManager::getLockInfoBSON(const std::map<LockerId, BSONObj>& lockToClientMap,
                                   BSONObjBuilder* result) {
-    auto lockInfoArr = BSONArrayBuilder(result->subarrayStart("lockInfo"));
-    _buildLocksArray(lockToClientMap, false, this, &lockInfoArr);
+    {
+        auto lockInfoArr = BSONArrayBuilder(result->subarrayStart("lockInfo"));
+        _buildLocksArray(lockToClientMap, false, this, &lockInfoArr);
+    }
+
+    // Report how often lock operations found their bucket's mutex already held, to show when
+    // unrelated resources hashing to the same bucket are colliding.
+    long long acquisitions = 0;
+    long long contended = 0;
+    long long maxBucketContended = 0;
+    for (unsigned i = 0; i < _numLockBuckets(); i++) {
+        const LockBucket& bucket = _lockBuckets[i];
+        acquisitions += bucket.acquisitions.load();
+        const auto bucketContended = bucket.contendedAcquisitions.load();
+        contended += bucketContended;
+        maxBucketContended = std::max(maxBucketContended, bucketContended);
+    }
+    BSONObjBuilder bucketStats(result->subobjStart("bucketContention"));
+    bucketStats.append("numBuckets", static_cast<int>(_numLockBuckets()));
+    bucketStats.append("acquisitions", acquisitions);
+    bucketStats.append("contended", contended);
+    bucketStats.append("maxContendedSingleBucket", maxBucketContended);
 }
 
 void LockManager::_buildLocksArray(const std::map<LockerId, BSONObj>& lockToClientMap,
                                    bool forLogging,
                                    LockManager* mutableThis,
                                    BSONArrayBuilder* locks) const {
-    for (size_t i = 0; i < _numLockBuckets; ++i) {
+    for (size_t i = 0; i < _numLockBuckets(); ++i) {
         LockBucket& bucket = _lockBuckets[i];
         stdx::lock_guard<SimpleMutex> scopedLock(bucket.mutex);
         // LockInfo cleans the unused locks as it goes, but dump doesn't.
@@ -122,6 +122,14 @@ public:
      */
     void downgrade(LockRequest* request, LockMode newMode);
 
+    /**
+     * Returns true if any requests are queued behind, or converting on, the lock which the
+     * granted 'request' references. The lock's state is read without the bucket mutex, so the
+     * answer is advisory only; yield policies use it to decide whether releasing locks would
+     * benefit anyone.
+     */
+    bool hasConflictingRequests(const LockRequest* request) const;
+
     /**
      * Iterates through all buckets and deletes all locks, which have no requests on them. This
      * call is kind of expensive and should only be used for reducing the memory footprint of
@@ -162,6 +170,24 @@ private:
         typedef stdx::unordered_map<ResourceId, LockHead*> Map;
         Map data;
         LockHead* findOrInsert(ResourceId resId);
+
+        /**
+         * Takes the bucket mutex, counting the acquisition and whether another thread already
+         * held the mutex. The counters quantify collisions between unrelated resources that
+         * hash to the same bucket and are reported through getLockInfoBSON().
+         */
+        stdx::unique_lock<SimpleMutex> lockWithStats() {
+            stdx::unique_lock<SimpleMutex> lk(mutex, stdx::try_to_lock);
+            if (!lk.owns_lock()) {
+                contendedAcquisitions.fetchAndAdd(1);
+                lk.lock();
+            }
+            acquisitions.fetchAndAdd(1);
+            return lk;
+        }
+
+        AtomicWord<long long> acquisitions{0};
+        AtomicWord<long long> contendedAcquisitions{0};
     };
 
     // Each locker maps to a partition that is used for resources acquired in intent modes
@@ -216,7 +242,20 @@ private:
      */
     void _cleanupUnusedLocksInBucket(LockBucket* bucket);
 
-    static const unsigned _numLockBuckets;
+    /**
+     * Returns the total number of lock buckets, dedicated and hashed.
+     */
+    unsigned _numLockBuckets() const {
+        return kNumDedicatedLockBuckets + _numHashedLockBuckets;
+    }
+
+    // The first kNumDedicatedLockBuckets buckets are reserved for the process-wide singleton
+    // resources (PBWM, RSTL, Global), indexed by their ResourceType, so that these extremely
+    // hot resources never share a bucket mutex with each other or with hashed resources. All
+    // other resources spread over the remaining _numHashedLockBuckets buckets, whose count
+    // scales with the number of cores; see _getBucket().
+    static constexpr unsigned kNumDedicatedLockBuckets = ResourceTypesCount;
+    const unsigned _numHashedLockBuckets;
     LockBucket* _lockBuckets;
 
     static const unsigned _numPartitions;
@@ -45,11 +45,14 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/stdx/new.h"
 #include "mongo/util/background.h"
+#include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/concurrency/admission_context_gen.h"
 #include "mongo/util/concurrency/ticketholder.h"
 #include "mongo/util/debug_util.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -282,6 +285,16 @@ void Locker::setGlobalThrottling(class TicketHolder* reading, class TicketHolder
     ticketHolders[MODE_IX] = writing;
 }
 
+/* static */
+bool Locker::isGlobalThrottlingExhausted() {
+    for (TicketHolder* holder : {ticketHolders[MODE_S], ticketHolders[MODE_IX]}) {
+        if (holder && holder->available() <= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 LockerImpl::LockerImpl()
     : _id(idCounter.addAndFetch(1)), _wuowNestingLevel(0), _threadId(stdx::this_thread::get_id()) {}
 
@@ -360,11 +373,42 @@ bool LockerImpl::_acquireTicket(OperationContext* opCtx, LockMode mode, Date_t d
             invariant(!opCtx->recoveryUnit()->isTimestamped());
 
         OperationContext* interruptible = _uninterruptibleLocksRequested ? nullptr : opCtx;
-        if (deadline == Date_t::max()) {
+        const auto priority = opCtx ? AdmissionContext::get(opCtx).getPriority()
+                                    : AdmissionContext::Priority::kNormal;
+        auto& admissionStats = admissionStatsForPriority(priority);
+        Timer queueTimer;
+        if (priority == AdmissionContext::Priority::kLow) {
+            // Low priority operations never park in the ticket holder's queue, where they would
+            // be admitted in arrival order ahead of normal priority operations that arrive later.
+            // Instead they poll for a ticket that nothing else is waiting for, and are shed once
+            // they have queued for longer than lowPriorityAdmissionMaxQueueTimeMS.
+            static constexpr Milliseconds kLowPriorityRetryInterval{10};
+            while (!holder->tryAcquire()) {
+                const auto maxQueueTimeMS = gLowPriorityAdmissionMaxQueueTimeMS.load();
+                if (maxQueueTimeMS > 0 && queueTimer.millis() >= maxQueueTimeMS) {
+                    admissionStats.shed.addAndFetch(1);
+                    uasserted(ErrorCodes::TemporarilyUnavailable,
+                              str::stream()
+                                  << "Low priority operation shed after queueing for a ticket "
+                                     "with mode '"
+                                  << mode << "' for longer than " << maxQueueTimeMS << " ms");
+                }
+                if (Date_t::now() >= deadline) {
+                    return false;
+                }
+                if (interruptible) {
+                    interruptible->sleepFor(kLowPriorityRetryInterval);
+                } else {
+                    sleepmillis(kLowPriorityRetryInterval.count());
+                }
+            }
+        } else if (deadline == Date_t::max()) {
             holder->waitForTicket(interruptible);
         } else if (!holder->waitForTicketUntil(interruptible, deadline)) {
             return false;
         }
+        admissionStats.admissions.addAndFetch(1);
+        admissionStats.queueMicros.addAndFetch(queueTimer.micros());
         restoreStateOnErrorGuard.dismiss();
     }
     _clientState.store(reader ? kActiveReader : kActiveWriter);
@@ -724,6 +768,21 @@ boost::optional<Locker::LockerInfo> LockerImpl::getLockerInfo(
     return std::move(lockerInfo);
 }
 
+bool LockerImpl::hasWaitersOnAnyHeldLock() const {
+    // Only called by the owning thread, so _requests cannot be mutated concurrently; no need
+    // for _lock. Requests granted through a partition have no LockHead and by construction no
+    // conflicts, so they are skipped here.
+    for (auto it = _requests.begin(); !it.finished(); it.next()) {
+        if (it->status != LockRequest::STATUS_GRANTED) {
+            continue;
+        }
+        if (getGlobalLockManager()->hasConflictingRequests(it.objAddr())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool LockerImpl::saveLockStateAndUnlock(Locker::LockSnapshot* stateOut) {
     // We shouldn't be saving and restoring lock state from inside a WriteUnitOfWork.
     invariant(!inAWriteUnitOfWork());
@@ -399,6 +399,8 @@ public:
     virtual bool hasLockPending() const {
         return getWaitingResource().isValid();
     }
+
+    bool hasWaitersOnAnyHeldLock() const override;
 };
 
 /**
@@ -464,6 +464,20 @@ public:
      */
     virtual bool hasLockPending() const = 0;
 
+    /**
+     * Returns true if another operation is queued behind, or converting on, any lock this locker
+     * currently holds. The underlying lock state is read without synchronization, so the answer
+     * is advisory only; yield policies use it to decide whether releasing locks would benefit
+     * anyone. Must be called by the thread that owns this locker.
+     */
+    virtual bool hasWaitersOnAnyHeldLock() const = 0;
+
+    /**
+     * Returns true if the throttling ticket holders installed by setGlobalThrottling() are
+     * exhausted, meaning other operations are likely queueing for a ticket.
+     */
+    static bool isGlobalThrottlingExhausted();
+
     /**
      * If set to false, this opts out of conflicting with replication's use of the
      * ParallelBatchWriterMode lock. Code that opts-out must be ok with seeing an inconsistent view
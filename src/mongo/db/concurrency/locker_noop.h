@@ -244,6 +244,10 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    virtual bool hasWaitersOnAnyHeldLock() const {
+        return false;
+    }
+
     bool isGlobalLockedRecursively() override {
         return false;
     }
@@ -886,6 +886,10 @@ string OpDebug::report(OperationContext* opCtx, const SingleThreadedLockStats* l
         s << " planCacheKey:" << zeroPaddedHex(*planCacheKey);
     }
 
+    if (planningTime > Microseconds::zero()) {
+        s << " planningTimeMicros:" << durationCount<Microseconds>(planningTime);
+    }
+
     if (!errInfo.isOK()) {
         s << " ok:" << 0;
         if (!errInfo.reason().empty()) {
@@ -1057,6 +1061,10 @@ void OpDebug::report(OperationContext* opCtx,
         pAttrs->addDeepCopy("planCacheKey", zeroPaddedHex(*planCacheKey));
     }
 
+    if (planningTime > Microseconds::zero()) {
+        pAttrs->add("planningTimeMicros", durationCount<Microseconds>(planningTime));
+    }
+
     if (!errInfo.isOK()) {
         pAttrs->add("ok", 0);
         if (!errInfo.reason().empty()) {
@@ -1194,6 +1202,10 @@ void OpDebug::append(OperationContext* opCtx,
         b.append("planCacheKey", zeroPaddedHex(*planCacheKey));
     }
 
+    if (planningTime > Microseconds::zero()) {
+        b.appendNumber("planningTimeMicros", durationCount<Microseconds>(planningTime));
+    }
+
     {
         BSONObjBuilder locks(b.subobjStart("locks"));
         lockStats.report(&locks);
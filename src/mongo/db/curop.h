@@ -246,6 +246,10 @@ public:
     // Details of any error (whether from an exception or a command returning failure).
     Status errInfo = Status::OK();
 
+    // Amount of time spent selecting a winning plan and building the executable tree for it,
+    // before execution started. Zero for operations that do not go through query planning.
+    Microseconds planningTime{0};
+
     // response info
     Microseconds executionTime{0};
     long long nreturned{-1};
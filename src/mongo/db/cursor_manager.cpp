@@ -89,7 +89,7 @@ const auto serviceCursorManager =
 
 ServiceContext::ConstructorActionRegisterer cursorManagerRegisterer{
     "CursorManagerRegisterer", [](ServiceContext* svcCtx) {
-        auto cursorManager = std::make_unique<CursorManager>(svcCtx->getPreciseClockSource());
+        auto cursorManager = std::make_unique<CursorManager>(svcCtx->getFastClockSource());
         CursorManager::set(svcCtx, std::move(cursorManager));
     }};
 
@@ -145,10 +145,10 @@ std::pair<Status, int> CursorManager::killCursorsWithMatchingSessions(
                           bySessionCursorKiller.getCursorsKilled());
 }
 
-CursorManager::CursorManager(ClockSource* preciseClockSource)
+CursorManager::CursorManager(ClockSource* clockSource)
     : _random(std::make_unique<PseudoRandom>(SecureRandom().nextInt64())),
       _cursorMap(std::make_unique<Partitioned<stdx::unordered_map<CursorId, ClientCursor*>>>()),
-      _preciseClockSource(preciseClockSource) {}
+      _clockSource(clockSource) {}
 
 CursorManager::~CursorManager() {
     auto allPartitions = _cursorMap->lockAllPartitions();
@@ -247,7 +247,7 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(OperationContext* opCtx,
 void CursorManager::unpin(OperationContext* opCtx,
                           std::unique_ptr<ClientCursor, ClientCursor::Deleter> cursor) {
     // Avoid computing the current time within the critical section.
-    auto now = _preciseClockSource->now();
+    auto now = _clockSource->now();
 
     auto partition = _cursorMap->lockOnePartition(cursor->cursorid());
     invariant(cursor->_operationUsingCursor);
@@ -385,7 +385,7 @@ CursorId CursorManager::allocateCursorId_inlock() {
 ClientCursorPin CursorManager::registerCursor(OperationContext* opCtx,
                                               ClientCursorParams&& cursorParams) {
     // Avoid computing the current time within the critical section.
-    auto now = _preciseClockSource->now();
+    auto now = _clockSource->now();
 
     // Make sure the PlanExecutor isn't registered, since we will register the ClientCursor wrapping
     // it.
@@ -425,7 +425,7 @@ ClientCursorPin CursorManager::registerCursor(OperationContext* opCtx,
 
 void CursorManager::deregisterCursor(ClientCursor* cursor) {
     removeCursorFromMap(_cursorMap, cursor);
-    incrementCursorLifespanMetric(cursor->_createdDate, _preciseClockSource->now());
+    incrementCursorLifespanMetric(cursor->_createdDate, _clockSource->now());
 }
 
 void CursorManager::deregisterAndDestroyCursor(
@@ -437,7 +437,7 @@ void CursorManager::deregisterAndDestroyCursor(
         removeCursorFromMap(lockWithRestrictedScope, cursor.get());
     }
 
-    incrementCursorLifespanMetric(cursor->_createdDate, _preciseClockSource->now());
+    incrementCursorLifespanMetric(cursor->_createdDate, _clockSource->now());
     // Dispose of the cursor without holding any cursor manager mutexes. Disposal of a cursor can
     // require taking lock manager locks, which we want to avoid while holding a mutex. If we did
     // so, any caller of a CursorManager method which already held a lock manager lock could induce
@@ -189,8 +189,8 @@ public:
     /**
      * Set the CursorManager's ClockSource*.
      */
-    void setPreciseClockSource(ClockSource* preciseClockSource) {
-        _preciseClockSource = preciseClockSource;
+    void setClockSource(ClockSource* clockSource) {
+        _clockSource = clockSource;
     }
 
 private:
@@ -250,6 +250,8 @@ private:
     mutable Mutex _opKeyMutex = MONGO_MAKE_LATCH("CursorManager::_opKeyMutex");
     stdx::unordered_map<OperationKey, CursorId, UUID::Hash> _opKeyMap;
 
-    ClockSource* _preciseClockSource;
+    // Clock used to time-stamp cursor use for idle timeouts and lifespan metrics. Those only
+    // need coarse granularity, so the service's fast clock source is wired in here.
+    ClockSource* _clockSource;
 };
 }  // namespace mongo
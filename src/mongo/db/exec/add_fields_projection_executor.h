@@ -87,6 +87,9 @@ public:
      */
     void optimize() final {
         _root->optimize();
+        if (_root->deduplicateCommonSubexpressions(_expCtx.get())) {
+            _hasCommonSubexpressions = true;
+        }
     }
 
     DepsTracker::State addDependencies(DepsTracker* deps) const final {
@@ -298,6 +298,73 @@ TEST(AddFieldsProjectionExecutorOptimize, ShouldOptimizeNestedExpressions) {
                        addition.serializeTransformation(ExplainOptions::Verbosity::kExecAllPlans));
 }
 
+// Verify that a deterministic subexpression which appears in several computed fields is rewritten
+// to evaluate through a shared per-document cache, without changing the serialized form.
+TEST(AddFieldsProjectionExecutorOptimize, ShouldDeduplicateRepeatedSubexpressions) {
+    boost::intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    AddFieldsProjectionExecutor addition(expCtx);
+    addition.parse(fromjson("{a: {$toUpper: '$x'}, b: {$toUpper: '$x'}, c: {$toLower: '$x'}}"));
+    addition.optimize();
+
+    auto exprA = dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        addition.getRoot().getExpressionForPath("a").get());
+    auto exprB = dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        addition.getRoot().getExpressionForPath("b").get());
+    ASSERT(exprA);
+    ASSERT(exprB);
+    ASSERT_EQ(exprA->getCacheSlot(), exprB->getCacheSlot());
+
+    // A subexpression which only occurs once is not worth caching.
+    ASSERT_FALSE(dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        addition.getRoot().getExpressionForPath("c").get()));
+
+    // The rewrite must be invisible in the serialized form.
+    auto expectedSerialization = Document(
+        fromjson("{a: {$toUpper: ['$x']}, b: {$toUpper: ['$x']}, c: {$toLower: ['$x']}}"));
+    ASSERT_DOCUMENT_EQ(expectedSerialization, addition.serializeTransformation(boost::none));
+
+    // The cache must be invalidated between input documents.
+    auto result = addition.applyTransformation(Document{{"x", "abc"_sd}});
+    ASSERT_DOCUMENT_EQ(result,
+                       Document(fromjson("{x: 'abc', a: 'ABC', b: 'ABC', c: 'abc'}")));
+    result = addition.applyTransformation(Document{{"x", "def"_sd}});
+    ASSERT_DOCUMENT_EQ(result,
+                       Document(fromjson("{x: 'def', a: 'DEF', b: 'DEF', c: 'def'}")));
+}
+
+// Verify that subexpressions whose results may differ between evaluations within one document are
+// left alone by the common-subexpression rewrite.
+TEST(AddFieldsProjectionExecutorOptimize, ShouldNotDeduplicateNonDeterministicSubexpressions) {
+    boost::intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    AddFieldsProjectionExecutor addition(expCtx);
+    addition.parse(fromjson("{a: {$rand: {}}, b: {$rand: {}}}"));
+    addition.optimize();
+
+    ASSERT_FALSE(dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        addition.getRoot().getExpressionForPath("a").get()));
+    ASSERT_FALSE(dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        addition.getRoot().getExpressionForPath("b").get()));
+}
+
+// Verify that subexpressions referring to user-defined variables, whose values can change between
+// evaluations within one document, are left alone by the common-subexpression rewrite.
+TEST(AddFieldsProjectionExecutorOptimize, ShouldNotDeduplicateSubexpressionsUsingVariables) {
+    boost::intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    AddFieldsProjectionExecutor addition(expCtx);
+    addition.parse(
+        fromjson("{a: {$map: {input: '$arr', as: 'el', in: {$add: ['$$el', 1]}}},"
+                 " b: {$map: {input: '$arr', as: 'el', in: {$add: ['$$el', 1]}}}}"));
+    addition.optimize();
+
+    ASSERT_FALSE(dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        addition.getRoot().getExpressionForPath("a").get()));
+    ASSERT_FALSE(dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        addition.getRoot().getExpressionForPath("b").get()));
+
+    auto result = addition.applyTransformation(Document(fromjson("{arr: [1, 2]}")));
+    ASSERT_DOCUMENT_EQ(result, Document(fromjson("{arr: [1, 2], a: [2, 3], b: [2, 3]}")));
+}
+
 //
 // Top-level only.
 //
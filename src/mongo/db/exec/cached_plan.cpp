@@ -64,12 +64,14 @@ CachedPlanStage::CachedPlanStage(ExpressionContext* expCtx,
                                  CanonicalQuery* cq,
                                  const QueryPlannerParams& params,
                                  size_t decisionWorks,
+                                 size_t trialsWithoutReplan,
                                  std::unique_ptr<PlanStage> root)
     : RequiresAllIndicesStage(kStageType, expCtx, collection),
       _ws(ws),
       _canonicalQuery(cq),
       _plannerParams(params),
-      _decisionWorks(decisionWorks) {
+      _decisionWorks(decisionWorks),
+      _trialsWithoutReplan(trialsWithoutReplan) {
     _children.emplace_back(std::move(root));
 }
 
@@ -92,6 +94,16 @@ Status CachedPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
     size_t maxWorksBeforeReplan =
         static_cast<size_t>(internalQueryCacheEvictionRatio * _decisionWorks);
 
+    // If the cache entry has completed enough consecutive trial periods without a replan, skip
+    // the trial entirely and let doWork() monitor the works-per-result ratio instead. Drift
+    // detected there deactivates the cache entry so the next execution of this shape replans.
+    const auto trialSkipThreshold = internalQueryCacheTrialSkipThreshold.load();
+    if (trialSkipThreshold > 0 && _trialsWithoutReplan >= static_cast<size_t>(trialSkipThreshold)) {
+        _monitorDrift = true;
+        _maxWorksBeforeReplan = maxWorksBeforeReplan;
+        return Status::OK();
+    }
+
     // The trial period ends without replanning if the cached plan produces this many results.
     size_t numResults = trial_period::getTrialPeriodNumToReturn(*_canonicalQuery);
 
@@ -134,10 +146,12 @@ Status CachedPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
 
             if (_results.size() >= numResults) {
                 // Once a plan returns enough results, stop working. There is no need to replan.
+                recordTrialSuccess();
                 return Status::OK();
             }
         } else if (PlanStage::IS_EOF == state) {
             // Cached plan hit EOF quickly enough. No need to replan.
+            recordTrialSuccess();
             return Status::OK();
         } else if (PlanStage::NEED_YIELD == state) {
             invariant(id == WorkingSet::INVALID_ID);
@@ -179,6 +193,15 @@ Status CachedPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
             << " works");
 }
 
+void CachedPlanStage::recordTrialSuccess() {
+    if (internalQueryCacheTrialSkipThreshold.load() <= 0) {
+        // Trial skipping is disabled, so there is no need to track replan-free history.
+        return;
+    }
+    PlanCache* cache = CollectionQueryInfo::get(collection()).getPlanCache();
+    cache->reportTrialSuccess(*_canonicalQuery);
+}
+
 Status CachedPlanStage::tryYield(PlanYieldPolicy* yieldPolicy) {
     // These are the conditions which can cause us to yield:
     //   1) The yield policy's timer elapsed, or
@@ -289,7 +312,32 @@ PlanStage::StageState CachedPlanStage::doWork(WorkingSetID* out) {
     }
 
     // Nothing left in trial period buffer.
-    return child()->work(out);
+    if (!_monitorDrift) {
+        return child()->work(out);
+    }
+
+    const StageState state = child()->work(out);
+    if (PlanStage::ADVANCED == state) {
+        _worksSinceLastAdvance = 0;
+    } else if (PlanStage::NEED_TIME == state && !_driftReported &&
+               ++_worksSinceLastAdvance > _maxWorksBeforeReplan) {
+        // The trial period was skipped because of this entry's replan-free history, but the plan
+        // has now burned through more works without producing a result than an entire trial
+        // period would have tolerated. Results may already have been returned to the client, so
+        // this execution cannot replan; instead deactivate the cache entry so that the next
+        // execution of this shape replans from scratch.
+        auto explainer = plan_explainer_factory::make(child().get());
+        LOGV2_DEBUG(5837140,
+                    1,
+                    "Cached plan drifted after skipping trial period; deactivating cache entry",
+                    "maxWorksBeforeReplan"_attr = _maxWorksBeforeReplan,
+                    "query"_attr = redact(_canonicalQuery->toStringShort()),
+                    "planSummary"_attr = explainer->getPlanSummary());
+        PlanCache* cache = CollectionQueryInfo::get(collection()).getPlanCache();
+        cache->deactivate(*_canonicalQuery);
+        _driftReported = true;
+    }
+    return state;
 }
 
 std::unique_ptr<PlanStageStats> CachedPlanStage::getStats() {
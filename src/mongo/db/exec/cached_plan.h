@@ -62,6 +62,7 @@ public:
                     CanonicalQuery* cq,
                     const QueryPlannerParams& params,
                     size_t decisionWorks,
+                    size_t trialsWithoutReplan,
                     std::unique_ptr<PlanStage> root);
 
     bool isEOF() final;
@@ -109,6 +110,12 @@ private:
      */
     Status tryYield(PlanYieldPolicy* yieldPolicy);
 
+    /**
+     * Records in the plan cache that the trial period completed without triggering a replan.
+     * A no-op unless trial skipping is enabled via 'internalQueryCacheTrialSkipThreshold'.
+     */
+    void recordTrialSuccess();
+
     // Not owned.
     WorkingSet* _ws;
 
@@ -121,6 +128,25 @@ private:
     // cached.
     size_t _decisionWorks;
 
+    // The number of consecutive trial periods the underlying cache entry has completed without
+    // triggering a replan.
+    size_t _trialsWithoutReplan;
+
+    // Set by pickBestPlan() when the trial period is skipped because of the entry's replan-free
+    // history. In that mode doWork() watches the works-per-result ratio and deactivates the
+    // cache entry if the plan drifts, so that the next execution of this shape replans.
+    bool _monitorDrift = false;
+
+    // The works-per-result bound used by drift monitoring; mirrors the bound that would have
+    // ended the trial period with a replan.
+    size_t _maxWorksBeforeReplan = 0;
+
+    // The number of work cycles since the last result while monitoring for drift.
+    size_t _worksSinceLastAdvance = 0;
+
+    // True once drift has been reported, so the cache entry is deactivated at most once.
+    bool _driftReported = false;
+
     // If we fall back to re-planning the query, and there is just one resulting query solution,
     // that solution is owned here.
     std::unique_ptr<QuerySolution> _replannedQs;
@@ -41,6 +41,7 @@
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/storage/oplog_hack.h"
 #include "mongo/logv2/log.h"
@@ -64,7 +65,8 @@ CollectionScan::CollectionScan(ExpressionContext* expCtx,
     : RequiresCollectionStage(kStageType, expCtx, collection),
       _workingSet(workingSet),
       _filter((filter && !filter->isTriviallyTrue()) ? filter : nullptr),
-      _params(params) {
+      _params(params),
+      _prefetchWindow(internalQueryCollectionScanPrefetchWindow.load()) {
     // Explain reports the direction of the collection scan.
     _specificStats.direction = params.direction;
     _specificStats.minTs = params.minTs;
@@ -132,6 +134,10 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
 
             _cursor = collection()->getCursor(opCtx(), forward);
 
+            if (_params.tailable) {
+                _cursorResumesAfterEof = _cursor->enableResumeAfterEof();
+            }
+
             if (!_lastSeenId.isNull()) {
                 invariant(_params.tailable);
                 // Seek to where we were last time. If it no longer exists, mark us as dead since we
@@ -197,9 +203,13 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
 
     if (!record) {
         // We hit EOF. If we are tailable and have already seen data, leave us in a state to pick up
-        // where we left off on the next call to work(). Otherwise, the EOF is permanent.
+        // where we left off on the next call to work(). Otherwise, the EOF is permanent. When the
+        // storage cursor can resume past EOF on restore we keep it positioned rather than paying
+        // for a rebuild and a re-seek to '_lastSeenId' on every wakeup.
         if (_params.tailable && !_lastSeenId.isNull()) {
-            _cursor.reset();
+            if (!_cursorResumesAfterEof) {
+                _cursor.reset();
+            }
         } else {
             _commonStats.isEOF = true;
         }
@@ -207,6 +217,12 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     }
 
     _lastSeenId = record->id;
+    if (_prefetchWindow > 0 && ++_recordsSincePrefetch >= _prefetchWindow) {
+        // Ask the storage engine to pull the next window of records into its cache in the
+        // background while we process this one.
+        _recordsSincePrefetch = 0;
+        _cursor->prefetch(_prefetchWindow);
+    }
     if (_params.assertMinTsHasNotFallenOffOplog) {
         assertMinTsHasNotFallenOffOplog(*record);
     }
@@ -270,6 +286,26 @@ PlanStage::StageState CollectionScan::returnIfMatches(WorkingSetMember* member,
     }
 }
 
+PlanStage::StageState CollectionScan::doWorkBatch(size_t maxResults,
+                                                  std::vector<WorkingSetID>* results,
+                                                  WorkingSetID* out) {
+    // doWork() is final in this class, so the calls below are dispatched directly and the whole
+    // batch costs a single virtual call from the parent stage.
+    size_t produced = 0;
+    while (produced < maxResults) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        const StageState state = doWork(&id);
+        if (PlanStage::ADVANCED != state) {
+            *out = id;
+            return state;
+        }
+        results->push_back(id);
+        ++produced;
+    }
+
+    return PlanStage::ADVANCED;
+}
+
 bool CollectionScan::isEOF() {
     return _commonStats.isEOF;
 }
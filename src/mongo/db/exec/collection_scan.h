@@ -61,6 +61,9 @@ public:
                    const MatchExpression* filter);
 
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxResults,
+                           std::vector<WorkingSetID>* results,
+                           WorkingSetID* out) final;
     bool isEOF() final;
 
     void doDetachFromOperationContext() final;
@@ -128,10 +131,20 @@ private:
 
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
+    // Whether '_cursor' can be re-positioned past EOF by restore(). If so, a tailable scan keeps
+    // the cursor when it runs out of data instead of rebuilding one and re-seeking to the last
+    // seen record on every wakeup.
+    bool _cursorResumesAfterEof = false;
+
     CollectionScanParams _params;
 
     RecordId _lastSeenId;  // Null if nothing has been returned from _cursor yet.
 
+    // When positive, every '_prefetchWindow' records we hint the storage engine to read the next
+    // '_prefetchWindow' records into cache in the background. Zero disables prefetching.
+    const int64_t _prefetchWindow;
+    int64_t _recordsSincePrefetch = 0;
+
     // If _params.shouldTrackLatestOplogTimestamp is set and the collection is the oplog, the latest
     // timestamp seen in the collection.  Otherwise, this is a null timestamp.
     Timestamp _latestOplogEntryTimestamp;
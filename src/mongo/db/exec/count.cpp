@@ -31,6 +31,7 @@
 
 #include "mongo/db/exec/count.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/db/catalog/collection.h"
@@ -42,6 +43,16 @@ namespace mongo {
 using std::unique_ptr;
 using std::vector;
 
+namespace {
+
+// The number of child results consumed per unit of work. The count stage discards its child's
+// results, so it can drain them in batches through workBatch() and amortize the per-document
+// stage dispatch; the batch is kept modest so interrupt and yield checks between units of work
+// retain a reasonable granularity.
+const size_t kChildBatchSize = 64;
+
+}  // namespace
+
 // static
 const char* CountStage::kStageType = "COUNT";
 
@@ -78,15 +89,23 @@ PlanStage::StageState CountStage::doWork(WorkingSetID* out) {
     // For cases where we can't ask the record store directly, we should always have a child stage
     // from which we can retrieve results.
     invariant(child());
+
+    // Don't ask the child for more results than we are allowed to observe: with a limit, the
+    // child may be able to produce more results than the count should reflect.
+    size_t batchSize = kChildBatchSize;
+    if (_limit > 0) {
+        batchSize = std::min(
+            batchSize, static_cast<size_t>(_leftToSkip + (_limit - _specificStats.nCounted)));
+    }
+
+    _childBatch.clear();
     WorkingSetID id = WorkingSet::INVALID_ID;
-    PlanStage::StageState state = child()->work(&id);
+    PlanStage::StageState state = child()->workBatch(batchSize, &_childBatch, &id);
 
-    if (PlanStage::IS_EOF == state) {
-        _commonStats.isEOF = true;
-        return PlanStage::IS_EOF;
-    } else if (PlanStage::ADVANCED == state) {
-        // We got a result. If we're still skipping, then decrement the number left to skip.
-        // Otherwise increment the count until we hit the limit.
+    // For each result we got, if we're still skipping then decrement the number left to skip.
+    // Otherwise increment the count until we hit the limit. Count doesn't need the actual
+    // results, so we just discard the working set members returned from the child.
+    for (WorkingSetID memberId : _childBatch) {
         if (_leftToSkip > 0) {
             _leftToSkip--;
             _specificStats.nSkipped++;
@@ -94,11 +113,14 @@ PlanStage::StageState CountStage::doWork(WorkingSetID* out) {
             _specificStats.nCounted++;
         }
 
-        // Count doesn't need the actual results, so we just discard any valid working
-        // set members that got returned from the child.
-        if (WorkingSet::INVALID_ID != id) {
-            _ws->free(id);
+        if (WorkingSet::INVALID_ID != memberId) {
+            _ws->free(memberId);
         }
+    }
+
+    if (PlanStage::IS_EOF == state) {
+        _commonStats.isEOF = true;
+        return PlanStage::IS_EOF;
     } else if (PlanStage::NEED_YIELD == state) {
         *out = id;
         return PlanStage::NEED_YIELD;
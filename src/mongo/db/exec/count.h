@@ -80,6 +80,10 @@ private:
     // by us.
     WorkingSet* _ws;
 
+    // Buffer for draining batches of child results per unit of work. A member so that its
+    // allocation is reused across calls to doWork().
+    std::vector<WorkingSetID> _childBatch;
+
     CountStats _specificStats;
 };
 
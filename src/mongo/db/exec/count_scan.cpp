@@ -156,6 +156,66 @@ PlanStage::StageState CountScan::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+PlanStage::StageState CountScan::doWorkBatch(size_t maxResults,
+                                             std::vector<WorkingSetID>* results,
+                                             WorkingSetID* out) {
+    if (_commonStats.isEOF)
+        return PlanStage::IS_EOF;
+
+    size_t produced = 0;
+
+    if (!_cursor) {
+        // Let doWork() perform the seek that establishes the cursor position.
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        const StageState state = doWork(&id);
+        if (PlanStage::ADVANCED != state) {
+            *out = id;
+            return state;
+        }
+        results->push_back(id);
+        ++produced;
+    }
+
+    // Harvest the rest of the batch through nextKeyString(), which hands back the raw KeyString
+    // without converting it to BSON; the end bound is enforced inside the cursor. Deduplicated
+    // keys do not produce a result but still count towards 'maxResults' so that a run of
+    // duplicates cannot starve the per-batch yield and interrupt checks.
+    for (size_t examined = produced; examined < maxResults; ++examined) {
+        boost::optional<KeyStringEntry> entry;
+        try {
+            entry = _cursor->nextKeyString();
+        } catch (const WriteConflictException&) {
+            *out = WorkingSet::INVALID_ID;
+            return PlanStage::NEED_YIELD;
+        }
+
+        ++_specificStats.keysExamined;
+
+        if (!entry) {
+            _commonStats.isEOF = true;
+            _cursor.reset();
+            return PlanStage::IS_EOF;
+        }
+
+        if (_shouldDedup && !_returned.insert(entry->loc).second) {
+            continue;
+        }
+
+        WorkingSetID id = _workingSet->allocate();
+        _workingSet->transitionToRecordIdAndObj(id);
+        results->push_back(id);
+        ++produced;
+    }
+
+    if (0 == produced) {
+        // Everything examined this batch was a duplicate.
+        *out = WorkingSet::INVALID_ID;
+        return PlanStage::NEED_TIME;
+    }
+
+    return PlanStage::ADVANCED;
+}
+
 bool CountScan::isEOF() {
     return _commonStats.isEOF;
 }
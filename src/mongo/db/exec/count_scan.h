@@ -93,6 +93,9 @@ public:
               WorkingSet* workingSet);
 
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxResults,
+                           std::vector<WorkingSetID>* results,
+                           WorkingSetID* out) final;
     bool isEOF() final;
     void doDetachFromOperationContext() final;
     void doReattachToOperationContext() final;
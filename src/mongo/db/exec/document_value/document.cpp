@@ -31,12 +31,16 @@
 
 #include "mongo/db/exec/document_value/document.h"
 
+#include <array>
+
 #include <boost/functional/hash.hpp>
+#include <boost/optional.hpp>
 
 #include "mongo/bson/bson_depth.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/pipeline/resume_token.h"
+#include "mongo/platform/bits.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -44,6 +48,71 @@ using boost::intrusive_ptr;
 using std::string;
 using std::vector;
 
+namespace {
+
+/**
+ * A small per-thread pool of retired DocumentStorage cache buffers. Pipelines allocate and free
+ * one cache buffer per materialized document, and consecutive documents tend to have the same
+ * shape and thus the same power-of-two buffer size, so recycling buffers by size class avoids
+ * hitting the allocator for nearly every document. Only small buffers are retained to bound the
+ * memory a thread may hold on to; everything else falls through to plain new/delete. Buffers may
+ * be returned by a different thread than the one that allocated them, which simply migrates them
+ * to the returning thread's pool.
+ */
+class CacheBufferPool {
+public:
+    static constexpr size_t kMinBytes = 128;        // Matches the minimum in alloc() below.
+    static constexpr size_t kMaxBytes = 16 * 1024;  // Don't retain large buffers.
+    static constexpr size_t kMaxBuffersPerSizeClass = 16;
+
+    ~CacheBufferPool() {
+        for (auto&& freeList : _freeLists)
+            for (auto buf : freeList)
+                delete[] buf;
+    }
+
+    char* allocate(size_t bytes) {
+        if (auto idx = _sizeClass(bytes)) {
+            auto& freeList = _freeLists[*idx];
+            if (!freeList.empty()) {
+                char* buf = freeList.back();
+                freeList.pop_back();
+                return buf;
+            }
+        }
+        return new char[bytes];
+    }
+
+    void deallocate(char* buf, size_t bytes) {
+        if (!buf)
+            return;
+        if (auto idx = _sizeClass(bytes)) {
+            auto& freeList = _freeLists[*idx];
+            if (freeList.size() < kMaxBuffersPerSizeClass) {
+                freeList.push_back(buf);
+                return;
+            }
+        }
+        delete[] buf;
+    }
+
+private:
+    // Only exact power-of-two sizes are pooled; reserveFields() can produce odd sizes which are
+    // not worth tracking.
+    boost::optional<size_t> _sizeClass(size_t bytes) const {
+        if (bytes < kMinBytes || bytes > kMaxBytes || (bytes & (bytes - 1)) != 0)
+            return boost::none;
+        return countTrailingZeros64(bytes) - countTrailingZeros64(kMinBytes);
+    }
+
+    static constexpr size_t kNumSizeClasses = 8;  // 128 bytes up to 16KB.
+    std::array<std::vector<char*>, kNumSizeClasses> _freeLists;
+};
+
+thread_local CacheBufferPool cacheBufferPool;
+
+}  // namespace
+
 const DocumentStorage DocumentStorage::kEmptyDoc;
 
 const StringDataSet Document::allMetadataFieldNames{Document::metaFieldTextScore,
@@ -242,6 +311,7 @@ void DocumentStorage::alloc(unsigned newSize) {
     const bool firstAlloc = !_cache;
     const bool doingRehash = needRehash();
     const size_t oldCapacity = _cacheEnd - _cache;
+    const size_t oldAllocatedBytes = allocatedBytes();  // Must be read before growing the table.
 
     // make new bucket count big enough
     while (needRehash() || hashTabBuckets() < HASH_TAB_INIT_SIZE)
@@ -254,13 +324,13 @@ void DocumentStorage::alloc(unsigned newSize) {
 
     uassert(16490, "Tried to make oversized document", capacity <= size_t(BufferMaxSize));
 
-    std::unique_ptr<char[]> oldBuf(_cache);
-    _cache = new char[capacity];
+    char* oldBuf = _cache;
+    _cache = cacheBufferPool.allocate(capacity);
     _cacheEnd = _cache + capacity - hashTabBytes();
 
     if (!firstAlloc) {
         // This just copies the elements
-        memcpy(_cache, oldBuf.get(), _usedBytes);
+        memcpy(_cache, oldBuf, _usedBytes);
 
         if (_numFields >= HASH_TAB_MIN) {
             // if we were hashing, deal with the hash table
@@ -268,10 +338,12 @@ void DocumentStorage::alloc(unsigned newSize) {
                 rehash();
             } else {
                 // no rehash needed so just slide table down to new position
-                memcpy(_hashTab, oldBuf.get() + oldCapacity, hashTabBytes());
+                memcpy(_hashTab, oldBuf + oldCapacity, hashTabBytes());
             }
         }
     }
+
+    cacheBufferPool.deallocate(oldBuf, oldAllocatedBytes);
 }
 
 void DocumentStorage::reserveFields(size_t expectedFields) {
@@ -287,7 +359,7 @@ void DocumentStorage::reserveFields(size_t expectedFields) {
 
     uassert(16491, "Tried to make oversized document", newSize <= size_t(BufferMaxSize));
 
-    _cache = new char[newSize + hashTabBytes()];
+    _cache = cacheBufferPool.allocate(newSize + hashTabBytes());
     _cacheEnd = _cache + newSize;
 }
 
@@ -298,7 +370,7 @@ intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
         // Make a copy of the buffer with the fields.
         // It is very important that the positions of each field are the same after cloning.
         const size_t bufferBytes = allocatedBytes();
-        out->_cache = new char[bufferBytes];
+        out->_cache = cacheBufferPool.allocate(bufferBytes);
         out->_cacheEnd = out->_cache + (_cacheEnd - _cache);
         memcpy(out->_cache, _cache, bufferBytes);
 
@@ -330,11 +402,17 @@ size_t DocumentStorage::getMetadataApproximateSize() const {
 }
 
 DocumentStorage::~DocumentStorage() {
-    std::unique_ptr<char[]> deleteBufferAtScopeEnd(_cache);
+    const size_t bufferBytes = allocatedBytes();
 
     for (auto it = iteratorCacheOnly(); !it.atEnd(); it.advance()) {
         it->val.~Value();  // explicit destructor call
     }
+
+    // The _cache check also keeps cache-less static storages (like kEmptyDoc, destroyed during
+    // shutdown) from touching the thread_local pool after it has been destroyed.
+    if (_cache) {
+        cacheBufferPool.deallocate(_cache, bufferBytes);
+    }
 }
 
 void DocumentStorage::reset(const BSONObj& bson, bool stripMetadata) {
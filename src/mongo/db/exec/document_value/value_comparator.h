@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <absl/container/flat_hash_map.h>
+
 #include <map>
 #include <set>
 
@@ -183,6 +185,18 @@ public:
         return stdx::unordered_map<Value, T, Hasher, EqualTo>(0, Hasher(this), EqualTo(this));
     }
 
+    /**
+     * Construct an empty open-addressing unordered map from Value to type T whose equivalence
+     * classes are given by this comparator. Compared to makeUnorderedValueMap() the entries are
+     * stored flat, with no per-entry allocation, which makes it a better fit for hot lookup loops
+     * with many entries. References into the map are invalidated by insertion. This comparator
+     * must outlive the returned map.
+     */
+    template <typename T>
+    absl::flat_hash_map<Value, T, Hasher, EqualTo> makeFlatUnorderedValueMap() const {
+        return absl::flat_hash_map<Value, T, Hasher, EqualTo>(0, Hasher(this), EqualTo(this));
+    }
+
 private:
     const StringData::ComparatorInterface* _stringComparator = nullptr;
 };
@@ -203,4 +217,8 @@ template <typename T>
 using ValueUnorderedMap =
     stdx::unordered_map<Value, T, ValueComparator::Hasher, ValueComparator::EqualTo>;
 
+template <typename T>
+using ValueFlatUnorderedMap =
+    absl::flat_hash_map<Value, T, ValueComparator::Hasher, ValueComparator::EqualTo>;
+
 }  // namespace mongo
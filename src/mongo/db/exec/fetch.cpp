@@ -31,6 +31,7 @@
 
 #include "mongo/db/exec/fetch.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/db/catalog/collection.h"
@@ -69,6 +70,11 @@ bool FetchStage::isEOF() {
         return false;
     }
 
+    if (!_batchIds.empty()) {
+        // A buffered batch has not been emitted yet.
+        return false;
+    }
+
     return child()->isEOF();
 }
 
@@ -125,6 +131,111 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState FetchStage::doWorkBatch(size_t maxResults,
+                                              std::vector<WorkingSetID>* results,
+                                              WorkingSetID* out) {
+    if (isEOF()) {
+        return PlanStage::IS_EOF;
+    }
+
+    if (WorkingSet::INVALID_ID != _idRetrying) {
+        // doWork() left a retry pending; finish it before buffering a new batch.
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        const StageState state = doWork(&id);
+        if (PlanStage::ADVANCED != state) {
+            *out = id;
+            return state;
+        }
+        results->push_back(id);
+        return PlanStage::ADVANCED;
+    }
+
+    if (_batchIds.empty()) {
+        // Buffer a batch of results from the child.
+        std::vector<WorkingSetID> childResults;
+        WorkingSetID childOut = WorkingSet::INVALID_ID;
+        _batchChildStatus = child()->workBatch(maxResults, &childResults, &childOut);
+        _batchChildOut = childOut;
+
+        if (childResults.empty()) {
+            *out = childOut;
+            return _batchChildStatus;
+        }
+
+        _batchIds = std::move(childResults);
+
+        // Decide which members need fetching and order those fetches by RecordId, so that the
+        // random-ordered id stream a secondary index range produces turns into a (near)
+        // sequential sweep over the record store.
+        _fetchOrder.clear();
+        for (size_t i = 0; i < _batchIds.size(); ++i) {
+            WorkingSetMember* member = _ws->get(_batchIds[i]);
+            if (member->hasObj()) {
+                ++_specificStats.alreadyHasObj;
+                continue;
+            }
+
+            // We need a valid RecordId to fetch from and this is the only state that has one.
+            verify(WorkingSetMember::RID_AND_IDX == member->getState());
+            verify(member->hasRecordId());
+            _fetchOrder.push_back(i);
+        }
+        std::sort(_fetchOrder.begin(), _fetchOrder.end(), [this](size_t lhs, size_t rhs) {
+            return _ws->get(_batchIds[lhs])->recordId < _ws->get(_batchIds[rhs])->recordId;
+        });
+        _numFetched = 0;
+    }
+
+    // Fetch phase. Execution resumes here after a WriteConflictException yield.
+    try {
+        if (!_cursor)
+            _cursor = collection()->getCursor(opCtx());
+
+        while (_numFetched < _fetchOrder.size()) {
+            const size_t ix = _fetchOrder[_numFetched];
+            const WorkingSetID id = _batchIds[ix];
+            if (!WorkingSetCommon::fetch(opCtx(), _ws, id, _cursor, collection()->ns())) {
+                _ws->free(id);
+                _batchIds[ix] = WorkingSet::INVALID_ID;
+            }
+            ++_numFetched;
+
+            if (1 == _numFetched && _fetchOrder.size() > 1) {
+                // Every remaining id sorts after the cursor's current position; hint the storage
+                // engine to read ahead of it.
+                _cursor->prefetch(static_cast<int64_t>(_fetchOrder.size() - 1));
+            }
+        }
+    } catch (const WriteConflictException&) {
+        // Ensure that the BSONObjs underlying the buffered WorkingSetMembers are owned because
+        // they may be freed when we yield.
+        for (WorkingSetID id : _batchIds) {
+            if (WorkingSet::INVALID_ID != id) {
+                _ws->get(id)->makeObjOwnedIfNeeded();
+            }
+        }
+        *out = WorkingSet::INVALID_ID;
+        return NEED_YIELD;
+    }
+
+    // Emit in the child's order, applying the filter.
+    for (WorkingSetID id : _batchIds) {
+        if (WorkingSet::INVALID_ID == id) {
+            continue;
+        }
+        WorkingSetID matched = WorkingSet::INVALID_ID;
+        if (PlanStage::ADVANCED == returnIfMatches(_ws->get(id), id, &matched)) {
+            results->push_back(matched);
+        }
+    }
+    _batchIds.clear();
+    _fetchOrder.clear();
+    _numFetched = 0;
+
+    *out = _batchChildOut;
+    return _batchChildStatus;
+}
+
 void FetchStage::doSaveStateRequiresCollection() {
     if (_cursor) {
         _cursor->saveUnpositioned();
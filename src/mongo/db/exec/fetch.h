@@ -60,6 +60,9 @@ public:
 
     bool isEOF() final;
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxResults,
+                           std::vector<WorkingSetID>* results,
+                           WorkingSetID* out) final;
 
     void doDetachFromOperationContext() final;
     void doReattachToOperationContext() final;
@@ -98,6 +101,18 @@ private:
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
+    // Buffered-fetch state used only by doWorkBatch(). '_batchIds' holds a batch of the child's
+    // results in arrival order (entries are invalidated in place when a fetch finds the record
+    // gone); '_fetchOrder' indexes into it sorted by RecordId so the fetches sweep the record
+    // store in order; '_numFetched' tracks progress so the fetch phase can resume after a
+    // WriteConflictException yield. The child's terminating status for the batch is saved in
+    // '_batchChildStatus'/'_batchChildOut' and reported once the buffer has been emitted.
+    std::vector<WorkingSetID> _batchIds;
+    std::vector<size_t> _fetchOrder;
+    size_t _numFetched = 0;
+    StageState _batchChildStatus = NEED_TIME;
+    WorkingSetID _batchChildOut = WorkingSet::INVALID_ID;
+
     // Stats
     FetchStats _specificStats;
 };
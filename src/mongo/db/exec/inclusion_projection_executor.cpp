@@ -29,6 +29,8 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
+
 #include "mongo/db/exec/inclusion_projection_executor.h"
 
 namespace mongo::projection_executor {
@@ -40,6 +42,10 @@ Document FastPathEligibleInclusionNode::applyToDocument(const Document& inputDoc
     // If we can get the backing BSON object off the input document without allocating an owned
     // copy, then we can apply a fast-path BSON-to-BSON inclusion projection.
     if (auto bson = inputDoc.toBsonIfTriviallyConvertible()) {
+        if (!_compiled) {
+            _compile();
+        }
+
         BSONObjBuilder bob;
         _applyProjections(*bson, &bob);
 
@@ -57,20 +63,62 @@ Document FastPathEligibleInclusionNode::applyToDocument(const Document& inputDoc
     return InclusionNode::applyToDocument(inputDoc);
 }
 
+void FastPathEligibleInclusionNode::_compile() const {
+    _compiledEntries.clear();
+    _compiledEntries.reserve(_projectedFields.size() + _children.size());
+
+    for (const auto& field : _projectedFields) {
+        _compiledEntries.push_back({StringData{field}, nullptr});
+    }
+    for (const auto& childPair : _children) {
+        const auto child = static_cast<const FastPathEligibleInclusionNode*>(childPair.second.get());
+        child->_compile();
+        _compiledEntries.push_back({StringData{childPair.first}, child});
+    }
+
+    std::sort(_compiledEntries.begin(),
+              _compiledEntries.end(),
+              [](const CompiledEntry& lhs, const CompiledEntry& rhs) { return lhs.name < rhs.name; });
+    _compiled = true;
+}
+
+const FastPathEligibleInclusionNode::CompiledEntry* FastPathEligibleInclusionNode::_findEntry(
+    StringData fieldName, size_t* hint) const {
+    if (*hint < _compiledEntries.size() && _compiledEntries[*hint].name == fieldName) {
+        return &_compiledEntries[(*hint)++];
+    }
+
+    auto it = std::lower_bound(
+        _compiledEntries.begin(),
+        _compiledEntries.end(),
+        fieldName,
+        [](const CompiledEntry& entry, StringData name) { return entry.name < name; });
+    if (it == _compiledEntries.end() || it->name != fieldName) {
+        return nullptr;
+    }
+    *hint = static_cast<size_t>(it - _compiledEntries.begin()) + 1;
+    return &*it;
+}
+
 void FastPathEligibleInclusionNode::_applyProjections(BSONObj bson, BSONObjBuilder* bob) const {
-    auto nFieldsNeeded = _projectedFields.size() + _children.size();
+    auto nFieldsNeeded = _compiledEntries.size();
+    size_t hint = 0;
 
     BSONObjIterator it{bson};
     while (it.more() && nFieldsNeeded > 0) {
         const auto bsonElement{it.next()};
         const auto fieldName{bsonElement.fieldNameStringData()};
-        const absl::string_view fieldNameKey{fieldName.rawData(), fieldName.size()};
 
-        if (_projectedFields.find(fieldNameKey) != _projectedFields.end()) {
+        const CompiledEntry* entry = _findEntry(fieldName, &hint);
+        if (!entry) {
+            continue;
+        }
+
+        if (!entry->child) {
             bob->append(bsonElement);
             --nFieldsNeeded;
-        } else if (auto childIt = _children.find(fieldNameKey); childIt != _children.end()) {
-            auto child = static_cast<FastPathEligibleInclusionNode*>(childIt->second.get());
+        } else {
+            const auto child = entry->child;
 
             if (bsonElement.type() == BSONType::Object) {
                 BSONObjBuilder subBob{bob->subobjStart(fieldName)};
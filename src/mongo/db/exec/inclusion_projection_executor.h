@@ -124,8 +124,35 @@ protected:
     }
 
 private:
+    // One entry per projected field or nested subtree at this level of the projection, sorted by
+    // field name. 'child' is null for plain field inclusions.
+    struct CompiledEntry {
+        StringData name;
+        const FastPathEligibleInclusionNode* child;
+    };
+
     void _applyProjections(BSONObj bson, BSONObjBuilder* bob) const;
     void _applyProjectionsToArray(BSONObj array, BSONArrayBuilder* bab) const;
+
+    /**
+     * Flattens this level of the projection (and, recursively, its children) into
+     * '_compiledEntries' so that applying the projection is a single pass over the input BSON with
+     * no per-field hash lookups.
+     */
+    void _compile() const;
+
+    /**
+     * Returns the entry for 'fieldName', or null if the projection does not mention it. '*hint' is
+     * the position in '_compiledEntries' where the field is expected next; input fields that
+     * arrive in the program's sorted order are matched with a single comparison each, and
+     * out-of-order fields fall back to a binary search.
+     */
+    const CompiledEntry* _findEntry(StringData fieldName, size_t* hint) const;
+
+    // The compiled program is built lazily on first use. The entries' names point into
+    // '_projectedFields' and '_children', which no longer change once execution has begun.
+    mutable std::vector<CompiledEntry> _compiledEntries;
+    mutable bool _compiled = false;
 };
 
 /**
@@ -183,6 +210,9 @@ public:
     void optimize() final {
         ProjectionExecutor::optimize();
         _root->optimize();
+        if (_root->deduplicateCommonSubexpressions(_expCtx.get())) {
+            _hasCommonSubexpressions = true;
+        }
     }
 
     DepsTracker::State addDependencies(DepsTracker* deps) const final {
@@ -44,6 +44,7 @@
 #include "mongo/db/exec/projection_executor.h"
 #include "mongo/db/exec/projection_executor_builder.h"
 #include "mongo/db/pipeline/dependencies.h"
+#include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/db/query/projection_parser.h"
 #include "mongo/logv2/log.h"
@@ -325,6 +326,38 @@ TEST_F(InclusionProjectionExecutionTestWithFallBackToDefault, ShouldOptimizeTopL
         inclusion->serializeTransformation(ExplainOptions::Verbosity::kExecAllPlans));
 }
 
+TEST_F(InclusionProjectionExecutionTestWithFallBackToDefault,
+       ShouldDeduplicateRepeatedSubexpressions) {
+    auto inclusion = makeInclusionProjectionWithDefaultPolicies(
+        fromjson("{a: {$toUpper: '$x'}, b: {$toUpper: '$x'}, c: {$toLower: '$x'}}"));
+
+    inclusion->optimize();
+
+    // The repeated subexpression in 'a' and 'b' is rewritten to evaluate through a shared
+    // per-document cache; the subexpression in 'c' only occurs once and is left alone.
+    auto root = static_cast<InclusionProjectionExecutor*>(inclusion.get())->getRoot();
+    auto exprA = dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        root->getExpressionForPath("a").get());
+    auto exprB = dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        root->getExpressionForPath("b").get());
+    ASSERT(exprA);
+    ASSERT(exprB);
+    ASSERT_EQ(exprA->getCacheSlot(), exprB->getCacheSlot());
+    ASSERT_FALSE(dynamic_cast<ExpressionInternalCachedSubexpression*>(
+        root->getExpressionForPath("c").get()));
+
+    // The rewrite must be invisible in the serialized form.
+    auto expectedSerialization = Document(fromjson(
+        "{_id: true, a: {$toUpper: ['$x']}, b: {$toUpper: ['$x']}, c: {$toLower: ['$x']}}"));
+    ASSERT_DOCUMENT_EQ(expectedSerialization, inclusion->serializeTransformation(boost::none));
+
+    // The cache must be invalidated between input documents.
+    auto result = inclusion->applyTransformation(Document{{"_id", 0}, {"x", "abc"_sd}});
+    ASSERT_DOCUMENT_EQ(result, Document(fromjson("{_id: 0, a: 'ABC', b: 'ABC', c: 'abc'}")));
+    result = inclusion->applyTransformation(Document{{"_id", 1}, {"x", "def"_sd}});
+    ASSERT_DOCUMENT_EQ(result, Document(fromjson("{_id: 1, a: 'DEF', b: 'DEF', c: 'def'}")));
+}
+
 TEST_F(InclusionProjectionExecutionTestWithFallBackToDefault, ShouldOptimizeNestedExpressions) {
     auto inclusion = makeInclusionProjectionWithDefaultPolicies(
         BSON("a.b" << BSON("$add" << BSON_ARRAY(1 << 2))));
@@ -412,6 +445,31 @@ TEST_F(InclusionProjectionExecutionTestWithoutFallBackToDefault, ShouldIncludeTo
     ASSERT_DOCUMENT_EQ(result, expectedResult);
 }
 
+TEST_F(InclusionProjectionExecutionTestWithoutFallBackToDefault,
+       ShouldIncludeFieldsRegardlessOfDocumentFieldOrder) {
+    auto inclusion =
+        makeInclusionProjectionWithDefaultPolicies(BSON("a" << true << "c" << true << "e" << true));
+
+    // BSON-backed documents exercise the single-pass BSON projection when the fast path is
+    // allowed. Document fields arrive in the projection's sorted order.
+    auto result = inclusion->applyTransformation(
+        Document{BSON("a" << 1 << "b" << 2 << "c" << 3 << "d" << 4 << "e" << 5)});
+    auto expectedResult = Document{{"a", 1}, {"c", 3}, {"e", 5}};
+    ASSERT_DOCUMENT_EQ(result, expectedResult);
+
+    // Document fields arrive in reverse order.
+    result = inclusion->applyTransformation(
+        Document{BSON("e" << 5 << "d" << 4 << "c" << 3 << "b" << 2 << "a" << 1)});
+    expectedResult = Document{{"e", 5}, {"c", 3}, {"a", 1}};
+    ASSERT_DOCUMENT_EQ(result, expectedResult);
+
+    // Document fields arrive interleaved and out of order.
+    result = inclusion->applyTransformation(
+        Document{BSON("c" << 3 << "a" << 1 << "e" << 5 << "b" << 2)});
+    expectedResult = Document{{"c", 3}, {"a", 1}, {"e", 5}};
+    ASSERT_DOCUMENT_EQ(result, expectedResult);
+}
+
 TEST_F(InclusionProjectionExecutionTestWithFallBackToDefault, ShouldAddComputedTopLevelField) {
     auto inclusion = makeInclusionProjectionWithDefaultPolicies(
         BSON("newField" << wrapInLiteral("computedVal")));
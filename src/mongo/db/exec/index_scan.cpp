@@ -52,6 +52,13 @@ int sgn(int i) {
     return i > 0 ? 1 : -1;
 }
 
+// When the bounds checker demands a re-seek, the target key is often only a handful of entries
+// ahead of the cursor: a large $in produces many point bounds over nearby values, and the gaps
+// between them are frequently within the same leaf page. Stepping the already-positioned cursor
+// forward up to this many times before falling back to a full seek trades a few cheap in-leaf
+// advances against a root-to-leaf tree descent.
+const int kMaxAdvancesBeforeSeek = 3;
+
 }  // namespace
 
 namespace mongo {
@@ -150,6 +157,7 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
                 break;
             case NEED_SEEK:
                 ++_specificStats.seeks;
+                _advancesTowardSeekPoint = 0;
                 kv = _indexCursor->seek(IndexEntryComparison::makeKeyStringFromSeekPointForSeek(
                     _seekPoint,
                     indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion(),
@@ -190,6 +198,7 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
     if (kv && _checker) {
         switch (_checker->checkKey(kv->key, &_seekPoint)) {
             case IndexBoundsChecker::VALID:
+                _advancesTowardSeekPoint = 0;
                 break;
 
             case IndexBoundsChecker::DONE:
@@ -197,7 +206,11 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
                 break;
 
             case IndexBoundsChecker::MUST_ADVANCE:
-                _scanState = NEED_SEEK;
+                // The key is in a gap between intervals. Before paying for a full seek, step the
+                // positioned cursor forward a bounded number of times in the hope of walking into
+                // the next interval; the checker re-validates whatever key we land on.
+                _scanState =
+                    _advancesTowardSeekPoint++ < kMaxAdvancesBeforeSeek ? GETTING_NEXT : NEED_SEEK;
                 return PlanStage::NEED_TIME;
         }
     }
@@ -243,6 +256,94 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+PlanStage::StageState IndexScan::doWorkBatch(size_t maxResults,
+                                             std::vector<WorkingSetID>* results,
+                                             WorkingSetID* out) {
+    size_t produced = 0;
+
+    // Delegate to doWork() until the scan reaches its steady state, and always when per-key
+    // interval checking is in play: IndexBoundsChecker may demand a re-seek at any key.
+    while (produced < maxResults && (_scanState != GETTING_NEXT || _checker)) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        const StageState state = doWork(&id);
+        if (PlanStage::ADVANCED != state) {
+            *out = id;
+            return state;
+        }
+        results->push_back(id);
+        ++produced;
+    }
+
+    // Steady state with the end bound enforced inside the cursor: harvest the rest of the batch
+    // with one try block and no per-key state dispatch. Keys dropped by deduplication or the
+    // filter do not produce a result but still count towards 'maxResults' so that a long run of
+    // misses cannot starve the per-batch yield and interrupt checks.
+    for (size_t examined = produced; examined < maxResults; ++examined) {
+        boost::optional<IndexKeyEntry> kv;
+        try {
+            kv = _indexCursor->next();
+        } catch (const WriteConflictException&) {
+            *out = WorkingSet::INVALID_ID;
+            return PlanStage::NEED_YIELD;
+        }
+
+        if (!kv) {
+            _scanState = HIT_END;
+            _commonStats.isEOF = true;
+            _indexCursor.reset();
+            return PlanStage::IS_EOF;
+        }
+
+        if (kDebugBuild && !_endKey.isEmpty()) {
+            int cmp = kv->key.woCompare(_endKey,
+                                        Ordering::make(_keyPattern),
+                                        /*compareFieldNames*/ false);
+            if (cmp == 0)
+                dassert(_endKeyInclusive);
+            dassert(_forward ? cmp <= 0 : cmp >= 0);
+        }
+
+        ++_specificStats.keysExamined;
+
+        if (_shouldDedup) {
+            ++_specificStats.dupsTested;
+            if (!_returned.insert(kv->loc).second) {
+                ++_specificStats.dupsDropped;
+                continue;
+            }
+        }
+
+        if (!Filter::passes(kv->key, _keyPattern, _filter)) {
+            continue;
+        }
+
+        if (!kv->key.isOwned())
+            kv->key = kv->key.getOwned();
+
+        WorkingSetID id = _workingSet->allocate();
+        WorkingSetMember* member = _workingSet->get(id);
+        member->recordId = kv->loc;
+        member->keyData.push_back(IndexKeyDatum(
+            _keyPattern, kv->key, workingSetIndexId(), opCtx()->recoveryUnit()->getSnapshotId()));
+        _workingSet->transitionToRecordIdAndIdx(id);
+
+        if (_addKeyMetadata) {
+            member->metadata().setIndexKey(IndexKeyEntry::rehydrateKey(_keyPattern, kv->key));
+        }
+
+        results->push_back(id);
+        ++produced;
+    }
+
+    if (0 == produced) {
+        // Everything examined this batch was deduplicated or filtered out.
+        *out = WorkingSet::INVALID_ID;
+        return PlanStage::NEED_TIME;
+    }
+
+    return PlanStage::ADVANCED;
+}
+
 bool IndexScan::isEOF() {
     return _commonStats.isEOF;
 }
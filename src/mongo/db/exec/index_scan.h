@@ -115,6 +115,9 @@ public:
               const MatchExpression* filter);
 
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxResults,
+                           std::vector<WorkingSetID>* results,
+                           WorkingSetID* out) final;
     bool isEOF() final;
     void doDetachFromOperationContext() final;
     void doReattachToOperationContext() final;
@@ -184,6 +187,10 @@ private:
     std::unique_ptr<IndexBoundsChecker> _checker;
     IndexSeekPoint _seekPoint;
 
+    // Number of consecutive keys stepped over with next() while trying to reach '_seekPoint'
+    // without paying for a full seek. See the MUST_ADVANCE handling in doWork().
+    int _advancesTowardSeekPoint = 0;
+
     //
     // 2) If the index scan is a single contiguous interval, then the scan can execute faster by
     //    letting the index cursor tell us when it hits the end, rather than repeatedly doing
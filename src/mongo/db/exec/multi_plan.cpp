@@ -70,6 +70,12 @@ void markShouldCollectTimingInfoOnSubtree(PlanStage* root) {
         markShouldCollectTimingInfoOnSubtree(child.get());
     }
 }
+
+// How many consecutive units of work each candidate receives before the trial round-robins to the
+// next one. Interleaving in slices rather than a single work at a time keeps each candidate's
+// cursors and caches hot and amortizes the per-work yield checks, without affecting the total
+// trial budget or the fairness of the ranking.
+const size_t kWorkUnitsPerSlice = 8;
 }  // namespace
 
 MultiPlanStage::MultiPlanStage(ExpressionContext* expCtx,
@@ -169,8 +175,9 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
 
     try {
         // Work the plans, stopping when a plan hits EOF or returns some fixed number of results.
-        for (size_t ix = 0; ix < numWorks; ++ix) {
-            bool moreToDo = workAllPlans(numResults, yieldPolicy);
+        for (size_t ix = 0; ix < numWorks; ix += kWorkUnitsPerSlice) {
+            const size_t numWorksThisRound = std::min(kWorkUnitsPerSlice, numWorks - ix);
+            bool moreToDo = workAllPlans(numWorksThisRound, numResults, yieldPolicy);
             if (!moreToDo) {
                 break;
             }
@@ -223,7 +230,9 @@ Status MultiPlanStage::pickBestPlan(PlanYieldPolicy* yieldPolicy) {
     return Status::OK();
 }
 
-bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy) {
+bool MultiPlanStage::workAllPlans(size_t numWorksThisRound,
+                                  size_t numResults,
+                                  PlanYieldPolicy* yieldPolicy) {
     bool doneWorking = false;
 
     for (size_t ix = 0; ix < _candidates.size(); ++ix) {
@@ -232,57 +241,61 @@ bool MultiPlanStage::workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolic
             continue;
         }
 
-        // Might need to yield between calls to work due to the timer elapsing.
-        tryYield(yieldPolicy);
-
-        WorkingSetID id = WorkingSet::INVALID_ID;
-        PlanStage::StageState state;
-        try {
-            state = candidate.root->work(&id);
-        } catch (const ExceptionFor<ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed>&) {
-            // If a candidate fails due to exceeding allowed resource consumption, then mark the
-            // candidate as failed but proceed with the multi-plan trial period. The MultiPlanStage
-            // as a whole only fails if _all_ candidates hit their resource consumption limit, or if
-            // a different, query-fatal error code is thrown.
-            candidate.failed = true;
-            ++_failureCount;
-
-            // If all children have failed, then rethrow. Otherwise, swallow the error and move onto
-            // the next candidate plan.
-            if (_failureCount == _candidates.size()) {
-                throw;
-            }
+        for (size_t workUnit = 0; workUnit < numWorksThisRound; ++workUnit) {
+            // Might need to yield between calls to work due to the timer elapsing.
+            tryYield(yieldPolicy);
 
-            continue;
-        }
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state;
+            try {
+                state = candidate.root->work(&id);
+            } catch (const ExceptionFor<ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed>&) {
+                // If a candidate fails due to exceeding allowed resource consumption, then mark the
+                // candidate as failed but proceed with the multi-plan trial period. The
+                // MultiPlanStage as a whole only fails if _all_ candidates hit their resource
+                // consumption limit, or if a different, query-fatal error code is thrown.
+                candidate.failed = true;
+                ++_failureCount;
+
+                // If all children have failed, then rethrow. Otherwise, swallow the error and move
+                // onto the next candidate plan.
+                if (_failureCount == _candidates.size()) {
+                    throw;
+                }
 
-        if (PlanStage::ADVANCED == state) {
-            // Save result for later.
-            WorkingSetMember* member = candidate.data->get(id);
-            // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we choose to
-            // return the results from the 'candidate' plan.
-            member->makeObjOwnedIfNeeded();
-            candidate.results.push(id);
+                break;
+            }
 
-            // Once a plan returns enough results, stop working.
-            if (candidate.results.size() >= numResults) {
+            if (PlanStage::ADVANCED == state) {
+                // Save result for later.
+                WorkingSetMember* member = candidate.data->get(id);
+                // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we
+                // choose to return the results from the 'candidate' plan.
+                member->makeObjOwnedIfNeeded();
+                candidate.results.push(id);
+
+                // Once a plan returns enough results, stop working.
+                if (candidate.results.size() >= numResults) {
+                    doneWorking = true;
+                    break;
+                }
+            } else if (PlanStage::IS_EOF == state) {
+                // First plan to hit EOF wins automatically.  Stop evaluating other plans.
+                // Assumes that the ranking will pick this plan.
                 doneWorking = true;
-            }
-        } else if (PlanStage::IS_EOF == state) {
-            // First plan to hit EOF wins automatically.  Stop evaluating other plans.
-            // Assumes that the ranking will pick this plan.
-            doneWorking = true;
-        } else if (PlanStage::NEED_YIELD == state) {
-            invariant(id == WorkingSet::INVALID_ID);
-            if (!yieldPolicy->canAutoYield()) {
-                throw WriteConflictException();
-            }
+                break;
+            } else if (PlanStage::NEED_YIELD == state) {
+                invariant(id == WorkingSet::INVALID_ID);
+                if (!yieldPolicy->canAutoYield()) {
+                    throw WriteConflictException();
+                }
 
-            if (yieldPolicy->canAutoYield()) {
-                yieldPolicy->forceYield();
-            }
+                if (yieldPolicy->canAutoYield()) {
+                    yieldPolicy->forceYield();
+                }
 
-            tryYield(yieldPolicy);
+                tryYield(yieldPolicy);
+            }
         }
     }
 
@@ -37,6 +37,24 @@
 #include "mongo/db/service_context.h"
 
 namespace mongo {
+PlanStage::StageState PlanStage::doWorkBatch(size_t maxResults,
+                                             std::vector<WorkingSetID>* results,
+                                             WorkingSetID* out) {
+    size_t produced = 0;
+    while (produced < maxResults) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        const StageState state = doWork(&id);
+        if (StageState::ADVANCED != state) {
+            *out = id;
+            return state;
+        }
+        results->push_back(id);
+        ++produced;
+    }
+
+    return StageState::ADVANCED;
+}
+
 void PlanStage::saveState() {
     ++_commonStats.yields;
     for (auto&& child : _children) {
@@ -221,6 +221,44 @@ public:
         return workResult;
     }
 
+    /**
+     * Works the stage repeatedly, appending the ids of up to 'maxResults' consecutive ADVANCED
+     * results to 'results'. Stops filling the batch as soon as a unit of work produces anything
+     * other than ADVANCED and returns that state, with *out set as it would be by work(); ids
+     * appended to 'results' before that point are valid and must still be consumed by the
+     * caller. Returns ADVANCED once 'maxResults' results have been appended.
+     *
+     * The base implementation performs one unit of work per result. Stages with a cheap
+     * per-document path may override doWorkBatch() to produce the whole batch in a single
+     * virtual call and amortize the per-document dispatch overhead.
+     */
+    StageState workBatch(size_t maxResults, std::vector<WorkingSetID>* results, WorkingSetID* out) {
+        auto optTimer(getOptTimer());
+
+        const size_t countBefore = results->size();
+        StageState workResult;
+        try {
+            workResult = doWorkBatch(maxResults, results, out);
+        } catch (...) {
+            _commonStats.failed = true;
+            throw;
+        }
+
+        const size_t numAdvanced = results->size() - countBefore;
+        _commonStats.works += numAdvanced;
+        _commonStats.advanced += numAdvanced;
+        if (StageState::ADVANCED != workResult) {
+            ++_commonStats.works;
+            if (StageState::NEED_TIME == workResult) {
+                ++_commonStats.needTime;
+            } else if (StageState::NEED_YIELD == workResult) {
+                ++_commonStats.needYield;
+            }
+        }
+
+        return workResult;
+    }
+
     /**
      * Returns true if no more work can be done on the query / out of results.
      */
@@ -359,6 +397,13 @@ protected:
      */
     virtual StageState doWork(WorkingSetID* out) = 0;
 
+    /**
+     * Produces up to 'maxResults' results per call.  See comment at workBatch() above.
+     */
+    virtual StageState doWorkBatch(size_t maxResults,
+                                   std::vector<WorkingSetID>* results,
+                                   WorkingSetID* out);
+
     /**
      * Saves any stage-specific state required to resume where it was if the underlying data
      * changes.
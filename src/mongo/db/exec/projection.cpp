@@ -145,6 +145,21 @@ PlanStage::StageState ProjectionStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState ProjectionStage::doWorkBatch(size_t maxResults,
+                                                   std::vector<WorkingSetID>* results,
+                                                   WorkingSetID* out) {
+    // Pull a whole batch from the child in one virtual call, then transform the members in a
+    // tight loop.
+    const size_t countBefore = results->size();
+    const StageState status = child()->workBatch(maxResults, results, out);
+
+    for (size_t i = countBefore; i < results->size(); ++i) {
+        transform(_ws.get((*results)[i]));
+    }
+
+    return status;
+}
+
 std::unique_ptr<PlanStageStats> ProjectionStage::getStats() {
     _commonStats.isEOF = isEOF();
     auto ret = std::make_unique<PlanStageStats>(_commonStats, stageType());
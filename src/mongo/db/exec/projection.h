@@ -52,6 +52,9 @@ protected:
 public:
     bool isEOF() final;
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxResults,
+                           std::vector<WorkingSetID>* results,
+                           WorkingSetID* out) final;
 
     std::unique_ptr<PlanStageStats> getStats() final;
 
@@ -74,6 +74,10 @@ public:
      * Apply the projection transformation.
      */
     Document applyTransformation(const Document& input) override {
+        if (_hasCommonSubexpressions) {
+            // Results cached by common subexpressions are only valid for a single input document.
+            _expCtx->variables.clearCachedValues();
+        }
         auto output = applyProjection(input);
         if (_rootReplacementExpression) {
             return _applyRootReplacementExpression(input, output);
@@ -116,6 +120,10 @@ protected:
 
     boost::intrusive_ptr<Expression> _rootReplacementExpression;
 
+    // Set by derived classes if optimization rewrote any repeated subexpressions to cache their
+    // per-document results; see ProjectionNode::deduplicateCommonSubexpressions().
+    bool _hasCommonSubexpressions = false;
+
 private:
     Document _applyRootReplacementExpression(const Document& input, const Document& output) {
         using namespace fmt::literals;
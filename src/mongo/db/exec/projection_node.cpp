@@ -31,11 +31,101 @@
 
 #include "mongo/db/exec/projection_node.h"
 
+#include "mongo/db/pipeline/expression.h"
+#include "mongo/db/pipeline/expression_function.h"
+#include "mongo/db/pipeline/expression_js_emit.h"
+
 namespace mongo::projection_executor {
 using ArrayRecursionPolicy = ProjectionPolicies::ArrayRecursionPolicy;
 using ComputedFieldsPolicy = ProjectionPolicies::ComputedFieldsPolicy;
 using DefaultIdPolicy = ProjectionPolicies::DefaultIdPolicy;
 
+namespace {
+/**
+ * Returns whether 'expr' is the kind of node worth caching: constants and bare field paths are
+ * cheaper to re-evaluate than to look up in the cache, and nodes which are already cached must not
+ * be wrapped a second time by a later optimization pass.
+ */
+bool isCacheableExpressionType(const Expression* expr) {
+    return !dynamic_cast<const ExpressionConstant*>(expr) &&
+        !dynamic_cast<const ExpressionFieldPath*>(expr) &&
+        !dynamic_cast<const ExpressionInternalCachedSubexpression*>(expr);
+}
+
+/**
+ * Returns whether it is semantically safe to evaluate 'expr' once per document and reuse the
+ * result for every occurrence. A subexpression which reads a variable bound by a $let or by the
+ * iteration of a $map or $filter may produce a different value each time it is evaluated within a
+ * single document, so any reference to a user-defined variable disqualifies the subtree; the
+ * builtin variables (like ROOT and NOW) do not change within a document. Note that two textually
+ * identical references to user-defined variables may also denote different bindings, which is
+ * another reason they must be rejected here rather than resolved. Javascript expressions and
+ * $rand are excluded as well, since their results may differ between evaluations.
+ */
+bool isCacheableSubexpression(const Expression* expr) {
+    if (dynamic_cast<const ExpressionRandom*>(expr) ||
+        dynamic_cast<const ExpressionFunction*>(expr) ||
+        dynamic_cast<const ExpressionInternalJsEmit*>(expr)) {
+        return false;
+    }
+    if (auto fieldPath = dynamic_cast<const ExpressionFieldPath*>(expr);
+        fieldPath && Variables::isUserDefinedVariable(fieldPath->getVariableId())) {
+        return false;
+    }
+    for (auto&& child : expr->getChildren()) {
+        if (child && !isCacheableSubexpression(child.get())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void countSubexpressions(const Expression* expr, ValueUnorderedMap<size_t>* counts) {
+    if (isCacheableExpressionType(expr)) {
+        ++(*counts)[expr->serialize(false)];
+    }
+    for (auto&& child : expr->getChildren()) {
+        if (child) {
+            countSubexpressions(child.get(), counts);
+        }
+    }
+}
+
+boost::intrusive_ptr<Expression> rewriteSubexpressions(boost::intrusive_ptr<Expression> expr,
+                                                       ExpressionContext* expCtx,
+                                                       const ValueUnorderedMap<size_t>& counts,
+                                                       ValueUnorderedMap<Variables::Id>* cacheSlots,
+                                                       bool* didRewrite) {
+    if (dynamic_cast<ExpressionInternalCachedSubexpression*>(expr.get())) {
+        // This subtree was already rewritten by a previous optimization pass.
+        return expr;
+    }
+    // Rewrite the children first; the wrapper serializes transparently, so doing this does not
+    // perturb the serialized form by which the parent is looked up below.
+    for (auto&& child : expr->getChildren()) {
+        if (child) {
+            child = rewriteSubexpressions(child, expCtx, counts, cacheSlots, didRewrite);
+        }
+    }
+    if (!isCacheableExpressionType(expr.get())) {
+        return expr;
+    }
+    auto key = expr->serialize(false);
+    auto countIt = counts.find(key);
+    if (countIt == counts.end() || countIt->second < 2 || !isCacheableSubexpression(expr.get())) {
+        return expr;
+    }
+    auto slotIt = cacheSlots->find(key);
+    if (slotIt == cacheSlots->end()) {
+        slotIt =
+            cacheSlots->emplace(key, expCtx->variables.useIdGenerator()->generateId()).first;
+    }
+    *didRewrite = true;
+    return make_intrusive<ExpressionInternalCachedSubexpression>(
+        expCtx, std::move(expr), slotIt->second);
+}
+}  // namespace
+
 ProjectionNode::ProjectionNode(ProjectionPolicies policies, std::string pathToNode)
     : _policies(policies), _pathToNode(std::move(pathToNode)) {}
 
@@ -269,6 +359,41 @@ void ProjectionNode::optimize() {
     _maxFieldsToProject = maxFieldsToProject();
 }
 
+bool ProjectionNode::deduplicateCommonSubexpressions(ExpressionContext* expCtx) {
+    // Enforce that this method can only be called on the root node.
+    invariant(_pathToNode.empty());
+
+    auto counts = ValueComparator().makeUnorderedValueMap<size_t>();
+    _countCommonSubexpressions(&counts);
+
+    auto cacheSlots = ValueComparator().makeUnorderedValueMap<Variables::Id>();
+    bool didRewrite = false;
+    _rewriteCommonSubexpressions(expCtx, counts, &cacheSlots, &didRewrite);
+    return didRewrite;
+}
+
+void ProjectionNode::_countCommonSubexpressions(ValueUnorderedMap<size_t>* counts) const {
+    for (auto&& expressionIt : _expressions) {
+        countSubexpressions(expressionIt.second.get(), counts);
+    }
+    for (auto&& childPair : _children) {
+        childPair.second->_countCommonSubexpressions(counts);
+    }
+}
+
+void ProjectionNode::_rewriteCommonSubexpressions(ExpressionContext* expCtx,
+                                                  const ValueUnorderedMap<size_t>& counts,
+                                                  ValueUnorderedMap<Variables::Id>* cacheSlots,
+                                                  bool* didRewrite) {
+    for (auto&& expressionIt : _expressions) {
+        _expressions[expressionIt.first] =
+            rewriteSubexpressions(expressionIt.second, expCtx, counts, cacheSlots, didRewrite);
+    }
+    for (auto&& childPair : _children) {
+        childPair.second->_rewriteCommonSubexpressions(expCtx, counts, cacheSlots, didRewrite);
+    }
+}
+
 Document ProjectionNode::serialize(boost::optional<ExplainOptions::Verbosity> explain) const {
     MutableDocument outputDoc;
     serialize(explain, &outputDoc);
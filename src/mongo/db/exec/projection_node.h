@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include "mongo/db/exec/document_value/value_comparator.h"
 #include "mongo/db/exec/projection_executor.h"
 
 #include "mongo/db/query/projection_policies.h"
@@ -128,6 +129,19 @@ public:
 
     void optimize();
 
+    /**
+     * Finds identical deterministic subexpressions which appear more than once across the computed
+     * fields of this projection tree and rewrites each occurrence to cache its result in a shared
+     * Variables slot, so it is evaluated at most once per input document. Subexpressions that are
+     * non-deterministic, trivially cheap, or that refer to variables bound inside the projection
+     * (such as the current element of a $map) are left alone.
+     *
+     * Can only be called on the root of the tree, after optimize(). Returns true if any
+     * subexpression was rewritten, in which case whoever drives evaluation must call
+     * Variables::clearCachedValues() between input documents.
+     */
+    bool deduplicateCommonSubexpressions(ExpressionContext* expCtx);
+
     Document serialize(boost::optional<ExplainOptions::Verbosity> explain) const;
 
     void serialize(boost::optional<ExplainOptions::Verbosity> explain,
@@ -207,6 +221,17 @@ private:
      */
     void _addExpressionForPath(const FieldPath& path, boost::intrusive_ptr<Expression> expr);
 
+    /**
+     * Internal helpers for deduplicateCommonSubexpressions(). The first pass counts how often each
+     * candidate subexpression occurs across the whole tree, keyed by its serialized form; the
+     * second pass rewrites the repeated ones.
+     */
+    void _countCommonSubexpressions(ValueUnorderedMap<size_t>* counts) const;
+    void _rewriteCommonSubexpressions(ExpressionContext* expCtx,
+                                      const ValueUnorderedMap<size_t>& counts,
+                                      ValueUnorderedMap<Variables::Id>* cacheSlots,
+                                      bool* didRewrite);
+
     /**
      * Internal helper function for addProjectionForPath().
      */
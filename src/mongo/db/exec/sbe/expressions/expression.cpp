@@ -119,12 +119,58 @@ std::unique_ptr<EExpression> EPrimBinary::clone() const {
     return std::make_unique<EPrimBinary>(_op, _nodes[0]->clone(), _nodes[1]->clone());
 }
 
+namespace {
+/**
+ * Evaluates the fully compiled expression 'code' and, if the result is a shallow value, returns a
+ * fragment pushing that value as a constant. Returns nullptr when the result is a deep value (a
+ * code fragment has no way to own it) or when the evaluation raises an error; in the latter case
+ * the operation is left to run time so that folding never changes when errors surface.
+ */
+std::unique_ptr<vm::CodeFragment> foldConstants(const vm::CodeFragment& code) {
+    try {
+        vm::ByteCode bytecode;
+        auto [owned, tag, val] = bytecode.run(&code);
+        if (owned) {
+            value::releaseValue(tag, val);
+            return nullptr;
+        }
+
+        auto folded = std::make_unique<vm::CodeFragment>();
+        folded->appendConstVal(tag, val);
+        return folded;
+    } catch (const DBException&) {
+        return nullptr;
+    }
+}
+}  // namespace
+
 std::unique_ptr<vm::CodeFragment> EPrimBinary::compile(CompileCtx& ctx) const {
     auto code = std::make_unique<vm::CodeFragment>();
 
     auto lhs = _nodes[0]->compile(ctx);
     auto rhs = _nodes[1]->compile(ctx);
 
+    // Pure arithmetic and comparison operators over two compile-time constants can be evaluated
+    // once here instead of being interpreted on every execution of the plan. Operators with
+    // observable failure modes, such as division by zero, are never folded.
+    const bool constFoldable = [&] {
+        switch (_op) {
+            case EPrimBinary::add:
+            case EPrimBinary::sub:
+            case EPrimBinary::mul:
+            case EPrimBinary::less:
+            case EPrimBinary::lessEq:
+            case EPrimBinary::greater:
+            case EPrimBinary::greaterEq:
+            case EPrimBinary::eq:
+            case EPrimBinary::neq:
+            case EPrimBinary::cmp3w:
+                return lhs->constantValue() && rhs->constantValue();
+            default:
+                return false;
+        }
+    }();
+
     switch (_op) {
         case EPrimBinary::add:
             code->append(std::move(lhs));
@@ -218,6 +264,12 @@ std::unique_ptr<vm::CodeFragment> EPrimBinary::compile(CompileCtx& ctx) const {
             MONGO_UNREACHABLE;
             break;
     }
+
+    if (constFoldable) {
+        if (auto folded = foldConstants(*code)) {
+            return folded;
+        }
+    }
     return code;
 }
 
@@ -284,6 +336,9 @@ std::unique_ptr<vm::CodeFragment> EPrimUnary::compile(CompileCtx& ctx) const {
 
     auto operand = _nodes[0]->compile(ctx);
 
+    // Both unary operators are pure, so a constant operand can be folded at compile time.
+    const bool constFoldable = static_cast<bool>(operand->constantValue());
+
     switch (_op) {
         case negate:
             code->append(std::move(operand));
@@ -297,6 +352,12 @@ std::unique_ptr<vm::CodeFragment> EPrimUnary::compile(CompileCtx& ctx) const {
             MONGO_UNREACHABLE;
             break;
     }
+
+    if (constFoldable) {
+        if (auto folded = foldConstants(*code)) {
+            return folded;
+        }
+    }
     return code;
 }
 
@@ -0,0 +1,113 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/exec/sbe/expression_test_base.h"
+
+namespace mongo::sbe {
+/**
+ * Tests for compile-time constant folding of pure operators over constant operands.
+ */
+
+using SBEConstantFoldTest = EExpressionTestFixture;
+
+// Size of a code fragment holding a single pushConstVal instruction.
+const size_t kPushConstValSize =
+    sizeof(vm::Instruction) + sizeof(value::TypeTags) + sizeof(value::Value);
+
+TEST_F(SBEConstantFoldTest, FoldsArithmeticOverConstants) {
+    auto expr = makeE<EPrimBinary>(
+        EPrimBinary::add,
+        makeE<EConstant>(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(17)),
+        makeE<EConstant>(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(25)));
+    auto compiledExpr = compileExpression(*expr);
+
+    // The whole expression must have been folded into a single constant push.
+    ASSERT_EQ(compiledExpr->instrs().size(), kPushConstValSize);
+
+    auto [tag, val] = runCompiledExpression(compiledExpr.get());
+    value::ValueGuard guard{tag, val};
+    ASSERT_EQUALS(tag, value::TypeTags::NumberInt64);
+    ASSERT_EQUALS(value::bitcastTo<int64_t>(val), 42);
+}
+
+TEST_F(SBEConstantFoldTest, FoldsComparisonOverConstants) {
+    auto expr = makeE<EPrimBinary>(
+        EPrimBinary::less,
+        makeE<EConstant>(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(1)),
+        makeE<EConstant>(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(2)));
+    auto compiledExpr = compileExpression(*expr);
+
+    ASSERT_EQ(compiledExpr->instrs().size(), kPushConstValSize);
+    ASSERT_TRUE(runCompiledExpressionPredicate(compiledExpr.get()));
+}
+
+TEST_F(SBEConstantFoldTest, FoldsUnaryOverConstant) {
+    auto expr =
+        makeE<EPrimUnary>(EPrimUnary::logicNot,
+                          makeE<EConstant>(value::TypeTags::Boolean, value::bitcastFrom<bool>(true)));
+    auto compiledExpr = compileExpression(*expr);
+
+    ASSERT_EQ(compiledExpr->instrs().size(), kPushConstValSize);
+    ASSERT_FALSE(runCompiledExpressionPredicate(compiledExpr.get()));
+}
+
+TEST_F(SBEConstantFoldTest, DoesNotFoldDivision) {
+    // Division can fail at run time, so it must never be evaluated during compilation, even over
+    // constants.
+    auto expr = makeE<EPrimBinary>(
+        EPrimBinary::div,
+        makeE<EConstant>(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(1)),
+        makeE<EConstant>(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(0)));
+    auto compiledExpr = compileExpression(*expr);
+
+    ASSERT_GT(compiledExpr->instrs().size(), kPushConstValSize);
+    ASSERT_THROWS(runCompiledExpression(compiledExpr.get()), DBException);
+}
+
+TEST_F(SBEConstantFoldTest, DoesNotFoldNonConstantOperands) {
+    value::OwnedValueAccessor accessor;
+    auto slot = bindAccessor(&accessor);
+
+    auto expr = makeE<EPrimBinary>(
+        EPrimBinary::add,
+        makeE<EVariable>(slot),
+        makeE<EConstant>(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(5)));
+    auto compiledExpr = compileExpression(*expr);
+
+    ASSERT_GT(compiledExpr->instrs().size(), kPushConstValSize);
+
+    accessor.reset(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(37));
+    auto [tag, val] = runCompiledExpression(compiledExpr.get());
+    value::ValueGuard guard{tag, val};
+    ASSERT_EQUALS(tag, value::TypeTags::NumberInt64);
+    ASSERT_EQUALS(value::bitcastTo<int64_t>(val), 42);
+}
+}  // namespace mongo::sbe
@@ -0,0 +1,135 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
+#include "mongo/db/exec/sbe/stages/hash_agg.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/query/sbe_stage_builder_helpers.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo::sbe {
+/**
+ * This file contains tests for sbe::HashAggStage.
+ */
+
+using HashAggStageTest = PlanStageTestFixture;
+
+TEST_F(HashAggStageTest, SumsAllInputsWithoutGroupByKeys) {
+    auto [inputTag, inputVal] = stage_builder::makeValue(BSON_ARRAY(1 << 2 << 3 << 4));
+    value::ValueGuard inputGuard{inputTag, inputVal};
+
+    auto [expectedTag, expectedVal] = stage_builder::makeValue(BSON_ARRAY(10));
+    value::ValueGuard expectedGuard{expectedTag, expectedVal};
+
+    auto makeStageFn = [this](value::SlotId scanSlot, std::unique_ptr<PlanStage> scanStage) {
+        auto groupSlot = generateSlotId();
+        auto hashAgg = makeS<HashAggStage>(
+            std::move(scanStage),
+            makeSV(),
+            makeEM(groupSlot, stage_builder::makeFunction("sum", makeE<EVariable>(scanSlot))),
+            kEmptyPlanNodeId);
+
+        return std::make_pair(groupSlot, std::move(hashAgg));
+    };
+
+    inputGuard.reset();
+    expectedGuard.reset();
+    runTest(inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
+}
+
+TEST_F(HashAggStageTest, GroupsByKeyAndAccumulates) {
+    auto [inputTag, inputVal] = stage_builder::makeValue(BSON_ARRAY(1 << 2 << 1 << 3 << 2 << 1));
+    auto [scanSlot, scanStage] = generateVirtualScan(inputTag, inputVal);
+
+    auto groupSlot = generateSlotId();
+    auto hashAgg = makeS<HashAggStage>(
+        std::move(scanStage),
+        makeSV(scanSlot),
+        makeEM(groupSlot, stage_builder::makeFunction("sum", makeE<EVariable>(scanSlot))),
+        kEmptyPlanNodeId);
+
+    auto ctx = makeCompileCtx();
+    auto accessors = prepareTree(ctx.get(), hashAgg.get(), makeSV(scanSlot, groupSlot));
+
+    // The iteration order over the groups is unspecified, so collect (key, sum) pairs and sort
+    // them before comparing.
+    std::vector<std::pair<int64_t, int64_t>> results;
+    while (hashAgg->getNext() == PlanState::ADVANCED) {
+        auto [keyTag, keyVal] = accessors[0]->getViewOfValue();
+        auto [sumTag, sumVal] = accessors[1]->getViewOfValue();
+        ASSERT_TRUE(value::isNumber(keyTag));
+        ASSERT_TRUE(value::isNumber(sumTag));
+        results.emplace_back(value::numericCast<int64_t>(keyTag, keyVal),
+                             value::numericCast<int64_t>(sumTag, sumVal));
+    }
+    hashAgg->close();
+
+    std::sort(results.begin(), results.end());
+    std::vector<std::pair<int64_t, int64_t>> expected{{1, 3}, {2, 4}, {3, 3}};
+    ASSERT_TRUE(results == expected);
+}
+
+TEST_F(HashAggStageTest, RespectsMemoryLimit) {
+    const auto memoryLimit = internalDocumentSourceGroupMaxMemoryBytes.load();
+    internalDocumentSourceGroupMaxMemoryBytes.store(1024);
+    ON_BLOCK_EXIT([&] { internalDocumentSourceGroupMaxMemoryBytes.store(memoryLimit); });
+
+    // Build an input with enough distinct keys for the hash table to exceed the limit above. The
+    // memory check is periodic, so make sure there are more rows than the check interval.
+    auto [inputTag, inputVal] = value::makeNewArray();
+    {
+        value::ValueGuard inputGuard{inputTag, inputVal};
+        auto inputView = value::getArrayView(inputVal);
+        for (int64_t i = 0; i < 4096; ++i) {
+            inputView->push_back(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(i));
+        }
+        inputGuard.reset();
+    }
+    auto [scanSlot, scanStage] = generateVirtualScan(inputTag, inputVal);
+
+    auto groupSlot = generateSlotId();
+    auto hashAgg = makeS<HashAggStage>(
+        std::move(scanStage),
+        makeSV(scanSlot),
+        makeEM(groupSlot, stage_builder::makeFunction("sum", makeE<EVariable>(scanSlot))),
+        kEmptyPlanNodeId);
+
+    // The hash table is built in open(), which prepareTree() calls.
+    auto ctx = makeCompileCtx();
+    ASSERT_THROWS_CODE(prepareTree(ctx.get(), hashAgg.get(), groupSlot),
+                       DBException,
+                       ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed);
+}
+}  // namespace mongo::sbe
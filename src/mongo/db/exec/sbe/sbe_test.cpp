@@ -188,6 +188,52 @@ TEST(SBEValues, HashCompound) {
     }
 }
 
+TEST(SBEVM, RunSingleInstructionCode) {
+    // Code fragments consisting of a single push instruction are evaluated directly, bypassing
+    // the interpreter loop. Make sure the results are indistinguishable from interpretation.
+    {
+        vm::CodeFragment code;
+        code.appendConstVal(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(42));
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_FALSE(owned);
+        ASSERT_EQUALS(tag, value::TypeTags::NumberInt64);
+        ASSERT_EQUALS(value::bitcastTo<int64_t>(val), 42);
+    }
+    {
+        value::OwnedValueAccessor accessor;
+        auto [strTag, strVal] = value::makeNewString("not so small string"sv);
+        accessor.reset(strTag, strVal);
+
+        vm::CodeFragment code;
+        code.appendAccessVal(&accessor);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_FALSE(owned);
+        ASSERT_EQUALS(tag, strTag);
+        ASSERT_EQUALS(val, strVal);
+    }
+    {
+        value::OwnedValueAccessor accessor;
+        auto [strTag, strVal] = value::makeNewString("not so small string"sv);
+        accessor.reset(strTag, strVal);
+
+        vm::CodeFragment code;
+        code.appendMoveVal(&accessor);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_TRUE(owned);
+        ASSERT_EQUALS(tag, value::TypeTags::StringBig);
+        value::releaseValue(tag, val);
+    }
+}
+
 TEST(SBEVM, Add) {
     {
         auto tagInt32 = value::TypeTags::NumberInt32;
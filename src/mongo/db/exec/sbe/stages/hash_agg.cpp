@@ -31,15 +31,28 @@
 
 #include "mongo/db/exec/sbe/stages/hash_agg.h"
 
+#include <algorithm>
+
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
 namespace sbe {
+namespace {
+// Minimum number of input rows processed between two memory usage checks. The effective interval
+// grows with the number of groups so that walking the hash table stays amortized constant time per
+// input row.
+const size_t kMemoryCheckInterval = 1024;
+}  // namespace
+
 HashAggStage::HashAggStage(std::unique_ptr<PlanStage> input,
                            value::SlotVector gbs,
                            value::SlotMap<std::unique_ptr<EExpression>> aggs,
                            PlanNodeId planNodeId)
-    : PlanStage("group"_sd, planNodeId), _gbs(std::move(gbs)), _aggs(std::move(aggs)) {
+    : PlanStage("group"_sd, planNodeId),
+      _gbs(std::move(gbs)),
+      _aggs(std::move(aggs)),
+      _memoryLimitBytes(internalDocumentSourceGroupMaxMemoryBytes.load()) {
     _children.emplace_back(std::move(input));
 }
 
@@ -107,6 +120,8 @@ void HashAggStage::open(bool reOpen) {
 
     if (reOpen) {
         _ht.clear();
+        _keyMemoryBytes = 0;
+        _rowsSinceMemoryCheck = 0;
     }
 
     while (_children[0]->getNext() == PlanState::ADVANCED) {
@@ -124,6 +139,8 @@ void HashAggStage::open(bool reOpen) {
             const_cast<value::MaterializedRow&>(it->first).makeOwned();
             // Initialize accumulators.
             it->second.resize(_outAggAccessors.size());
+
+            _keyMemoryBytes += it->first.memUsageForSorter();
         }
 
         // Accumulate.
@@ -132,6 +149,12 @@ void HashAggStage::open(bool reOpen) {
             auto [owned, tag, val] = _bytecode.run(_aggCodes[idx].get());
             _outAggAccessors[idx]->reset(owned, tag, val);
         }
+
+        // Estimating the accumulators' size on every row would be too expensive, so the memory
+        // check runs at intervals proportional to the number of groups.
+        if (++_rowsSinceMemoryCheck >= std::max(kMemoryCheckInterval, _ht.size() / 2)) {
+            checkMemoryUsage();
+        }
     }
 
     _children[0]->close();
@@ -177,9 +200,24 @@ const SpecificStats* HashAggStage::getSpecificStats() const {
     return nullptr;
 }
 
+void HashAggStage::checkMemoryUsage() {
+    _rowsSinceMemoryCheck = 0;
+
+    auto memoryUsageBytes = _keyMemoryBytes;
+    for (auto&& [key, accumulators] : _ht) {
+        memoryUsageBytes += accumulators.memUsageForSorter();
+    }
+
+    uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
+            "Exceeded memory limit for group, and external spilling is not supported",
+            memoryUsageBytes <= _memoryLimitBytes);
+}
+
 void HashAggStage::close() {
     _commonStats.closes++;
     _ht.clear();
+    _keyMemoryBytes = 0;
+    _rowsSinceMemoryCheck = 0;
 }
 
 std::vector<DebugPrinter::Block> HashAggStage::debugPrint() const {
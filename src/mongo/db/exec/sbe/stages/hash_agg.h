@@ -58,6 +58,13 @@ public:
     std::vector<DebugPrinter::Block> debugPrint() const final;
 
 private:
+    /**
+     * Walks the hash table to estimate its current memory footprint and raises
+     * 'QueryExceededMemoryLimitNoDiskUseAllowed' if it exceeds the limit. Called periodically from
+     * the build loop in open().
+     */
+    void checkMemoryUsage();
+
     using TableType = stdx::
         unordered_map<value::MaterializedRow, value::MaterializedRow, value::MaterializedRowHasher>;
 
@@ -80,6 +87,13 @@ private:
     vm::ByteCode _bytecode;
 
     bool _compiled{false};
+
+    // The hash table is bounded by the same memory limit as the $group aggregation stage. The key
+    // portion of the table is tracked incrementally as groups are created; the accumulator portion
+    // changes on every input row, so it is re-estimated periodically by checkMemoryUsage().
+    const long long _memoryLimitBytes;
+    long long _keyMemoryBytes{0};
+    size_t _rowsSinceMemoryCheck{0};
 };
 }  // namespace sbe
 }  // namespace mongo
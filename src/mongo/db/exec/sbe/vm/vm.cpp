@@ -184,6 +184,23 @@ void CodeFragment::appendConstVal(value::TypeTags tag, value::Value val) {
     offset += value::writeToMemory(offset, val);
 }
 
+boost::optional<std::pair<value::TypeTags, value::Value>> CodeFragment::constantValue() const {
+    if (_instrs.size() !=
+        sizeof(Instruction) + sizeof(value::TypeTags) + sizeof(value::Value)) {
+        return boost::none;
+    }
+
+    auto pcPointer = _instrs.data();
+    Instruction i = value::readFromMemory<Instruction>(pcPointer);
+    if (i.tag != Instruction::pushConstVal) {
+        return boost::none;
+    }
+
+    auto tag = value::readFromMemory<value::TypeTags>(pcPointer + sizeof(i));
+    auto val = value::readFromMemory<value::Value>(pcPointer + sizeof(i) + sizeof(tag));
+    return std::make_pair(tag, val);
+}
+
 void CodeFragment::appendAccessVal(value::SlotAccessor* accessor) {
     Instruction i;
     i.tag = Instruction::pushAccessVal;
@@ -2649,6 +2666,49 @@ std::tuple<uint8_t, value::TypeTags, value::Value> ByteCode::run(const CodeFragm
     auto pcPointer = code->instrs().data();
     auto pcEnd = pcPointer + code->instrs().size();
 
+    // Simple expressions - constant predicates and plain slot references - compile down to a
+    // single push instruction. Evaluate those directly instead of paying for the interpreter
+    // dispatch loop and the value stack, as they are extremely common in filter and project
+    // bytecode.
+    if (code->instrs().size() > 0) {
+        Instruction first = value::readFromMemory<Instruction>(pcPointer);
+        switch (first.tag) {
+            case Instruction::pushConstVal: {
+                auto offset = pcPointer + sizeof(first);
+                auto tag = value::readFromMemory<value::TypeTags>(offset);
+                offset += sizeof(tag);
+                auto val = value::readFromMemory<value::Value>(offset);
+                offset += sizeof(val);
+                if (offset == pcEnd) {
+                    return {false, tag, val};
+                }
+                break;
+            }
+            case Instruction::pushAccessVal: {
+                auto offset = pcPointer + sizeof(first);
+                auto accessor = value::readFromMemory<value::SlotAccessor*>(offset);
+                offset += sizeof(accessor);
+                if (offset == pcEnd) {
+                    auto [tag, val] = accessor->getViewOfValue();
+                    return {false, tag, val};
+                }
+                break;
+            }
+            case Instruction::pushMoveVal: {
+                auto offset = pcPointer + sizeof(first);
+                auto accessor = value::readFromMemory<value::SlotAccessor*>(offset);
+                offset += sizeof(accessor);
+                if (offset == pcEnd) {
+                    auto [tag, val] = accessor->copyOrMoveValue();
+                    return {true, tag, val};
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
     for (;;) {
         if (pcPointer == pcEnd) {
             break;
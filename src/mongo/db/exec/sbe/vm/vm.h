@@ -29,8 +29,11 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "mongo/db/exec/sbe/values/slot.h"
@@ -269,6 +272,14 @@ public:
     auto stackSize() const {
         return _stackSize;
     }
+
+    /**
+     * If this fragment consists of a single instruction pushing a constant, returns that constant.
+     * The returned value remains owned by whoever owns the constant referenced by the bytecode.
+     * Used by the expression compiler to fold operators over constant operands at compile time.
+     */
+    boost::optional<std::pair<value::TypeTags, value::Value>> constantValue() const;
+
     void removeFixup(FrameId frameId);
 
     void append(std::unique_ptr<CodeFragment> code);
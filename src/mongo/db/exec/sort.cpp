@@ -78,6 +78,50 @@ PlanStage::StageState SortStage::doWork(WorkingSetID* out) {
     return unspool(out);
 }
 
+PlanStage::StageState SortStage::doWorkBatch(size_t maxResults,
+                                             std::vector<WorkingSetID>* results,
+                                             WorkingSetID* out) {
+    if (isEOF()) {
+        return PlanStage::IS_EOF;
+    }
+
+    if (!_populated) {
+        // Spool an entire batch from the child per unit of work.
+        std::vector<WorkingSetID> toSpool;
+        toSpool.reserve(maxResults);
+        const StageState code = child()->workBatch(maxResults, &toSpool, out);
+
+        for (auto id : toSpool) {
+            spool(id);
+        }
+
+        if (code == PlanStage::IS_EOF) {
+            // The child has returned all of its results. Record this fact so that subsequent
+            // calls will perform sorting and unspool the sorted results.
+            _populated = true;
+            loadingDone();
+            return PlanStage::NEED_TIME;
+        } else if (code == PlanStage::ADVANCED) {
+            return PlanStage::NEED_TIME;
+        }
+
+        // NEED_TIME or NEED_YIELD, with *out already set by the child in the latter case.
+        return code;
+    }
+
+    size_t produced = 0;
+    while (produced < maxResults) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        if (PlanStage::ADVANCED != unspool(&id)) {
+            return PlanStage::IS_EOF;
+        }
+        results->push_back(id);
+        ++produced;
+    }
+
+    return PlanStage::ADVANCED;
+}
+
 void SortStageDefault::loadingDone() {
     _sortExecutor.loadingDone();
     auto& metricsCollector = ResourceConsumption::MetricsCollector::get(expCtx()->opCtx);
@@ -84,6 +84,9 @@ public:
     virtual StageState unspool(WorkingSetID* out) = 0;
 
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxResults,
+                           std::vector<WorkingSetID>* results,
+                           WorkingSetID* out) final;
 
     std::unique_ptr<PlanStageStats> getStats() override final;
 
@@ -55,7 +55,9 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
         return std::tuple<BSONObj, Date_t>(BSONObj(), Date_t());
     }
 
-    BSONObjBuilder builder;
+    // Consecutive samples have nearly identical sizes, so sizing the buffer from the previous
+    // sample lets the collectors append without a series of buffer growth copies.
+    BSONObjBuilder builder(_nextSampleSizeHint);
 
     Date_t start = client->getServiceContext()->getPreciseClockSource()->now();
     Date_t end;
@@ -97,7 +99,10 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
 
     builder.appendDate(kFTDCCollectEndField, end);
 
-    return std::tuple<BSONObj, Date_t>(builder.obj(), start);
+    auto sample = builder.obj();
+    _nextSampleSizeHint = sample.objsize();
+
+    return std::tuple<BSONObj, Date_t>(std::move(sample), start);
 }
 
 }  // namespace mongo
@@ -113,6 +113,10 @@ public:
 private:
     // collection of collectors
     std::vector<std::unique_ptr<FTDCCollectorInterface>> _collectors;
+
+    // Size of the most recently collected sample, used to pre-size the builder for the next one.
+    // Starts at the BSONObjBuilder default so the first sample behaves as before.
+    int _nextSampleSizeHint = 512;
 };
 
 }  // namespace mongo
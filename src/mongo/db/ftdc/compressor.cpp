@@ -31,7 +31,8 @@
 
 #include "mongo/db/ftdc/compressor.h"
 
-#include "mongo/base/data_builder.h"
+#include <third_party/s2/util/coding/varint.h>
+
 #include "mongo/db/ftdc/config.h"
 #include "mongo/db/ftdc/util.h"
 #include "mongo/db/ftdc/varint.h"
@@ -43,6 +44,23 @@ namespace mongo {
 
 using std::swap;
 
+namespace {
+
+/**
+ * Appends 'value' to 'buf' in FTDCVarInt encoding.
+ *
+ * Writes through BufBuilder::grow() at the worst case size and trims afterwards, which keeps the
+ * encode loop free of the per-element bounds checks and Status plumbing that writing through a
+ * DataBuilder incurs.
+ */
+void appendVarInt(BufBuilder& buf, std::uint64_t value) {
+    char* ptr = buf.grow(FTDCVarInt::kMaxSizeBytes64);
+    char* end = Varint::Encode64(ptr, value);
+    buf.setlen(buf.len() - (ptr + FTDCVarInt::kMaxSizeBytes64 - end));
+}
+
+}  // namespace
+
 StatusWith<boost::optional<std::tuple<ConstDataRange, FTDCCompressor::CompressorState, Date_t>>>
 FTDCCompressor::addSample(const BSONObj& sample, Date_t date) {
     if (_referenceDoc.isEmpty()) {
@@ -129,9 +147,6 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
     _uncompressedChunkBuffer.appendNum(static_cast<std::uint32_t>(_deltaCount));
 
     if (_metricsCount != 0 && _deltaCount != 0) {
-        // On average, we do not need all 10 bytes for every sample, worst case, we grow the buffer
-        DataBuilder db(_metricsCount * _deltaCount * FTDCVarInt::kMaxSizeBytes64 / 2);
-
         std::uint32_t zeroesCount = 0;
 
         // For each set of samples for a particular metric,
@@ -145,7 +160,7 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
         //   - Each memeber is stored as VarInt packed integer
         // 3. Finally, for non-zero members, we store these as VarInt packed
         //
-        // These byte arrays are added to a buffer which is then concatenated with other chunks and
+        // These byte arrays are written directly into the uncompressed buffer which is then
         // compressed with ZLIB.
         for (std::uint32_t i = 0; i < _metricsCount; i++) {
             for (std::uint32_t j = 0; j < _deltaCount; j++) {
@@ -158,44 +173,22 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
 
                 // If we have a non-zero sample, then write out all the accumulated zero samples.
                 if (zeroesCount > 0) {
-                    auto s1 = db.writeAndAdvance(FTDCVarInt(0));
-                    if (!s1.isOK()) {
-                        return s1;
-                    }
-
-                    auto s2 = db.writeAndAdvance(FTDCVarInt(zeroesCount - 1));
-                    if (!s2.isOK()) {
-                        return s2;
-                    }
-
+                    appendVarInt(_uncompressedChunkBuffer, 0);
+                    appendVarInt(_uncompressedChunkBuffer, zeroesCount - 1);
                     zeroesCount = 0;
                 }
 
-                auto s3 = db.writeAndAdvance(FTDCVarInt(delta));
-                if (!s3.isOK()) {
-                    return s3;
-                }
+                appendVarInt(_uncompressedChunkBuffer, delta);
             }
 
             // If we are on the last metric, and the previous loop ended in a zero, write out the
             // RLE
             // pair of zero information.
             if ((i == (_metricsCount - 1)) && zeroesCount) {
-                auto s1 = db.writeAndAdvance(FTDCVarInt(0));
-                if (!s1.isOK()) {
-                    return s1;
-                }
-
-                auto s2 = db.writeAndAdvance(FTDCVarInt(zeroesCount - 1));
-                if (!s2.isOK()) {
-                    return s2;
-                }
+                appendVarInt(_uncompressedChunkBuffer, 0);
+                appendVarInt(_uncompressedChunkBuffer, zeroesCount - 1);
             }
         }
-
-        // Append the entire compacted metric chunk into the uncompressed buffer
-        ConstDataRange cdr = db.getCursor();
-        _uncompressedChunkBuffer.appendBuf(cdr.data(), cdr.length());
     }
 
     auto swDest = _compressor.compress(
@@ -39,7 +39,6 @@
 #include "mongo/db/fts/stemmer.h"
 #include "mongo/db/fts/stop_words.h"
 #include "mongo/db/fts/tokenizer.h"
-#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/string_map.h"
 
 namespace mongo {
@@ -51,7 +50,7 @@ extern const double MAX_WORD_WEIGHT;
 extern const double DEFAULT_WEIGHT;
 
 typedef std::map<std::string, double> Weights;  // TODO cool map
-typedef stdx::unordered_map<std::string, double> TermFrequencyMap;
+typedef StringMap<double> TermFrequencyMap;
 
 struct ScoreHelperStruct {
     ScoreHelperStruct() : freq(0), count(0), exp(0) {}
@@ -58,6 +58,11 @@ bool GeometryContainer::hasS2Region() const {
         nullptr != _multiLine || nullptr != _multiPolygon || nullptr != _geometryCollection;
 }
 
+S2CellId GeometryContainer::getS2PointCellId() const {
+    invariant(nullptr != _point && SPHERE == _point->crs);
+    return _point->cell.id();
+}
+
 const S2Region& GeometryContainer::getS2Region() const {
     if (nullptr != _point && SPHERE == _point->crs) {
         return _point->cell;
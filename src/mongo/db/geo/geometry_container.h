@@ -113,6 +113,12 @@ public:
     bool hasS2Region() const;
     const S2Region& getS2Region() const;
 
+    /**
+     * Returns the id of the S2 leaf cell containing the point. It is an error to call this unless
+     * isPoint() is true and the point has been projected into the SPHERE CRS.
+     */
+    S2CellId getS2PointCellId() const;
+
     // Region which can be used to generate a covering of the query object in euclidean space.
     bool hasR2Region() const;
     const R2Region& getR2Region() const;
@@ -70,9 +70,6 @@ Status S2GetKeysForElement(const BSONElement& element,
     if (!status.isOK())
         return status;
 
-    S2RegionCoverer coverer;
-    params.configureCoverer(geoContainer, &coverer);
-
     // Don't index big polygon
     if (geoContainer.getNativeCRS() == STRICT_SPHERE) {
         return Status(ErrorCodes::BadValue, "can't index geometry with strict winding order");
@@ -95,6 +92,16 @@ Status S2GetKeysForElement(const BSONElement& element,
 
     invariant(geoContainer.hasS2Region());
 
+    // Points in modern index versions are indexed at the fixed point level, where the covering is
+    // exactly the leaf cell containing the point. Since point documents dominate typical 2dsphere
+    // ingest workloads, read the cell id directly rather than running the region coverer.
+    if (params.indexVersion >= S2_INDEX_VERSION_3 && geoContainer.isPoint()) {
+        out->push_back(geoContainer.getS2PointCellId());
+        return Status::OK();
+    }
+
+    S2RegionCoverer coverer;
+    params.configureCoverer(geoContainer, &coverer);
     coverer.GetCovering(geoContainer.getS2Region(), out);
     return Status::OK();
 }
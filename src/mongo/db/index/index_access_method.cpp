@@ -33,6 +33,7 @@
 
 #include "mongo/db/index/btree_access_method.h"
 
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -43,6 +44,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/curop.h"
+#include "mongo/db/index/index_access_method_gen.h"
 #include "mongo/db/index/index_build_interceptor.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/jsobj.h"
@@ -53,7 +55,11 @@
 #include "mongo/db/storage/durable_catalog.h"
 #include "mongo/db/storage/execution_context.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/progress_meter.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/stacktrace.h"
@@ -89,6 +95,7 @@ SortOptions makeSortOptions(size_t maxMemoryUsageBytes, StringData dbName) {
         .TempDir(storageGlobalParams.dbpath + "/_tmp")
         .ExtSortAllowed()
         .MaxMemoryUsageBytes(maxMemoryUsageBytes)
+        .MaxMergeParallelism(static_cast<size_t>(maxIndexBuildMergeParallelism.load()))
         .DBName(dbName.toString());
 }
 
@@ -489,6 +496,8 @@ public:
                     const IndexStateInfo& stateInfo,
                     StringData dbName);
 
+    ~BulkBuilderImpl() override;
+
     Status insert(OperationContext* opCtx,
                   const BSONObj& obj,
                   const RecordId& loc,
@@ -506,13 +515,68 @@ public:
      * Inserts all multikey metadata keys cached during the BulkBuilder's lifetime into the
      * underlying Sorter, finalizes it, and returns an iterator over the sorted dataset.
      */
-    Sorter::Iterator* done() final;
+    Sorter::Iterator* done(OperationContext* opCtx) final;
 
     int64_t getKeysInserted() const final;
 
-    Sorter::PersistedState persistDataForShutdown() final;
+    Sorter::PersistedState persistDataForShutdown(OperationContext* opCtx) final;
 
 private:
+    // Number of documents handed to a key generation worker thread at a time. Batching amortizes
+    // the queue synchronization overhead over many getKeys() calls.
+    static constexpr size_t kKeyGenBatchSize = 64;
+
+    // Maximum number of batches that may sit in the queue before the collection scan thread
+    // blocks. Bounding the queue bounds the memory pinned by owned document copies.
+    static constexpr size_t kMaxQueuedKeyGenBatches = 8;
+
+    using KeyGenBatch = std::vector<std::pair<BSONObj, RecordId>>;
+
+    /**
+     * State owned by a single key generation worker thread. Each worker maintains its own Sorter
+     * and multikey bookkeeping so the hot path runs without synchronization; the per-worker state
+     * is folded into the main members when the workers are joined.
+     */
+    struct KeyGenWorker {
+        stdx::thread thread;
+        std::unique_ptr<Sorter> sorter;
+        SharedBufferFragmentBuilder pooledBufferBuilder{
+            static_cast<size_t>(gOperationMemoryPoolBlockInitialSizeKB.loadRelaxed()) * 1024,
+            SharedBufferFragmentBuilder::DoubleGrowStrategy(
+                static_cast<size_t>(gOperationMemoryPoolBlockMaxSizeKB.loadRelaxed()) * 1024)};
+        KeyStringSet multikeyMetadataKeys;
+        MultikeyPaths multikeyPaths;
+        bool isMultiKey = false;
+        int64_t keysInserted = 0;
+    };
+
+    Status _insertParallel(OperationContext* opCtx,
+                           const BSONObj& obj,
+                           const RecordId& loc,
+                           const InsertDeleteOptions& options);
+
+    void _startKeyGenWorkers(IndexAccessMethod::GetKeysMode getKeysMode);
+
+    void _keyGenWorkerLoop(KeyGenWorker* worker);
+
+    void _keyGenProcessDocument(KeyGenWorker* worker, const BSONObj& obj, const RecordId& loc);
+
+    void _dispatchKeyGenBatch();
+
+    /**
+     * Records with the SkippedRecordTracker any documents whose key generation errors were
+     * suppressed on a worker thread. Workers cannot write to the tracker themselves because doing
+     * so requires an OperationContext, so they queue the RecordIds for the scan thread.
+     */
+    void _drainSuppressedRecords(OperationContext* opCtx);
+
+    /**
+     * Flushes any pending batch, joins the worker threads and folds their multikey state and key
+     * counts into the main members. Safe to call when workers were never started; only the first
+     * call after they were does any work.
+     */
+    void _finalizeKeyGenWorkers(OperationContext* opCtx);
+
     void _insertMultikeyMetadataKeysIntoSorter();
 
     Sorter* _makeSorter(
@@ -525,6 +589,8 @@ private:
 
     IndexCatalogEntry* _indexCatalogEntry;
     std::unique_ptr<Sorter> _sorter;
+    size_t _maxMemoryUsageBytes;
+    std::string _dbName;
     int64_t _keysInserted = 0;
 
     // Set to true if any document added to the BulkBuilder causes the index to become multikey.
@@ -538,6 +604,31 @@ private:
     // These are inserted into the sorter after all normal data keys have been added, just
     // before the bulk build is committed.
     KeyStringSet _multikeyMetadataKeys;
+
+    // Number of key generation worker threads, or 0 when key generation stays on the collection
+    // scan thread. Captured once at construction so a runtime change to the server parameter
+    // cannot alter an in-progress build.
+    size_t _numKeyGenWorkers = 0;
+
+    // The key generation mode captured from the first insert; all inserts of a bulk build use the
+    // same InsertDeleteOptions.
+    IndexAccessMethod::GetKeysMode _keyGenKeysMode = GetKeysMode::kEnforceConstraints;
+
+    std::vector<std::unique_ptr<KeyGenWorker>> _keyGenWorkers;
+
+    // Batch under construction on the collection scan thread. Not guarded by _keyGenMutex.
+    KeyGenBatch _pendingKeyGenBatch;
+
+    bool _keyGenFinalized = false;
+
+    // Guards the members below. Held only for queue operations, never while generating keys.
+    Mutex _keyGenMutex = MONGO_MAKE_LATCH("BulkBuilderImpl::_keyGenMutex");
+    stdx::condition_variable _keyGenHasWork;
+    stdx::condition_variable _keyGenHasSpace;
+    std::deque<KeyGenBatch> _keyGenQueue;
+    std::vector<RecordId> _suppressedRecords;
+    Status _keyGenError = Status::OK();
+    bool _keyGenDone = false;
 };
 
 std::unique_ptr<IndexAccessMethod::BulkBuilder> AbstractIndexAccessMethod::initiateBulk(
@@ -553,7 +644,15 @@ std::unique_ptr<IndexAccessMethod::BulkBuilder> AbstractIndexAccessMethod::initi
 AbstractIndexAccessMethod::BulkBuilderImpl::BulkBuilderImpl(IndexCatalogEntry* index,
                                                             size_t maxMemoryUsageBytes,
                                                             StringData dbName)
-    : _indexCatalogEntry(index), _sorter(_makeSorter(maxMemoryUsageBytes, dbName)) {}
+    : _indexCatalogEntry(index),
+      _sorter(_makeSorter(maxMemoryUsageBytes, dbName)),
+      _maxMemoryUsageBytes(maxMemoryUsageBytes),
+      _dbName(dbName.toString()) {
+    auto parallelism = maxIndexBuildKeyGenerationParallelism.load();
+    if (parallelism > 1) {
+        _numKeyGenWorkers = static_cast<size_t>(parallelism);
+    }
+}
 
 AbstractIndexAccessMethod::BulkBuilderImpl::BulkBuilderImpl(IndexCatalogEntry* index,
                                                             size_t maxMemoryUsageBytes,
@@ -562,14 +661,40 @@ AbstractIndexAccessMethod::BulkBuilderImpl::BulkBuilderImpl(IndexCatalogEntry* i
     : _indexCatalogEntry(index),
       _sorter(
           _makeSorter(maxMemoryUsageBytes, dbName, stateInfo.getFileName(), stateInfo.getRanges())),
+      _maxMemoryUsageBytes(maxMemoryUsageBytes),
+      _dbName(dbName.toString()),
       _keysInserted(stateInfo.getNumKeys().value_or(0)),
       _isMultiKey(stateInfo.getIsMultikey()),
-      _indexMultikeyPaths(createMultikeyPaths(stateInfo.getMultikeyPaths())) {}
+      _indexMultikeyPaths(createMultikeyPaths(stateInfo.getMultikeyPaths())) {
+    auto parallelism = maxIndexBuildKeyGenerationParallelism.load();
+    if (parallelism > 1) {
+        _numKeyGenWorkers = static_cast<size_t>(parallelism);
+    }
+}
+
+AbstractIndexAccessMethod::BulkBuilderImpl::~BulkBuilderImpl() {
+    // If the build was abandoned before done() or persistDataForShutdown() joined the workers,
+    // shut them down here so the threads never outlive the queue they read from.
+    if (!_keyGenWorkers.empty() && !_keyGenFinalized) {
+        {
+            stdx::lock_guard<Latch> lk(_keyGenMutex);
+            _keyGenDone = true;
+        }
+        _keyGenHasWork.notify_all();
+        for (auto& worker : _keyGenWorkers) {
+            worker->thread.join();
+        }
+    }
+}
 
 Status AbstractIndexAccessMethod::BulkBuilderImpl::insert(OperationContext* opCtx,
                                                           const BSONObj& obj,
                                                           const RecordId& loc,
                                                           const InsertDeleteOptions& options) {
+    if (_numKeyGenWorkers > 0) {
+        return _insertParallel(opCtx, obj, loc, options);
+    }
+
     auto& executionCtx = StorageExecutionContext::get(opCtx);
 
     auto keys = executionCtx.keys();
@@ -629,6 +754,208 @@ Status AbstractIndexAccessMethod::BulkBuilderImpl::insert(OperationContext* opCt
     return Status::OK();
 }
 
+Status AbstractIndexAccessMethod::BulkBuilderImpl::_insertParallel(
+    OperationContext* opCtx,
+    const BSONObj& obj,
+    const RecordId& loc,
+    const InsertDeleteOptions& options) {
+    if (_keyGenWorkers.empty()) {
+        _startKeyGenWorkers(options.getKeysMode);
+    }
+
+    {
+        stdx::lock_guard<Latch> lk(_keyGenMutex);
+        if (!_keyGenError.isOK()) {
+            return _keyGenError;
+        }
+    }
+
+    _drainSuppressedRecords(opCtx);
+
+    // The BSONObj handed to us only remains valid for the duration of this call, but the batch
+    // outlives it, so take an owned copy.
+    _pendingKeyGenBatch.emplace_back(obj.getOwned(), loc);
+    if (_pendingKeyGenBatch.size() >= kKeyGenBatchSize) {
+        _dispatchKeyGenBatch();
+    }
+
+    return Status::OK();
+}
+
+void AbstractIndexAccessMethod::BulkBuilderImpl::_startKeyGenWorkers(
+    IndexAccessMethod::GetKeysMode getKeysMode) {
+    invariant(_keyGenWorkers.empty());
+    _keyGenKeysMode = getKeysMode;
+
+    // Split the memory budget across the worker sorters; in parallel mode the main sorter only
+    // receives multikey metadata keys and resumed state, so it keeps no share of its own.
+    const size_t perWorkerMemBytes =
+        std::max(_maxMemoryUsageBytes / _numKeyGenWorkers, static_cast<size_t>(1024 * 1024));
+
+    for (size_t i = 0; i < _numKeyGenWorkers; ++i) {
+        auto worker = std::make_unique<KeyGenWorker>();
+        worker->sorter.reset(_makeSorter(perWorkerMemBytes, _dbName));
+        worker->thread = stdx::thread([this, w = worker.get()] { _keyGenWorkerLoop(w); });
+        _keyGenWorkers.push_back(std::move(worker));
+    }
+}
+
+void AbstractIndexAccessMethod::BulkBuilderImpl::_keyGenWorkerLoop(KeyGenWorker* worker) {
+    while (true) {
+        KeyGenBatch batch;
+        bool failed = false;
+        {
+            stdx::unique_lock<Latch> lk(_keyGenMutex);
+            _keyGenHasWork.wait(lk, [&] { return !_keyGenQueue.empty() || _keyGenDone; });
+            if (_keyGenQueue.empty()) {
+                return;
+            }
+            batch = std::move(_keyGenQueue.front());
+            _keyGenQueue.pop_front();
+            failed = !_keyGenError.isOK();
+        }
+        _keyGenHasSpace.notify_one();
+
+        // After a failure keep draining batches without processing them so the scan thread never
+        // blocks on a full queue; it surfaces the error on its next insert.
+        if (failed) {
+            continue;
+        }
+
+        try {
+            for (const auto& doc : batch) {
+                _keyGenProcessDocument(worker, doc.first, doc.second);
+            }
+        } catch (...) {
+            stdx::lock_guard<Latch> lk(_keyGenMutex);
+            if (_keyGenError.isOK()) {
+                _keyGenError = exceptionToStatus();
+            }
+        }
+    }
+}
+
+void AbstractIndexAccessMethod::BulkBuilderImpl::_keyGenProcessDocument(KeyGenWorker* worker,
+                                                                        const BSONObj& obj,
+                                                                        const RecordId& loc) {
+    KeyStringSet keys;
+    MultikeyPaths multikeyPaths;
+
+    _indexCatalogEntry->accessMethod()->getKeys(
+        worker->pooledBufferBuilder,
+        obj,
+        _keyGenKeysMode,
+        GetKeysContext::kAddingKeys,
+        &keys,
+        &worker->multikeyMetadataKeys,
+        &multikeyPaths,
+        loc,
+        [&](Status status, const BSONObj&, boost::optional<RecordId>) {
+            // Recording the document as "skipped" requires an OperationContext, which worker
+            // threads do not have, so queue the RecordId for the collection scan thread.
+            LOGV2_DEBUG(5837117,
+                        1,
+                        "Deferring suppressed key generation error to the scan thread",
+                        "error"_attr = status,
+                        "loc"_attr = loc,
+                        "obj"_attr = redact(obj));
+            stdx::lock_guard<Latch> lk(_keyGenMutex);
+            _suppressedRecords.push_back(loc);
+        });
+
+    if (!multikeyPaths.empty()) {
+        if (worker->multikeyPaths.empty()) {
+            worker->multikeyPaths = multikeyPaths;
+        } else {
+            invariant(worker->multikeyPaths.size() == multikeyPaths.size());
+            for (size_t i = 0; i < multikeyPaths.size(); ++i) {
+                worker->multikeyPaths[i].insert(boost::container::ordered_unique_range_t(),
+                                                multikeyPaths[i].begin(),
+                                                multikeyPaths[i].end());
+            }
+        }
+    }
+
+    for (const auto& keyString : keys) {
+        worker->sorter->add(keyString, mongo::NullValue());
+        ++worker->keysInserted;
+    }
+
+    worker->isMultiKey = worker->isMultiKey ||
+        _indexCatalogEntry->accessMethod()->shouldMarkIndexAsMultikey(
+            keys.size(), worker->multikeyMetadataKeys, multikeyPaths);
+}
+
+void AbstractIndexAccessMethod::BulkBuilderImpl::_dispatchKeyGenBatch() {
+    {
+        stdx::unique_lock<Latch> lk(_keyGenMutex);
+        _keyGenHasSpace.wait(lk, [&] { return _keyGenQueue.size() < kMaxQueuedKeyGenBatches; });
+        _keyGenQueue.push_back(std::move(_pendingKeyGenBatch));
+    }
+    _pendingKeyGenBatch.clear();
+    _keyGenHasWork.notify_one();
+}
+
+void AbstractIndexAccessMethod::BulkBuilderImpl::_drainSuppressedRecords(OperationContext* opCtx) {
+    std::vector<RecordId> records;
+    {
+        stdx::lock_guard<Latch> lk(_keyGenMutex);
+        records.swap(_suppressedRecords);
+    }
+    if (records.empty()) {
+        return;
+    }
+
+    auto interceptor = _indexCatalogEntry->indexBuildInterceptor();
+    if (!interceptor || !interceptor->getSkippedRecordTracker()) {
+        return;
+    }
+    for (const auto& loc : records) {
+        interceptor->getSkippedRecordTracker()->record(opCtx, loc);
+    }
+}
+
+void AbstractIndexAccessMethod::BulkBuilderImpl::_finalizeKeyGenWorkers(OperationContext* opCtx) {
+    if (!_keyGenWorkers.empty() && !_keyGenFinalized) {
+        _keyGenFinalized = true;
+
+        if (!_pendingKeyGenBatch.empty()) {
+            _dispatchKeyGenBatch();
+        }
+        {
+            stdx::lock_guard<Latch> lk(_keyGenMutex);
+            _keyGenDone = true;
+        }
+        _keyGenHasWork.notify_all();
+        for (auto& worker : _keyGenWorkers) {
+            worker->thread.join();
+        }
+
+        // The workers are joined, so their state can be folded in without holding _keyGenMutex.
+        for (auto& worker : _keyGenWorkers) {
+            if (!worker->multikeyPaths.empty()) {
+                if (_indexMultikeyPaths.empty()) {
+                    _indexMultikeyPaths = worker->multikeyPaths;
+                } else {
+                    invariant(_indexMultikeyPaths.size() == worker->multikeyPaths.size());
+                    for (size_t i = 0; i < worker->multikeyPaths.size(); ++i) {
+                        _indexMultikeyPaths[i].insert(boost::container::ordered_unique_range_t(),
+                                                      worker->multikeyPaths[i].begin(),
+                                                      worker->multikeyPaths[i].end());
+                    }
+                }
+            }
+            _multikeyMetadataKeys.insert(worker->multikeyMetadataKeys.begin(),
+                                         worker->multikeyMetadataKeys.end());
+            _isMultiKey = _isMultiKey || worker->isMultiKey;
+            _keysInserted += worker->keysInserted;
+        }
+    }
+
+    _drainSuppressedRecords(opCtx);
+    uassertStatusOK(_keyGenError);
+}
+
 const MultikeyPaths& AbstractIndexAccessMethod::BulkBuilderImpl::getMultikeyPaths() const {
     return _indexMultikeyPaths;
 }
@@ -638,9 +965,23 @@ bool AbstractIndexAccessMethod::BulkBuilderImpl::isMultikey() const {
 }
 
 IndexAccessMethod::BulkBuilder::Sorter::Iterator*
-AbstractIndexAccessMethod::BulkBuilderImpl::done() {
+AbstractIndexAccessMethod::BulkBuilderImpl::done(OperationContext* opCtx) {
+    _finalizeKeyGenWorkers(opCtx);
     _insertMultikeyMetadataKeysIntoSorter();
-    return _sorter->done();
+
+    if (_keyGenWorkers.empty()) {
+        return _sorter->done();
+    }
+
+    // Merge the per-worker sorters with the main sorter. The merged stream satisfies the same
+    // non-decreasing key order commitBulk() expects from a single sorter.
+    std::vector<std::shared_ptr<Sorter::Iterator>> iters;
+    iters.emplace_back(_sorter->done());
+    for (auto& worker : _keyGenWorkers) {
+        iters.emplace_back(worker->sorter->done());
+    }
+    return Sorter::Iterator::merge(
+        iters, makeSortOptions(_maxMemoryUsageBytes, _dbName), BtreeExternalSortComparison());
 }
 
 int64_t AbstractIndexAccessMethod::BulkBuilderImpl::getKeysInserted() const {
@@ -648,8 +989,21 @@ int64_t AbstractIndexAccessMethod::BulkBuilderImpl::getKeysInserted() const {
 }
 
 AbstractIndexAccessMethod::BulkBuilder::Sorter::PersistedState
-AbstractIndexAccessMethod::BulkBuilderImpl::persistDataForShutdown() {
+AbstractIndexAccessMethod::BulkBuilderImpl::persistDataForShutdown(OperationContext* opCtx) {
+    _finalizeKeyGenWorkers(opCtx);
     _insertMultikeyMetadataKeysIntoSorter();
+
+    // Resumable index build state records a single spill file, so funnel the worker sorters'
+    // output into the main sorter before persisting. The keys were already counted when the
+    // workers were folded in, so do not bump _keysInserted again here.
+    for (auto& worker : _keyGenWorkers) {
+        std::unique_ptr<Sorter::Iterator> it(worker->sorter->done());
+        while (it->more()) {
+            auto data = it->next();
+            _sorter->add(data.first, data.second);
+        }
+    }
+
     return _sorter->persistDataForShutdown();
 }
 
@@ -694,7 +1048,7 @@ Status AbstractIndexAccessMethod::commitBulk(OperationContext* opCtx,
                                              const RecordIdHandlerFn& onDuplicateRecord) {
     Timer timer;
 
-    std::unique_ptr<BulkBuilder::Sorter::Iterator> it(bulk->done());
+    std::unique_ptr<BulkBuilder::Sorter::Iterator> it(bulk->done(opCtx));
 
     static constexpr char message[] = "Index Build: inserting keys from external sorter into index";
     ProgressMeterHolder pm;
@@ -261,8 +261,10 @@ public:
         /**
          * Inserts all multikey metadata keys cached during the BulkBuilder's lifetime into the
          * underlying Sorter, finalizes it, and returns an iterator over the sorted dataset.
+         * Joins any key generation worker threads first; 'opCtx' is used to record documents
+         * whose key generation errors were suppressed on a worker thread.
          */
-        virtual Sorter::Iterator* done() = 0;
+        virtual Sorter::Iterator* done(OperationContext* opCtx) = 0;
 
         /**
          * Returns number of keys inserted using this BulkBuilder.
@@ -273,7 +275,7 @@ public:
          * Persists on disk the keys that have been inserted using this BulkBuilder. Returns the
          * state of the underlying Sorter.
          */
-        virtual Sorter::PersistedState persistDataForShutdown() = 0;
+        virtual Sorter::PersistedState persistDataForShutdown(OperationContext* opCtx) = 0;
     };
 
     /**
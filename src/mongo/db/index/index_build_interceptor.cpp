@@ -33,6 +33,7 @@
 
 #include "mongo/db/index/index_build_interceptor.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "mongo/bson/bsonobj.h"
@@ -179,6 +180,10 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
         // table matters.
         std::vector<RecordId> recordsAddedToIndex;
 
+        // Decoded side writes accumulated for this batch. They are read in side-table order and
+        // applied to the index in KeyString order once the batch is full.
+        std::vector<DecodedSideWrite> batch;
+
         auto record = cursor->next();
         while (record) {
             opCtx->checkForInterrupt();
@@ -200,16 +205,7 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
             batchSize += 1;
             batchSizeBytes += objSize;
 
-            if (auto status = _applyWrite(opCtx,
-                                          coll,
-                                          unownedDoc,
-                                          options,
-                                          trackDuplicates,
-                                          &totalInserted,
-                                          &totalDeleted);
-                !status.isOK()) {
-                return status;
-            }
+            batch.push_back(_decodeSideWrite(unownedDoc));
 
             // Save the record ids of the documents inserted into the index for deletion later.
             // We can't delete records while holding a positioned cursor.
@@ -223,6 +219,20 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
             record = cursor->next();
         }
 
+        // Sort the decoded writes by KeyString so that the index is updated in key order, which
+        // gives sequential locality in the storage engine. The sort must be stable: operations on
+        // identical KeyStrings have to retain their original relative order so that only the last
+        // one determines the final state of that key.
+        std::stable_sort(batch.begin(), batch.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.keyString.compare(rhs.keyString) < 0;
+        });
+
+        if (auto status = _applySortedBatch(
+                opCtx, coll, batch, options, trackDuplicates, &totalInserted, &totalDeleted);
+            !status.isOK()) {
+            return status;
+        }
+
         // Delete documents from the side table as soon as they have been inserted into the index.
         // This ensures that no key is ever inserted twice and no keys are skipped.
         for (const auto& recordId : recordsAddedToIndex) {
@@ -280,67 +290,104 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
     return Status::OK();
 }
 
-Status IndexBuildInterceptor::_applyWrite(OperationContext* opCtx,
-                                          const CollectionPtr& coll,
-                                          const BSONObj& operation,
-                                          const InsertDeleteOptions& options,
-                                          TrackDuplicates trackDups,
-                                          int64_t* const keysInserted,
-                                          int64_t* const keysDeleted) {
+IndexBuildInterceptor::DecodedSideWrite IndexBuildInterceptor::_decodeSideWrite(
+    const BSONObj& operation) const {
     // Deserialize the encoded KeyString::Value.
     int keyLen;
     const char* binKey = operation["key"].binData(keyLen);
     BufReader reader(binKey, keyLen);
-    const KeyString::Value keyString = KeyString::Value::deserialize(
+    KeyString::Value keyString = KeyString::Value::deserialize(
         reader,
         _indexCatalogEntry->accessMethod()->getSortedDataInterface()->getKeyStringVersion());
 
-    const Op opType =
-        (strcmp(operation.getStringField("op"), "i") == 0) ? Op::kInsert : Op::kDelete;
+    const bool isInsert = strcmp(operation.getStringField("op"), "i") == 0;
+    if (kDebugBuild && !isInsert)
+        invariant(strcmp(operation.getStringField("op"), "d") == 0);
 
-    const KeyStringSet keySet{keyString};
-    const RecordId opRecordId =
-        KeyString::decodeRecordIdAtEnd(keyString.getBuffer(), keyString.getSize());
+    return {std::move(keyString), isInsert ? Op::kInsert : Op::kDelete};
+}
 
+Status IndexBuildInterceptor::_applySortedBatch(OperationContext* opCtx,
+                                                const CollectionPtr& coll,
+                                                const std::vector<DecodedSideWrite>& batch,
+                                                const InsertDeleteOptions& options,
+                                                TrackDuplicates trackDups,
+                                                int64_t* const keysInserted,
+                                                int64_t* const keysDeleted) {
     auto accessMethod = _indexCatalogEntry->accessMethod();
-    if (opType == Op::kInsert) {
-        int64_t numInserted;
-        auto status = accessMethod->insertKeysAndUpdateMultikeyPaths(
-            opCtx,
-            coll,
-            {keySet.begin(), keySet.end()},
-            {},
-            MultikeyPaths{},
-            opRecordId,
-            options,
-            [=](const KeyString::Value& duplicateKey) {
-                return trackDups == TrackDuplicates::kTrack
-                    ? recordDuplicateKey(opCtx, duplicateKey)
-                    : Status::OK();
-            },
-            &numInserted);
-        if (!status.isOK()) {
-            return status;
+
+    // Applies a run of same-type operations through a single multi-key call. 'runKeys' is sorted
+    // and duplicate-free, so the set can be constructed without re-sorting. Note that unlike the
+    // collection scan phase, a drained insert never contributes multikey information; multikey
+    // state for side writes is tracked separately when the write is intercepted.
+    std::vector<KeyString::Value> runKeys;
+    auto flushRun = [&](Op op) -> Status {
+        if (runKeys.empty()) {
+            return Status::OK();
+        }
+        KeyStringSet keys(boost::container::ordered_unique_range_t(),
+                          std::make_move_iterator(runKeys.begin()),
+                          std::make_move_iterator(runKeys.end()));
+        runKeys.clear();
+
+        // The RecordId each operation applies to is encoded at the end of its KeyString, so the
+        // explicit RecordId argument is unused.
+        if (op == Op::kInsert) {
+            int64_t numInserted;
+            auto status = accessMethod->insertKeys(
+                opCtx,
+                coll,
+                keys,
+                RecordId(),
+                options,
+                [=](const KeyString::Value& duplicateKey) {
+                    return trackDups == TrackDuplicates::kTrack
+                        ? recordDuplicateKey(opCtx, duplicateKey)
+                        : Status::OK();
+                },
+                &numInserted);
+            if (!status.isOK()) {
+                return status;
+            }
+
+            *keysInserted += numInserted;
+            opCtx->recoveryUnit()->onRollback(
+                [keysInserted, numInserted] { *keysInserted -= numInserted; });
+        } else {
+            int64_t numDeleted;
+            Status s = accessMethod->removeKeys(opCtx, keys, RecordId(), options, &numDeleted);
+            if (!s.isOK()) {
+                return s;
+            }
+
+            *keysDeleted += numDeleted;
+            opCtx->recoveryUnit()->onRollback(
+                [keysDeleted, numDeleted] { *keysDeleted -= numDeleted; });
+        }
+        return Status::OK();
+    };
+
+    boost::optional<Op> runOp;
+    for (size_t i = 0; i < batch.size(); i++) {
+        // When several operations target an identical KeyString, only the last one can affect the
+        // final state of that key: an insert superseded by a delete cancels out entirely, and a
+        // deleted-then-reinserted key only needs the reinsert. Inserts and removals of index keys
+        // are idempotent, so applying just the last operation is equivalent to applying them all.
+        if (i + 1 < batch.size() && batch[i].keyString.compare(batch[i + 1].keyString) == 0) {
+            continue;
         }
 
-        *keysInserted += numInserted;
-        opCtx->recoveryUnit()->onRollback(
-            [keysInserted, numInserted] { *keysInserted -= numInserted; });
-    } else {
-        invariant(opType == Op::kDelete);
-        if (kDebugBuild)
-            invariant(strcmp(operation.getStringField("op"), "d") == 0);
-
-        int64_t numDeleted;
-        Status s = accessMethod->removeKeys(
-            opCtx, {keySet.begin(), keySet.end()}, opRecordId, options, &numDeleted);
-        if (!s.isOK()) {
-            return s;
+        if (runOp && *runOp != batch[i].op) {
+            if (auto status = flushRun(*runOp); !status.isOK()) {
+                return status;
+            }
         }
+        runOp = batch[i].op;
+        runKeys.push_back(batch[i].keyString);
+    }
 
-        *keysDeleted += numDeleted;
-        opCtx->recoveryUnit()->onRollback(
-            [keysDeleted, numDeleted] { *keysDeleted -= numDeleted; });
+    if (runOp) {
+        return flushRun(*runOp);
     }
     return Status::OK();
 }
@@ -175,14 +175,27 @@ public:
 private:
     using SideWriteRecord = std::pair<RecordId, BSONObj>;
 
+    // A side-table entry decoded into the KeyString it applies to.
+    struct DecodedSideWrite {
+        KeyString::Value keyString;
+        Op op;
+    };
 
-    Status _applyWrite(OperationContext* opCtx,
-                       const CollectionPtr& coll,
-                       const BSONObj& doc,
-                       const InsertDeleteOptions& options,
-                       TrackDuplicates trackDups,
-                       int64_t* const keysInserted,
-                       int64_t* const keysDeleted);
+    DecodedSideWrite _decodeSideWrite(const BSONObj& operation) const;
+
+    /**
+     * Applies a drained batch of side writes, sorted by KeyString, to the index. Consecutive
+     * operations of the same type are applied through a single multi-key insert or remove call,
+     * and when several operations target an identical KeyString only the last one is applied,
+     * since the earlier ones cannot affect the final state of that key.
+     */
+    Status _applySortedBatch(OperationContext* opCtx,
+                             const CollectionPtr& coll,
+                             const std::vector<DecodedSideWrite>& batch,
+                             const InsertDeleteOptions& options,
+                             TrackDuplicates trackDups,
+                             int64_t* const keysInserted,
+                             int64_t* const keysDeleted);
 
     /**
      * Yield lock manager locks and abandon the current storage engine snapshot.
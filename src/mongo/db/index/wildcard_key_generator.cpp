@@ -104,6 +104,8 @@ WildcardKeyGenerator::WildcardKeyGenerator(BSONObj keyPattern,
     : _proj(createProjectionExecutor(keyPattern, pathProjection)),
       _collator(collator),
       _keyPattern(keyPattern),
+      _projExcludesIdOnly(pathProjection.isEmpty() &&
+                          keyPattern.firstElement().fieldNameStringData() == "$**"_sd),
       _keyStringVersion(keyStringVersion),
       _ordering(ordering) {}
 
@@ -118,8 +120,15 @@ void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBuffe
     KeyStringSet::sequence_type multikeyPathsSequence;
     if (multikeyPaths)
         multikeyPathsSequence = multikeyPaths->extract_sequence();
+    // When the projection is the default {_id: 0} exclusion, strip the top-level _id field
+    // directly. This avoids materializing the document, walking the projection executor and
+    // re-serializing the result — a fixed per-document cost that dominates key generation for
+    // small documents.
+    auto projectedDoc = _projExcludesIdOnly
+        ? (inputDoc.hasField("_id"_sd) ? inputDoc.removeField("_id"_sd) : inputDoc)
+        : _proj.exec()->applyTransformation(Document{inputDoc}).toBson();
     _traverseWildcard(pooledBufferBuilder,
-                      _proj.exec()->applyTransformation(Document{inputDoc}).toBson(),
+                      projectedDoc,
                       false,
                       &rootPath,
                       &keysSequence,
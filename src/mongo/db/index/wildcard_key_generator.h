@@ -116,6 +116,11 @@ private:
     WildcardProjection _proj;
     const CollatorInterface* _collator;
     const BSONObj _keyPattern;
+
+    // True if '_proj' is the default {_id: 0} exclusion of an all-paths index. In that case
+    // generateKeys() strips the top-level _id field directly instead of funnelling every document
+    // through the projection executor.
+    const bool _projExcludesIdOnly;
     const KeyString::Version _keyStringVersion;
     const Ordering _ordering;
 };
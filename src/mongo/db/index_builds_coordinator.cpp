@@ -33,12 +33,14 @@
 
 #include "mongo/db/index_builds_coordinator.h"
 
+#include "mongo/base/counter.h"
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/commit_quorum_options.h"
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/index_build_entry_gen.h"
 #include "mongo/db/catalog/uncommitted_collections.h"
 #include "mongo/db/catalog_raii.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/locker.h"
 #include "mongo/db/concurrency/replication_state_transition_lock_guard.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
@@ -95,6 +97,16 @@ constexpr StringData kIndexesFieldName = "indexes"_sd;
 constexpr StringData kKeyFieldName = "key"_sd;
 constexpr StringData kUniqueFieldName = "unique"_sd;
 
+// Tracks how startup recovery handled interrupted two-phase index builds, so operators doing
+// rolling maintenance can confirm builds resumed from their checkpoint rather than re-scanning
+// the collection.
+Counter64 resumedIndexBuilds;
+Counter64 restartedIndexBuilds;
+ServerStatusMetricField<Counter64> displayResumedIndexBuilds("indexBuilds.resumed",
+                                                             &resumedIndexBuilds);
+ServerStatusMetricField<Counter64> displayRestartedIndexBuilds("indexBuilds.restarted",
+                                                               &restartedIndexBuilds);
+
 /**
  * Checks if unique index specification is compatible with sharding configuration.
  */
@@ -1367,6 +1379,7 @@ void IndexBuildsCoordinator::restartIndexBuildsForRecovery(
             MONGO_COMPILER_VARIABLE_UNUSED auto fut = uassertStatusOK(resumeIndexBuild(
                 opCtx, nss->db().toString(), collUUID, indexSpecs, buildUUID, resumeInfo));
             successfullyResumed.insert(buildUUID);
+            resumedIndexBuilds.increment();
         } catch (const DBException& e) {
             LOGV2(4841701,
                   "Index build: failed to resume, restarting instead",
@@ -1419,6 +1432,7 @@ void IndexBuildsCoordinator::restartIndexBuildsForRecovery(
               "buildUUID"_attr = buildUUID,
               "collectionUUID"_attr = build.collUUID,
               logAttrs(nss.get()));
+        restartedIndexBuilds.increment();
         IndexBuildsCoordinator::IndexBuildOptions indexBuildOptions;
         // Indicate that the initialization should not generate oplog entries or timestamps for the
         // first catalog write, and that the original durable catalog entries should be dropped and
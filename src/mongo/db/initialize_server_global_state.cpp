@@ -357,6 +357,7 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
         lv2Config.fileOpenMode = serverGlobalParams.logAppend
             ? logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kAppend
             : logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kTruncate;
+        lv2Config.asyncEnabled = serverGlobalParams.logAsync;
 
         if (serverGlobalParams.logAppend && exists) {
             writeServerRestartedAfterLogConfig = true;
@@ -63,7 +63,8 @@ LogicalSessionCacheImpl::LogicalSessionCacheImpl(std::unique_ptr<ServiceLiaison>
                                                  ReapSessionsOlderThanFn reapSessionsOlderThanFn)
     : _service(std::move(service)),
       _sessionsColl(std::move(collection)),
-      _reapSessionsOlderThanFn(std::move(reapSessionsOlderThanFn)) {
+      _reapSessionsOlderThanFn(std::move(reapSessionsOlderThanFn)),
+      _activeSessions(std::make_unique<ActiveSessionsMap>()) {
     _stats.setLastSessionsCollectionJobTimestamp(_service->now());
     _stats.setLastTransactionReaperJobTimestamp(_service->now());
 
@@ -88,15 +89,16 @@ void LogicalSessionCacheImpl::joinOnShutDown() {
 
 Status LogicalSessionCacheImpl::startSession(OperationContext* opCtx,
                                              const LogicalSessionRecord& record) {
-    stdx::lock_guard lg(_mutex);
-    return _addToCacheIfNotFull(lg, record);
+    auto partition = _activeSessions->lockOnePartition(record.getId());
+    return _addToCacheIfNotFull(partition, record);
 }
 
 Status LogicalSessionCacheImpl::vivify(OperationContext* opCtx, const LogicalSessionId& lsid) {
-    stdx::lock_guard lg(_mutex);
-    auto it = _activeSessions.find(lsid);
-    if (it == _activeSessions.end())
-        return _addToCacheIfNotFull(lg, makeLogicalSessionRecord(opCtx, lsid, _service->now()));
+    auto partition = _activeSessions->lockOnePartition(lsid);
+    auto it = partition->find(lsid);
+    if (it == partition->end())
+        return _addToCacheIfNotFull(partition,
+                                    makeLogicalSessionRecord(opCtx, lsid, _service->now()));
 
     auto& cacheEntry = it->second;
     cacheEntry.setLastUse(_service->now());
@@ -118,8 +120,7 @@ void LogicalSessionCacheImpl::reapNow(OperationContext* opCtx) {
 }
 
 size_t LogicalSessionCacheImpl::size() {
-    stdx::lock_guard<Latch> lock(_mutex);
-    return _activeSessions.size();
+    return _activeSessions->size();
 }
 
 void LogicalSessionCacheImpl::_periodicRefresh(Client* client) {
@@ -281,7 +282,19 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         using std::swap;
         stdx::lock_guard<Latch> lk(_mutex);
         swap(explicitlyEndingSessions, _endingSessions);
-        swap(activeSessions, _activeSessions);
+    }
+
+    // Drain the active sessions partition by partition. Sessions vivified after a partition is
+    // drained simply become part of the next refresh round.
+    {
+        auto allPartitions = _activeSessions->lockAllPartitions();
+        for (auto&& partition : allPartitions) {
+            for (auto&& entry : partition) {
+                activeSessions.emplace(entry.first, std::move(entry.second));
+            }
+            partition.clear();
+        }
+        _numActiveSessions.store(0);
     }
 
     // Create guards that in the case of a exception replace the ending or active sessions that
@@ -295,7 +308,16 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
             member.emplace(it);
         }
     };
-    auto activeSessionsBackSwapper = makeGuard([&] { backSwap(_activeSessions, activeSessions); });
+    auto activeSessionsBackSwapper = makeGuard([&] {
+        // Put the drained records back. Records vivified since the drain are already in place and
+        // take precedence, since their last-use times are more recent.
+        for (const auto& it : activeSessions) {
+            auto partition = _activeSessions->lockOnePartition(it.first);
+            if (partition->emplace(it.first, it.second).second) {
+                _numActiveSessions.addAndFetch(1);
+            }
+        }
+    });
     auto explicitlyEndingBackSwaper =
         makeGuard([&] { backSwap(_endingSessions, explicitlyEndingSessions); });
 
@@ -345,12 +367,13 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     // Exclude sessions added to _activeSessions from the openCursorSession to avoid race between
     // killing cursors on the removed sessions and creating sessions.
     {
-        stdx::lock_guard<Latch> lk(_mutex);
-
-        for (const auto& it : _activeSessions) {
-            auto newSessionIt = openCursorSessions.find(it.first);
-            if (newSessionIt != openCursorSessions.end()) {
-                openCursorSessions.erase(newSessionIt);
+        auto allPartitions = _activeSessions->lockAllPartitions();
+        for (auto&& partition : allPartitions) {
+            for (auto&& entry : partition) {
+                auto newSessionIt = openCursorSessions.find(entry.first);
+                if (newSessionIt != openCursorSessions.end()) {
+                    openCursorSessions.erase(newSessionIt);
+                }
             }
         }
     }
@@ -385,13 +408,19 @@ void LogicalSessionCacheImpl::endSessions(const LogicalSessionIdSet& sessions) {
 }
 
 LogicalSessionCacheStats LogicalSessionCacheImpl::getStats() {
+    // Compute the active sessions count before taking '_mutex' so that the partition locks are
+    // never nested within it.
+    const auto activeSessionsCount = _activeSessions->size();
+
     stdx::lock_guard<Latch> lk(_mutex);
-    _stats.setActiveSessionsCount(_activeSessions.size());
+    _stats.setActiveSessionsCount(activeSessionsCount);
     return _stats;
 }
 
-Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRecord record) {
-    if (_activeSessions.size() >= size_t(maxSessions)) {
+Status LogicalSessionCacheImpl::_addToCacheIfNotFull(ActiveSessionsMap::OnePartition& partition,
+                                                     LogicalSessionRecord record) {
+    const auto numActiveSessions = _numActiveSessions.load();
+    if (numActiveSessions >= static_cast<long long>(maxSessions)) {
         Status status = {ErrorCodes::TooManyLogicalSessions,
                          str::stream()
                              << "Unable to add session ID " << record.getId()
@@ -407,34 +436,40 @@ Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRec
                     "{sessionCount}, maximum: {maxSessions}",
                     "Unable to add session into the cache, too many active sessions",
                     "sessionId"_attr = record.getId(),
-                    "sessionCount"_attr = _activeSessions.size(),
+                    "sessionCount"_attr = numActiveSessions,
                     "maxSessions"_attr = maxSessions);
         return status;
     }
 
-    _activeSessions.insert(std::make_pair(record.getId(), std::move(record)));
+    if (partition->insert(std::make_pair(record.getId(), std::move(record))).second) {
+        _numActiveSessions.addAndFetch(1);
+    }
 
     return Status::OK();
 }
 
 std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds() const {
-    stdx::lock_guard<Latch> lk(_mutex);
+    auto allPartitions = _activeSessions->lockAllPartitions();
     std::vector<LogicalSessionId> ret;
-    ret.reserve(_activeSessions.size());
-    for (const auto& id : _activeSessions) {
-        ret.push_back(id.first);
+    ret.reserve(allPartitions.size());
+    for (auto&& partition : allPartitions) {
+        for (const auto& entry : partition) {
+            ret.push_back(entry.first);
+        }
     }
     return ret;
 }
 
 std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds(
     const std::vector<SHA256Block>& userDigests) const {
-    stdx::lock_guard<Latch> lk(_mutex);
+    auto allPartitions = _activeSessions->lockAllPartitions();
     std::vector<LogicalSessionId> ret;
-    for (const auto& it : _activeSessions) {
-        if (std::find(userDigests.cbegin(), userDigests.cend(), it.first.getUid()) !=
-            userDigests.cend()) {
-            ret.push_back(it.first);
+    for (auto&& partition : allPartitions) {
+        for (const auto& entry : partition) {
+            if (std::find(userDigests.cbegin(), userDigests.cend(), entry.first.getUid()) !=
+                userDigests.cend()) {
+                ret.push_back(entry.first);
+            }
         }
     }
     return ret;
@@ -442,9 +477,9 @@ std::vector<LogicalSessionId> LogicalSessionCacheImpl::listIds(
 
 boost::optional<LogicalSessionRecord> LogicalSessionCacheImpl::peekCached(
     const LogicalSessionId& id) const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    const auto it = _activeSessions.find(id);
-    if (it == _activeSessions.end()) {
+    auto partition = _activeSessions->lockOnePartition(id);
+    const auto it = partition->find(id);
+    if (it == partition->end()) {
         return boost::none;
     }
     return it->second;
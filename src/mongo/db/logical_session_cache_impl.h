@@ -29,15 +29,20 @@
 
 #pragma once
 
+#include "mongo/db/catalog/util/partitioned.h"
 #include "mongo/db/logical_session_cache.h"
 #include "mongo/db/service_liaison.h"
 #include "mongo/db/sessions_collection.h"
-#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/functional.h"
 #include "mongo/util/hierarchical_acquisition.h"
 
 namespace mongo {
 
+inline std::size_t partitionOf(const LogicalSessionId& lsid, const std::size_t nPartitions) {
+    return LogicalSessionIdHash{}(lsid) % nPartitions;
+}
+
 /**
  * A thread-safe cache structure for logical session records.
  *
@@ -101,16 +106,26 @@ private:
      */
     bool _isDead(const LogicalSessionRecord& record, Date_t now) const;
 
-    Status _addToCacheIfNotFull(WithLock, LogicalSessionRecord record);
+    using ActiveSessionsMap = Partitioned<LogicalSessionIdMap<LogicalSessionRecord>>;
+
+    Status _addToCacheIfNotFull(ActiveSessionsMap::OnePartition& partition,
+                                LogicalSessionRecord record);
 
     const std::unique_ptr<ServiceLiaison> _service;
     const std::shared_ptr<SessionsCollection> _sessionsColl;
     const ReapSessionsOlderThanFn _reapSessionsOlderThanFn;
 
+    // Guards '_endingSessions' and '_stats'. The active sessions live in their own partitioned
+    // map so that vivification on one session does not serialize behind vivification on another;
+    // never acquire a partition lock while holding '_mutex' or vice versa.
     mutable Mutex _mutex =
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "LogicalSessionCacheImpl::_mutex");
 
-    LogicalSessionIdMap<LogicalSessionRecord> _activeSessions;
+    std::unique_ptr<ActiveSessionsMap> _activeSessions;
+
+    // Approximate count of entries in '_activeSessions', maintained so the cache-full check in
+    // vivification does not need to visit every partition.
+    AtomicWord<long long> _numActiveSessions{0};
 
     LogicalSessionIdSet _endingSessions;
 
@@ -389,6 +389,8 @@ std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
     next->_hasEmptyArray = _hasEmptyArray;
     next->_equalitySet = _equalitySet;
     next->_originalEqualityVector = _originalEqualityVector;
+    // The clone must hash with its own comparator rather than share ours, which it may outlive.
+    next->_buildEqualityHashSet();
     for (auto&& regex : _regexes) {
         std::unique_ptr<RegexMatchExpression> clonedRegex(
             static_cast<RegexMatchExpression*>(regex->shallowClone().release()));
@@ -397,7 +399,20 @@ std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
     return next;
 }
 
+void InMatchExpression::_buildEqualityHashSet() {
+    if (_equalitySet.size() < kMinEqualitiesForHashSet) {
+        _equalityHashSet = boost::none;
+        return;
+    }
+    _equalityHashSet.emplace(_eltCmp.makeBSONEltUnorderedSet());
+    _equalityHashSet->reserve(_equalitySet.size());
+    _equalityHashSet->insert(_equalitySet.begin(), _equalitySet.end());
+}
+
 bool InMatchExpression::contains(const BSONElement& e) const {
+    if (_equalityHashSet) {
+        return _equalityHashSet->count(e) > 0;
+    }
     return std::binary_search(_equalitySet.begin(), _equalitySet.end(), e, _eltCmp.makeLessThan());
 }
 
@@ -509,6 +524,7 @@ void InMatchExpression::_doSetCollator(const CollatorInterface* collator) {
                      _originalEqualityVector.end(),
                      std::back_inserter(_equalitySet),
                      _eltCmp.makeEqualTo());
+    _buildEqualityHashSet();
 }
 
 Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
@@ -542,6 +558,7 @@ Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
                      _originalEqualityVector.end(),
                      std::back_inserter(_equalitySet),
                      _eltCmp.makeEqualTo());
+    _buildEqualityHashSet();
 
     return Status::OK();
 }
@@ -604,8 +604,19 @@ public:
     }
 
 private:
+    // Equality sets this large or larger are additionally indexed in '_equalityHashSet' so that
+    // contains() costs a single hash probe instead of O(log n) BSON comparisons. Smaller sets
+    // stay with binary search over '_equalitySet', where building and probing a hash table does
+    // not pay for itself.
+    static constexpr size_t kMinEqualitiesForHashSet = 8;
+
     ExpressionOptimizerFunc getOptimizer() const final;
 
+    // Recomputes '_equalityHashSet' from '_equalitySet'. Must be called whenever '_equalitySet'
+    // or '_eltCmp' changes, since the hash set's hasher and equality predicate are keyed off
+    // '_eltCmp'.
+    void _buildEqualityHashSet();
+
     // Whether or not '_equalities' has a jstNULL element in it.
     bool _hasNull = false;
 
@@ -625,14 +636,17 @@ private:
     // enables a fast-path to avoid re-sorting if the expression is serialized and re-parsed.
     std::vector<BSONElement> _originalEqualityVector;
 
-    // Deduped set of equality elements associated with this expression. Kept in sorted order to
-    // support std::binary_search. Because we need to sort the elements anyway for things like index
-    // bounds building, using binary search avoids the overhead of inserting into a hash table which
-    // doesn't pay for itself in the common case where lookups are done a few times if ever.
-    // TODO It may be worth dynamically creating a hashset after matchesSingleElement() has been
-    // called "many" times.
+    // Deduped set of equality elements associated with this expression. Kept in sorted order
+    // because index bounds building and serialization need the elements sorted anyway, and to
+    // support std::binary_search in contains() for small sets.
     std::vector<BSONElement> _equalitySet;
 
+    // Hashed view of '_equalitySet', present only once the set reaches
+    // 'kMinEqualitiesForHashSet' elements. It holds a pointer to '_eltCmp' for hashing and
+    // equality, so it honors the collation and ignores field names, and it must be rebuilt
+    // whenever '_eltCmp' is replaced.
+    boost::optional<BSONEltUnorderedSet> _equalityHashSet;
+
     // Container of regex elements this object owns.
     std::vector<std::unique_ptr<RegexMatchExpression>> _regexes;
 };
@@ -1370,6 +1370,48 @@ TEST(InMatchExpression, ChangingCollationAfterAddingEqualitiesPreservesEqualitie
     ASSERT(in.contains(obj2.firstElement()));
 }
 
+// Large equality sets take a hashed lookup path in contains(); make sure membership still behaves
+// the same on both sides of the threshold.
+TEST(InMatchExpression, MatchesWithLargeNumberOfEqualities) {
+    BSONArrayBuilder bab;
+    for (int i = 0; i < 100; ++i) {
+        bab.append(i);
+    }
+    BSONArray operand = bab.arr();
+    InMatchExpression in("a");
+    std::vector<BSONElement> equalities;
+    for (auto&& elt : operand) {
+        equalities.push_back(elt);
+    }
+    ASSERT_OK(in.setEqualities(std::move(equalities)));
+    ASSERT(in.matchesBSON(BSON("a" << 0)));
+    ASSERT(in.matchesBSON(BSON("a" << 42)));
+    ASSERT(in.matchesBSON(BSON("a" << 99.0)));
+    ASSERT(!in.matchesBSON(BSON("a" << 100)));
+    ASSERT(!in.matchesBSON(BSON("a"
+                                << "42")));
+}
+
+TEST(InMatchExpression, LargeEqualitySetRespectsCollationAfterCollatorChange) {
+    BSONArrayBuilder bab;
+    for (int i = 0; i < 100; ++i) {
+        bab.append("string" + std::to_string(i));
+    }
+    BSONArray operand = bab.arr();
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kAlwaysEqual);
+    InMatchExpression in("a");
+    std::vector<BSONElement> equalities;
+    for (auto&& elt : operand) {
+        equalities.push_back(elt);
+    }
+    ASSERT_OK(in.setEqualities(std::move(equalities)));
+    ASSERT(!in.matchesBSON(BSON("a"
+                                << "other")));
+    in.setCollator(&collator);
+    ASSERT(in.matchesBSON(BSON("a"
+                               << "other")));
+}
+
 std::vector<uint32_t> bsonArrayToBitPositions(const BSONArray& ba) {
     std::vector<uint32_t> bitPositions;
 
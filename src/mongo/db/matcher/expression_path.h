@@ -53,6 +53,22 @@ public:
 
     virtual ~PathMatchExpression() {}
 
+    bool matchesBSON(const BSONObj& doc, MatchDetails* details = nullptr) const final {
+        // Fast path for a single-component path: look the field up directly in the raw object.
+        // Unless the value is an array, the ElementPath iterator would yield exactly this element
+        // (including EOO when the field is missing), so we can match it without constructing a
+        // MatchableDocument and an iterator. Arrays fall back to the iterator, which implements
+        // the implicit array traversal semantics. This is the hot path for collection scan
+        // filters and oplog application, which match raw BSON with mostly top-level predicates.
+        if (_elementPath.fieldRef().numParts() == 1) {
+            auto element = doc.getField(_elementPath.fieldRef().getPart(0));
+            if (element.type() != BSONType::Array) {
+                return matchesSingleElement(element, details);
+            }
+        }
+        return MatchExpression::matchesBSON(doc, details);
+    }
+
     bool matches(const MatchableDocument* doc, MatchDetails* details = nullptr) const final {
         MatchableDocument::IteratorHolder cursor(doc, &_elementPath);
         while (cursor->more()) {
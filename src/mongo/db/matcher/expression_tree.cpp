@@ -205,6 +205,21 @@ bool AndMatchExpression::matches(const MatchableDocument* doc, MatchDetails* det
     return true;
 }
 
+bool AndMatchExpression::matchesBSON(const BSONObj& doc, MatchDetails* details) const {
+    // Dispatch the children through matchesBSON() rather than wrapping 'doc' in a
+    // MatchableDocument up front, so that path children with a raw-BSON fast path can use it.
+    // $and is the canonical root of a parsed filter, so this covers the common case of a
+    // conjunction of simple predicates evaluated against raw BSON.
+    for (size_t i = 0; i < numChildren(); i++) {
+        if (!getChild(i)->matchesBSON(doc, details)) {
+            if (details)
+                details->resetOutput();
+            return false;
+        }
+    }
+    return true;
+}
+
 bool AndMatchExpression::matchesSingleElement(const BSONElement& e, MatchDetails* details) const {
     for (size_t i = 0; i < numChildren(); i++) {
         if (!getChild(i)->matchesSingleElement(e, details)) {
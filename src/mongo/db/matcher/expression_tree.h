@@ -120,6 +120,8 @@ public:
 
     virtual bool matches(const MatchableDocument* doc, MatchDetails* details = nullptr) const;
 
+    bool matchesBSON(const BSONObj& doc, MatchDetails* details = nullptr) const final;
+
     bool matchesSingleElement(const BSONElement&, MatchDetails* details = nullptr) const final;
 
     virtual std::unique_ptr<MatchExpression> shallowClone() const {
@@ -33,6 +33,7 @@
 
 #include "mongo/db/mirror_maestro.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <utility>
@@ -45,6 +46,7 @@
 #include "mongo/db/client_out_of_line_executor.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/commands/server_status.h"
+#include "mongo/db/curop.h"
 #include "mongo/db/mirror_maestro_gen.h"
 #include "mongo/db/mirroring_sampler.h"
 #include "mongo/db/repl/hello_response.h"
@@ -72,6 +74,7 @@ constexpr auto kMirroredReadsSeenKey = "seen"_sd;
 constexpr auto kMirroredReadsSentKey = "sent"_sd;
 constexpr auto kMirroredReadsResolvedKey = "resolved"_sd;
 constexpr auto kMirroredReadsResolvedBreakdownKey = "resolvedBreakdown"_sd;
+constexpr auto kMirroredReadsComparisonKey = "comparison"_sd;
 
 MONGO_FAIL_POINT_DEFINE(mirrorMaestroExpectsResponse);
 
@@ -89,8 +92,13 @@ public:
 
     /**
      * Mirror only if this maestro has been initialized
+     *
+     * The primary's latency and response size for the original execution are carried along so
+     * they can be compared against the mirrored responses when 'compareResponses' is on.
      */
-    void tryMirror(std::shared_ptr<CommandInvocation> invocation) noexcept;
+    void tryMirror(std::shared_ptr<CommandInvocation> invocation,
+                   Microseconds primaryLatency,
+                   int primaryResponseLength) noexcept;
 
     /**
      * Maintains the state required for mirroring requests.
@@ -100,17 +108,21 @@ public:
         MirroredRequestState(MirrorMaestroImpl* maestro,
                              std::vector<HostAndPort> hosts,
                              std::shared_ptr<CommandInvocation> invocation,
-                             MirroredReadsParameters params)
+                             MirroredReadsParameters params,
+                             Microseconds primaryLatency,
+                             int primaryResponseLength)
             : _maestro(std::move(maestro)),
               _hosts(std::move(hosts)),
               _invocation(std::move(invocation)),
-              _params(std::move(params)) {}
+              _params(std::move(params)),
+              _primaryLatency(primaryLatency),
+              _primaryResponseLength(primaryResponseLength) {}
 
         MirroredRequestState() = delete;
 
         void mirror() noexcept {
             invariant(_maestro);
-            _maestro->_mirror(_hosts, _invocation, _params);
+            _maestro->_mirror(_hosts, _invocation, _params, _primaryLatency, _primaryResponseLength);
         }
 
     private:
@@ -118,6 +130,8 @@ public:
         std::vector<HostAndPort> _hosts;
         std::shared_ptr<CommandInvocation> _invocation;
         MirroredReadsParameters _params;
+        Microseconds _primaryLatency;
+        int _primaryResponseLength;
     };
 
 private:
@@ -128,7 +142,9 @@ private:
      */
     void _mirror(const std::vector<HostAndPort>& hosts,
                  std::shared_ptr<CommandInvocation> invocation,
-                 const MirroredReadsParameters& params) noexcept;
+                 const MirroredReadsParameters& params,
+                 Microseconds primaryLatency,
+                 int primaryResponseLength) noexcept;
 
     /**
      * An enum detailing the liveness of the Maestro
@@ -187,6 +203,8 @@ public:
             section.append(kMirroredReadsResolvedBreakdownKey, resolvedBreakdown.toBSON());
         }
 
+        section.append(kMirroredReadsComparisonKey, comparator.toBSON());
+
         return section.obj();
     };
 
@@ -222,7 +240,70 @@ public:
         stdx::unordered_map<std::string, CounterT> _resolved;
     };
 
+    /**
+     * Compares mirrored responses against the primary's original execution when the
+     * 'compareResponses' parameter is on. Maintains a coarse histogram of how much slower (or
+     * faster) the mirrored read was, and counts responses whose size differed from the
+     * primary's. Response envelopes differ between primary and secondary, so the size counter
+     * is a coarse divergence signal rather than an exact comparison.
+     */
+    class ResponseComparator {
+    public:
+        void onResponse(Microseconds primaryLatency,
+                        Microseconds mirroredLatency,
+                        bool sizesDiverged) noexcept {
+            stdx::lock_guard<Mutex> lk(_mutex);
+
+            _compared++;
+            if (sizesDiverged) {
+                _sizeDivergence++;
+            }
+
+            const auto diff = mirroredLatency - primaryLatency;
+            if (diff <= Microseconds{0}) {
+                _mirroredFaster++;
+            } else if (diff < Milliseconds{1}) {
+                _slowerLessThan1ms++;
+            } else if (diff < Milliseconds{10}) {
+                _slowerLessThan10ms++;
+            } else if (diff < Milliseconds{100}) {
+                _slowerLessThan100ms++;
+            } else {
+                _slowerAtLeast100ms++;
+            }
+        }
+
+        BSONObj toBSON() const noexcept {
+            stdx::lock_guard<Mutex> lk(_mutex);
+
+            BSONObjBuilder bob;
+            bob.append("compared", _compared);
+            bob.append("sizeDivergence", _sizeDivergence);
+            {
+                BSONObjBuilder diffBob(bob.subobjStart("latencyDiff"));
+                diffBob.append("mirroredFaster", _mirroredFaster);
+                diffBob.append("slowerLessThan1ms", _slowerLessThan1ms);
+                diffBob.append("slowerLessThan10ms", _slowerLessThan10ms);
+                diffBob.append("slowerLessThan100ms", _slowerLessThan100ms);
+                diffBob.append("slowerAtLeast100ms", _slowerAtLeast100ms);
+            }
+            return bob.obj();
+        }
+
+    private:
+        mutable Mutex _mutex = MONGO_MAKE_LATCH("MirroredReadsSection::ResponseComparator"_sd);
+
+        CounterT _compared = 0;
+        CounterT _sizeDivergence = 0;
+        CounterT _mirroredFaster = 0;
+        CounterT _slowerLessThan1ms = 0;
+        CounterT _slowerLessThan10ms = 0;
+        CounterT _slowerLessThan100ms = 0;
+        CounterT _slowerAtLeast100ms = 0;
+    };
+
     ResolvedBreakdownByHost resolvedBreakdown;
+    ResponseComparator comparator;
 
     AtomicWord<CounterT> seen;
     AtomicWord<CounterT> sent;
@@ -285,10 +366,16 @@ void MirrorMaestro::tryMirrorRequest(OperationContext* opCtx) noexcept {
 
     auto invocation = CommandInvocation::get(opCtx);
 
-    impl.tryMirror(std::move(invocation));
+    // This hook runs after the command has finished, so the elapsed time and response length
+    // describe the primary's execution of the original request.
+    auto* curOp = CurOp::get(opCtx);
+    impl.tryMirror(
+        std::move(invocation), curOp->elapsedTimeExcludingPauses(), curOp->debug().responseLength);
 }
 
-void MirrorMaestroImpl::tryMirror(std::shared_ptr<CommandInvocation> invocation) noexcept {
+void MirrorMaestroImpl::tryMirror(std::shared_ptr<CommandInvocation> invocation,
+                                  Microseconds primaryLatency,
+                                  int primaryResponseLength) noexcept {
     if (!_isInitialized.load()) {
         // If we're not even available, nothing to do
         return;
@@ -308,6 +395,14 @@ void MirrorMaestroImpl::tryMirror(std::shared_ptr<CommandInvocation> invocation)
         return;
     }
 
+    if (auto&& targetNss = params.getTargetNamespaces(); targetNss && !targetNss->empty()) {
+        // Targeted mirroring is on: only mirror reads on the configured namespaces.
+        const auto ns = invocation->ns().ns();
+        if (std::find(targetNss->begin(), targetNss->end(), ns) == targetNss->end()) {
+            return;
+        }
+    }
+
     auto imr = _topologyVersionObserver.getCached();
     auto samplingParams = MirroringSampler::SamplingParameters(params.getSamplingRate());
     if (!_sampler.shouldSample(imr, samplingParams)) {
@@ -328,8 +423,12 @@ void MirrorMaestroImpl::tryMirror(std::shared_ptr<CommandInvocation> invocation)
     // There is the potential to actually mirror requests, so schedule the _mirror() invocation
     // out-of-line. This means the command itself can return quickly and we do the arduous work of
     // building new bsons and evaluating randomness in a less important context.
-    auto requestState = std::make_unique<MirroredRequestState>(
-        this, std::move(hosts), std::move(invocation), std::move(params));
+    auto requestState = std::make_unique<MirroredRequestState>(this,
+                                                               std::move(hosts),
+                                                               std::move(invocation),
+                                                               std::move(params),
+                                                               primaryLatency,
+                                                               primaryResponseLength);
     ExecutorFuture(_executor)  //
         .getAsync([clientExecutorHandle,
                    requestState = std::move(requestState)](const auto& status) mutable {
@@ -344,7 +443,9 @@ void MirrorMaestroImpl::tryMirror(std::shared_ptr<CommandInvocation> invocation)
 
 void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
                                 std::shared_ptr<CommandInvocation> invocation,
-                                const MirroredReadsParameters& params) noexcept try {
+                                const MirroredReadsParameters& params,
+                                Microseconds primaryLatency,
+                                int primaryResponseLength) noexcept try {
     auto payload = [&] {
         BSONObjBuilder bob;
 
@@ -367,38 +468,60 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
         return bob.obj();
     }();
 
-    // Mirror to a normalized subset of eligible hosts (i.e., secondaries).
+    const bool expectsResponse =
+        params.getCompareResponses() || MONGO_unlikely(mirrorMaestroExpectsResponse.shouldFail());
+
+    // Mirror to a normalized subset of eligible hosts (i.e., secondaries). The amplification
+    // factor repeats the send, wrapping around the eligible hosts, so capacity tests can push
+    // more than one mirrored copy per sampled read.
     const auto startIndex = rand() % hosts.size();
-    const auto mirroringFactor = std::ceil(params.getSamplingRate() * hosts.size());
+    const auto mirroringFactor =
+        std::ceil(params.getSamplingRate() * hosts.size()) * params.getAmplificationFactor();
 
     for (auto i = 0; i < mirroringFactor; i++) {
         auto& host = hosts[(startIndex + i) % hosts.size()];
-        auto mirrorResponseCallback = [host](auto& args) {
-            if (MONGO_likely(!mirrorMaestroExpectsResponse.shouldFail())) {
-                // If we don't expect responses, then there is nothing to do here
-                return;
-            }
-
-            if (ErrorCodes::isRetriableError(args.response.status)) {
-                LOGV2_WARNING(5089200,
-                              "Received mirroring response with a retriable failure",
-                              "error"_attr = args.response);
-                return;
-            } else if (!args.response.isOK()) {
-                LOGV2_FATAL(4717301,
-                            "Received mirroring response with a non-okay status",
-                            "error"_attr = args.response);
-            }
-
-            gMirroredReadsSection.resolved.fetchAndAdd(1);
-            gMirroredReadsSection.resolvedBreakdown.onResponseReceived(host);
-            LOGV2_DEBUG(
-                31457, 4, "Response received", "host"_attr = host, "response"_attr = args.response);
-        };
+        auto mirrorResponseCallback =
+            [host, expectsResponse, primaryLatency, primaryResponseLength](auto& args) {
+                if (MONGO_likely(!expectsResponse)) {
+                    // If we don't expect responses, then there is nothing to do here
+                    return;
+                }
+
+                if (ErrorCodes::isRetriableError(args.response.status)) {
+                    LOGV2_WARNING(5089200,
+                                  "Received mirroring response with a retriable failure",
+                                  "error"_attr = args.response);
+                    return;
+                } else if (!args.response.isOK()) {
+                    if (MONGO_unlikely(mirrorMaestroExpectsResponse.shouldFail())) {
+                        LOGV2_FATAL(4717301,
+                                    "Received mirroring response with a non-okay status",
+                                    "error"_attr = args.response);
+                    }
+                    LOGV2_WARNING(5837131,
+                                  "Received mirroring response with a non-okay status",
+                                  "error"_attr = args.response);
+                    return;
+                }
+
+                gMirroredReadsSection.resolved.fetchAndAdd(1);
+                gMirroredReadsSection.resolvedBreakdown.onResponseReceived(host);
+                if (args.response.elapsed) {
+                    gMirroredReadsSection.comparator.onResponse(
+                        primaryLatency,
+                        *args.response.elapsed,
+                        args.response.data.objsize() != primaryResponseLength);
+                }
+                LOGV2_DEBUG(31457,
+                            4,
+                            "Response received",
+                            "host"_attr = host,
+                            "response"_attr = args.response);
+            };
 
         auto newRequest = executor::RemoteCommandRequest(
             host, invocation->ns().db().toString(), payload, nullptr);
-        if (MONGO_likely(!mirrorMaestroExpectsResponse.shouldFail())) {
+        if (MONGO_likely(!expectsResponse)) {
             // If we're not expecting a response, set to fire and forget
             newRequest.fireAndForgetMode = executor::RemoteCommandRequest::FireAndForgetMode::kOn;
         }
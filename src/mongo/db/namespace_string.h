@@ -158,7 +158,7 @@ public:
     /**
      * Constructs an empty NamespaceString.
      */
-    NamespaceString() : _ns(), _dotIndex(std::string::npos) {}
+    NamespaceString() : _ns(), _dotIndex(std::string::npos), _hash(_computeHash(_ns)) {}
 
     /**
      * Constructs a NamespaceString from the fully qualified namespace named in "ns".
@@ -166,6 +166,7 @@ public:
     explicit NamespaceString(StringData ns) {
         _ns = ns.toString();  // copy to our buffer
         _dotIndex = _ns.find('.');
+        _hash = _computeHash(_ns);
         uassert(ErrorCodes::InvalidNamespace,
                 "namespaces cannot have embedded null characters",
                 _ns.find('\0') == std::string::npos);
@@ -189,6 +190,7 @@ public:
         ++it;
         it = std::copy(collectionName.begin(), collectionName.end(), it);
         _dotIndex = dbName.size();
+        _hash = _computeHash(_ns);
 
         dassert(it == _ns.end());
         dassert(_ns[_dotIndex] == '.');
@@ -457,12 +459,14 @@ public:
      */
     static bool validCollectionName(StringData coll);
 
-    // Relops among `NamespaceString`.
+    // Relops among `NamespaceString`. Equality compares the precomputed hashes first, so that
+    // mismatched namespaces which share a long common prefix (e.g. siblings within one database)
+    // are rejected without walking the strings.
     friend bool operator==(const NamespaceString& a, const NamespaceString& b) {
-        return a.ns() == b.ns();
+        return a._hash == b._hash && a.ns() == b.ns();
     }
     friend bool operator!=(const NamespaceString& a, const NamespaceString& b) {
-        return a.ns() != b.ns();
+        return !(a == b);
     }
     friend bool operator<(const NamespaceString& a, const NamespaceString& b) {
         return a.ns() < b.ns();
@@ -479,7 +483,7 @@ public:
 
     template <typename H>
     friend H AbslHashValue(H h, const NamespaceString& nss) {
-        return H::combine(std::move(h), nss._ns);
+        return H::combine(std::move(h), nss._hash);
     }
 
     friend auto logAttrs(const NamespaceString& nss) {
@@ -487,8 +491,17 @@ public:
     }
 
 private:
+    static size_t _computeHash(const std::string& ns) {
+        return std::hash<std::string>{}(ns);
+    }
+
     std::string _ns;
     size_t _dotIndex = 0;
+
+    // Hash of '_ns', computed once at construction and carried along by copies. Namespaces are
+    // hashed on every catalog and cursor map lookup an operation performs, so hashing feeds the
+    // cached value into the hasher instead of re-walking the string each time.
+    size_t _hash = 0;
 };
 
 /**
@@ -737,12 +737,15 @@ static SingleWriteResult performSingleUpdateOpWithDupKeyRetry(
     globalOpCounters.gotUpdate();
     ServerWriteConcernMetrics::get(opCtx)->recordWriteConcernForUpdate(opCtx->getWriteConcern());
     auto& curOp = *CurOp::get(opCtx);
+    // Serialize the op description before taking the Client lock; large batches of updates would
+    // otherwise spend per-op serialization time holding it.
+    const auto opDescription = op.toBSON();
     {
         stdx::lock_guard<Client> lk(*opCtx->getClient());
         curOp.setNS_inlock(ns.ns());
         curOp.setNetworkOp_inlock(dbUpdate);
         curOp.setLogicalOp_inlock(LogicalOp::opUpdate);
-        curOp.setOpDescription_inlock(op.toBSON());
+        curOp.setOpDescription_inlock(opDescription);
         curOp.ensureStarted();
     }
 
@@ -761,6 +764,12 @@ static SingleWriteResult performSingleUpdateOpWithDupKeyRetry(
                                ? PlanYieldPolicy::YieldPolicy::INTERRUPT_ONLY
                                : PlanYieldPolicy::YieldPolicy::YIELD_AUTO);
 
+    // The update and query are fixed across retries, so they are parsed for the retryability
+    // check at most once, on the first DuplicateKey error. The check itself still runs per error,
+    // since consecutive errors may implicate different unique indexes.
+    const ExtensionsCallbackReal extensionsCallback(opCtx, &request.getNamespaceString());
+    boost::optional<ParsedUpdate> parsedUpdateForRetryCheck;
+
     size_t numAttempts = 0;
     while (true) {
         ++numAttempts;
@@ -768,15 +777,16 @@ static SingleWriteResult performSingleUpdateOpWithDupKeyRetry(
         try {
             return performSingleUpdateOp(opCtx, ns, stmtId, request);
         } catch (ExceptionFor<ErrorCodes::DuplicateKey>& ex) {
-            const ExtensionsCallbackReal extensionsCallback(opCtx, &request.getNamespaceString());
-            ParsedUpdate parsedUpdate(opCtx, &request, extensionsCallback);
-            uassertStatusOK(parsedUpdate.parseRequest());
+            if (!parsedUpdateForRetryCheck) {
+                parsedUpdateForRetryCheck.emplace(opCtx, &request, extensionsCallback);
+                uassertStatusOK(parsedUpdateForRetryCheck->parseRequest());
 
-            if (!parsedUpdate.hasParsedQuery()) {
-                uassertStatusOK(parsedUpdate.parseQueryToCQ());
+                if (!parsedUpdateForRetryCheck->hasParsedQuery()) {
+                    uassertStatusOK(parsedUpdateForRetryCheck->parseQueryToCQ());
+                }
             }
 
-            if (!shouldRetryDuplicateKeyException(parsedUpdate,
+            if (!shouldRetryDuplicateKeyException(*parsedUpdateForRetryCheck,
                                                   *ex.extraInfo<DuplicateKeyErrorInfo>())) {
                 throw;
             }
@@ -873,12 +883,14 @@ static SingleWriteResult performSingleDeleteOp(OperationContext* opCtx,
     globalOpCounters.gotDelete();
     ServerWriteConcernMetrics::get(opCtx)->recordWriteConcernForDelete(opCtx->getWriteConcern());
     auto& curOp = *CurOp::get(opCtx);
+    // As for updates, serialize the op description outside the Client lock.
+    const auto opDescription = op.toBSON();
     {
         stdx::lock_guard<Client> lk(*opCtx->getClient());
         curOp.setNS_inlock(ns.ns());
         curOp.setNetworkOp_inlock(dbDelete);
         curOp.setLogicalOp_inlock(LogicalOp::opDelete);
-        curOp.setOpDescription_inlock(op.toBSON());
+        curOp.setOpDescription_inlock(opDescription);
         curOp.ensureStarted();
     }
 
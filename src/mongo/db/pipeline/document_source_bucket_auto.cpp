@@ -156,12 +156,31 @@ DocumentSource::GetNextResult DocumentSourceBucketAuto::populateSorter() {
     auto next = pSource->getNext();
     for (; next.isAdvanced(); next = pSource->getNext()) {
         auto nextDoc = next.releaseDocument();
-        _sorter->add(extractKey(nextDoc), nextDoc);
+        auto key = extractKey(nextDoc);
+        // Only the accumulator arguments are needed once the bucket boundaries have been chosen,
+        // so rather than sorting entire input documents we evaluate the arguments up front and
+        // sort a compact document holding just their values. This can shrink the sorter's memory
+        // footprint and spill volume considerably when the accumulators use only a few fields.
+        _sorter->add(std::move(key), computeAccumulatorArgs(nextDoc));
         ++_nDocuments;
     }
     return next;
 }
 
+Document DocumentSourceBucketAuto::computeAccumulatorArgs(const Document& doc) {
+    const size_t numAccumulators = _accumulatedFields.size();
+    MutableDocument args(numAccumulators);
+    for (size_t k = 0; k < numAccumulators; k++) {
+        Value argValue = _accumulatedFields[k].expr.argument->evaluate(doc, &pExpCtx->variables);
+        // Skip missing values so that they read back as missing, which accumulators treat
+        // differently from null.
+        if (!argValue.missing()) {
+            args.addField(std::to_string(k), std::move(argValue));
+        }
+    }
+    return args.freeze();
+}
+
 Value DocumentSourceBucketAuto::extractKey(const Document& doc) {
     if (!_groupByExpression) {
         return Value(BSONNULL);
@@ -200,9 +219,7 @@ void DocumentSourceBucketAuto::addDocumentToBucket(const pair<Value, Document>&
 
     const size_t numAccumulators = _accumulatedFields.size();
     for (size_t k = 0; k < numAccumulators; k++) {
-        bucket._accums[k]->process(
-            _accumulatedFields[k].expr.argument->evaluate(entry.second, &pExpCtx->variables),
-            false);
+        bucket._accums[k]->process(entry.second[std::to_string(k)], false);
     }
 }
 
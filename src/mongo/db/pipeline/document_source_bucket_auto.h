@@ -140,6 +140,14 @@ private:
      */
     Value extractKey(const Document& doc);
 
+    /**
+     * Evaluates each accumulator's argument expression against 'doc' and packs the results into a
+     * compact document keyed by the accumulator's ordinal. This is what is stored in the sorter
+     * alongside the 'groupBy' key, so that the whole input document need not be kept in memory or
+     * spilled to disk. Missing values are omitted so that they read back as missing.
+     */
+    Document computeAccumulatorArgs(const Document& doc);
+
     /**
      * Returns the next bucket if exists. boost::none if none exist.
      */
@@ -148,7 +156,8 @@ private:
     boost::optional<std::pair<Value, Document>> adjustBoundariesAndGetMinForNextBucket(
         Bucket* currentBucket);
     /**
-     * Adds the document in 'entry' to 'bucket' by updating the accumulators in 'bucket'.
+     * Adds the sorted entry, consisting of the 'groupBy' key and the pre-evaluated accumulator
+     * arguments, to 'bucket' by updating the accumulators in 'bucket'.
      */
     void addDocumentToBucket(const std::pair<Value, Document>& entry, Bucket& bucket);
 
@@ -307,6 +307,22 @@ TEST_F(BucketAutoTests, EvaluatesAccumulatorsInOutputField) {
     ASSERT_DOCUMENT_EQ(results[1], Document(fromjson("{_id : {min : 4, max : 6}, avg : 5}")));
 }
 
+TEST_F(BucketAutoTests, AccumulatorsTreatMissingValuesAsMissingNotNull) {
+    // $push must skip documents where its argument is missing, even though the accumulator
+    // arguments are pre-evaluated while the documents are being sorted.
+    auto bucketAutoSpec = fromjson(
+        "{$bucketAuto : {groupBy : '$x', buckets : 1, output : {ys : {$push : '$y'}}}}");
+    auto results = getResults(bucketAutoSpec,
+                              {Document{{"x", 0}},
+                               Document{{"x", 1}, {"y", 10}},
+                               Document{{"x", 2}, {"y", BSONNULL}},
+                               Document{{"x", 3}, {"y", 30}}});
+
+    ASSERT_EQUALS(results.size(), 1UL);
+    ASSERT_DOCUMENT_EQ(results[0],
+                       Document(fromjson("{_id : {min : 0, max : 3}, ys : [10, null, 30]}")));
+}
+
 TEST_F(BucketAutoTests, EvaluatesNonFieldPathExpressionInGroupByField) {
     auto bucketAutoSpec = fromjson("{$bucketAuto : {groupBy : {$add : ['$x', 1]}, buckets : 2}}");
     auto results = getResults(
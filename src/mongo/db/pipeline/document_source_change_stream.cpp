@@ -34,6 +34,7 @@
 #include "mongo/bson/simple_bsonelement_comparator.h"
 #include "mongo/db/bson/bson_helper.h"
 #include "mongo/db/commands/feature_compatibility_version_documentation.h"
+#include "mongo/db/matcher/expression_leaf.h"
 #include "mongo/db/pipeline/change_stream_constants.h"
 #include "mongo/db/pipeline/document_path_support.h"
 #include "mongo/db/pipeline/document_source_change_stream_close_cursor.h"
@@ -138,6 +139,139 @@ Value DocumentSourceOplogMatch::serialize(optional<ExplainOptions::Verbosity> ex
     return Value();
 }
 
+namespace {
+
+/**
+ * If 'expr', or any clause of a top-level $and, constrains the change event's 'operationType' to a
+ * set of string values, returns those values. Returns boost::none if no such clause exists.
+ */
+boost::optional<std::vector<StringData>> extractOperationTypeValues(const MatchExpression* expr) {
+    switch (expr->matchType()) {
+        case MatchExpression::AND: {
+            for (size_t i = 0; i < expr->numChildren(); ++i) {
+                if (auto opTypes = extractOperationTypeValues(expr->getChild(i))) {
+                    return opTypes;
+                }
+            }
+            return boost::none;
+        }
+        case MatchExpression::EQ: {
+            auto eqExpr = static_cast<const EqualityMatchExpression*>(expr);
+            if (eqExpr->path() != DocumentSourceChangeStream::kOperationTypeField ||
+                eqExpr->getData().type() != BSONType::String) {
+                return boost::none;
+            }
+            return std::vector<StringData>{eqExpr->getData().valueStringData()};
+        }
+        case MatchExpression::MATCH_IN: {
+            auto inExpr = static_cast<const InMatchExpression*>(expr);
+            if (inExpr->path() != DocumentSourceChangeStream::kOperationTypeField ||
+                !inExpr->getRegexes().empty()) {
+                return boost::none;
+            }
+            std::vector<StringData> opTypes;
+            for (auto&& equality : inExpr->getEqualities()) {
+                if (equality.type() != BSONType::String) {
+                    return boost::none;
+                }
+                opTypes.push_back(equality.valueStringData());
+            }
+            return opTypes;
+        }
+        default:
+            return boost::none;
+    }
+}
+
+/**
+ * Translates the requested change event operation types into a filter on raw oplog entries.
+ * Entries other than plain CRUD writes, such as the commands which drive invalidation, are always
+ * retained, since the internal change stream stages must observe them whatever the user asked
+ * for. Returns boost::none if any requested type cannot be mapped onto raw oplog entries.
+ */
+boost::optional<BSONObj> buildOperationTypeOplogFilter(const std::vector<StringData>& opTypes) {
+    BSONArrayBuilder orBuilder;
+    orBuilder.append(BSON("op" << BSON("$nin" << BSON_ARRAY("i"
+                                                            << "u"
+                                                            << "d"))));
+    for (auto&& opType : opTypes) {
+        if (opType == DocumentSourceChangeStream::kInsertOpType) {
+            orBuilder.append(BSON("op"
+                                  << "i"));
+        } else if (opType == DocumentSourceChangeStream::kDeleteOpType) {
+            orBuilder.append(BSON("op"
+                                  << "d"));
+        } else if (opType == DocumentSourceChangeStream::kUpdateOpType) {
+            // An update entry carries a modification description, while a replacement carries the
+            // full new document, which always includes its _id.
+            orBuilder.append(BSON("op"
+                                  << "u"
+                                  << "o._id" << BSON("$exists" << false)));
+        } else if (opType == DocumentSourceChangeStream::kReplaceOpType) {
+            orBuilder.append(BSON("op"
+                                  << "u"
+                                  << "o._id" << BSON("$exists" << true)));
+        } else {
+            return boost::none;
+        }
+    }
+    return BSON("$or" << orBuilder.arr());
+}
+
+}  // namespace
+
+Pipeline::SourceContainer::iterator DocumentSourceOplogMatch::doOptimizeAt(
+    Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container) {
+    invariant(*itr == this);
+
+    if (_pushedDownOperationTypes) {
+        return std::next(itr);
+    }
+
+    // Walk past the internal change stream stages to find the first user stage. None of the
+    // stages skipped here modify the 'operationType' field of the events they pass along.
+    auto userItr = std::next(itr);
+    for (; userItr != container->end(); ++userItr) {
+        auto stage = userItr->get();
+        // A stream which must observe the event matching its resume token cannot narrow the oplog
+        // scan: the resumed-from event has to be seen again regardless of the user's filter.
+        if (dynamic_cast<DocumentSourceEnsureResumeTokenPresent*>(stage)) {
+            return std::next(itr);
+        }
+        if (!dynamic_cast<DocumentSourceChangeStreamTransform*>(stage) &&
+            !dynamic_cast<DocumentSourceCheckInvalidate*>(stage) &&
+            !dynamic_cast<DocumentSourceCheckResumability*>(stage) &&
+            !dynamic_cast<DocumentSourceCloseCursor*>(stage) &&
+            !dynamic_cast<DocumentSourceLookupChangePreImage*>(stage) &&
+            !dynamic_cast<DocumentSourceLookupChangePostImage*>(stage)) {
+            break;
+        }
+    }
+    if (userItr == container->end()) {
+        return std::next(itr);
+    }
+
+    auto userMatch = dynamic_cast<DocumentSourceMatch*>(userItr->get());
+    if (!userMatch) {
+        return std::next(itr);
+    }
+
+    auto opTypes = extractOperationTypeValues(userMatch->getMatchExpression());
+    if (!opTypes) {
+        return std::next(itr);
+    }
+    auto oplogFilter = buildOperationTypeOplogFilter(*opTypes);
+    if (!oplogFilter) {
+        return std::next(itr);
+    }
+
+    // Narrow the oplog filter. The user's $match stays in place; the pushed-down predicate only
+    // discards entries which could never produce an event matching it.
+    rebuild(BSON("$and" << BSON_ARRAY(getQuery() << *oplogFilter)));
+    _pushedDownOperationTypes = true;
+    return std::next(itr);
+}
+
 void DocumentSourceChangeStream::checkValueType(const Value v,
                                                 const StringData filedName,
                                                 BSONType expectedType) {
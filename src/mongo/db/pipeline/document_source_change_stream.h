@@ -240,8 +240,22 @@ public:
 
     Value serialize(boost::optional<ExplainOptions::Verbosity> explain) const final;
 
+protected:
+    /**
+     * If the first user stage after the internal change stream stages is a $match that constrains
+     * the event's 'operationType' to a set of CRUD types, pushes an equivalent predicate on raw
+     * oplog entries down into this stage's filter, so that entries which could never produce a
+     * requested event are discarded before they are transformed into change events.
+     */
+    Pipeline::SourceContainer::iterator doOptimizeAt(Pipeline::SourceContainer::iterator itr,
+                                                     Pipeline::SourceContainer* container) final;
+
 private:
     using DocumentSourceMatch::DocumentSourceMatch;
+
+    // Set once an 'operationType' predicate has been pushed down into the oplog filter, so that
+    // repeated optimization passes do not duplicate it.
+    bool _pushedDownOperationTypes = false;
 };
 
 }  // namespace mongo
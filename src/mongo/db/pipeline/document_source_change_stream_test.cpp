@@ -1992,6 +1992,114 @@ TEST_F(ChangeStreamStageTest, TransformationShouldBeAbleToReParseSerializedStage
     ASSERT_VALUE_EQ(newSerialization[0], serialization[0]);
 }
 
+TEST_F(ChangeStreamStageTest, OptimizationPushesOperationTypeEqPredicateIntoOplogFilter) {
+    auto expCtx = getExpCtx();
+
+    auto stages = DSChangeStream::createFromBson(kDefaultSpec.firstElement(), expCtx);
+    stages.push_back(DocumentSourceMatch::create(fromjson("{operationType: 'insert'}"), expCtx));
+    auto pipeline = Pipeline::create(std::move(stages), expCtx);
+
+    auto oplogMatch = dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get());
+    ASSERT(oplogMatch);
+    auto originalQuery = oplogMatch->getQuery();
+
+    pipeline->optimizePipeline();
+
+    // The oplog filter should now reject plain CRUD entries other than inserts up front, while
+    // still letting through the non-CRUD entries that drive invalidation.
+    auto expectedOplogFilter =
+        BSON("$or" << BSON_ARRAY(BSON("op" << BSON("$nin" << BSON_ARRAY("i"
+                                                                        << "u"
+                                                                        << "d")))
+                                 << BSON("op"
+                                         << "i")));
+    oplogMatch = dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get());
+    ASSERT(oplogMatch);
+    ASSERT_BSONOBJ_EQ(oplogMatch->getQuery(),
+                      BSON("$and" << BSON_ARRAY(originalQuery << expectedOplogFilter)));
+}
+
+TEST_F(ChangeStreamStageTest, OptimizationPushesOperationTypeInPredicateIntoOplogFilter) {
+    auto expCtx = getExpCtx();
+
+    auto stages = DSChangeStream::createFromBson(kDefaultSpec.firstElement(), expCtx);
+    stages.push_back(DocumentSourceMatch::create(
+        fromjson("{operationType: {$in: ['update', 'replace']}}"), expCtx));
+    auto pipeline = Pipeline::create(std::move(stages), expCtx);
+
+    auto oplogMatch = dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get());
+    ASSERT(oplogMatch);
+    auto originalQuery = oplogMatch->getQuery();
+
+    pipeline->optimizePipeline();
+
+    // Updates and replacements are distinguished by whether the 'o' field carries a full document
+    // with its _id, so both map onto "u" entries with an $exists predicate.
+    auto expectedOplogFilter =
+        BSON("$or" << BSON_ARRAY(BSON("op" << BSON("$nin" << BSON_ARRAY("i"
+                                                                        << "u"
+                                                                        << "d")))
+                                 << BSON("op"
+                                         << "u"
+                                         << "o._id" << BSON("$exists" << false))
+                                 << BSON("op"
+                                         << "u"
+                                         << "o._id" << BSON("$exists" << true))));
+    oplogMatch = dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get());
+    ASSERT(oplogMatch);
+    ASSERT_BSONOBJ_EQ(oplogMatch->getQuery(),
+                      BSON("$and" << BSON_ARRAY(originalQuery << expectedOplogFilter)));
+}
+
+TEST_F(ChangeStreamStageTest, OptimizationDoesNotPushDownNonCrudOperationTypePredicate) {
+    auto expCtx = getExpCtx();
+
+    auto stages = DSChangeStream::createFromBson(kDefaultSpec.firstElement(), expCtx);
+    stages.push_back(DocumentSourceMatch::create(fromjson("{operationType: 'drop'}"), expCtx));
+    auto pipeline = Pipeline::create(std::move(stages), expCtx);
+
+    auto oplogMatch = dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get());
+    ASSERT(oplogMatch);
+    auto originalQuery = oplogMatch->getQuery();
+
+    pipeline->optimizePipeline();
+
+    // A 'drop' event is produced from a command entry, which the pushdown cannot describe, so the
+    // oplog filter must be left untouched.
+    oplogMatch = dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get());
+    ASSERT(oplogMatch);
+    ASSERT_BSONOBJ_EQ(oplogMatch->getQuery(), originalQuery);
+}
+
+TEST_F(ChangeStreamStageTest, OptimizationDoesNotPushDownOperationTypePredicateWhenResuming) {
+    auto expCtx = getExpCtx();
+    const auto uuid = testUuid();
+
+    std::shared_ptr<Collection> collection = std::make_shared<CollectionMock>(nss);
+    CollectionCatalog::write(expCtx->opCtx, [&](CollectionCatalog& catalog) {
+        catalog.registerCollection(expCtx->opCtx, uuid, std::move(collection));
+    });
+
+    auto resumeToken = makeResumeToken(kDefaultTs, uuid, BSON("_id" << 1));
+    auto spec = BSON("$changeStream" << BSON("resumeAfter" << resumeToken));
+
+    auto stages = DSChangeStream::createFromBson(spec.firstElement(), expCtx);
+    stages.push_back(DocumentSourceMatch::create(fromjson("{operationType: 'insert'}"), expCtx));
+    auto pipeline = Pipeline::create(std::move(stages), expCtx);
+
+    auto oplogMatch = dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get());
+    ASSERT(oplogMatch);
+    auto originalQuery = oplogMatch->getQuery();
+
+    pipeline->optimizePipeline();
+
+    // A resuming stream must observe the event matching its resume token even if the user's filter
+    // would discard it, so the oplog filter cannot be narrowed.
+    oplogMatch = dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get());
+    ASSERT(oplogMatch);
+    ASSERT_BSONOBJ_EQ(oplogMatch->getQuery(), originalQuery);
+}
+
 TEST_F(ChangeStreamStageTest, CloseCursorOnInvalidateEntries) {
     OplogEntry dropColl = createCommand(BSON("drop" << nss.coll()), testUuid());
     auto stages = makeStages(dropColl);
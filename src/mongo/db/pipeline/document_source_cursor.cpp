@@ -154,8 +154,12 @@ void DocumentSourceCursor::loadBatch() {
             // As long as we're waiting for inserts, we shouldn't do any batching at this level we
             // need the whole pipeline to see each document to see if we should stop waiting.
             if (awaitDataState(pExpCtx->opCtx).shouldWaitForInserts ||
-                static_cast<long long>(_currentBatch.memUsageBytes()) >
-                    internalDocumentSourceCursorBatchSizeBytes.load()) {
+                static_cast<long long>(_currentBatch.memUsageBytes()) > _batchSizeBytes) {
+                // The pipeline is consuming everything we load, so provision the next batch
+                // geometrically larger, up to the configured ceiling.
+                _batchSizeBytes = std::min<long long>(
+                    _batchSizeBytes * 2, internalDocumentSourceCursorBatchSizeBytes.load());
+
                 // End this batch and prepare PlanExecutor for yielding.
                 _exec->saveState();
                 return;
@@ -294,6 +298,8 @@ DocumentSourceCursor::DocumentSourceCursor(
     bool trackOplogTimestamp)
     : DocumentSource(kStageName, pCtx),
       _currentBatch(cursorType),
+      _batchSizeBytes(std::min<long long>(internalDocumentSourceCursorInitialBatchSizeBytes.load(),
+                                          internalDocumentSourceCursorBatchSizeBytes.load())),
       _exec(std::move(exec)),
       _trackOplogTS(trackOplogTimestamp) {
     // It is illegal for both 'kEmptyDocuments' and 'trackOplogTimestamp' to be set.
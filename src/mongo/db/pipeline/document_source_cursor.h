@@ -223,6 +223,12 @@ private:
     // Batches results returned from the underlying PlanExecutor.
     Batch _currentBatch;
 
+    // Current size target in bytes for a batch loaded from '_exec'. Starts at
+    // 'internalDocumentSourceCursorInitialBatchSizeBytes' and doubles each time a batch fills
+    // up, capped at 'internalDocumentSourceCursorBatchSizeBytes', so that pipelines which
+    // short-circuit after a few results do not materialize a full-size prefetch.
+    long long _batchSizeBytes;
+
     // The underlying query plan which feeds this pipeline. Must be destroyed while holding the
     // collection lock.
     std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> _exec;
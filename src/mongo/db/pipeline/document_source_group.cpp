@@ -229,7 +229,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextSpilled() {
         _firstPartOfNextGroup = _sorterIterator->next();
     }
 
-    return makeDocument(_currentId, _currentAccumulators, pExpCtx->needsMerge);
+    return makeDocument(_currentId, _currentAccumulators, pExpCtx->needsMerge && _willBeMerged);
 }
 
 DocumentSource::GetNextResult DocumentSourceGroup::getNextStandard() {
@@ -237,7 +237,8 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextStandard() {
     if (_groups->empty())
         return GetNextResult::makeEOF();
 
-    Document out = makeDocument(groupsIterator->first, groupsIterator->second, pExpCtx->needsMerge);
+    Document out = makeDocument(
+        groupsIterator->first, groupsIterator->second, pExpCtx->needsMerge && _willBeMerged);
 
     if (++groupsIterator == _groups->end())
         dispose();
@@ -247,7 +248,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextStandard() {
 
 void DocumentSourceGroup::doDispose() {
     // Free our resources.
-    _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+    _groups = pExpCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>();
     _sorterIterator.reset();
 
     // Make us look done.
@@ -302,6 +303,12 @@ Value DocumentSourceGroup::serialize(boost::optional<ExplainOptions::Verbosity>
         insides["$doingMerge"] = Value(true);
     }
 
+    if (!_willBeMerged) {
+        // The shards half of a $group whose output will not be combined by a merging $group must
+        // emit final results; record that so the flag survives being sent to the shards.
+        insides["$willBeMerged"] = Value(false);
+    }
+
     MutableDocument out;
     out[getSourceName()] = Value(insides.freeze());
 
@@ -404,7 +411,7 @@ DocumentSourceGroup::DocumentSourceGroup(const intrusive_ptr<ExpressionContext>&
                      maxMemoryUsageBytes ? *maxMemoryUsageBytes
                                          : internalDocumentSourceGroupMaxMemoryBytes.load()},
       _initialized(false),
-      _groups(expCtx->getValueComparator().makeUnorderedValueMap<Accumulators>()),
+      _groups(expCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>()),
       _spilled(false) {
     if (!expCtx->inMongos && (expCtx->allowDiskUse || kDebugBuild)) {
         // We spill to disk in debug mode, regardless of allowDiskUse, to stress the system.
@@ -493,6 +500,10 @@ intrusive_ptr<DocumentSource> DocumentSourceGroup::createFromBson(
             massert(17030, "$doingMerge should be true if present", groupField.Bool());
 
             groupStage->setDoingMerge(true);
+        } else if (pFieldName == "$willBeMerged") {
+            massert(5837138, "$willBeMerged should be false if present", !groupField.Bool());
+
+            groupStage->setWillBeMerged(false);
         } else {
             // Any other field will be treated as an accumulator specification.
             groupStage->addAccumulator(
@@ -626,7 +637,7 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
                 }
 
                 // We won't be using groups again so free its memory.
-                _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+                _groups = pExpCtx->getValueComparator().makeFlatUnorderedValueMap<Accumulators>();
 
                 _sorterIterator.reset(Sorter<Value, Value>::Iterator::merge(
                     _sortedFiles, SortOptions(), SorterComparator(pExpCtx->getValueComparator())));
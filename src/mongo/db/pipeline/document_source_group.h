@@ -89,7 +89,11 @@ private:
 class DocumentSourceGroup final : public DocumentSource {
 public:
     using Accumulators = std::vector<boost::intrusive_ptr<AccumulatorState>>;
-    using GroupsMap = ValueUnorderedMap<Accumulators>;
+
+    // The groups are kept in an open-addressing map to avoid the per-entry allocations and
+    // pointer-chasing of a node-based table in the hot accumulation loop. References into the map
+    // are invalidated by insertion, so they must never be held across input documents.
+    using GroupsMap = ValueFlatUnorderedMap<Accumulators>;
 
     static constexpr StringData kStageName = "$group"_sd;
 
@@ -156,6 +160,22 @@ public:
         _doingMerge = doingMerge;
     }
 
+    /**
+     * Returns false if this $group stage runs on the shards half of a split pipeline but no
+     * merging $group will combine its output, in which case it must emit final rather than partial
+     * accumulator states even though the pipeline as a whole needs merging.
+     */
+    bool willBeMerged() const {
+        return _willBeMerged;
+    }
+
+    /**
+     * Tell this source whether a merging $group will combine its output. Defaults to true.
+     */
+    void setWillBeMerged(bool willBeMerged) {
+        _willBeMerged = willBeMerged;
+    }
+
     /**
      * Returns true if this $group stage used disk during execution and false otherwise.
      */
@@ -274,6 +294,7 @@ private:
     std::vector<AccumulationStatement> _accumulatedFields;
 
     bool _doingMerge;
+    bool _willBeMerged = true;
 
     MemoryUsageTracker _memoryTracker;
 
@@ -245,6 +245,39 @@ TEST_F(DocumentSourceGroupTest, ShouldNotReportDottedGroupKeyAsARename) {
     ASSERT_EQ(modifiedPathsRet.renames.size(), 0UL);
 }
 
+TEST_F(DocumentSourceGroupTest, ShouldEmitFinalResultsWhenToldItWillNotBeMerged) {
+    auto expCtx = getExpCtx();
+    expCtx->needsMerge = true;
+
+    auto&& parser = AccumulationStatement::getParser("$avg", boost::none);
+    auto accumulatorArg = BSON(""
+                               << "$b");
+    auto accExpr = parser(expCtx.get(), accumulatorArg.firstElement(), expCtx->variablesParseState);
+    AccumulationStatement avgStatement{"avg", accExpr};
+    auto group = DocumentSourceGroup::create(
+        expCtx,
+        ExpressionFieldPath::parse(expCtx.get(), "$a", expCtx->variablesParseState),
+        {avgStatement});
+    group->setWillBeMerged(false);
+
+    auto mock = DocumentSourceMock::createForTest(
+        {Document{{"a", 1}, {"b", 2}}, Document{{"a", 1}, {"b", 4}}}, expCtx);
+    group->setSource(mock.get());
+
+    // Even though the pipeline as a whole needs a merge, the $avg must be emitted as a final value
+    // rather than as a partial state, because no merging $group will combine the output.
+    auto result = group->getNext();
+    ASSERT_TRUE(result.isAdvanced());
+    ASSERT_DOCUMENT_EQ(result.releaseDocument(), (Document{{"_id", 1}, {"avg", 3.0}}));
+    ASSERT_TRUE(group->getNext().isEOF());
+
+    // The flag must survive serialization so that it reaches the shards.
+    vector<Value> serialized;
+    group->serializeToArray(serialized);
+    ASSERT_VALUE_EQ(serialized[0].getDocument()["$group"].getDocument()["$willBeMerged"],
+                    Value(false));
+}
+
 BSONObj toBson(const intrusive_ptr<DocumentSource>& source) {
     vector<Value> arr;
     source->serializeToArray(arr);
@@ -33,6 +33,7 @@
 #include "mongo/db/pipeline/document_source_lookup.h"
 
 #include <memory>
+#include <set>
 
 #include "mongo/base/init.h"
 #include "mongo/db/exec/document_value/document.h"
@@ -48,6 +49,7 @@
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/platform/overflow_arithmetic.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/str.h"
 
 namespace mongo {
 
@@ -75,6 +77,16 @@ BSONObj buildEqualityOrQuery(const std::string& fieldName, const BSONArray& valu
     return orBuilder.obj();
 }
 
+/**
+ * Returns true if an equality match against 'value' can be answered by a hash table probe. Null,
+ * undefined and missing values also match documents where the foreign field is absent, arrays
+ * match on their elements as well as on the whole array, and regexes perform pattern matching
+ * against strings; none of those semantics are reproducible with a plain hash lookup.
+ */
+bool isHashJoinableValue(const Value& value) {
+    return !value.nullish() && !value.isArray() && value.getType() != BSONType::RegEx;
+}
+
 void lookupPipeValidator(const Pipeline& pipeline) {
     const auto& sources = pipeline.getSources();
     std::for_each(sources.begin(), sources.end(), [](auto& src) {
@@ -311,6 +323,30 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     invariant(!_matchSrc);
 
     if (hasLocalFieldForeignFieldJoin()) {
+        if (_hashJoinState == HashJoinState::kNotBuilt) {
+            try {
+                buildHashJoinTable();
+            } catch (const ExceptionForCat<ErrorCategory::StaleShardVersionError>& ex) {
+                // If lookup on a sharded collection is disallowed and the foreign collection is
+                // sharded, throw a custom exception.
+                if (auto staleInfo = ex.extraInfo<StaleConfigInfo>()) {
+                    uassert(51069,
+                            "Cannot run $lookup with sharded foreign collection",
+                            foreignShardedLookupAllowed() || !staleInfo->getVersionWanted() ||
+                                staleInfo->getVersionWanted() == ChunkVersion::UNSHARDED());
+                }
+                throw;
+            }
+        }
+
+        if (_hashJoinState == HashJoinState::kBuilt) {
+            if (auto results = probeHashJoinTable(inputDoc)) {
+                MutableDocument output(std::move(inputDoc));
+                output.setNestedField(_as, Value(std::move(*results)));
+                return output.freeze();
+            }
+        }
+
         auto matchStage =
             makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
         // We've already allocated space for the trailing $match stage in '_resolvedPipeline'.
@@ -418,6 +454,140 @@ std::unique_ptr<Pipeline, PipelineDeleter> DocumentSourceLookUp::buildPipeline(
     return pipeline;
 }
 
+void DocumentSourceLookUp::buildHashJoinTable() {
+    invariant(_hashJoinState == HashJoinState::kNotBuilt);
+    _hashJoinState = HashJoinState::kAbandoned;
+
+    const auto maxBytes = internalDocumentSourceLookupHashJoinMaxBytes.load();
+
+    // The hash join strategy only applies to a plain equality match: the resolved pipeline must
+    // consist of the generated $match stage, plus any view prefix, which is not correlated with
+    // the input documents. A user pipeline, 'let' variables or an absorbed filter all make the
+    // foreign pipeline depend on more than the joined field values.
+    if (maxBytes <= 0 || hasPipeline() || !_letVariables.empty() || _additionalFilter ||
+        _matchSrc || internalQueryAllowShardedLookup.load()) {
+        return;
+    }
+
+    // Numeric path components are ambiguous under query path traversal: they can name both an
+    // array position and a literal field. Document path traversal only follows the positional
+    // interpretation, so such joins keep the per-document pipeline.
+    for (size_t i = 0; i < _foreignField->getPathLength(); ++i) {
+        if (str::parseUnsignedBase10Integer(_foreignField->getFieldName(i))) {
+            return;
+        }
+    }
+
+    // Copy all 'let' variables into the foreign pipeline's expression context.
+    _variables.copyToExpCtx(_variablesParseState, _fromExpCtx.get());
+
+    if (!foreignShardedLookupAllowed()) {
+        // Enforce that the foreign collection must be unsharded for lookup.
+        _fromExpCtx->mongoProcessInterface->setExpectedShardVersion(
+            _fromExpCtx->opCtx, _fromExpCtx->ns, ChunkVersion::UNSHARDED());
+    }
+
+    // Scan the foreign collection once by executing the resolved pipeline without the correlated
+    // $match placeholder.
+    invariant(_fieldMatchPipelineIdx);
+    auto scanPipeline = _resolvedPipeline;
+    scanPipeline.erase(scanPipeline.begin() + *_fieldMatchPipelineIdx);
+
+    MakePipelineOptions pipelineOpts;
+    pipelineOpts.optimize = true;
+    pipelineOpts.attachCursorSource = true;
+    pipelineOpts.validator = lookupPipeValidator;
+    pipelineOpts.allowTargetingShards = internalQueryAllowShardedLookup.load();
+    auto pipeline = Pipeline::makePipeline(scanPipeline, _fromExpCtx, pipelineOpts);
+
+    auto table = pExpCtx->getValueComparator().makeFlatUnorderedValueMap<std::vector<size_t>>();
+    std::vector<Document> docs;
+    size_t memBytes = 0;
+
+    while (auto result = pipeline->getNext()) {
+        const size_t index = docs.size();
+        memBytes += result->getApproximateSize();
+        document_path_support::visitAllValuesAtPath(
+            *result, *_foreignField, [&](const Value& foreignValue) {
+                if (!isHashJoinableValue(foreignValue)) {
+                    return;
+                }
+                auto& entries = table[foreignValue];
+                // A document whose foreign field holds an array may visit the same value more
+                // than once; it should be recorded only once per value.
+                if (entries.empty() || entries.back() != index) {
+                    if (entries.empty()) {
+                        memBytes += foreignValue.getApproximateSize();
+                    }
+                    entries.push_back(index);
+                }
+            });
+        docs.push_back(std::move(*result));
+
+        if (memBytes > static_cast<size_t>(maxBytes)) {
+            // The foreign collection does not fit within the memory budget. Fall back to
+            // executing the foreign pipeline once per input document.
+            recordPlanSummaryStats(*pipeline);
+            return;
+        }
+    }
+
+    recordPlanSummaryStats(*pipeline);
+    _hashJoinForeignDocs = std::move(docs);
+    _hashJoinTable.emplace(std::move(table));
+    _hashJoinState = HashJoinState::kBuilt;
+}
+
+boost::optional<std::vector<Value>> DocumentSourceLookUp::probeHashJoinTable(
+    const Document& inputDoc) {
+    invariant(_hashJoinState == HashJoinState::kBuilt);
+
+    // Collect the values to join on. Any value whose equality-match semantics a hash probe cannot
+    // reproduce sends this document through the per-document pipeline instead. A missing local
+    // field is treated as null by makeMatchStageFromInput(), so it falls back as well.
+    bool fallback = false;
+    std::vector<Value> localValues;
+    document_path_support::visitAllValuesAtPath(
+        inputDoc, *_localField, [&](const Value& localValue) {
+            if (isHashJoinableValue(localValue)) {
+                localValues.push_back(localValue);
+            } else {
+                fallback = true;
+            }
+        });
+    if (fallback || localValues.empty()) {
+        return boost::none;
+    }
+
+    // Gather the positions of all matching foreign documents. The ordered set both removes
+    // duplicates, so that a document matching several local values is returned only once, and
+    // restores the order in which the foreign collection was scanned.
+    std::set<size_t> matches;
+    for (auto&& localValue : localValues) {
+        auto it = _hashJoinTable->find(localValue);
+        if (it != _hashJoinTable->end()) {
+            matches.insert(it->second.begin(), it->second.end());
+        }
+    }
+
+    std::vector<Value> results;
+    long long objsize = 0;
+    const auto maxBytes = internalLookupStageIntermediateDocumentMaxSizeBytes.load();
+    for (auto&& index : matches) {
+        const auto& doc = _hashJoinForeignDocs[index];
+        long long safeSum = 0;
+        bool hasOverflowed = overflow::add(objsize, doc.getApproximateSize(), &safeSum);
+        uassert(4568,
+                str::stream() << "Total size of documents in " << _fromNs.coll()
+                              << " matching pipeline's $lookup stage exceeds " << maxBytes
+                              << " bytes",
+                !hasOverflowed && objsize <= maxBytes);
+        objsize = safeSum;
+        results.emplace_back(doc);
+    }
+    return results;
+}
+
 DocumentSource::GetModPathsReturn DocumentSourceLookUp::getModifiedPaths() const {
     std::set<std::string> modifiedPaths{_as.fullPath()};
     if (_unwindSrc) {
@@ -565,6 +735,10 @@ void DocumentSourceLookUp::doDispose() {
         _pipeline->dispose(pExpCtx->opCtx);
         _pipeline.reset();
     }
+
+    _hashJoinState = HashJoinState::kAbandoned;
+    _hashJoinTable = boost::none;
+    _hashJoinForeignDocs.clear();
 }
 
 BSONObj DocumentSourceLookUp::makeMatchStageFromInput(const Document& input,
@@ -270,6 +270,23 @@ private:
      */
     std::unique_ptr<Pipeline, PipelineDeleter> buildPipeline(const Document& inputDoc);
 
+    /**
+     * Attempts to build an in-memory hash table over the foreign collection, keyed by the values
+     * found at '_foreignField' in each foreign document, so that equality-match lookups can be
+     * answered with a hash probe instead of executing the foreign pipeline once per input
+     * document. Leaves '_hashJoinState' at kAbandoned if this $lookup is not a plain equality
+     * match or the foreign collection exceeds 'internalDocumentSourceLookupHashJoinMaxBytes'.
+     */
+    void buildHashJoinTable();
+
+    /**
+     * Probes the hash join table with the values found at '_localField' in 'inputDoc' and returns
+     * the matching foreign documents in collection scan order. Returns boost::none if any of the
+     * local values requires match semantics that a hash probe cannot reproduce, in which case the
+     * caller must fall back to executing the foreign pipeline for this document.
+     */
+    boost::optional<std::vector<Value>> probeHashJoinTable(const Document& inputDoc);
+
     /**
      * Reinitialize the cache with a new max size. May only be called if this DSLookup was created
      * with pipeline syntax only, the cache has not been frozen or abandoned, and no data has been
@@ -311,6 +328,15 @@ private:
     // from a cursor source.
     boost::optional<SequentialDocumentCache> _cache;
 
+    // When eligible (see buildHashJoinTable()), an equality-match $lookup scans the foreign
+    // collection once and builds a hash table over it, rather than executing the foreign pipeline
+    // for every input document. The table maps each foreign field value to the positions in
+    // '_hashJoinForeignDocs' of the documents containing it.
+    enum class HashJoinState { kNotBuilt, kBuilt, kAbandoned };
+    HashJoinState _hashJoinState = HashJoinState::kNotBuilt;
+    std::vector<Document> _hashJoinForeignDocs;
+    boost::optional<ValueFlatUnorderedMap<std::vector<size_t>>> _hashJoinTable;
+
     // The ExpressionContext used when performing aggregation pipelines against the '_resolvedNs'
     // namespace.
     boost::intrusive_ptr<ExpressionContext> _fromExpCtx;
@@ -50,6 +50,7 @@
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/repl/storage_interface_mock.h"
 #include "mongo/db/server_options.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -897,6 +898,140 @@ TEST_F(DocumentSourceLookUpTest, ShouldPropagatePausesWhileUnwinding) {
     lookup->dispose();
 }
 
+TEST_F(DocumentSourceLookUpTest, HashJoinReturnsMatchesInForeignCollectionScanOrder) {
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs("test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    // Mock out the foreign collection. The second document's foreign field is an array, so it
+    // should be joinable through each of its elements.
+    auto foreignDoc0 = Document{{"_id", 0}, {"x", 1}};
+    auto foreignDoc1 = Document{{"_id", 1}, {"x", {2, 3}}};
+    auto foreignDoc2 = Document{{"_id", 2}, {"x", 2}};
+    deque<DocumentSource::GetNextResult> mockForeignContents{foreignDoc0, foreignDoc1, foreignDoc2};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "joinKey"_sd},
+                                         {"foreignField", "x"_sd},
+                                         {"as", "matches"_sd}}}}
+                          .toBson();
+    auto parsed = DocumentSourceLookUp::createFromBson(lookupSpec.firstElement(), expCtx);
+    auto lookup = static_cast<DocumentSourceLookUp*>(parsed.get());
+
+    // The first and last documents can probe the hash table; the second one holds an array, whose
+    // $in match semantics a hash probe cannot reproduce, so it is answered by the per-document
+    // pipeline instead.
+    auto mockLocalSource = DocumentSourceMock::createForTest({Document{{"joinKey", 2}},
+                                                              Document{{"joinKey", {3, 1}}},
+                                                              Document{{"joinKey", 5}}},
+                                                             expCtx);
+    lookup->setSource(mockLocalSource.get());
+
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"joinKey", 2}, {"matches", {foreignDoc1, foreignDoc2}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"joinKey", {3, 1}}, {"matches", {foreignDoc0, foreignDoc1}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"joinKey", 5}, {"matches", std::vector<Value>{}}}));
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    lookup->dispose();
+}
+
+TEST_F(DocumentSourceLookUpTest, HashJoinFallsBackToPipelineForNullValues) {
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs("test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    // A null (or missing) local value also matches foreign documents where the field is absent,
+    // which a hash probe cannot answer, so such documents must take the per-document pipeline.
+    auto foreignDoc0 = Document{{"_id", 0}};
+    auto foreignDoc1 = Document{{"_id", 1}, {"x", BSONNULL}};
+    auto foreignDoc2 = Document{{"_id", 2}, {"x", 2}};
+    deque<DocumentSource::GetNextResult> mockForeignContents{foreignDoc0, foreignDoc1, foreignDoc2};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "joinKey"_sd},
+                                         {"foreignField", "x"_sd},
+                                         {"as", "matches"_sd}}}}
+                          .toBson();
+    auto parsed = DocumentSourceLookUp::createFromBson(lookupSpec.firstElement(), expCtx);
+    auto lookup = static_cast<DocumentSourceLookUp*>(parsed.get());
+
+    auto mockLocalSource = DocumentSourceMock::createForTest(
+        {Document{{"joinKey", BSONNULL}}, Document{{"joinKey", 2}}}, expCtx);
+    lookup->setSource(mockLocalSource.get());
+
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"joinKey", BSONNULL}, {"matches", {foreignDoc0, foreignDoc1}}}));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"joinKey", 2}, {"matches", {foreignDoc2}}}));
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    lookup->dispose();
+}
+
+TEST_F(DocumentSourceLookUpTest, HashJoinFallsBackWhenForeignCollectionExceedsMemoryLimit) {
+    const auto defaultMaxBytes = internalDocumentSourceLookupHashJoinMaxBytes.load();
+    internalDocumentSourceLookupHashJoinMaxBytes.store(1);
+    ON_BLOCK_EXIT([&] { internalDocumentSourceLookupHashJoinMaxBytes.store(defaultMaxBytes); });
+
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs("test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    auto foreignDoc0 = Document{{"_id", 0}, {"x", 1}};
+    auto foreignDoc1 = Document{{"_id", 1}, {"x", 2}};
+    deque<DocumentSource::GetNextResult> mockForeignContents{foreignDoc0, foreignDoc1};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "joinKey"_sd},
+                                         {"foreignField", "x"_sd},
+                                         {"as", "matches"_sd}}}}
+                          .toBson();
+    auto parsed = DocumentSourceLookUp::createFromBson(lookupSpec.firstElement(), expCtx);
+    auto lookup = static_cast<DocumentSourceLookUp*>(parsed.get());
+
+    auto mockLocalSource =
+        DocumentSourceMock::createForTest({Document{{"joinKey", 2}}}, expCtx);
+    lookup->setSource(mockLocalSource.get());
+
+    // The foreign collection does not fit within the one byte budget, so the stage must abandon
+    // the hash join and still produce the correct result through the per-document pipeline.
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       (Document{{"joinKey", 2}, {"matches", {foreignDoc1}}}));
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    lookup->dispose();
+}
+
 TEST_F(DocumentSourceLookUpTest, LookupReportsAsFieldIsModified) {
     auto expCtx = getExpCtx();
     NamespaceString fromNs("test", "foreign");
@@ -541,8 +541,13 @@ std::pair<DocumentSourceMerge::BatchObject, int> DocumentSourceMerge::makeBatchO
     auto mergeOnFields = extractMergeOnFieldsFromDoc(doc, _mergeOnFields);
     auto mod = makeBatchUpdateModification(doc);
     auto vars = resolveLetVariablesIfNeeded(doc);
-    auto modSize = mod.objsize() + (vars ? vars->objsize() : 0);
-    return {{std::move(mergeOnFields), std::move(mod), std::move(vars)}, modSize};
+    // Account for the filter and the let constants in addition to the update modification itself,
+    // as each batch entry serializes all three into the write command. Counting only the
+    // modification would allow a buffered batch to exceed the maximum BSON size once serialized,
+    // forcing the write path to split it and issue extra round trips.
+    auto batchObjSize = mergeOnFields.objsize() + mod.objsize() + (vars ? vars->objsize() : 0) +
+        write_ops::kWriteCommandBSONArrayPerElementOverheadBytes;
+    return {{std::move(mergeOnFields), std::move(mod), std::move(vars)}, batchObjSize};
 }
 
 void DocumentSourceMerge::spill(BatchedObjects&& batch) try {
@@ -129,7 +129,10 @@ private:
 
     std::pair<BSONObj, int> makeBatchObject(Document&& doc) const override {
         auto obj = doc.toBson();
-        return {obj, obj.objsize()};
+        // Include the array element overhead so that a buffered batch serializes into a single
+        // insert command without exceeding the maximum BSON size.
+        auto batchObjSize = obj.objsize() + write_ops::kWriteCommandBSONArrayPerElementOverheadBytes;
+        return {obj, batchObjSize};
     }
 
     void waitWhileFailPointEnabled() override;
@@ -91,7 +91,19 @@ DocumentSource::GetNextResult DocumentSourceSort::doGetNext() {
         return GetNextResult::makeEOF();
     }
 
-    return GetNextResult{_sortExecutor->getNext().second};
+    auto [sortKey, doc] = _sortExecutor->getNext();
+
+    if (pExpCtx->needsMerge) {
+        // If this sort stage is part of a merged pipeline, make sure that each returned Document's
+        // sort key gets saved with its metadata to speed up the merge later. The metadata is
+        // attached here, rather than before the document enters the sorter, so that a top-k sort
+        // only pays for the copy on the documents it actually returns.
+        MutableDocument output(std::move(doc));
+        output.metadata().setSortKey(std::move(sortKey), _sortKeyGen->isSingleElementKey());
+        return output.freeze();
+    }
+
+    return GetNextResult{std::move(doc)};
 }
 
 void DocumentSourceSort::serializeToArray(
@@ -245,17 +257,7 @@ bool DocumentSourceSort::usedDisk() {
 
 std::pair<Value, Document> DocumentSourceSort::extractSortKey(Document&& doc) const {
     Value sortKey = _sortKeyGen->computeSortKeyFromDocument(doc);
-
-    if (pExpCtx->needsMerge) {
-        // If this sort stage is part of a merged pipeline, make sure that each Document's sort key
-        // gets saved with its metadata.
-        MutableDocument toBeSorted(std::move(doc));
-        toBeSorted.metadata().setSortKey(sortKey, _sortKeyGen->isSingleElementKey());
-
-        return std::make_pair(std::move(sortKey), toBeSorted.freeze());
-    } else {
-        return std::make_pair(std::move(sortKey), std::move(doc));
-    }
+    return std::make_pair(std::move(sortKey), std::move(doc));
 }
 
 boost::optional<DocumentSource::DistributedPlanLogic> DocumentSourceSort::distributedPlanLogic() {
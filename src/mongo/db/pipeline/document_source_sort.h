@@ -169,8 +169,9 @@ private:
     /**
      * Returns the sort key for 'doc', as well as the document that should be entered into the
      * sorter to eventually be returned. If we will need to later merge the sorted results with
-     * other results, this method adds the sort key as metadata onto 'doc' to speed up the merge
-     * later.
+     * other results, doGetNext() adds the sort key as metadata onto each returned document to
+     * speed up the merge later; it is not attached here so that a top-k sort does not have to
+     * copy documents it ends up discarding.
      */
     std::pair<Value, Document> extractSortKey(Document&& doc) const;
 
@@ -218,6 +218,29 @@ protected:
     }
 };
 
+TEST_F(DocumentSourceSortExecutionTest, ShouldAttachSortKeyMetadataWhenMergingIsNeeded) {
+    getExpCtx()->needsMerge = true;
+    createSort(BSON("a" << 1));
+
+    auto source = DocumentSourceMock::createForTest(
+        {Document{{"_id", 0}, {"a", 2}}, Document{{"_id", 1}, {"a", 1}}}, getExpCtx());
+    sort()->setSource(source.get());
+
+    auto next = sort()->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    auto doc = next.releaseDocument();
+    ASSERT_TRUE(doc.metadata().hasSortKey());
+    ASSERT_VALUE_EQ(doc.metadata().getSortKey(), Value(1));
+
+    next = sort()->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    doc = next.releaseDocument();
+    ASSERT_TRUE(doc.metadata().hasSortKey());
+    ASSERT_VALUE_EQ(doc.metadata().getSortKey(), Value(2));
+
+    assertEOF();
+}
+
 TEST_F(DocumentSourceSortExecutionTest, ShouldGiveNoOutputIfGivenNoInputs) {
     checkResults({}, BSON("a" << 1), "[]");
 }
@@ -126,12 +126,13 @@ DocumentSource::GetNextResult DocumentSourceUnwind::Unwinder::getNext() {
             }
             _output.removeNestedField(_unwindPathFieldIndexes);
         } else {
-            // Set field to be the next element in the array. If needed, this will automatically
-            // clone all the documents along the field path so that the end values are not shared
-            // across documents that have come out of this pipeline operator. This is a partial deep
-            // clone. Because the value at the end will be replaced, everything along the path
-            // leading to that will be replaced in order not to share that change with any other
-            // clones (or the original).
+            // Set field to be the next element in the array. The emitted documents share the
+            // input document's backing storage: mutating '_output' after the previous element was
+            // peeked at only clones DocumentStorage's small field cache (which holds the unwind
+            // path and, if requested, the array index slot), while the underlying BSON and all
+            // other field Values remain shared. For nested unwind paths the documents along the
+            // path are cloned as well so the replaced leaf value is not visible through documents
+            // already emitted.
             _output.setNestedField(_unwindPathFieldIndexes, _inputArray[_index]);
             indexForOutput = _index;
             _index++;
@@ -35,6 +35,7 @@
 
 #include "mongo/db/db_raii.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/ops/write_ops.h"
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/read_concern.h"
 #include "mongo/db/storage/recovery_unit.h"
@@ -216,7 +217,7 @@ DocumentSource::GetNextResult DocumentSourceWriter<B>::doGetNext() {
                 batch.clear();
                 bufferedBytes = objSize;
             }
-            batch.push_back(obj);
+            batch.push_back(std::move(obj));
         }
         if (!batch.empty()) {
             spill(std::move(batch));
@@ -1007,6 +1007,18 @@ const char* ExpressionConstant::getOpName() const {
     return "$const";
 }
 
+/* ---------------- ExpressionInternalCachedSubexpression ---------------- */
+
+Value ExpressionInternalCachedSubexpression::evaluate(const Document& root,
+                                                      Variables* variables) const {
+    if (auto cached = variables->getCachedValue(_cacheSlot)) {
+        return *cached;
+    }
+    auto value = _children[0]->evaluate(root, variables);
+    variables->setCachedValue(_cacheSlot, value);
+    return value;
+}
+
 /* ---------------------- ExpressionDateFromParts ----------------------- */
 
 /* Helper functions also shared with ExpressionDateToParts */
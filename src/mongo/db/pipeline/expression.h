@@ -618,6 +618,60 @@ private:
     Value _value;
 };
 
+/**
+ * An internal expression which wraps a deterministic subexpression that appears more than once in
+ * the enclosing projection, caching its result in a Variables slot so that it is evaluated at most
+ * once per input document. The wrapper is never produced by the parser; it is introduced by the
+ * common-subexpression pass in ProjectionNode::deduplicateCommonSubexpressions(). It serializes as
+ * the wrapped subexpression, so explain output and pipelines sent to other nodes are unaffected.
+ *
+ * Whoever drives evaluation is responsible for calling Variables::clearCachedValues() between
+ * input documents; the projection executors do so in applyTransformation().
+ */
+class ExpressionInternalCachedSubexpression final : public Expression {
+public:
+    ExpressionInternalCachedSubexpression(ExpressionContext* const expCtx,
+                                          boost::intrusive_ptr<Expression> subexpression,
+                                          Variables::Id cacheSlot)
+        : Expression(expCtx, {std::move(subexpression)}), _cacheSlot(cacheSlot) {}
+
+    boost::intrusive_ptr<Expression> optimize() final {
+        _children[0] = _children[0]->optimize();
+        return this;
+    }
+
+    Value evaluate(const Document& root, Variables* variables) const final;
+
+    Value serialize(bool explain) const final {
+        return _children[0]->serialize(explain);
+    }
+
+    ComputedPaths getComputedPaths(const std::string& exprFieldPath,
+                                   Variables::Id renamingVar = Variables::kRootId) const final {
+        return _children[0]->getComputedPaths(exprFieldPath, renamingVar);
+    }
+
+    const boost::intrusive_ptr<Expression>& getSubexpression() const {
+        return _children[0];
+    }
+
+    Variables::Id getCacheSlot() const {
+        return _cacheSlot;
+    }
+
+    void acceptVisitor(ExpressionVisitor* visitor) final {
+        return visitor->visit(this);
+    }
+
+protected:
+    void _doAddDependencies(DepsTracker* deps) const final {
+        _children[0]->addDependencies(deps);
+    }
+
+private:
+    const Variables::Id _cacheSlot;
+};
+
 /**
  * Inherit from this class if your expression works with date types, and accepts either a single
  * argument which is a date, or an object {date: <date>, timezone: <string>}.
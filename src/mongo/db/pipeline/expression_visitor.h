@@ -149,6 +149,7 @@ class ExpressionHyperbolicSine;
 class ExpressionInternalFindSlice;
 class ExpressionInternalFindPositional;
 class ExpressionInternalFindElemMatch;
+class ExpressionInternalCachedSubexpression;
 class ExpressionInternalJsEmit;
 class ExpressionFunction;
 class ExpressionDegreesToRadians;
@@ -301,6 +302,7 @@ public:
     virtual void visit(ExpressionFromAccumulator<AccumulatorSum>*) = 0;
     virtual void visit(ExpressionFromAccumulator<AccumulatorMergeObjects>*) = 0;
     virtual void visit(ExpressionTests::Testable*) = 0;
+    virtual void visit(ExpressionInternalCachedSubexpression*) = 0;
     virtual void visit(ExpressionInternalJsEmit*) = 0;
     virtual void visit(ExpressionFunction*) = 0;
     virtual void visit(ExpressionInternalFindSlice*) = 0;
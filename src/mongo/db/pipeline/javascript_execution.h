@@ -96,7 +96,7 @@ public:
     /**
      * Creates a function in the owned Scope* if it hasn't been created yet.
      */
-    ScriptingFunction createFunction(std::string funcCode) {
+    ScriptingFunction createFunction(const std::string& funcCode) {
         return _scope->createFunction(funcCode.c_str());
     };
 
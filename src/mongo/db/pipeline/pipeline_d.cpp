@@ -116,8 +116,9 @@ StatusWith<unique_ptr<PlanExecutor, PlanExecutor::Deleter>> createRandomCursorEx
         return {nullptr};
     }
 
-    // Attempt to get a random cursor from the RecordStore.
-    auto rsRandCursor = coll->getRecordStore()->getRandomCursor(opCtx);
+    // Attempt to get a random cursor from the RecordStore. Pass the sample size along so storage
+    // engines that support it can account for skew in the tree shape when drawing the samples.
+    auto rsRandCursor = coll->getRecordStore()->getRandomCursor(opCtx, sampleSize);
     if (!rsRandCursor) {
         // The storage engine has no random cursor support.
         return {nullptr};
@@ -583,6 +583,52 @@ boost::optional<ShardedExchangePolicy> walkPipelineBackwardsTrackingShardKey(
     return ShardedExchangePolicy{std::move(exchangeSpec), std::move(consumerShards)};
 }
 
+/**
+ * If 'splitPipeline' was split at a $group whose key is a superset of the shard key, then every
+ * document which belongs to one group lives on a single shard, so each per-shard group is already
+ * complete. In that case the merging half of the $group is redundant: remove it and instruct the
+ * shards half to emit final rather than partial accumulator states, leaving the merger to simply
+ * concatenate one finished document per group coming off each shard.
+ */
+void dropRedundantMergingGroup(SplitPipeline& splitPipeline, const ChunkManager& cm) {
+    const auto& shardsSources = splitPipeline.shardsPipeline->getSources();
+    const auto& mergeSources = splitPipeline.mergePipeline->getSources();
+    if (shardsSources.empty() || mergeSources.empty()) {
+        return;
+    }
+
+    auto shardsGroup = dynamic_cast<DocumentSourceGroup*>(shardsSources.back().get());
+    auto mergingGroup = dynamic_cast<DocumentSourceGroup*>(mergeSources.front().get());
+    if (!shardsGroup || shardsGroup->doingMerge() || !mergingGroup || !mergingGroup->doingMerge()) {
+        return;
+    }
+
+    // Determine the names the shard key fields have by the time they reach the $group. If any
+    // earlier stage may modify them, the group key cannot be proven to cover the shard key.
+    std::set<std::string> shardKeyPaths;
+    for (auto&& path : cm.getShardKeyPattern().getKeyPatternFields()) {
+        shardKeyPaths.emplace(path->dottedField().toString());
+    }
+    auto renames = semantic_analysis::renamedPaths(
+        shardsSources.cbegin(), std::prev(shardsSources.cend()), shardKeyPaths);
+    if (!renames) {
+        return;
+    }
+
+    std::set<std::string> renamedShardKeyPaths;
+    for (auto&& rename : *renames) {
+        renamedShardKeyPaths.insert(rename.second);
+    }
+
+    // For a non-merging $group this verifies that every shard key path is part of the group key.
+    if (!shardsGroup->canRunInParallelBeforeWriteStage(renamedShardKeyPaths)) {
+        return;
+    }
+
+    shardsGroup->setWillBeMerged(false);
+    splitPipeline.mergePipeline->popFront();
+}
+
 /**
  * Non-correlated pipeline caching is only supported locally. When the
  * DocumentSourceSequentialDocumentCache stage has been moved to the shards pipeline, abandon the
@@ -907,6 +953,10 @@ DispatchShardPipelineResults dispatchShardPipeline(
         splitPipelines = splitPipeline(std::move(pipeline));
 
         exchangeSpec = checkIfEligibleForExchange(opCtx, splitPipelines->mergePipeline.get());
+
+        if (!exchangeSpec && executionNsRoutingInfo && executionNsRoutingInfo->isSharded()) {
+            dropRedundantMergingGroup(*splitPipelines, *executionNsRoutingInfo);
+        }
     }
 
     // Generate the command object for the targeted shards.
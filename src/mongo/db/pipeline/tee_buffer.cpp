@@ -73,6 +73,19 @@ DocumentSource::GetNextResult TeeBuffer::getNext(size_t consumerId) {
     const size_t bufferIndex = _buffer.size() - _consumers[consumerId].nLeftToReturn;
     --_consumers[consumerId].nLeftToReturn;
 
+    // If no other consumer still needs the document at 'bufferIndex', steal it from the buffer so
+    // that its memory is released as soon as the last consumer has taken it, rather than when the
+    // next batch is loaded. A consumer still needs the document if its next read position is at or
+    // before 'bufferIndex'.
+    const int nLeftIncludingThisDoc = static_cast<int>(_buffer.size() - bufferIndex);
+    const bool isLastConsumerOfThisDoc =
+        std::none_of(_consumers.begin(), _consumers.end(), [&](const ConsumerInfo& info) {
+            return info.nLeftToReturn >= nLeftIncludingThisDoc;
+        });
+    if (isLastConsumerOfThisDoc) {
+        return std::move(_buffer[bufferIndex]);
+    }
+
     return _buffer[bufferIndex];
 }
 
@@ -44,7 +44,8 @@ namespace mongo {
  * This stage takes a stream of input documents and makes them available to multiple consumers. To
  * do so, it will batch incoming documents and allow each consumer to consume one batch at a time.
  * As a consequence, consumers must be able to pause their execution to allow other consumers to
- * process the batch before moving to the next batch.
+ * process the batch before moving to the next batch. Each document is released from the buffer as
+ * soon as the last consumer that still needs it has consumed it.
  */
 class TeeBuffer : public RefCountable {
 public:
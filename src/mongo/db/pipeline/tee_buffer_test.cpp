@@ -100,6 +100,36 @@ TEST_F(TeeBufferTest, ShouldProvideAllResultsWithoutPauseIfOnlyOneConsumer) {
     ASSERT_TRUE(teeBuffer->getNext(0).isEOF());
 }
 
+TEST_F(TeeBufferTest, ShouldProvideAllResultsToInterleavedConsumersWithinOneBatch) {
+    std::deque<DocumentSource::GetNextResult> inputs{Document{{"a", 1}}, Document{{"a", 2}}};
+    auto mock = DocumentSourceMock::createForTest(inputs, getExpCtx());
+
+    const size_t nConsumers = 2;
+    auto teeBuffer = TeeBuffer::create(nConsumers);  // Both docs fit in a single batch.
+    teeBuffer->setSource(mock.get());
+
+    // Interleave the two consumers so that each of them is the last consumer of one of the
+    // documents, which causes that document to be released from the buffer.
+    auto next0 = teeBuffer->getNext(0);
+    ASSERT_TRUE(next0.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next0.getDocument(), inputs.front().getDocument());
+
+    auto next1 = teeBuffer->getNext(1);
+    ASSERT_TRUE(next1.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next1.getDocument(), inputs.front().getDocument());
+
+    next1 = teeBuffer->getNext(1);
+    ASSERT_TRUE(next1.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next1.getDocument(), inputs.back().getDocument());
+
+    next0 = teeBuffer->getNext(0);
+    ASSERT_TRUE(next0.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next0.getDocument(), inputs.back().getDocument());
+
+    ASSERT_TRUE(teeBuffer->getNext(0).isEOF());
+    ASSERT_TRUE(teeBuffer->getNext(1).isEOF());
+}
+
 TEST_F(TeeBufferTest, ShouldTellConsumerToPauseIfItFinishesBatchBeforeOtherConsumers) {
     std::deque<DocumentSource::GetNextResult> inputs{Document{{"a", 1}}, Document{{"a", 2}}};
     auto mock = DocumentSourceMock::createForTest(inputs, getExpCtx());
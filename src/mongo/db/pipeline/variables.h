@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
 #include <memory>
 
 #include "mongo/db/exec/document_value/document.h"
@@ -160,6 +161,27 @@ public:
         return _definitions.find(id) != _definitions.end();
     };
 
+    /**
+     * Returns the value cached under 'id' since the last call to clearCachedValues(), if any.
+     * Cache slot ids are allocated from the same IdGenerator as user variables, but cached values
+     * are kept separate from variable definitions: they hold per-document results of common
+     * subexpressions and must be cleared by the caller between input documents.
+     */
+    boost::optional<Value> getCachedValue(Variables::Id id) const {
+        if (auto it = _cachedValues.find(id); it != _cachedValues.end()) {
+            return it->second;
+        }
+        return boost::none;
+    }
+
+    void setCachedValue(Variables::Id id, Value value) {
+        _cachedValues[id] = std::move(value);
+    }
+
+    void clearCachedValues() {
+        _cachedValues.clear();
+    }
+
     void appendSystemVariables(BSONObjBuilder& bob) const;
 
     /**
@@ -198,6 +220,10 @@ private:
 
     IdGenerator _idGenerator;
     stdx::unordered_map<Id, ValueAndState> _definitions;
+
+    // Per-document cache of common subexpression results, keyed by cache slot id. See
+    // getCachedValue().
+    stdx::unordered_map<Id, Value> _cachedValues;
 };
 
 /**
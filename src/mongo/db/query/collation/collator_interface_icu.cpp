@@ -34,7 +34,6 @@
 #include <memory>
 
 #include <unicode/coll.h>
-#include <unicode/sortkey.h>
 
 #include "mongo/util/assert_util.h"
 
@@ -77,26 +76,31 @@ CollatorInterface::ComparisonKey CollatorInterfaceICU::getComparisonKey(
     StringData stringData) const {
     // A StringPiece is ICU's StringData. They are logically the same abstraction.
     const icu::StringPiece stringPiece(stringData.rawData(), stringData.size());
-
-    UErrorCode status = U_ZERO_ERROR;
-    icu::CollationKey icuKey;
-    _collator->getCollationKey(icu::UnicodeString::fromUTF8(stringPiece), icuKey, status);
-
-    // Any sequence of bytes, even invalid UTF-8, has defined comparison behavior in ICU (invalid
-    // subsequences are weighted as the replacement character, U+FFFD). A non-ok error code is only
-    // expected when a memory allocation fails inside ICU, which we consider fatal to the process.
-    fassert(34439, U_SUCCESS(status));
-
-    int32_t keyLength;
-    const uint8_t* keyBuffer = icuKey.getByteArray(keyLength);
+    const icu::UnicodeString unicodeStr = icu::UnicodeString::fromUTF8(stringPiece);
+
+    // Generate the sort key directly into a stack buffer, which avoids the internal heap
+    // allocations an icu::CollationKey performs before we would copy the bytes back out again.
+    // Most sort keys fit; when one does not, getSortKey() reports the length it needs and we
+    // regenerate it into exactly-sized storage.
+    uint8_t buffer[256];
+    const int32_t keyLength = _collator->getSortKey(unicodeStr, buffer, sizeof(buffer));
     invariant(keyLength > 0);
-    invariant(keyBuffer);
 
-    // The last byte of the sort key should always be null. When we construct the comparison key, we
-    // omit the trailing null byte.
-    invariant(keyBuffer[keyLength - 1u] == '\0');
-    const char* charBuffer = reinterpret_cast<const char*>(keyBuffer);
-    return makeComparisonKey(std::string(charBuffer, keyLength - 1u));
+    if (keyLength <= static_cast<int32_t>(sizeof(buffer))) {
+        // The last byte of the sort key should always be null. When we construct the comparison
+        // key, we omit the trailing null byte.
+        invariant(buffer[keyLength - 1] == '\0');
+        return makeComparisonKey(std::string(reinterpret_cast<const char*>(buffer), keyLength - 1));
+    }
+
+    std::string key;
+    key.resize(keyLength);
+    const int32_t fullKeyLength =
+        _collator->getSortKey(unicodeStr, reinterpret_cast<uint8_t*>(&key[0]), keyLength);
+    invariant(fullKeyLength == keyLength);
+    invariant(key.back() == '\0');
+    key.pop_back();
+    return makeComparisonKey(std::move(key));
 }
 
 }  // namespace mongo
@@ -35,6 +35,7 @@
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/query/find_common.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/rpc/reply_builder_interface.h"
 
@@ -83,6 +84,20 @@ public:
 
     void append(const BSONObj& obj) {
         invariant(_active);
+        if (!_reservedFullBatchBytes &&
+            bytesUsed() + obj.objsize() > FindCommon::kInitReplyBufferSize) {
+            // Growing the reply buffer geometrically while a large batch is appended into it
+            // copies the batch roughly one extra time across the reallocations. Once the batch
+            // outgrows the initial reply buffer, reserve the rest of the per-batch budget up
+            // front so the remaining appends never reallocate. Small responses stay below this
+            // threshold and keep their small buffer. The extra 1K mirrors the getMore reply
+            // reservation and covers the batch's array element overhead.
+            const size_t fullBatchBytes = FindCommon::kMaxBytesToReturnToClientAtOnce + 1024u;
+            if (bytesUsed() < fullBatchBytes) {
+                _replyBuilder->reserveBytes(fullBatchBytes - bytesUsed());
+            }
+            _reservedFullBatchBytes = true;
+        }
         if (_options.useDocumentSequences) {
             _docSeqBuilder->append(obj);
         } else {
@@ -126,6 +141,7 @@ private:
     boost::optional<OpMsgBuilder::DocSequenceBuilder> _docSeqBuilder;
 
     bool _active = true;
+    bool _reservedFullBatchBytes = false;
     long long _numDocs = 0;
     BSONObj _postBatchResumeToken;
     bool _partialResultsReturned = false;
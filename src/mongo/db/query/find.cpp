@@ -416,7 +416,9 @@ Message getMore(OperationContext* opCtx,
     exec->reattachToOperationContext(opCtx);
     exec->restoreState(readLock ? &readLock->getCollection() : nullptr);
 
-    auto planSummary = exec->getPlanExplainer().getPlanSummary();
+    // The cursor caches the plan summary string at construction, so there is no need to regenerate
+    // it from the explainer for every batch.
+    auto planSummary = cursorPin->getPlanSummary();
     {
         stdx::lock_guard<Client> lk(*opCtx->getClient());
         curOp.setPlanSummary_inlock(planSummary);
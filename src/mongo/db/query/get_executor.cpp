@@ -40,6 +40,7 @@
 #include "mongo/base/error_codes.h"
 #include "mongo/base/parse_number.h"
 #include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/curop.h"
 #include "mongo/db/exec/cached_plan.h"
 #include "mongo/db/exec/collection_scan.h"
 #include "mongo/db/exec/count.h"
@@ -99,6 +100,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/scripting/engine.h"
 #include "mongo/util/str.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -621,8 +623,7 @@ public:
                                     "query"_attr = redact(_cq->toStringShort()));
                     }
 
-                    return buildCachedPlan(
-                        std::move(querySolution), plannerParams, cs->decisionWorks);
+                    return buildCachedPlan(std::move(querySolution), plannerParams, *cs);
                 }
             }
         }
@@ -715,7 +716,7 @@ protected:
      */
     virtual std::unique_ptr<ResultType> buildCachedPlan(std::unique_ptr<QuerySolution> solution,
                                                         const QueryPlannerParams& plannerParams,
-                                                        size_t decisionWorks) = 0;
+                                                        const CachedSolution& cachedSolution) = 0;
 
     /**
      * Constructs a special PlanStage tree for rooted $or queries. Each clause of the $or is planned
@@ -831,20 +832,22 @@ protected:
     std::unique_ptr<ClassicPrepareExecutionResult> buildCachedPlan(
         std::unique_ptr<QuerySolution> solution,
         const QueryPlannerParams& plannerParams,
-        size_t decisionWorks) final {
+        const CachedSolution& cachedSolution) final {
         auto result = makeResult();
         auto&& root = buildExecutableTree(*solution);
 
         // Add a CachedPlanStage on top of the previous root.
         //
         // 'decisionWorks' is used to determine whether the existing cache entry should
-        // be evicted, and the query replanned.
+        // be evicted, and the query replanned. 'trialsWithoutReplan' is the entry's replan-free
+        // history, which may allow the trial period to be skipped.
         result->emplace(std::make_unique<CachedPlanStage>(_cq->getExpCtxRaw(),
                                                           _collection,
                                                           _ws,
                                                           _cq,
                                                           plannerParams,
-                                                          decisionWorks,
+                                                          cachedSolution.decisionWorks,
+                                                          cachedSolution.trialsWithoutReplan,
                                                           std::move(root)),
                         std::move(solution));
         return result;
@@ -918,11 +921,11 @@ protected:
     std::unique_ptr<SlotBasedPrepareExecutionResult> buildCachedPlan(
         std::unique_ptr<QuerySolution> solution,
         const QueryPlannerParams& plannerParams,
-        size_t decisionWorks) final {
+        const CachedSolution& cachedSolution) final {
         auto result = makeResult();
         auto execTree = buildExecutableTree(*solution);
         result->emplace(std::move(execTree), std::move(solution));
-        result->setDecisionWorks(decisionWorks);
+        result->setDecisionWorks(cachedSolution.decisionWorks);
         return result;
     }
 
@@ -1105,11 +1108,17 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutor(
     std::unique_ptr<CanonicalQuery> canonicalQuery,
     PlanYieldPolicy::YieldPolicy yieldPolicy,
     size_t plannerOptions) {
-    return feature_flags::gSBE.isEnabledAndIgnoreFCV()
+    // Time how long it takes to select a plan and build the execution tree so the breakdown is
+    // available in the slow query log and the profiler. Runtime plan selection that happens
+    // during execution is reported separately via 'fromMultiPlanner'.
+    Timer planningTimer;
+    auto executor = feature_flags::gSBE.isEnabledAndIgnoreFCV()
         ? getSlotBasedExecutor(
               opCtx, collection, std::move(canonicalQuery), yieldPolicy, plannerOptions)
         : getClassicExecutor(
               opCtx, collection, std::move(canonicalQuery), yieldPolicy, plannerOptions);
+    CurOp::get(opCtx)->debug().planningTime = Microseconds(planningTimer.micros());
+    return executor;
 }
 
 //
@@ -834,16 +834,41 @@ void IndexBoundsBuilder::_translatePredicate(const MatchExpression* expr,
 
         IndexBoundsBuilder::BoundsTightness tightness;
         bool arrayOrNullPresent = false;
+        // Plain point equalities are appended into one shared buffer so that a large $in builds a
+        // single owned BSONObj instead of one small allocation per element; the point intervals
+        // then hold BSONElement views into the shared buffer. Null and array equalities expand to
+        // multiple intervals and hashed indexes transform each element individually, so those go
+        // through the generic per-element path.
+        BSONObjBuilder sharedPointsBob;
+        bool haveSharedPoints = false;
         for (auto&& equality : ime->getEqualities()) {
+            const bool isNullOrArray =
+                equality.type() == BSONType::jstNULL || equality.type() == BSONType::Array;
+            if (!isHashed && !isNullOrArray) {
+                CollationIndexKey::collationAwareIndexKeyAppend(
+                    equality, index.collator, &sharedPointsBob);
+                haveSharedPoints = true;
+                continue;
+            }
             translateEquality(equality, index, isHashed, oilOut, &tightness);
             // The ordering invariant of oil has been violated by the call to translateEquality.
-            arrayOrNullPresent = arrayOrNullPresent || equality.type() == BSONType::jstNULL ||
-                equality.type() == BSONType::Array;
+            arrayOrNullPresent = arrayOrNullPresent || isNullOrArray;
             if (tightness != IndexBoundsBuilder::EXACT) {
                 *tightnessOut = tightness;
             }
         }
 
+        if (haveSharedPoints) {
+            BSONObj sharedPoints = sharedPointsBob.obj();
+            for (auto&& elt : sharedPoints) {
+                Interval interval;
+                interval._intervalData = sharedPoints;
+                interval.startInclusive = interval.endInclusive = true;
+                interval.start = interval.end = elt;
+                oilOut->intervals.push_back(std::move(interval));
+            }
+        }
+
         for (auto&& regex : ime->getRegexes()) {
             translateRegex(regex.get(), index, oilOut, &tightness);
             if (tightness != IndexBoundsBuilder::EXACT) {
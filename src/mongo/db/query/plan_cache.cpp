@@ -165,7 +165,9 @@ bool PlanCache::shouldCacheQuery(const CanonicalQuery& query) {
 }
 
 CachedSolution::CachedSolution(const PlanCacheEntry& entry)
-    : plannerData(entry.plannerData->clone()), decisionWorks(entry.works) {}
+    : plannerData(entry.plannerData->clone()),
+      decisionWorks(entry.works),
+      trialsWithoutReplan(entry.trialsWithoutReplan) {}
 
 //
 // PlanCacheEntry
@@ -261,13 +263,15 @@ std::unique_ptr<PlanCacheEntry> PlanCacheEntry::clone() const {
         debugInfoCopy.emplace(*debugInfo);
     }
 
-    return std::unique_ptr<PlanCacheEntry>(new PlanCacheEntry(plannerData->clone(),
-                                                              timeOfCreation,
-                                                              queryHash,
-                                                              planCacheKey,
-                                                              isActive,
-                                                              works,
-                                                              std::move(debugInfoCopy)));
+    auto entry = std::unique_ptr<PlanCacheEntry>(new PlanCacheEntry(plannerData->clone(),
+                                                                    timeOfCreation,
+                                                                    queryHash,
+                                                                    planCacheKey,
+                                                                    isActive,
+                                                                    works,
+                                                                    std::move(debugInfoCopy)));
+    entry->trialsWithoutReplan = trialsWithoutReplan;
+    return entry;
 }
 
 uint64_t PlanCacheEntry::CreatedFromQuery::estimateObjectSizeInBytes() const {
@@ -431,9 +435,31 @@ std::string SolutionCacheData::toString() const {
 // PlanCache
 //
 
-PlanCache::PlanCache() : PlanCache(internalQueryCacheMaxEntriesPerCollection.load()) {}
+namespace {
+// Number of partitions used by the default constructor. Kept modest: each partition receives an
+// equal share of the entry budget, and too many partitions would make the per-partition LRU too
+// small to retain a useful working set.
+const size_t kNumPlanCachePartitions = 8;
+}  // namespace
+
+PlanCache::PlanCache()
+    : PlanCache(internalQueryCacheMaxEntriesPerCollection.load(), kNumPlanCachePartitions) {}
+
+PlanCache::PlanCache(size_t size) : PlanCache(size, 1) {}
 
-PlanCache::PlanCache(size_t size) : _cache(size) {}
+PlanCache::PlanCache(size_t size, size_t numPartitions) {
+    invariant(numPartitions > 0);
+    // Divide the entry budget evenly among the partitions, giving each at least one slot.
+    const size_t partitionSize = std::max(size_t(1), (size + numPartitions - 1) / numPartitions);
+    _partitions.reserve(numPartitions);
+    for (size_t i = 0; i < numPartitions; ++i) {
+        _partitions.push_back(std::make_unique<Partition>(partitionSize));
+    }
+}
+
+PlanCache::Partition& PlanCache::_partition(const PlanCacheKey& key) const {
+    return *_partitions[PlanCacheKeyHasher{}(key) % _partitions.size()];
+}
 
 PlanCache::~PlanCache() {}
 
@@ -586,7 +612,8 @@ Status PlanCache::set(const CanonicalQuery& query,
                                              }},
                     why->stats);
     const auto key = computeKey(query);
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
     bool isNewEntryActive = false;
     uint32_t queryHash;
     uint32_t planCacheKey;
@@ -597,7 +624,7 @@ Status PlanCache::set(const CanonicalQuery& query,
         queryHash = canonical_query_encoder::computeHash(key.getStableKeyStringData());
     } else {
         PlanCacheEntry* oldEntry = nullptr;
-        Status cacheStatus = _cache.get(key, &oldEntry);
+        Status cacheStatus = partition.entries.get(key, &oldEntry);
         invariant(cacheStatus.isOK() || cacheStatus == ErrorCodes::NoSuchKey);
         if (oldEntry) {
             queryHash = oldEntry->queryHash;
@@ -624,7 +651,7 @@ Status PlanCache::set(const CanonicalQuery& query,
     auto newEntry(PlanCacheEntry::create(
         solns, std::move(why), query, queryHash, planCacheKey, now, isNewEntryActive, newWorks));
 
-    std::unique_ptr<PlanCacheEntry> evictedEntry = _cache.add(key, newEntry.release());
+    std::unique_ptr<PlanCacheEntry> evictedEntry = partition.entries.add(key, newEntry.release());
 
     if (nullptr != evictedEntry.get()) {
         LOGV2_DEBUG(20942,
@@ -644,15 +671,31 @@ void PlanCache::deactivate(const CanonicalQuery& query) {
     }
 
     PlanCacheKey key = computeKey(query);
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
     PlanCacheEntry* entry = nullptr;
-    Status cacheStatus = _cache.get(key, &entry);
+    Status cacheStatus = partition.entries.get(key, &entry);
     if (!cacheStatus.isOK()) {
         invariant(cacheStatus == ErrorCodes::NoSuchKey);
         return;
     }
     invariant(entry);
     entry->isActive = false;
+    entry->trialsWithoutReplan = 0;
+}
+
+void PlanCache::reportTrialSuccess(const CanonicalQuery& query) {
+    PlanCacheKey key = computeKey(query);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
+    PlanCacheEntry* entry = nullptr;
+    Status cacheStatus = partition.entries.get(key, &entry);
+    if (!cacheStatus.isOK()) {
+        invariant(cacheStatus == ErrorCodes::NoSuchKey);
+        return;
+    }
+    invariant(entry);
+    ++entry->trialsWithoutReplan;
 }
 
 PlanCache::GetResult PlanCache::get(const CanonicalQuery& query) const {
@@ -661,9 +704,10 @@ PlanCache::GetResult PlanCache::get(const CanonicalQuery& query) const {
 }
 
 PlanCache::GetResult PlanCache::get(const PlanCacheKey& key) const {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
     PlanCacheEntry* entry = nullptr;
-    Status cacheStatus = _cache.get(key, &entry);
+    Status cacheStatus = partition.entries.get(key, &entry);
     if (!cacheStatus.isOK()) {
         invariant(cacheStatus == ErrorCodes::NoSuchKey);
         return {CacheEntryState::kNotPresent, nullptr};
@@ -676,13 +720,17 @@ PlanCache::GetResult PlanCache::get(const PlanCacheKey& key) const {
 }
 
 Status PlanCache::remove(const CanonicalQuery& canonicalQuery) {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-    return _cache.remove(computeKey(canonicalQuery));
+    const auto key = computeKey(canonicalQuery);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
+    return partition.entries.remove(key);
 }
 
 void PlanCache::clear() {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-    _cache.clear();
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> cacheLock(partition->mutex);
+        partition->entries.clear();
+    }
 }
 
 PlanCacheKey PlanCache::computeKey(const CanonicalQuery& cq) const {
@@ -696,9 +744,10 @@ PlanCacheKey PlanCache::computeKey(const CanonicalQuery& cq) const {
 StatusWith<std::unique_ptr<PlanCacheEntry>> PlanCache::getEntry(const CanonicalQuery& query) const {
     PlanCacheKey key = computeKey(query);
 
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+    auto& partition = _partition(key);
+    stdx::lock_guard<Latch> cacheLock(partition.mutex);
     PlanCacheEntry* entry;
-    Status cacheStatus = _cache.get(key, &entry);
+    Status cacheStatus = partition.entries.get(key, &entry);
     if (!cacheStatus.isOK()) {
         return cacheStatus;
     }
@@ -708,20 +757,26 @@ StatusWith<std::unique_ptr<PlanCacheEntry>> PlanCache::getEntry(const CanonicalQ
 }
 
 std::vector<std::unique_ptr<PlanCacheEntry>> PlanCache::getAllEntries() const {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
     std::vector<std::unique_ptr<PlanCacheEntry>> entries;
 
-    for (auto&& cacheEntry : _cache) {
-        auto entry = cacheEntry.second;
-        entries.push_back(std::unique_ptr<PlanCacheEntry>(entry->clone()));
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> cacheLock(partition->mutex);
+        for (auto&& cacheEntry : partition->entries) {
+            auto entry = cacheEntry.second;
+            entries.push_back(std::unique_ptr<PlanCacheEntry>(entry->clone()));
+        }
     }
 
     return entries;
 }
 
 size_t PlanCache::size() const {
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-    return _cache.size();
+    size_t size = 0;
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> cacheLock(partition->mutex);
+        size += partition->entries.size();
+    }
+    return size;
 }
 
 void PlanCache::notifyOfIndexUpdates(const std::vector<CoreIndexInfo>& indexCores) {
@@ -732,13 +787,15 @@ std::vector<BSONObj> PlanCache::getMatchingStats(
     const std::function<BSONObj(const PlanCacheEntry&)>& serializationFunc,
     const std::function<bool(const BSONObj&)>& filterFunc) const {
     std::vector<BSONObj> results;
-    stdx::lock_guard<Latch> cacheLock(_cacheMutex);
 
-    for (auto&& cacheEntry : _cache) {
-        const auto entry = cacheEntry.second;
-        auto serializedEntry = serializationFunc(*entry);
-        if (filterFunc(serializedEntry)) {
-            results.push_back(serializedEntry);
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> cacheLock(partition->mutex);
+        for (auto&& cacheEntry : partition->entries) {
+            const auto entry = cacheEntry.second;
+            auto serializedEntry = serializationFunc(*entry);
+            if (filterFunc(serializedEntry)) {
+                results.push_back(serializedEntry);
+            }
         }
     }
 
@@ -30,7 +30,9 @@
 #pragma once
 
 #include <boost/optional/optional.hpp>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/query/canonical_query.h"
@@ -280,6 +282,10 @@ public:
     // The number of work cycles taken to decide on a winning plan when the plan was first
     // cached.
     const size_t decisionWorks;
+
+    // The number of consecutive trial periods this entry has completed without triggering a
+    // replan since it last became active.
+    const size_t trialsWithoutReplan;
 };
 
 /**
@@ -388,6 +394,12 @@ public:
     // cause this value to be increased.
     size_t works = 0;
 
+    // The number of consecutive trial periods completed without triggering a replan since this
+    // entry last became active. Reset whenever the entry is deactivated. Entries with a long
+    // replan-free history may skip the trial period entirely; see
+    // 'internalQueryCacheTrialSkipThreshold'.
+    size_t trialsWithoutReplan = 0;
+
     // Optional debug info containing detailed statistics. Includes a description of the query which
     // resulted in this plan cache's creation as well as runtime stats from the multi-planner trial
     // period that resulted in this cache entry.
@@ -471,12 +483,24 @@ public:
     static bool shouldCacheQuery(const CanonicalQuery& query);
 
     /**
-     * If omitted, namespace set to empty string.
+     * If omitted, namespace set to empty string. The entry budget is taken from
+     * 'internalQueryCacheMaxEntriesPerCollection' and the entries are spread across several
+     * independently locked partitions.
      */
     PlanCache();
 
+    /**
+     * Constructs a cache holding at most 'size' entries in a single partition. Eviction order is
+     * therefore the exact cache-wide LRU order, which several tests depend on.
+     */
     PlanCache(size_t size);
 
+    /**
+     * Constructs a cache whose entry budget of 'size' is divided evenly across 'numPartitions'
+     * partitions, each protected by its own mutex.
+     */
+    PlanCache(size_t size, size_t numPartitions);
+
     ~PlanCache();
 
     /**
@@ -506,6 +530,12 @@ public:
      */
     void deactivate(const CanonicalQuery& query);
 
+    /**
+     * Records that the cached plan for 'query' completed a trial period without triggering a
+     * replan, extending the entry's replan-free history. A no-op if the entry no longer exists.
+     */
+    void reportTrialSuccess(const CanonicalQuery& query);
+
     /**
      * Look up the cached data access for the provided 'query'.  Used by the query planner
      * to shortcut planning.
@@ -600,10 +630,29 @@ private:
                                    size_t newWorks,
                                    double growthCoefficient);
 
-    LRUKeyValue<PlanCacheKey, PlanCacheEntry, PlanCacheKeyHasher> _cache;
+    /**
+     * One independently locked slice of the cache. Each plan cache key maps to exactly one
+     * partition, selected by its hash, so lookups and writes for different query shapes no longer
+     * serialize on a single cache-wide mutex.
+     */
+    struct Partition {
+        explicit Partition(size_t maxSize) : entries(maxSize) {}
+
+        LRUKeyValue<PlanCacheKey, PlanCacheEntry, PlanCacheKeyHasher> entries;
+
+        // Protects 'entries'. Lookups promote the found entry in the LRU list, so readers must
+        // also hold the mutex in exclusive mode.
+        mutable Mutex mutex = MONGO_MAKE_LATCH("PlanCache::Partition::mutex");
+    };
+
+    /**
+     * Returns the partition responsible for 'key'.
+     */
+    Partition& _partition(const PlanCacheKey& key) const;
 
-    // Protects _cache.
-    mutable Mutex _cacheMutex = MONGO_MAKE_LATCH("PlanCache::_cacheMutex");
+    // The partitions are created at construction time and never resized, so the vector itself
+    // needs no synchronization.
+    std::vector<std::unique_ptr<Partition>> _partitions;
 
     // Holds computed information about the collection's indexes.  Used for generating plan
     // cache keys.
@@ -574,6 +574,45 @@ TEST(PlanCacheTest, PlanCacheLRUPolicyRemovesInactiveEntries) {
     ASSERT_EQ(planCache.get(*cqC).state, PlanCache::CacheEntryState::kPresentInactive);
 }
 
+TEST(PlanCacheTest, PartitionedPlanCacheBasicOperations) {
+    // Use more partitions than entries so that some partitions stay empty.
+    const size_t kCacheSize = 16;
+    const size_t kNumPartitions = 4;
+    PlanCache planCache(kCacheSize, kNumPartitions);
+    QueryTestServiceContext serviceContext;
+
+    // Add entries for several query shapes, which will hash to different partitions.
+    std::vector<unique_ptr<CanonicalQuery>> queries;
+    std::string queryString = "{a: 1}";
+    for (size_t i = 0; i < 8; ++i) {
+        queryString[1] = 'a' + i;
+        unique_ptr<CanonicalQuery> cq(canonicalize(queryString));
+        ASSERT_EQ(planCache.get(*cq).state, PlanCache::CacheEntryState::kNotPresent);
+        addCacheEntryForShape(*cq.get(), &planCache);
+        queries.push_back(std::move(cq));
+    }
+
+    // All entries must be retrievable regardless of which partition they landed in, and size()
+    // must aggregate across partitions.
+    ASSERT_EQ(planCache.size(), 8U);
+    for (auto&& cq : queries) {
+        ASSERT_EQ(planCache.get(*cq).state, PlanCache::CacheEntryState::kPresentInactive);
+    }
+    ASSERT_EQ(planCache.getAllEntries().size(), 8U);
+
+    // remove() must find the entry in its partition.
+    ASSERT_OK(planCache.remove(*queries[0]));
+    ASSERT_EQ(planCache.get(*queries[0]).state, PlanCache::CacheEntryState::kNotPresent);
+    ASSERT_EQ(planCache.size(), 7U);
+
+    // clear() must empty every partition.
+    planCache.clear();
+    ASSERT_EQ(planCache.size(), 0U);
+    for (auto&& cq : queries) {
+        ASSERT_EQ(planCache.get(*cq).state, PlanCache::CacheEntryState::kNotPresent);
+    }
+}
+
 TEST(PlanCacheTest, PlanCacheRemoveDeletesInactiveEntries) {
     PlanCache planCache;
     unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
@@ -31,6 +31,7 @@
 
 #include "mongo/db/query/plan_yield_policy.h"
 
+#include "mongo/db/concurrency/locker.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
@@ -83,11 +84,38 @@ Status PlanYieldPolicy::yieldOrInterrupt(OperationContext* opCtx,
     // again right away. We delay the resetTimer() call so that the clock doesn't start ticking
     // until after we return from the yield.
     ON_BLOCK_EXIT([this]() { resetTimer(); });
+
+    if (!_forceYield && canSkipYield(opCtx)) {
+        // Nothing is waiting for what this operation holds, so releasing and reacquiring the
+        // snapshot and locks would benefit no one. Skip the save-restore cycle but still honor
+        // interrupt, effectively extending the yield interval while the plan runs uncontended.
+        _consecutiveYieldsSkipped++;
+        return opCtx->checkForInterruptNoAssert();
+    }
+
+    _consecutiveYieldsSkipped = 0;
     _forceYield = false;
 
     return yield(opCtx, whileYieldingFn);
 }
 
+bool PlanYieldPolicy::canSkipYield(OperationContext* opCtx) const {
+    if (_policy != YieldPolicy::YIELD_AUTO) {
+        // The testing policies must reach yield() to time out or kill the plan, and
+        // WRITE_CONFLICT_RETRY_ONLY yields only storage resources, which skipping would pin.
+        return false;
+    }
+    if (_consecutiveYieldsSkipped >= kMaxConsecutiveYieldsSkipped) {
+        return false;
+    }
+    // If the throttling tickets are exhausted, releasing ours lets a queued operation run even
+    // though no lock conflict exists.
+    if (Locker::isGlobalThrottlingExhausted()) {
+        return false;
+    }
+    return !opCtx->lockState()->hasWaitersOnAnyHeldLock();
+}
+
 void PlanYieldPolicy::handleDuringYieldFailpoints(OperationContext* opCtx,
                                                   const NamespaceString& planExecNs) {
     auto failPointHang = [opCtx, &planExecNs](FailPoint* fp) {
@@ -257,10 +257,23 @@ private:
      */
     virtual void preCheckInterruptOnly(OperationContext* opCtx) {}
 
+    /**
+     * Returns true if the pending yield may be skipped because no other operation is waiting
+     * for the locks or throttling tickets this operation holds, so the save-restore cycle
+     * would benefit no one. Only YIELD_AUTO plans may skip.
+     */
+    bool canSkipYield(OperationContext* opCtx) const;
+
     const YieldPolicy _policy;
 
     bool _forceYield = false;
     ElapsedTracker _elapsedTracker;
+
+    // Number of consecutive yield points at which the save-restore cycle was skipped because
+    // nothing was waiting. Bounded by kMaxConsecutiveYieldsSkipped so that the storage
+    // snapshot is still refreshed and waiters are re-checked at a reasonable cadence.
+    static constexpr int kMaxConsecutiveYieldsSkipped = 7;
+    int _consecutiveYieldsSkipped = 0;
 };
 
 }  // namespace mongo
@@ -52,6 +52,7 @@
 #include "mongo/db/query/planner_access.h"
 #include "mongo/db/query/planner_analysis.h"
 #include "mongo/db/query/planner_ixselect.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner_common.h"
 #include "mongo/db/query/query_solution.h"
 #include "mongo/logv2/log.h"
@@ -323,6 +324,83 @@ static BSONObj finishMaxObj(const IndexEntry& indexEntry,
     }
 }
 
+/**
+ * Returns whether 'shorterKp' is a key-pattern prefix of 'longerKp': every element of 'shorterKp'
+ * must be binary-equal (same field name and same direction) to the corresponding element of
+ * 'longerKp'.
+ */
+static bool isKeyPatternPrefix(const BSONObj& shorterKp, const BSONObj& longerKp) {
+    BSONObjIterator shortIt(shorterKp);
+    BSONObjIterator longIt(longerKp);
+    while (shortIt.more()) {
+        if (!longIt.more() || !shortIt.next().binaryEqual(longIt.next())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Removes from 'relevantIndices' any index that cannot contribute a plan for 'query' that another
+ * relevant index does not already provide, to shrink the enumeration search space on collections
+ * with many overlapping indexes. An index is only pruned when another relevant index forms a
+ * strict key-pattern prefix of it, the query involves none of its extra trailing fields, and the
+ * pair is interchangeable for index bounds purposes: both plain btree indexes with matching
+ * collations and with no sparseness, partial filters or multikey paths. Queries with a sort or a
+ * projection are left alone entirely, since the trailing fields of the longer index could provide
+ * a sort order or a covered plan that the prefix index cannot.
+ */
+static void pruneRedundantIndexCandidates(const CanonicalQuery& query,
+                                          const stdx::unordered_set<std::string>& fields,
+                                          std::vector<IndexEntry>* relevantIndices) {
+    if (!query.getQueryRequest().getSort().isEmpty() ||
+        !query.getQueryRequest().getProj().isEmpty()) {
+        return;
+    }
+
+    auto interchangeable = [](const IndexEntry& a, const IndexEntry& b) {
+        return a.type == IndexType::INDEX_BTREE && b.type == IndexType::INDEX_BTREE &&
+            !a.multikey && !b.multikey && !a.sparse && !b.sparse && !a.filterExpr &&
+            !b.filterExpr && CollatorInterface::collatorsMatch(a.collator, b.collator);
+    };
+
+    std::vector<IndexEntry> kept;
+    kept.reserve(relevantIndices->size());
+    for (const auto& candidate : *relevantIndices) {
+        bool redundant = false;
+        for (const auto& other : *relevantIndices) {
+            if (other.keyPattern.nFields() >= candidate.keyPattern.nFields() ||
+                !interchangeable(candidate, other) ||
+                !isKeyPatternPrefix(other.keyPattern, candidate.keyPattern)) {
+                continue;
+            }
+            // 'other' is a strict key-pattern prefix of 'candidate', so 'candidate' is redundant
+            // unless the query involves one of its extra trailing fields.
+            redundant = true;
+            BSONObjIterator it(candidate.keyPattern);
+            for (int position = 0; it.more(); ++position) {
+                BSONElement elt = it.next();
+                if (position >= other.keyPattern.nFields() && fields.count(elt.fieldName())) {
+                    redundant = false;
+                    break;
+                }
+            }
+            if (redundant) {
+                LOGV2_DEBUG(5837139,
+                            2,
+                            "Pruning redundant index from planning",
+                            "prunedIndex"_attr = candidate.toString(),
+                            "prefixIndex"_attr = other.toString());
+                break;
+            }
+        }
+        if (!redundant) {
+            kept.push_back(candidate);
+        }
+    }
+    *relevantIndices = std::move(kept);
+}
+
 std::unique_ptr<QuerySolution> buildCollscanSoln(const CanonicalQuery& query,
                                                  bool tailable,
                                                  const QueryPlannerParams& params) {
@@ -699,6 +777,9 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
 
     if (!hintedIndexEntry) {
         relevantIndices = QueryPlannerIXSelect::findRelevantIndices(fields, fullIndexList);
+        if (internalQueryPlannerPruneRedundantIndexes.load()) {
+            pruneRedundantIndexCandidates(query, fields, &relevantIndices);
+        }
     } else {
         relevantIndices = fullIndexList;
 
@@ -238,6 +238,11 @@ struct PlanStageData {
 
 /**
  * A stage builder which builds an executable tree using slot-based PlanStages.
+ *
+ * A new tree is lowered from the QuerySolution for every execution, even when the solution itself
+ * came from the plan cache. Caching the built tree instead would require the query's constants to
+ * be auto-parameterized during canonicalization and rebound into slots per execution; until such
+ * parameterization exists, a built tree is only valid for the exact constants it was built with.
  */
 class SlotBasedStageBuilder final : public StageBuilder<sbe::PlanStage> {
 public:
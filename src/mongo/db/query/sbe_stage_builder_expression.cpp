@@ -474,6 +474,7 @@ public:
     void visit(ExpressionFromAccumulator<AccumulatorSum>* expr) final {}
     void visit(ExpressionFromAccumulator<AccumulatorMergeObjects>* expr) final {}
     void visit(ExpressionTests::Testable* expr) final {}
+    void visit(ExpressionInternalCachedSubexpression* expr) final {}
     void visit(ExpressionInternalJsEmit* expr) final {}
     void visit(ExpressionInternalFindSlice* expr) final {}
     void visit(ExpressionInternalFindPositional* expr) final {}
@@ -672,6 +673,7 @@ public:
     void visit(ExpressionFromAccumulator<AccumulatorSum>* expr) final {}
     void visit(ExpressionFromAccumulator<AccumulatorMergeObjects>* expr) final {}
     void visit(ExpressionTests::Testable* expr) final {}
+    void visit(ExpressionInternalCachedSubexpression* expr) final {}
     void visit(ExpressionInternalJsEmit* expr) final {}
     void visit(ExpressionInternalFindSlice* expr) final {}
     void visit(ExpressionInternalFindPositional* expr) final {}
@@ -2549,6 +2551,9 @@ public:
     void visit(ExpressionTests::Testable* expr) final {
         unsupportedExpression("$test");
     }
+    void visit(ExpressionInternalCachedSubexpression* expr) final {
+        unsupportedExpression("$internalCachedSubexpression");
+    }
     void visit(ExpressionInternalJsEmit* expr) final {
         unsupportedExpression("$internalJsEmit");
     }
@@ -126,16 +126,15 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
     const std::vector<BSONObj>::const_iterator end) {
     auto iter = begin;
     while (iter != end) {
-        std::vector<RecordId> locs;
         Status status = writeConflictRetry(
             _opCtx.get(), "CollectionBulkLoaderImpl/insertDocumentsUncapped", _nss.ns(), [&] {
                 WriteUnitOfWork wunit(_opCtx.get());
                 auto insertIter = iter;
                 int bytesInBlock = 0;
-                locs.clear();
 
+                RecordId loc;
                 auto onRecordInserted = [&](const RecordId& location) {
-                    locs.emplace_back(location);
+                    loc = location;
                     return Status::OK();
                 };
 
@@ -143,40 +142,33 @@ Status CollectionBulkLoaderImpl::_insertDocumentsForUncappedCollection(
                     const auto& doc = *insertIter++;
                     bytesInBlock += doc.objsize();
                     // This version of insert will not update any indexes.
-                    const auto status =
+                    auto status =
                         (*_collection)
                             ->insertDocumentForBulkLoader(_opCtx.get(), doc, onRecordInserted);
                     if (!status.isOK()) {
                         return status;
                     }
+
+                    // Insert the index entries into the external sorter in the same storage
+                    // transaction, so each batch commits exactly once. This will not update
+                    // pre-existing indexes, but may modify the durable record store which can
+                    // throw a write conflict exception.
+                    status = _addDocumentToIndexBlocks(doc, loc);
+                    if (!status.isOK()) {
+                        return status;
+                    }
                 }
 
                 wunit.commit();
+                // Only advance the batch cursor once the transaction commits, so a write
+                // conflict retry starts over from the beginning of the batch.
+                iter = insertIter;
                 return Status::OK();
             });
 
         if (!status.isOK()) {
             return status;
         }
-
-        // Inserts index entries into the external sorter. This will not update pre-existing
-        // indexes. Wrap this in a WUOW since the index entry insertion may modify the durable
-        // record store which can throw a write conflict exception.
-        status = writeConflictRetry(_opCtx.get(), "_addDocumentToIndexBlocks", _nss.ns(), [&] {
-            WriteUnitOfWork wunit(_opCtx.get());
-            for (size_t index = 0; index < locs.size(); ++index) {
-                status = _addDocumentToIndexBlocks(*iter++, locs.at(index));
-                if (!status.isOK()) {
-                    return status;
-                }
-            }
-            wunit.commit();
-            return Status::OK();
-        });
-
-        if (!status.isOK()) {
-            return status;
-        }
     }
     return Status::OK();
 }
@@ -31,7 +31,10 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
+
 #include "mongo/base/string_data.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands/list_collections_filter.h"
 #include "mongo/db/index_build_entry_helpers.h"
 #include "mongo/db/index_builds_coordinator.h"
@@ -39,9 +42,11 @@
 #include "mongo/db/repl/collection_cloner.h"
 #include "mongo/db/repl/database_cloner_gen.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/repl/replication_auth.h"
 #include "mongo/db/wire_version.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/get_status_from_command_result.h"
+#include "mongo/stdx/thread.h"
 
 #include "mongo/util/assert_util.h"
 
@@ -56,6 +61,10 @@ MONGO_FAIL_POINT_DEFINE(initialSyncHangDuringCollectionClone);
 // DBClientConnection, optionally limited to a specific collection.
 MONGO_FAIL_POINT_DEFINE(initialSyncHangCollectionClonerAfterHandlingBatchResponse);
 
+// A collection is only cloned with concurrent range cursors when every range would contain at
+// least this much data; splitting small collections just wastes connections on the sync source.
+constexpr long long kMinBytesPerIdRange = 64 * 1024 * 1024;
+
 CollectionCloner::CollectionCloner(const NamespaceString& sourceNss,
                                    const CollectionOptions& collectionOptions,
                                    InitialSyncSharedData* sharedData,
@@ -69,6 +78,7 @@ CollectionCloner::CollectionCloner(const NamespaceString& sourceNss,
       _collectionOptions(collectionOptions),
       _sourceDbAndUuid(NamespaceString("UNINITIALIZED")),
       _collectionClonerBatchSize(collectionClonerBatchSize),
+      _maxParallelRanges(collectionClonerMaxParallelRanges),
       _countStage("count", this, &CollectionCloner::countStage),
       _listIndexesStage("listIndexes", this, &CollectionCloner::listIndexesStage),
       _createCollectionStage("createCollection", this, &CollectionCloner::createCollectionStage),
@@ -301,6 +311,22 @@ BaseCloner::AfterStageBehavior CollectionCloner::setupIndexBuildersForUnfinished
 }
 
 void CollectionCloner::runQuery() {
+    // Decide exactly once whether this collection is cloned with concurrent range cursors, so a
+    // retried query round can never switch modes halfway through the clone. Capped collections
+    // must preserve insertion order and are always cloned with a single cursor, and the parallel
+    // mode relies on retrying interrupted range cursors, which needs a 4.4+ sync source just
+    // like resumable queries do.
+    if (!_attemptedIdRangeSplit && _maxParallelRanges > 1 && _resumeSupported &&
+        !_collectionOptions.capped) {
+        _attemptedIdRangeSplit = true;
+        computeIdRanges();
+    }
+
+    if (!_idRanges.empty()) {
+        runParallelQuery();
+        return;
+    }
+
     // Non-resumable query.
     Query query;
 
@@ -371,6 +397,132 @@ void CollectionCloner::runQuery() {
     }
 }
 
+void CollectionCloner::computeIdRanges() {
+    long long bytesToCopy;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        bytesToCopy = _stats.bytesToCopy;
+    }
+    if (bytesToCopy < 2 * kMinBytesPerIdRange) {
+        return;
+    }
+    auto numRanges = std::min(static_cast<long long>(_maxParallelRanges),
+                              bytesToCopy / kMinBytesPerIdRange);
+
+    BSONObj res;
+    getClient()->runCommand(_sourceNss.db().toString(),
+                            BSON("splitVector" << _sourceNss.ns() << "keyPattern"
+                                               << BSON("_id" << 1) << "maxChunkSizeBytes"
+                                               << bytesToCopy / numRanges << "maxSplitPoints"
+                                               << numRanges - 1),
+                            res);
+    if (auto status = getStatusFromCommandResult(res); !status.isOK()) {
+        LOGV2_DEBUG(5837118,
+                    1,
+                    "Cloning collection with a single cursor because splitVector failed",
+                    "namespace"_attr = _sourceNss,
+                    "error"_attr = status);
+        return;
+    }
+
+    std::vector<BSONObj> splitKeys;
+    for (const auto& elem : res.getObjectField("splitKeys")) {
+        splitKeys.push_back(elem.Obj().getOwned());
+    }
+    if (splitKeys.empty()) {
+        return;
+    }
+
+    BSONObj lowerBound;
+    for (const auto& splitKey : splitKeys) {
+        _idRanges.push_back({lowerBound, splitKey, BSONObj(), false});
+        lowerBound = splitKey;
+    }
+    _idRanges.push_back({lowerBound, BSONObj(), BSONObj(), false});
+
+    LOGV2(5837119,
+          "Cloning collection using concurrent _id range cursors",
+          "namespace"_attr = _sourceNss,
+          "numRanges"_attr = _idRanges.size());
+}
+
+void CollectionCloner::runParallelQuery() {
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _rangeCloneStatus = Status::OK();
+    }
+
+    std::vector<stdx::thread> workers;
+    for (auto& range : _idRanges) {
+        // Ranges that were fully cloned in a previous query round stay finished.
+        if (range.done) {
+            continue;
+        }
+        workers.emplace_back([this, rangePtr = &range] { cloneRange(rangePtr); });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    uassertStatusOK(_rangeCloneStatus);
+}
+
+void CollectionCloner::cloneRange(IdRange* range) noexcept {
+    Client::initThread("CollectionClonerRangeCloner");
+    try {
+        // Each range cursor gets its own connection so the clone is not serialized on one
+        // socket. The shared client connection stays dedicated to the cloner's own commands.
+        auto conn = std::make_unique<DBClientConnection>(true /* autoReconnect */);
+        uassertStatusOK(conn->connect(getSource(), "CollectionClonerRangeCloner"));
+        uassertStatusOK(replAuthenticate(conn.get())
+                            .withContext(str::stream()
+                                         << "Failed to authenticate to " << getSource()
+                                         << " to clone an _id range of " << _sourceNss.ns()));
+
+        // The _id sort and matching hint guarantee that documents arrive in key order, which
+        // makes lastIdCloned a correct resume point if this query round is interrupted.
+        Query query(makeRangeFilter(*range));
+        query.sort(BSON("_id" << 1));
+        query.hint(BSON("_id" << 1));
+
+        conn->query([this, range](
+                        DBClientCursorBatchIterator& iter) { handleNextRangeBatch(iter, range); },
+                    _sourceDbAndUuid,
+                    query,
+                    nullptr /* fieldsToReturn */,
+                    QueryOption_NoCursorTimeout | QueryOption_SecondaryOk |
+                        (collectionClonerUsesExhaust ? QueryOption_Exhaust : 0),
+                    _collectionClonerBatchSize,
+                    ReadConcernArgs::kImplicitDefault);
+        range->done = true;
+    } catch (...) {
+        auto status = exceptionToStatus();
+        stdx::lock_guard<Latch> lk(_mutex);
+        // Keep the first failure; it decides whether the query stage retries.
+        if (_rangeCloneStatus.isOK()) {
+            _rangeCloneStatus = status;
+        }
+    }
+}
+
+BSONObj CollectionCloner::makeRangeFilter(const IdRange& range) const {
+    BSONObjBuilder filter;
+    {
+        BSONObjBuilder idBounds(filter.subobjStart("_id"));
+        if (!range.lastIdCloned.isEmpty()) {
+            // Resume after the last document this range handed off for insertion.
+            idBounds.appendAs(range.lastIdCloned.firstElement(), "$gt");
+        } else if (!range.lowerBound.isEmpty()) {
+            idBounds.appendAs(range.lowerBound.firstElement(), "$gte");
+        }
+        if (!range.upperBound.isEmpty()) {
+            idBounds.appendAs(range.upperBound.firstElement(), "$lt");
+        }
+    }
+    return filter.obj();
+}
+
 void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
     {
         stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
@@ -442,6 +594,48 @@ void CollectionCloner::handleNextBatch(DBClientCursorBatchIterator& iter) {
         });
 }
 
+void CollectionCloner::handleNextRangeBatch(DBClientCursorBatchIterator& iter, IdRange* range) {
+    {
+        stdx::lock_guard<InitialSyncSharedData> lk(*getSharedData());
+        if (!getSharedData()->getStatus(lk).isOK()) {
+            static constexpr char message[] =
+                "Collection cloning cancelled due to initial sync failure";
+            LOGV2(5837120, message, "error"_attr = getSharedData()->getStatus(lk));
+            uasserted(ErrorCodes::CallbackCanceled,
+                      str::stream() << message << ": " << getSharedData()->getStatus(lk));
+        }
+    }
+
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        // Stop this range's cursor promptly once a sibling range cursor has failed.
+        uassertStatusOK(_rangeCloneStatus);
+        _stats.receivedBatches++;
+        BSONObj lastDoc;
+        while (iter.moreInCurrentBatch()) {
+            lastDoc = iter.nextSafe();
+            _documentsToInsert.emplace_back(lastDoc);
+        }
+        if (!lastDoc.isEmpty()) {
+            // Documents arrive in _id order within a range, so the last document of the batch is
+            // the resume point once this batch has been handed off.
+            range->lastIdCloned = lastDoc["_id"].wrap();
+        }
+    }
+
+    // Schedule the next document batch insertion. The insert tasks run one at a time, so every
+    // range cursor feeds the one bulk loader without further synchronization.
+    auto&& scheduleResult = _scheduleDbWorkFn(
+        [=](const executor::TaskExecutor::CallbackArgs& cbd) { insertDocumentsCallback(cbd); });
+
+    if (!scheduleResult.isOK()) {
+        Status newStatus = scheduleResult.getStatus().withContext(
+            str::stream() << "Error cloning collection '" << _sourceNss.ns() << "'");
+        // We must throw an exception to terminate query.
+        uassertStatusOK(newStatus);
+    }
+}
+
 void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd) {
     uassertStatusOK(cbd.status);
 
@@ -206,12 +206,57 @@ private:
      */
     AfterStageBehavior setupIndexBuildersForUnfinishedIndexesStage();
 
+    /**
+     * A contiguous range of the _id index cloned by one of the concurrent range cursors. Bounds
+     * are single-field key objects as returned by splitVector; an empty bound means the range is
+     * unbounded on that side.
+     */
+    struct IdRange {
+        BSONObj lowerBound;  // inclusive
+        BSONObj upperBound;  // exclusive
+        // The _id of the last document this range handed off for insertion. A retried query
+        // round resumes the range after this key.
+        BSONObj lastIdCloned;
+        bool done = false;
+    };
+
+    /**
+     * Asks the sync source to split the collection into _id ranges suitable for cloning with
+     * concurrent cursors, using the splitVector command like the chunk splitter does. Leaves
+     * _idRanges empty - falling back to the single-cursor clone - if the collection is too small
+     * to be worth splitting or splitVector is unavailable for it.
+     */
+    void computeIdRanges();
+
+    /**
+     * Runs one cursor per unfinished _id range on its own thread and connection, all feeding the
+     * shared bulk loader through the usual insert task queue. Throws the first range failure
+     * after every range cursor has stopped, so the query stage can decide whether to retry.
+     */
+    void runParallelQuery();
+
+    /**
+     * Thread body for cloning a single _id range. Stores the first failure in _rangeCloneStatus.
+     */
+    void cloneRange(IdRange* range) noexcept;
+
+    /**
+     * Returns the find filter selecting the not-yet-cloned remainder of the given range.
+     */
+    BSONObj makeRangeFilter(const IdRange& range) const;
+
     /**
      * Put all results from a query batch into a buffer to be inserted, and schedule
      * it to be inserted.
      */
     void handleNextBatch(DBClientCursorBatchIterator& iter);
 
+    /**
+     * As handleNextBatch, but for a batch read by one of the concurrent range cursors. Also
+     * advances the range's resume point.
+     */
+    void handleNextRangeBatch(DBClientCursorBatchIterator& iter, IdRange* range);
+
     /**
      * Called whenever there is a new batch of documents ready from the DBClientConnection.
      *
@@ -246,6 +291,10 @@ private:
     // The size of the batches of documents returned in collection cloning.
     int _collectionClonerBatchSize;  // (R)
 
+    // The maximum number of concurrent _id-range cursors to clone this collection with. Set by
+    // server parameter 'collectionClonerMaxParallelRanges'; 1 means a single cursor.
+    const int _maxParallelRanges;  // (R)
+
     CollectionClonerStage _countStage;                                   // (R)
     CollectionClonerStage _listIndexesStage;                             // (R)
     CollectionClonerStage _createCollectionStage;                        // (R)
@@ -278,6 +327,18 @@ private:
     // If true, it means we are starting a new query or resuming an interrupted one.
     bool _firstBatchOfQueryRound = true;  // (X)
 
+    // Whether we already decided if this collection should be cloned with concurrent range
+    // cursors. The decision is made once so a clone never switches modes between query rounds.
+    bool _attemptedIdRangeSplit = false;  // (X)
+
+    // The _id ranges being cloned concurrently, empty when cloning with a single cursor. The
+    // bounds are set up once by computeIdRanges() and reused across query retries; lastIdCloned
+    // is advanced under _mutex as batches are handed off.
+    std::vector<IdRange> _idRanges;  // (X), lastIdCloned is (M)
+
+    // First failure encountered by any range cursor in the current query round.
+    Status _rangeCloneStatus = Status::OK();  // (M)
+
     // Only set during non-resumable (4.2) queries.
     // Signifies that there were changes to the collection on the sync source that resulted in
     // our remote cursor getting killed.
@@ -403,6 +403,31 @@ TEST_F(CollectionClonerTestResumable, BatchSizeStoredInConstructor) {
     ASSERT_EQUALS(3u, stats.receivedBatches);
 }
 
+TEST_F(CollectionClonerTestResumable, SingleCursorFallbackWhenSplitVectorFails) {
+    auto maxRangesDefault = collectionClonerMaxParallelRanges;
+    collectionClonerMaxParallelRanges = 4;
+    ON_BLOCK_EXIT([&]() { collectionClonerMaxParallelRanges = maxRangesDefault; });
+
+    // Make the collection look large enough to be considered for a parallel range clone, but
+    // have splitVector fail so the cloner falls back to the single-cursor path.
+    setMockServerReplies(BSON("size" << 1024 * 1024 * 1024),
+                         createCountResponse(3),
+                         createCursorResponse(_nss.ns(), BSON_ARRAY(_idIndexSpec)));
+    _mockServer->setCommandReply("splitVector",
+                                 Status(ErrorCodes::CommandNotFound, "no such command"));
+
+    // Set up documents to be returned from upstream node.
+    _mockServer->insert(_nss.ns(), BSON("_id" << 1));
+    _mockServer->insert(_nss.ns(), BSON("_id" << 2));
+    _mockServer->insert(_nss.ns(), BSON("_id" << 3));
+
+    auto cloner = makeCollectionCloner();
+    ASSERT_OK(cloner->run());
+
+    ASSERT_EQUALS(3, _collectionStats->insertCount);
+    ASSERT_TRUE(_collectionStats->commitCalled);
+}
+
 TEST_F(CollectionClonerTestResumable, InsertDocumentsMultipleBatches) {
     // Set up data for preliminary stages
     setMockServerReplies(BSON("size" << 10),
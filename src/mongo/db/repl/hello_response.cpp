@@ -216,6 +216,13 @@ BSONObj HelloResponse::toBSON(bool useLegacyResponseFields) const {
     return builder.obj();
 }
 
+const BSONObj& HelloResponse::serialized(bool useLegacyResponseFields) const {
+    auto idx = useLegacyResponseFields ? 0 : 1;
+    std::call_once(_serializedOnce[idx],
+                   [&] { _serialized[idx] = toBSON(useLegacyResponseFields); });
+    return _serialized[idx];
+}
+
 Status HelloResponse::initialize(const BSONObj& doc) {
     Status status = bsonExtractBooleanField(doc, kIsMasterFieldName, &_isWritablePrimary);
     if (!status.isOK()) {
@@ -29,9 +29,11 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
 #include <vector>
 
+#include "mongo/bson/bsonobj.h"
 #include "mongo/bson/oid.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/optime_with.h"
@@ -78,6 +80,15 @@ public:
      */
     BSONObj toBSON(bool useLegacyResponseFields = true) const;
 
+    /**
+     * Returns the serialized form of this response, building it on first use. May only be called
+     * once this response is fully built and will no longer be mutated. The same response object is
+     * commonly shared by many hello commands (every waiter on a topology change receives the same
+     * response, and responses are cached between topology changes), so serializing once and
+     * sharing the result spares each command a fresh toBSON().
+     */
+    const BSONObj& serialized(bool useLegacyResponseFields) const;
+
 
     // ===================== Accessors for member variables ================================= //
 
@@ -295,6 +306,11 @@ private:
     // If _shutdownInProgress is true toBSON will return a set of hardcoded values to indicate
     // that we are mid shutdown
     bool _shutdownInProgress;
+
+    // Memoized results of toBSON() for each value of useLegacyResponseFields, built lazily by
+    // serialized(). Note that these members make this class non-copyable.
+    mutable std::once_flag _serializedOnce[2];
+    mutable BSONObj _serialized[2];
 };
 
 }  // namespace repl
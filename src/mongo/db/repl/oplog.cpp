@@ -446,6 +446,16 @@ std::vector<OpTime> logInsertOps(OperationContext* opCtx,
 
     WriteUnitOfWork wuow(opCtx);
 
+    // When no statement has a pre-reserved slot, acquire all of the oplog slots in a single call
+    // rather than paying one slot-acquisition mutex round trip per document. Mixed batches, where
+    // only some statements carry reserved slots, fall back to per-statement acquisition to
+    // preserve the relative ordering of the reserved slots.
+    std::vector<OplogSlot> batchedSlots;
+    if (std::all_of(
+            begin, end, [](const InsertStatement& stmt) { return stmt.oplogSlot.isNull(); })) {
+        batchedSlots = oplogInfo->getNextOpTimes(opCtx, count);
+    }
+
     std::vector<OpTime> opTimes(count);
     std::vector<Timestamp> timestamps(count);
     std::vector<BSONObj> bsonOplogEntries(count);
@@ -457,7 +467,9 @@ std::vector<OpTime> logInsertOps(OperationContext* opCtx,
         auto insertStatementOplogSlot = begin[i].oplogSlot;
         // Fetch optime now, if not already fetched.
         if (insertStatementOplogSlot.isNull()) {
-            insertStatementOplogSlot = oplogInfo->getNextOpTimes(opCtx, 1U)[0];
+            insertStatementOplogSlot = batchedSlots.empty()
+                ? oplogInfo->getNextOpTimes(opCtx, 1U)[0]
+                : batchedSlots[i];
         }
         oplogEntry.setObject(begin[i].doc);
         oplogEntry.setOpTime(insertStatementOplogSlot);
@@ -0,0 +1,300 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/collection_impl.h"
+#include "mongo/db/catalog/database_holder.h"
+#include "mongo/db/catalog/database_holder_impl.h"
+#include "mongo/db/client_strand.h"
+#include "mongo/db/index/index_access_method_factory_impl.h"
+#include "mongo/db/index_builds_coordinator_mongod.h"
+#include "mongo/db/op_observer_registry.h"
+#include "mongo/db/repl/drop_pending_collection_reaper.h"
+#include "mongo/db/repl/oplog.h"
+#include "mongo/db/repl/oplog_applier_impl.h"
+#include "mongo/db/repl/oplog_entry_test_helpers.h"
+#include "mongo/db/repl/replication_consistency_markers_mock.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/repl/storage_interface_impl.h"
+#include "mongo/db/s/collection_sharding_state_factory_standalone.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/control/storage_control.h"
+#include "mongo/db/storage/storage_engine_init.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/db/vector_clock_mutable.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/periodic_runner_factory.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+namespace repl {
+namespace {
+
+// Number of oplog entries applied per applyOplogBatch() call, matching the order of magnitude
+// of real steady-state replication batches.
+const int kBatchSize = 1024;
+
+// Each batch gets its own timestamp second, shared across all generators in the process so the
+// local oplog never sees the same timestamp twice. Second 1 is taken by the startup cluster
+// time tick.
+AtomicWord<long long> nextBatchSeconds{2};
+
+/**
+ * An in-process standalone mongod with a real WiredTiger storage engine and just enough of the
+ * replication machinery (mocked coordinator and consistency markers, real StorageInterface and
+ * oplog collection) to drive OplogApplierImpl::applyOplogBatch the same way steady-state
+ * replication does.
+ */
+class OplogApplicationBenchmarkFixture {
+public:
+    OplogApplicationBenchmarkFixture() : _tempDir("oplog_application_bm") {
+        storageGlobalParams.engine = "wiredTiger";
+        storageGlobalParams.engineSetByUser = true;
+        storageGlobalParams.dbpath = _tempDir.path();
+
+        // benchmark_main has already run the global initializers and installed the global
+        // service context, so build on top of that one.
+        _serviceContext = getGlobalServiceContext();
+        _serviceContext->setPeriodicRunner(makePeriodicRunner(_serviceContext));
+        _serviceContext->setOpObserver(std::make_unique<OpObserverRegistry>());
+
+        auto strand = ClientStrand::make(_serviceContext->makeClient("oplog bench setup"));
+        auto guard = strand->bind();
+        {
+            auto opCtx = _serviceContext->makeOperationContext(guard.get());
+            initializeStorageEngine(opCtx.get(),
+                                    StorageEngineInitFlags::kAllowNoLockFile |
+                                        StorageEngineInitFlags::kSkipMetadataFile);
+        }
+        StorageControl::startStorageControls(_serviceContext, true /*forTestOnly*/);
+
+        DatabaseHolder::set(_serviceContext, std::make_unique<DatabaseHolderImpl>());
+        IndexAccessMethodFactory::set(_serviceContext,
+                                      std::make_unique<IndexAccessMethodFactoryImpl>());
+        Collection::Factory::set(_serviceContext, std::make_unique<CollectionImpl::FactoryImpl>());
+        IndexBuildsCoordinator::set(_serviceContext,
+                                    std::make_unique<IndexBuildsCoordinatorMongod>());
+        CollectionShardingStateFactory::set(
+            _serviceContext,
+            std::make_unique<CollectionShardingStateFactoryStandalone>(_serviceContext));
+
+        ReplicationCoordinator::set(_serviceContext,
+                                    std::make_unique<ReplicationCoordinatorMock>(_serviceContext));
+        invariant(
+            ReplicationCoordinator::get(_serviceContext)->setFollowerMode(MemberState::RS_PRIMARY));
+
+        StorageInterface::set(_serviceContext, std::make_unique<StorageInterfaceImpl>());
+        DropPendingCollectionReaper::set(_serviceContext,
+                                         std::make_unique<DropPendingCollectionReaper>(
+                                             StorageInterface::get(_serviceContext)));
+
+        _consistencyMarkers = std::make_unique<ReplicationConsistencyMarkersMock>();
+
+        // (Generic FCV reference): the fixture does not have an FCV document to initialize the
+        // server parameter from.
+        serverGlobalParams.mutableFeatureCompatibility.setVersion(
+            ServerGlobalParams::FeatureCompatibility::kLatest);
+
+        {
+            auto opCtx = _serviceContext->makeOperationContext(guard.get());
+            createOplog(opCtx.get());
+            VectorClockMutable::get(opCtx.get())->tickClusterTimeTo(LogicalTime(Timestamp(1, 0)));
+        }
+    }
+
+    ServiceContext* serviceContext() const {
+        return _serviceContext;
+    }
+
+    ReplicationConsistencyMarkers* consistencyMarkers() const {
+        return _consistencyMarkers.get();
+    }
+
+    /**
+     * Creates 'count' empty collections in a database unique to this benchmark run, so state
+     * never leaks from one run into the next.
+     */
+    std::vector<NamespaceString> createCollections(OperationContext* opCtx, int count) {
+        const std::string dbName = str::stream() << "oplog_bench_" << _nextRunId.fetchAndAdd(1);
+        std::vector<NamespaceString> collections;
+        collections.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            NamespaceString nss(dbName, str::stream() << "coll" << i);
+            invariant(StorageInterface::get(opCtx)->createCollection(
+                opCtx, nss, CollectionOptions()));
+            collections.push_back(std::move(nss));
+        }
+        return collections;
+    }
+
+private:
+    unittest::TempDir _tempDir;
+    ServiceContext* _serviceContext;
+    std::unique_ptr<ReplicationConsistencyMarkers> _consistencyMarkers;
+    AtomicWord<int> _nextRunId{0};
+};
+
+/**
+ * The fixture stands up a whole WiredTiger instance and service context, so it is created once
+ * and deliberately leaked rather than torn down between benchmark runs.
+ */
+OplogApplicationBenchmarkFixture& fixture() {
+    static auto* instance = new OplogApplicationBenchmarkFixture();
+    return *instance;
+}
+
+/**
+ * Synthesizes batches of mixed CRUD oplog entries fanned out over a set of collections. Each
+ * collection cycles through insert/insert/update/delete, so updates and deletes always target
+ * a document inserted earlier in the same stream and every generated batch stays valid for
+ * steady-state application.
+ */
+class BatchGenerator {
+public:
+    BatchGenerator(std::vector<NamespaceString> collections, int docBytes)
+        : _collections(std::move(collections)),
+          _padding(docBytes, 'x'),
+          _streams(_collections.size()) {}
+
+    std::vector<OplogEntry> makeBatch() {
+        std::vector<OplogEntry> ops;
+        ops.reserve(kBatchSize);
+        const long long seconds = nextBatchSeconds.fetchAndAdd(1);
+        for (int i = 0; i < kBatchSize; ++i) {
+            const OpTime opTime(Timestamp(Seconds(seconds), i + 1), 1LL);
+            const auto& nss = _collections[i % _collections.size()];
+            auto& stream = _streams[i % _collections.size()];
+            switch (stream.phase++ % 4) {
+                case 0:
+                    stream.updateId = _nextDocId++;
+                    ops.push_back(
+                        makeInsertDocumentOplogEntry(opTime, nss, makeDocument(stream.updateId)));
+                    break;
+                case 1:
+                    stream.deleteId = _nextDocId++;
+                    ops.push_back(
+                        makeInsertDocumentOplogEntry(opTime, nss, makeDocument(stream.deleteId)));
+                    break;
+                case 2:
+                    ops.push_back(makeUpdateDocumentOplogEntry(opTime,
+                                                               nss,
+                                                               BSON("_id" << stream.updateId),
+                                                               makeDocument(stream.updateId)));
+                    break;
+                case 3:
+                    ops.push_back(makeDeleteDocumentOplogEntry(
+                        opTime, nss, BSON("_id" << stream.deleteId)));
+                    break;
+            }
+        }
+        return ops;
+    }
+
+private:
+    BSONObj makeDocument(long long id) const {
+        return BSON("_id" << id << "padding" << _padding);
+    }
+
+    struct CollectionStream {
+        int phase = 0;
+        long long updateId = 0;
+        long long deleteId = 0;
+    };
+
+    std::vector<NamespaceString> _collections;
+    std::string _padding;
+    std::vector<CollectionStream> _streams;
+    long long _nextDocId = 0;
+};
+
+/**
+ * Applies synthesized oplog batches with OplogApplierImpl and reports entries/s.
+ *
+ * Arguments: (writer threads, collection fan-out, approximate document size in bytes).
+ */
+void BM_OplogApplication(benchmark::State& state) {
+    const int writerThreads = state.range(0);
+    const int numCollections = state.range(1);
+    const int docBytes = state.range(2);
+
+    auto& fix = fixture();
+    auto strand = ClientStrand::make(fix.serviceContext()->makeClient("oplog bench"));
+    auto guard = strand->bind();
+    auto opCtx = fix.serviceContext()->makeOperationContext(guard.get());
+
+    BatchGenerator generator(fix.createCollections(opCtx.get(), numCollections), docBytes);
+
+    auto writerPool = makeReplWriterPool(writerThreads);
+    NoopOplogApplierObserver observer;
+    OplogApplierImpl applier(nullptr,  // executor
+                             nullptr,  // oplogBuffer
+                             &observer,
+                             ReplicationCoordinator::get(opCtx.get()),
+                             fix.consistencyMarkers(),
+                             StorageInterface::get(opCtx.get()),
+                             OplogApplier::Options(OplogApplication::Mode::kSecondary),
+                             writerPool.get());
+
+    for (auto keepRunning : state) {
+        // Batch synthesis is untimed; only the apply pipeline is measured.
+        state.PauseTiming();
+        auto ops = generator.makeBatch();
+        state.ResumeTiming();
+
+        invariant(applier.applyOplogBatch(opCtx.get(), std::move(ops)).getStatus());
+    }
+
+    state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+BENCHMARK(BM_OplogApplication)
+    ->Args({1, 1, 256})
+    ->Args({4, 1, 256})
+    ->Args({4, 8, 256})
+    ->Args({8, 8, 256})
+    ->Args({16, 8, 256})
+    ->Args({8, 32, 256})
+    ->Args({16, 32, 256})
+    ->Args({4, 8, 4 * 1024})
+    ->Args({8, 8, 4 * 1024})
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace repl
+}  // namespace mongo
@@ -75,6 +75,12 @@ public:
 
     /**
      * Updates a CRUD op's hash and isForCappedCollection field if necessary.
+     *
+     * The document's _id is mixed into the namespace hash so that writes to a single collection
+     * are partitioned across writer threads at the document level; operations on the same
+     * document always land on the same writer and so retain their oplog order. Capped collections
+     * are the exception: they must preserve insertion order, so their ops keep the plain
+     * namespace hash and serialize on one writer.
      */
     static void processCrudOp(OperationContext* opCtx,
                               OplogEntry* op,
@@ -84,8 +90,9 @@ public:
 
 
     /**
-     * Adds a single oplog entry to the appropriate writer vector.  Returns the index of the
-     * writer vector the entry was written to.
+     * Adds a single oplog entry to the appropriate writer vector. CRUD ops are partitioned by
+     * namespace and document _id (see processCrudOp); all other entries are partitioned by
+     * namespace alone. Returns the index of the writer vector the entry was written to.
      */
     static uint32_t addToWriterVector(OperationContext* opCtx,
                                       OplogEntry* op,
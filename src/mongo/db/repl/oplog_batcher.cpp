@@ -31,7 +31,9 @@
 
 #include "mongo/db/repl/oplog_batcher.h"
 
+#include "mongo/base/counter.h"
 #include "mongo/db/catalog_raii.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/commands/txn_cmds_gen.h"
 #include "mongo/db/repl/oplog_applier.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
@@ -41,6 +43,18 @@ namespace mongo {
 namespace repl {
 MONGO_FAIL_POINT_DEFINE(skipOplogBatcherWaitForData);
 
+// The estimated apply cost of all batched oplog entries, in the units returned by
+// OplogBatcher::getApplyCost().
+Counter64 batchApplyCostUnits;
+ServerStatusMetricField<Counter64> displayBatchApplyCostUnits("repl.batcher.applyCostUnits",
+                                                              &batchApplyCostUnits);
+
+// The number of batches that were ended by the apply cost limit rather than the count or byte
+// limits.
+Counter64 batchesCutByApplyCost;
+ServerStatusMetricField<Counter64> displayBatchesCutByApplyCost(
+    "repl.batcher.batchesCutByApplyCost", &batchesCutByApplyCost);
+
 OplogBatcher::OplogBatcher(OplogApplier* oplogApplier, OplogBuffer* oplogBuffer)
     : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer), _ops(0) {}
 OplogBatcher::~OplogBatcher() {
@@ -149,6 +163,41 @@ std::size_t OplogBatcher::getOpCount(const OplogEntry& entry) {
     return 1U;
 }
 
+std::size_t OplogBatcher::getApplyCost(const OplogEntry& entry) {
+    // Base weights per operation type, chosen relative to each other rather than as absolute
+    // timings: an update pays for the read-modify-write of the target document, an insert or
+    // delete for a single write, and a no-op only for bookkeeping. Command entries take the
+    // update weight per wrapped operation, which covers unprepared transaction commits that
+    // expand into many CRUD writes.
+    constexpr std::size_t kNoopCost = 1;
+    constexpr std::size_t kInsertCost = 4;
+    constexpr std::size_t kDeleteCost = 4;
+    constexpr std::size_t kUpdateCost = 8;
+
+    std::size_t cost;
+    switch (entry.getOpType()) {
+        case OpTypeEnum::kNoop:
+            cost = kNoopCost;
+            break;
+        case OpTypeEnum::kInsert:
+            cost = kInsertCost;
+            break;
+        case OpTypeEnum::kDelete:
+            cost = kDeleteCost;
+            break;
+        case OpTypeEnum::kUpdate:
+            cost = kUpdateCost;
+            break;
+        default:
+            cost = kUpdateCost * getOpCount(entry);
+            break;
+    }
+
+    // One unit per kilobyte of oplog entry, so entries carrying large documents weigh more than
+    // small ones of the same operation type.
+    return cost + static_cast<std::size_t>(entry.getRawObjSizeBytes()) / 1024;
+}
+
 StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
     OperationContext* opCtx, const BatchLimits& batchLimits) {
     if (batchLimits.ops == 0) {
@@ -157,6 +206,7 @@ StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
 
     std::size_t totalOps = 0;
     std::uint32_t totalBytes = 0;
+    std::size_t totalCost = 0;
     std::vector<OplogEntry> ops;
     BSONObj op;
     while (_oplogBuffer->peek(opCtx, &op)) {
@@ -203,7 +253,13 @@ StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
         // Apply replication batch limits. Avoid returning an empty batch.
         auto opCount = getOpCount(entry);
         auto opBytes = entry.getRawObjSizeBytes();
+        auto opCost = batchLimits.applyCostUnits > 0 ? getApplyCost(entry) : std::size_t(0);
         if (totalOps > 0) {
+            if (batchLimits.applyCostUnits > 0 &&
+                totalCost + opCost > batchLimits.applyCostUnits) {
+                batchesCutByApplyCost.increment();
+                return std::move(ops);
+            }
             if (totalOps + opCount > batchLimits.ops || totalBytes + opBytes > batchLimits.bytes) {
                 return std::move(ops);
             }
@@ -219,6 +275,8 @@ StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
         // Add op to buffer.
         totalOps += opCount;
         totalBytes += opBytes;
+        totalCost += opCost;
+        batchApplyCostUnits.increment(opCost);
         ops.push_back(std::move(entry));
         _consume(opCtx, _oplogBuffer);
     }
@@ -263,6 +321,7 @@ void OplogBatcher::_run(StorageInterface* storageInterface) {
 
         // Check the limits once per batch since users can change them at runtime.
         batchLimits.ops = getBatchLimitOplogEntries();
+        batchLimits.applyCostUnits = getBatchLimitApplyCostUnits();
 
         // Use the OplogBuffer to populate a local OplogBatch. Note that the buffer may be empty.
         OplogBatch ops(batchLimits.ops);
@@ -352,5 +411,9 @@ std::size_t getBatchLimitOplogBytes(OperationContext* opCtx, StorageInterface* s
     return std::min(oplogMaxSize / 10, std::size_t(replBatchLimitBytes.load()));
 }
 
+std::size_t getBatchLimitApplyCostUnits() {
+    return std::size_t(replBatchLimitApplyCostUnits.load());
+}
+
 }  // namespace repl
 }  // namespace mongo
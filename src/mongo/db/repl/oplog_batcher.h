@@ -129,6 +129,11 @@ public:
         size_t bytes = 0;
         size_t ops = 0;
 
+        // The maximum estimated apply cost of the batch, in the abstract units returned by
+        // getApplyCost(). A value of 0 disables the cost-based limit, leaving only the count and
+        // byte limits in effect.
+        size_t applyCostUnits = 0;
+
         // If provided, the batch will not include any operations with timestamps after this point.
         // This is intended for implementing slaveDelay, so it should be some number of seconds
         // before now.
@@ -167,6 +172,8 @@ public:
      * A batch may consist of:
      *     at most "BatchLimits::ops" OplogEntries
      *     at most "BatchLimits::bytes" worth of OplogEntries
+     *     at most "BatchLimits::applyCostUnits" of estimated apply cost, when that limit is
+     *     enabled
      *     only OplogEntries from before the "BatchLimits::slaveDelayLatestTimestamp" point
      *     a single command OplogEntry (excluding applyOps, which are grouped with CRUD ops)
      */
@@ -185,6 +192,14 @@ public:
      */
     static std::size_t getOpCount(const OplogEntry& entry);
 
+    /**
+     * Returns an estimate of the cost of applying an oplog entry, in abstract cost units. The
+     * estimate weighs the operation type - updates are more expensive than inserts and deletes,
+     * no-ops are nearly free - and adds one unit per kilobyte of entry size, so a batch of large
+     * full-document updates is cut earlier than a batch of small no-ops.
+     */
+    static std::size_t getApplyCost(const OplogEntry& entry);
+
 private:
     /**
      * If slaveDelay is enabled, this function calculates the most recent timestamp of any oplog
@@ -226,5 +241,11 @@ std::size_t getBatchLimitOplogEntries();
  */
 std::size_t getBatchLimitOplogBytes(OperationContext* opCtx, StorageInterface* storageInterface);
 
+/**
+ * Returns the maximum estimated apply cost of each batch, in the units returned by
+ * OplogBatcher::getApplyCost(), or 0 if the cost-based batch limit is disabled.
+ */
+std::size_t getBatchLimitApplyCostUnits();
+
 }  // namespace repl
 }  // namespace mongo
@@ -32,6 +32,7 @@
 #include "mongo/db/repl/oplog_fetcher.h"
 
 #include "mongo/base/counter.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/matcher.h"
@@ -306,6 +307,11 @@ Milliseconds OplogFetcher::_getRetriedFindMaxTime() const {
 
 void OplogFetcher::_finishCallback(Status status) {
     invariant(isActive());
+
+    // Stop the batch processing thread, if any, before invoking the shutdown callback so that no
+    // more batches are enqueued once the callback has run.
+    _joinProcessingThread();
+
     // If the oplog fetcher is shutting down, consolidate return code to CallbackCanceled.
     if (_isShuttingDown() && status != ErrorCodes::CallbackCanceled) {
         status = Status(ErrorCodes::CallbackCanceled,
@@ -362,6 +368,27 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
     _setMetadataWriterAndReader();
     _createNewCursor(true /* initialFind */);
 
+    // When pipelined batch processing is enabled, batches are validated and enqueued on a
+    // dedicated thread so this thread can read the next reply off the connection concurrently.
+    // This matters most on the exhaust cursor path during steady state and catch-up, where the
+    // sync source streams batches back to back and a blocking enqueue into a full oplog buffer
+    // would otherwise stall the socket.
+    const bool pipelinedProcessing = oplogFetcherPipelinedBatchProcessing;
+    if (pipelinedProcessing) {
+        _processingThread = stdx::thread([this] { _processBatchesLoop(); });
+    }
+
+    // The stopReplProducer fail point expects the oplog fetcher to shut down successfully. If
+    // another fail point wants it to shut down unsuccessfully, it should use a different error
+    // code.
+    auto finishWithProcessingStatus = [this](Status status) {
+        if (status == ErrorCodes::FailPointEnabled) {
+            _finishCallback(Status::OK());
+            return;
+        }
+        _finishCallback(status);
+    };
+
     while (true) {
         Status status{Status::OK()};
         {
@@ -384,6 +411,16 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
         if (!batchResult.isOK()) {
             auto brStatus = batchResult.getStatus();
 
+            // A restarted cursor's find query is built from _lastFetched, which only advances as
+            // batches are processed, so any batches still in the pipeline must be processed
+            // before deciding whether to restart. A processing failure ends the oplog fetcher
+            // regardless of how many retries are left.
+            status = _drainProcessingPipeline();
+            if (!status.isOK()) {
+                finishWithProcessingStatus(status);
+                return;
+            }
+
             // Recreate a cursor if we have enough retries left.
             if (_oplogFetcherRestartDecision->shouldContinue(this, brStatus)) {
                 hangBeforeOplogFetcherRetries.pauseWhileSet();
@@ -395,17 +432,16 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
             }
         }
 
-        // This will advance our view of _lastFetched.
-        status = _onSuccessfulBatch(batchResult.getValue());
+        if (pipelinedProcessing) {
+            // The processing thread will advance our view of _lastFetched. If an earlier batch
+            // failed to process, the failure is returned here and the batch is dropped.
+            status = _pushToProcessingThread(std::move(batchResult.getValue()));
+        } else {
+            // This will advance our view of _lastFetched.
+            status = _onSuccessfulBatch(batchResult.getValue());
+        }
         if (!status.isOK()) {
-            // The stopReplProducer fail point expects this to return successfully. If another fail
-            // point wants this to return unsuccessfully, it should use a different error code.
-            if (status == ErrorCodes::FailPointEnabled) {
-                _finishCallback(Status::OK());
-                return;
-            }
-
-            _finishCallback(status);
+            finishWithProcessingStatus(status);
             return;
         }
 
@@ -413,6 +449,14 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
             // This means the sync source closes the tailable cursor with a returned cursorId of 0.
             // Any users of the oplog fetcher should create a new oplog fetcher if they see a
             // successful status and would like to continue fetching more oplog entries.
+            //
+            // All batches read from this cursor must finish processing before reporting a
+            // successful close.
+            status = _drainProcessingPipeline();
+            if (!status.isOK()) {
+                finishWithProcessingStatus(status);
+                return;
+            }
             _finishCallback(Status::OK());
             return;
         }
@@ -548,8 +592,9 @@ void OplogFetcher::_createNewCursor(bool initialFind) {
     readersCreatedStats.increment();
 }
 
-StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
-    Documents batch;
+StatusWith<OplogFetcher::FetchedBatch> OplogFetcher::_getNextBatch() {
+    FetchedBatch batch;
+    batch.isFirstBatch = _firstBatch;
     try {
         Timer timer;
         // If it is the first batch, we should initialize the cursor, which will run the find query.
@@ -590,12 +635,23 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
         }
 
         while (_cursor->moreInCurrentBatch()) {
-            batch.emplace_back(_cursor->nextSafe());
+            batch.documents.emplace_back(_cursor->nextSafe());
+        }
+
+        // Snapshot the response state that belongs to this batch. The ReplyMetadataReader
+        // overwrites _metadataObj and the cursor overwrites its post-batch resume token as soon
+        // as the next reply is read, so these must be captured here rather than when the batch is
+        // processed.
+        batch.metadataObj = _metadataObj;
+        if (auto pbrt = _cursor->getPostBatchResumeToken()) {
+            batch.postBatchResumeToken = pbrt->getOwned();
         }
 
         // This value is only used on a successful batch for metrics.repl.network.getmores. This
         // metric intentionally tracks the time taken by the initial find as well.
-        _lastBatchElapsedMS = timer.millis();
+        batch.elapsedMS = timer.millis();
+
+        _firstBatch = false;
     } catch (const DBException& ex) {
         if (_cursor->connectionHasPendingReplies()) {
             // Close the connection because the connection cannot be used anymore as more data is on
@@ -609,7 +665,9 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
     return batch;
 }
 
-Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
+Status OplogFetcher::_onSuccessfulBatch(const FetchedBatch& batch) {
+    const auto& documents = batch.documents;
+
     hangBeforeProcessingSuccessfulBatch.pauseWhileSet();
 
     if (_isShuttingDown()) {
@@ -669,7 +727,7 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
         LOGV2_DEBUG(21271, 2, "Oplog fetcher read 0 operations from remote oplog");
     }
 
-    auto oqMetadataResult = rpc::OplogQueryMetadata::readFromMetadata(_metadataObj);
+    auto oqMetadataResult = rpc::OplogQueryMetadata::readFromMetadata(batch.metadataObj);
     if (!oqMetadataResult.isOK()) {
         LOGV2_ERROR(21278,
                     "invalid oplog query metadata from sync source {syncSource}: "
@@ -677,12 +735,12 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
                     "Invalid oplog query metadata from sync source",
                     "syncSource"_attr = _config.source,
                     "error"_attr = oqMetadataResult.getStatus(),
-                    "metadata"_attr = _metadataObj);
+                    "metadata"_attr = batch.metadataObj);
         return oqMetadataResult.getStatus();
     }
     auto oqMetadata = oqMetadataResult.getValue();
 
-    if (_firstBatch) {
+    if (batch.isFirstBatch) {
         auto status =
             _checkRemoteOplogStart(documents, oqMetadata.getLastOpApplied(), oqMetadata.getRBID());
         if (!status.isOK()) {
@@ -724,8 +782,10 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     // This lastFetched value is the last OpTime from the previous batch.
     auto previousOpTimeFetched = _getLastOpTimeFetched();
 
-    auto validateResult = OplogFetcher::validateDocuments(
-        documents, _firstBatch, previousOpTimeFetched.getTimestamp(), _config.startingPoint);
+    auto validateResult = OplogFetcher::validateDocuments(documents,
+                                                          batch.isFirstBatch,
+                                                          previousOpTimeFetched.getTimestamp(),
+                                                          _config.startingPoint);
     if (!validateResult.isOK()) {
         return validateResult.getStatus();
     }
@@ -736,7 +796,7 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     // Process replset metadata.  It is important that this happen after we've validated the
     // first batch, so we don't progress our knowledge of the commit point from a
     // response that triggers a rollback.
-    auto metadataResult = rpc::ReplSetMetadata::readFromMetadata(_metadataObj);
+    auto metadataResult = rpc::ReplSetMetadata::readFromMetadata(batch.metadataObj);
     if (!metadataResult.isOK()) {
         LOGV2_ERROR(21279,
                     "invalid replication metadata from sync source {syncSource}: "
@@ -744,7 +804,7 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
                     "Invalid replication metadata from sync source",
                     "syncSource"_attr = _config.source,
                     "error"_attr = metadataResult.getStatus(),
-                    "metadata"_attr = _metadataObj);
+                    "metadata"_attr = batch.metadataObj);
         return metadataResult.getStatus();
     }
     auto replSetMetadata = metadataResult.getValue();
@@ -772,12 +832,12 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     opsReadStats.increment(info.networkDocumentCount);
     networkByteStats.increment(info.networkDocumentBytes);
 
-    oplogBatchStats.recordMillis(_lastBatchElapsedMS, documents.empty());
+    oplogBatchStats.recordMillis(batch.elapsedMS, documents.empty());
 
-    if (_cursor->getPostBatchResumeToken()) {
+    if (batch.postBatchResumeToken) {
         auto pbrt = ResumeTokenOplogTimestamp::parse(
             IDLParserErrorContext("OplogFetcher PostBatchResumeToken"),
-            *_cursor->getPostBatchResumeToken());
+            *batch.postBatchResumeToken);
         info.resumeToken = pbrt.getTs();
     }
 
@@ -815,10 +875,81 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
         _lastFetched = lastDocOpTime;
     }
 
-    _firstBatch = false;
     return Status::OK();
 }
 
+void OplogFetcher::_processBatchesLoop() {
+    Client::initThread("OplogFetcherBatchProcessor");
+
+    while (true) {
+        FetchedBatch batch;
+        {
+            stdx::unique_lock<Latch> lk(_processingMutex);
+            _processingHasWork.wait(
+                lk, [this] { return !_pipelinedBatches.empty() || _processingShutdown; });
+            if (_processingShutdown) {
+                return;
+            }
+            batch = std::move(_pipelinedBatches.front());
+            _pipelinedBatches.pop_front();
+            if (!_processingStatus.isOK()) {
+                // An earlier batch failed; discard the rest without processing them so the
+                // fetcher thread never blocks on a full pipeline.
+                _processingHasSpace.notify_all();
+                continue;
+            }
+            _processingBatchInFlight = true;
+        }
+
+        // This will advance our view of _lastFetched.
+        auto status = _onSuccessfulBatch(batch);
+
+        stdx::lock_guard<Latch> lk(_processingMutex);
+        _processingBatchInFlight = false;
+        if (!status.isOK()) {
+            _processingStatus = status;
+        }
+        _processingHasSpace.notify_all();
+    }
+}
+
+Status OplogFetcher::_pushToProcessingThread(FetchedBatch batch) {
+    stdx::unique_lock<Latch> lk(_processingMutex);
+    _processingHasSpace.wait(lk, [this] {
+        return _pipelinedBatches.size() < kMaxPipelinedBatches || !_processingStatus.isOK();
+    });
+    if (!_processingStatus.isOK()) {
+        return _processingStatus;
+    }
+    _pipelinedBatches.push_back(std::move(batch));
+    _processingHasWork.notify_one();
+    return Status::OK();
+}
+
+Status OplogFetcher::_drainProcessingPipeline() {
+    if (!_processingThread.joinable()) {
+        return Status::OK();
+    }
+    stdx::unique_lock<Latch> lk(_processingMutex);
+    _processingHasSpace.wait(lk, [this] {
+        return (_pipelinedBatches.empty() && !_processingBatchInFlight) ||
+            !_processingStatus.isOK();
+    });
+    return _processingStatus;
+}
+
+void OplogFetcher::_joinProcessingThread() {
+    if (!_processingThread.joinable()) {
+        return;
+    }
+    {
+        stdx::lock_guard<Latch> lk(_processingMutex);
+        _processingShutdown = true;
+    }
+    _processingHasWork.notify_all();
+    _processingThread.join();
+}
+
 Status OplogFetcher::_checkRemoteOplogStart(const OplogFetcher::Documents& documents,
                                             OpTime remoteLastOpApplied,
                                             int remoteRBID) {
@@ -29,7 +29,9 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
 #include <cstddef>
+#include <deque>
 #include <functional>
 
 #include "mongo/base/status_with.h"
@@ -42,6 +44,8 @@
 #include "mongo/db/repl/repl_set_config.h"
 #include "mongo/db/repl/replication_process.h"
 #include "mongo/db/vector_clock_metadata_hook.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/fail_point.h"
 
 namespace mongo {
@@ -66,7 +70,9 @@ extern FailPoint stopReplProducer;
  * Collect stats about all the batches received to be able to report in serverStatus metrics.
  *
  * Pushes operations from each batch of operations onto a buffer using the "enqueueDocumentsFn"
- * function.
+ * function. When the 'oplogFetcherPipelinedBatchProcessing' server parameter is enabled, batches
+ * are validated and enqueued on a dedicated thread so the next reply can be read from the sync
+ * source concurrently.
  *
  * When there is an error, it will create a new cursor by issuing a new `find` command to the sync
  * source. If the sync source is no longer eligible or the OplogFetcher was shutdown, calls
@@ -367,6 +373,22 @@ private:
      */
     BSONObj _makeFindQuery(long long findTimeout) const;
 
+    /**
+     * A batch read off the cursor together with the response state that accompanies it. The reply
+     * metadata and post-batch resume token are snapshotted at read time since the connection
+     * overwrites them with each subsequent reply.
+     */
+    struct FetchedBatch {
+        Documents documents;
+        BSONObj metadataObj;
+        boost::optional<BSONObj> postBatchResumeToken;
+        int elapsedMS = 0;
+        // Whether this is the first batch received via the current cursor. Carried with the batch
+        // since _firstBatch belongs to the fetcher thread and may have advanced by the time the
+        // batch is processed.
+        bool isFirstBatch = false;
+    };
+
     /**
      * Gets the next batch from the exhaust cursor.
      *
@@ -374,15 +396,44 @@ private:
      * shouldContinue function to see if it should create a new cursor and if so, calls
      * _createNewCursor.
      */
-    StatusWith<Documents> _getNextBatch();
+    StatusWith<FetchedBatch> _getNextBatch();
 
     /**
      * Function called by the oplog fetcher when it gets a successful batch from the sync source.
-     * This will also process the metadata received from the response.
+     * This will also process the metadata received with the response.
      *
      * On failure returns a status that will be passed to _finishCallback.
      */
-    Status _onSuccessfulBatch(const Documents& documents);
+    Status _onSuccessfulBatch(const FetchedBatch& batch);
+
+    /**
+     * Body of the batch processing thread used when 'oplogFetcherPipelinedBatchProcessing' is
+     * enabled. Pops fetched batches off _pipelinedBatches and runs _onSuccessfulBatch on them so
+     * that the fetcher thread can read the next reply off the connection concurrently. After the
+     * first batch fails, the remaining batches are discarded without being processed so the
+     * fetcher thread never blocks on a full pipeline.
+     */
+    void _processBatchesLoop();
+
+    /**
+     * Hands a fetched batch to the processing thread, blocking while the pipeline is full.
+     * Returns the first processing failure if an earlier batch failed; the batch is dropped in
+     * that case.
+     */
+    Status _pushToProcessingThread(FetchedBatch batch);
+
+    /**
+     * Waits for the processing thread to finish all queued batches and returns the first
+     * processing failure, if any. Must be called before restarting the cursor or finishing, since
+     * _lastFetched only advances as batches are processed and restarting with batches still in
+     * the pipeline would refetch and duplicate them.
+     */
+    Status _drainProcessingPipeline();
+
+    /**
+     * Signals the processing thread to stop and joins it. Any unprocessed batches are discarded.
+     */
+    void _joinProcessingThread();
 
     /**
      * Notifies caller that the oplog fetcher has completed processing operations from the remote
@@ -440,7 +491,8 @@ private:
     // the requiredRBID in the OplogFetcher::Config and passed to the onShutdown callback.
     int _receivedRBID;
 
-    // Indicates whether the current batch is the first received via this cursor.
+    // Indicates whether the next batch to read will be the first received via this cursor. Only
+    // accessed by the fetcher thread; each fetched batch carries its own isFirstBatch flag.
     bool _firstBatch = true;
 
     // In the case of an error, this will help decide if a new cursor should be created or the
@@ -481,7 +533,21 @@ private:
     // Handle to currently scheduled _runQuery task.
     executor::TaskExecutor::CallbackHandle _runQueryHandle;
 
-    int _lastBatchElapsedMS = 0;
+    // Batch processing pipeline state, used when 'oplogFetcherPipelinedBatchProcessing' is
+    // enabled. The fetcher thread pushes batches read off the cursor onto _pipelinedBatches and
+    // the processing thread validates and enqueues them, so a socket read and an enqueue into the
+    // oplog buffer can overlap. The pipeline depth is kept small; it only needs to cover the gap
+    // between reading a reply and enqueueing it, and the oplog buffer provides the real
+    // buffering.
+    static constexpr size_t kMaxPipelinedBatches = 2;
+    stdx::thread _processingThread;
+    Mutex _processingMutex = MONGO_MAKE_LATCH("OplogFetcher::_processingMutex");
+    stdx::condition_variable _processingHasWork;
+    stdx::condition_variable _processingHasSpace;
+    std::deque<FetchedBatch> _pipelinedBatches;
+    bool _processingBatchInFlight = false;
+    bool _processingShutdown = false;
+    Status _processingStatus = Status::OK();
 };
 
 class OplogFetcherFactory {
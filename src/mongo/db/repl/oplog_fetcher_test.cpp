@@ -406,8 +406,10 @@ void OplogFetcherTest::setUp() {
     _mockServer = std::make_unique<MockRemoteDBServer>(target.toString());
 
     // Always enable oplogFetcherUsesExhaust at the beginning of each unittest in case some
-    // unittests disable it in the test.
+    // unittests disable it in the test. Similarly, always disable the batch processing thread
+    // since most tests expect batches to be processed synchronously.
     oplogFetcherUsesExhaust = true;
+    oplogFetcherPipelinedBatchProcessing = false;
 }
 
 std::unique_ptr<OplogFetcher> OplogFetcherTest::makeOplogFetcher() {
@@ -1577,6 +1579,69 @@ TEST_F(OplogFetcherTest, OplogFetcherWorksWithoutExhaust) {
     ASSERT_EQUALS(remoteRBID, shutdownState.getRBID());
 }
 
+TEST_F(OplogFetcherTest, OplogFetcherWorksWithPipelinedBatchProcessing) {
+    // Test that the oplog fetcher enqueues batches correctly if the
+    // 'oplogFetcherPipelinedBatchProcessing' server parameter is set to true and batches are
+    // validated and enqueued on a dedicated thread.
+
+    ShutdownState shutdownState;
+
+    oplogFetcherPipelinedBatchProcessing = true;
+
+    // Create an oplog fetcher with one retry.
+    auto oplogFetcher = getOplogFetcherAfterConnectionCreated(std::ref(shutdownState), 1);
+
+    CursorId cursorId = 22LL;
+    auto firstEntry = makeNoopOplogEntry(lastFetched);
+    auto secondEntry = makeNoopOplogEntry({{Seconds(456), 0}, lastFetched.getTerm()});
+    auto metadataObj = makeOplogBatchMetadata(replSetMetadata, oqMetadata);
+    auto firstBatch = {firstEntry, secondEntry};
+
+    // Update lastFetched before it is updated by getting the next batch.
+    lastFetched = oplogFetcher->getLastOpTimeFetched_forTest();
+
+    // Creating the cursor will succeed. After this, the cursor will be blocked on call() for the
+    // getMore command while the first batch is handed off to the processing thread.
+    auto m = processSingleRequestResponse(oplogFetcher->getDBClientConnection_forTest(),
+                                          makeFirstBatch(cursorId, firstBatch, metadataObj),
+                                          true);
+
+    validateFindCommand(
+        m, lastFetched, durationCount<Milliseconds>(oplogFetcher->getInitialFindMaxTime_forTest()));
+
+    auto thirdEntry = makeNoopOplogEntry({{Seconds(457), 0}, lastFetched.getTerm()});
+    auto fourthEntry = makeNoopOplogEntry({{Seconds(458), 0}, lastFetched.getTerm()});
+    auto secondBatch = {thirdEntry, fourthEntry};
+
+    // Respond to the getMore request on the exhaust stream. The fetcher will read this reply
+    // while the first batch may still be in the processing pipeline.
+    processSingleRequestResponse(
+        oplogFetcher->getDBClientConnection_forTest(),
+        makeSubsequentBatch(cursorId, secondBatch, metadataObj, true /* moreToCome */),
+        true);
+
+    auto fifthEntry = makeNoopOplogEntry({{Seconds(789), 0}, lastFetched.getTerm()});
+    auto sixthEntry = makeNoopOplogEntry({{Seconds(790), 0}, lastFetched.getTerm()});
+    auto thirdBatch = {fifthEntry, sixthEntry};
+
+    // Terminating batch from the exhaust stream with cursorId 0. The fetcher must drain the
+    // processing pipeline before shutting down with a successful status.
+    processSingleExhaustResponse(oplogFetcher->getDBClientConnection_forTest(),
+                                 makeSubsequentBatch(0LL, thirdBatch, metadataObj, false),
+                                 false);
+
+    // Joining guarantees that every batch has been processed, since the oplog fetcher waits for
+    // the processing pipeline to empty before finishing.
+    oplogFetcher->join();
+
+    // Check that the last batch was successfully processed.
+    validateLastBatch(
+        false /* skipFirstDoc */, thirdBatch, oplogFetcher->getLastOpTimeFetched_forTest());
+
+    ASSERT_OK(shutdownState.getStatus());
+    ASSERT_EQ(remoteRBID, shutdownState.getRBID());
+}
+
 TEST_F(OplogFetcherTest, CursorIsDeadShutsDownOplogFetcherWithSuccessfulStatus) {
     ShutdownState shutdownState;
 
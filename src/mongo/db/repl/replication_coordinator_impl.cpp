@@ -719,10 +719,12 @@ void ReplicationCoordinatorImpl::_startDataReplication(OperationContext* opCtx,
         return;
     }
 
-    // Check to see if we need to do an initial sync.
+    // Check to see if we need to do an initial sync. A node with a valid data directory resumes
+    // from its own oplog via steady-state replication; initial sync is only required when there is
+    // no data to resume from or a previous initial sync attempt was interrupted partway through.
     const auto lastOpTime = getMyLastAppliedOpTime();
-    const auto needsInitialSync =
-        lastOpTime.isNull() || _externalState->isInitialSyncFlagSet(opCtx);
+    const bool initialSyncFlagSet = _externalState->isInitialSyncFlagSet(opCtx);
+    const auto needsInitialSync = lastOpTime.isNull() || initialSyncFlagSet;
     if (!needsInitialSync) {
         LOGV2_DEBUG(4280512, 1, "No initial sync required. Attempting to begin steady replication");
         // Start steady replication, since we already have data.
@@ -737,7 +739,13 @@ void ReplicationCoordinatorImpl::_startDataReplication(OperationContext* opCtx,
         return;
     }
 
-    LOGV2_DEBUG(4280513, 1, "Initial sync required. Attempting to start initial sync...");
+    // Log unconditionally: initial sync discards any existing local data, which can be very
+    // expensive to re-clone, so record why it was deemed necessary.
+    LOGV2(4280513,
+          "Initial sync required. Attempting to start initial sync...",
+          "reason"_attr = (lastOpTime.isNull() ? "no oplog entries to resume from"_sd
+                                               : "previous initial sync was interrupted"_sd),
+          "initialSyncFlagSet"_attr = initialSyncFlagSet);
     // Do initial sync.
     if (!_externalState->getTaskExecutor()) {
         LOGV2(21323, "Not running initial sync during test");
@@ -1003,8 +1011,10 @@ ReplicationCoordinator::Mode ReplicationCoordinatorImpl::getReplicationMode() co
 }
 
 MemberState ReplicationCoordinatorImpl::getMemberState() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    return _getMemberState_inlock();
+    // Answered from the shadow so that state checks never contend on _mutex against heartbeat
+    // processing and optime bookkeeping. The value is as fresh as one obtained under _mutex,
+    // which may in any case be stale by the time the caller examines it.
+    return MemberState(_memberStateShadow.load());
 }
 
 std::vector<MemberData> ReplicationCoordinatorImpl::getMemberData() const {
@@ -1725,8 +1735,15 @@ Status ReplicationCoordinatorImpl::setLastDurableOptime_forTest(long long cfgVer
 
     const UpdatePositionArgs::UpdateInfo update(
         OpTime(), Date_t(), opTime, wallTime, cfgVer, memberId);
-    const auto status = _setLastOptime(lock, update);
-    return status;
+    const auto result = _setLastOptime(lock, update);
+    if (result.isOK()) {
+        _cancelAndRescheduleLivenessUpdate_inlock(memberId);
+        if (result.getValue()) {
+            _updateLastCommittedOpTimeAndWallTime(lock);
+            _wakeReadyWaiters(lock, opTime);
+        }
+    }
+    return result.getStatus();
 }
 
 Status ReplicationCoordinatorImpl::setLastAppliedOptime_forTest(long long cfgVer,
@@ -1742,25 +1759,20 @@ Status ReplicationCoordinatorImpl::setLastAppliedOptime_forTest(long long cfgVer
 
     const UpdatePositionArgs::UpdateInfo update(
         opTime, wallTime, OpTime(), Date_t(), cfgVer, memberId);
-    const auto status = _setLastOptime(lock, update);
-    return status;
-}
-
-Status ReplicationCoordinatorImpl::_setLastOptime(WithLock lk,
-                                                  const UpdatePositionArgs::UpdateInfo& args) {
-    auto result = _topCoord->setLastOptime(args, _replExecutor->now());
-    if (!result.isOK())
-        return result.getStatus();
-    const bool advancedOpTime = result.getValue();
-    // Only update committed optime if the remote optimes increased.
-    if (advancedOpTime) {
-        _updateLastCommittedOpTimeAndWallTime(lk);
-        // Wait up replication waiters on optime changes.
-        _wakeReadyWaiters(lk, std::max(args.appliedOpTime, args.durableOpTime));
+    const auto result = _setLastOptime(lock, update);
+    if (result.isOK()) {
+        _cancelAndRescheduleLivenessUpdate_inlock(memberId);
+        if (result.getValue()) {
+            _updateLastCommittedOpTimeAndWallTime(lock);
+            _wakeReadyWaiters(lock, opTime);
+        }
     }
+    return result.getStatus();
+}
 
-    _cancelAndRescheduleLivenessUpdate_inlock(args.memberId);
-    return Status::OK();
+StatusWith<bool> ReplicationCoordinatorImpl::_setLastOptime(
+    WithLock lk, const UpdatePositionArgs::UpdateInfo& args) {
+    return _topCoord->setLastOptime(args, _replExecutor->now());
 }
 
 bool ReplicationCoordinatorImpl::isCommitQuorumSatisfied(
@@ -2107,7 +2119,7 @@ long long ReplicationCoordinatorImpl::_calculateRemainingQuiesceTimeMillis() con
     return remainingQuiesceTimeLong;
 }
 
-std::shared_ptr<HelloResponse> ReplicationCoordinatorImpl::_makeHelloResponse(
+std::shared_ptr<const HelloResponse> ReplicationCoordinatorImpl::_makeHelloResponse(
     boost::optional<StringData> horizonString, WithLock lock, const bool hasValidConfig) const {
 
     uassert(ShutdownInProgressQuiesceInfo(_calculateRemainingQuiesceTimeMillis()),
@@ -2123,11 +2135,29 @@ std::shared_ptr<HelloResponse> ReplicationCoordinatorImpl::_makeHelloResponse(
 
     // horizonString must be passed in if we are a valid member of the config.
     invariant(horizonString);
-    auto response = std::make_shared<HelloResponse>();
     invariant(getSettings().usingReplSets());
-    _topCoord->fillHelloForReplSet(response, *horizonString);
 
-    OpTime lastOpTime = _getMyLastAppliedOpTime_inlock();
+    // Everything in the response is a function of the topology (which cannot change without
+    // bumping the topology version counter), the optimes reported under "lastWrite", and the
+    // drain mode and shutdown flags checked below. While all of those are unchanged, serve the
+    // response built last time rather than building and serializing a fresh, identical one for
+    // every driver heartbeat.
+    const auto topologyVersionCounter = _topCoord->getTopologyVersion().getCounter();
+    const OpTime lastOpTime = _getMyLastAppliedOpTime_inlock();
+    const bool canAcceptNonLocalWrites = _readWriteAbility->canAcceptNonLocalWrites(lock);
+
+    if (auto it = _helloResponseCache.find(*horizonString); it != _helloResponseCache.end()) {
+        const auto& entry = it->second;
+        if (entry.topologyVersionCounter == topologyVersionCounter &&
+            entry.lastWrite == lastOpTime && entry.lastMajorityWrite == _currentCommittedSnapshot &&
+            entry.canAcceptNonLocalWrites == canAcceptNonLocalWrites &&
+            entry.inShutdown == _inShutdown) {
+            return entry.response;
+        }
+    }
+
+    auto response = std::make_shared<HelloResponse>();
+    _topCoord->fillHelloForReplSet(response, *horizonString);
 
     response->setLastWrite(lastOpTime, lastOpTime.getTimestamp().getSecs());
     if (_currentCommittedSnapshot) {
@@ -2135,7 +2165,7 @@ std::shared_ptr<HelloResponse> ReplicationCoordinatorImpl::_makeHelloResponse(
                                        _currentCommittedSnapshot->getTimestamp().getSecs());
     }
 
-    if (response->isWritablePrimary() && !_readWriteAbility->canAcceptNonLocalWrites(lock)) {
+    if (response->isWritablePrimary() && !canAcceptNonLocalWrites) {
         // Report that we are secondary and not accepting writes until drain completes.
         response->setIsWritablePrimary(false);
         response->setIsSecondary(true);
@@ -2145,6 +2175,13 @@ std::shared_ptr<HelloResponse> ReplicationCoordinatorImpl::_makeHelloResponse(
         response->setIsWritablePrimary(false);
         response->setIsSecondary(false);
     }
+
+    _helloResponseCache[horizonString->toString()] = {response,
+                                                      topologyVersionCounter,
+                                                      lastOpTime,
+                                                      _currentCommittedSnapshot,
+                                                      canAcceptNonLocalWrites,
+                                                      _inShutdown};
     return response;
 }
 
@@ -4108,6 +4145,7 @@ ReplicationCoordinatorImpl::_updateMemberStateFromTopologyCoordinator(WithLock l
           "newState"_attr = newState,
           "oldState"_attr = _memberState);
     _memberState = newState;
+    _memberStateShadow.store(newState.s);
 
     _cancelAndRescheduleElectionTimeout_inlock();
 
@@ -4559,10 +4597,37 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig(WithLock lk,
 }
 
 void ReplicationCoordinatorImpl::_wakeReadyWaiters(WithLock lk, boost::optional<OpTime> opTime) {
+    // The waiters are scanned in increasing awaited-optime order and satisfaction of a fixed
+    // write concern is monotone in the awaited optime, so once a write concern has been found
+    // unsatisfied there is no need to re-evaluate it - which costs a scan of the member table -
+    // for every later waiter. Most waiters share a handful of distinct write concerns, so this
+    // bounds the work per optime advance by the number of distinct write concerns rather than
+    // the number of waiters.
+    std::vector<WriteConcernOptions> unsatisfiedWriteConcerns;
+    auto alreadyFoundUnsatisfied = [&](const WriteConcernOptions& writeConcern) {
+        for (const auto& unsatisfied : unsatisfiedWriteConcerns) {
+            // Only the fields examined by _doneWaitingForReplication_inlock determine
+            // satisfaction.
+            if (unsatisfied.wNumNodes == writeConcern.wNumNodes &&
+                unsatisfied.wMode == writeConcern.wMode &&
+                unsatisfied.syncMode == writeConcern.syncMode) {
+                return true;
+            }
+        }
+        return false;
+    };
     _replicationWaiterList.setValueIf_inlock(
-        [this](const OpTime& opTime, const SharedWaiterHandle& waiter) {
+        [&](const OpTime& opTime, const SharedWaiterHandle& waiter) {
             invariant(waiter->writeConcern);
-            return _doneWaitingForReplication_inlock(opTime, waiter->writeConcern.get());
+            const auto& writeConcern = waiter->writeConcern.get();
+            if (alreadyFoundUnsatisfied(writeConcern)) {
+                return false;
+            }
+            if (_doneWaitingForReplication_inlock(opTime, writeConcern)) {
+                return true;
+            }
+            unsatisfiedWriteConcerns.push_back(writeConcern);
+            return false;
         },
         opTime);
 }
@@ -4571,16 +4636,44 @@ Status ReplicationCoordinatorImpl::processReplSetUpdatePosition(const UpdatePosi
     stdx::unique_lock<Latch> lock(_mutex);
     Status status = Status::OK();
     bool somethingChanged = false;
+    bool advancedOpTime = false;
+    bool updatedStalestMember = false;
+    OpTime maxRemoteOpTime;
     for (UpdatePositionArgs::UpdateIterator update = updates.updatesBegin();
          update != updates.updatesEnd();
          ++update) {
-        status = _setLastOptime(lock, *update);
-        if (!status.isOK()) {
+        auto result = _setLastOptime(lock, *update);
+        if (!result.isOK()) {
+            status = result.getStatus();
             break;
         }
+        if (_earliestMemberId == -1 || _earliestMemberId == update->memberId) {
+            updatedStalestMember = true;
+        }
+        if (result.getValue()) {
+            advancedOpTime = true;
+            maxRemoteOpTime =
+                std::max({maxRemoteOpTime, update->appliedOpTime, update->durableOpTime});
+        }
         somethingChanged = true;
     }
 
+    if (updatedStalestMember) {
+        // Each successful update above refreshed the liveness clock of its member, but the
+        // liveness timeout is only keyed off the stalest member. Cancel and reschedule it once
+        // for the entire update command rather than once per member entry. Passing
+        // _earliestMemberId satisfies the helper's check that the rescheduling is warranted.
+        _cancelAndRescheduleLivenessUpdate_inlock(_earliestMemberId);
+    }
+
+    if (advancedOpTime) {
+        // Advance the commit point and wake replication waiters once for the entire update
+        // command rather than once per member entry; an update from a secondary with chained
+        // members below it can carry entries for much of the set.
+        _updateLastCommittedOpTimeAndWallTime(lock);
+        _wakeReadyWaiters(lock, maxRemoteOpTime);
+    }
+
     if (somethingChanged && !_getMemberState_inlock().primary()) {
         lock.unlock();
         // Must do this outside _mutex
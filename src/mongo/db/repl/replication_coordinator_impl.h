@@ -990,8 +990,14 @@ private:
      * This is only valid to call on replica sets.
      * "configVersion" will be populated with our config version if it and the configVersion
      * of "args" differ.
+     *
+     * Returns whether the remote optimes advanced; if so, the caller is responsible for
+     * updating the last committed optime and waking replication waiters, so that a position
+     * update carrying entries for many members pays those costs once rather than per entry.
+     * The caller is likewise responsible for rescheduling the liveness timeout, which this
+     * method refreshes in the member data but deliberately does not reschedule itself.
      */
-    Status _setLastOptime(WithLock lk, const UpdatePositionArgs::UpdateInfo& args);
+    StatusWith<bool> _setLastOptime(WithLock lk, const UpdatePositionArgs::UpdateInfo& args);
 
     /**
      * This function will report our position externally (like upstream) if necessary.
@@ -1230,11 +1236,12 @@ private:
 
     /**
      * Fills a HelloResponse with the appropriate replication related fields. horizonString
-     * should be passed in if hasValidConfig is true.
+     * should be passed in if hasValidConfig is true. Responses are cached per horizon and a
+     * cached response is returned as long as every input that shapes it is unchanged, so
+     * callers must treat the result as immutable.
      */
-    std::shared_ptr<HelloResponse> _makeHelloResponse(boost::optional<StringData> horizonString,
-                                                      WithLock,
-                                                      const bool hasValidConfig) const;
+    std::shared_ptr<const HelloResponse> _makeHelloResponse(
+        boost::optional<StringData> horizonString, WithLock, const bool hasValidConfig) const;
 
     /**
      * Creates a semi-future for HelloResponse. horizonString should be passed in if and only if
@@ -1536,6 +1543,24 @@ private:
     // the default horizon.
     StringMap<std::shared_ptr<SharedPromiseOfHelloResponse>> _sniToValidConfigPromiseMap;  // (M)
 
+    // A hello response previously built by _makeHelloResponse along with the inputs that shaped
+    // it, so that the many hello commands issued between changes to those inputs (driver
+    // heartbeats in particular) can share one immutable response instead of each building and
+    // serializing their own. A topology change bumps the topology version counter, which
+    // invalidates every cached entry.
+    struct HelloResponseCacheEntry {
+        std::shared_ptr<const HelloResponse> response;
+        long long topologyVersionCounter;
+        OpTime lastWrite;
+        boost::optional<OpTime> lastMajorityWrite;
+        bool canAcceptNonLocalWrites;
+        bool inShutdown;
+    };
+
+    // Maps a horizon name to the hello response cached for it. Mutable so that the const
+    // response-building path can maintain it; like its inputs, it is guarded by _mutex.
+    mutable StringMap<HelloResponseCacheEntry> _helloResponseCache;  // (M)
+
     // Set to true when we are in the process of shutting down replication.
     bool _inShutdown;  // (M)
 
@@ -1548,6 +1573,10 @@ private:
     // Current ReplicaSet state.
     MemberState _memberState;  // (M)
 
+    // Shadow of _memberState, maintained on every state transition so that getMemberState() can
+    // answer without acquiring _mutex, as _termShadow does for the term.
+    AtomicWord<int> _memberStateShadow{MemberState::RS_STARTUP};  // (S)
+
     // Used to signal threads waiting for changes to _memberState.
     stdx::condition_variable _drainFinishedCond;  // (M)
 
@@ -115,7 +115,7 @@ TopologyVersion appendReplicationInfo(OperationContext* opCtx,
         }
         auto helloResponse =
             replCoord->awaitHelloResponse(opCtx, horizonParams, clientTopologyVersion, deadline);
-        result->appendElements(helloResponse->toBSON(useLegacyResponseFields));
+        result->appendElements(helloResponse->serialized(useLegacyResponseFields));
         if (appendReplicationProcess) {
             replCoord->appendSecondaryInfoData(result);
         }
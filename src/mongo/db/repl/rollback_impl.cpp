@@ -1262,7 +1262,12 @@ void RollbackImpl::_resetDropPendingState(OperationContext* opCtx) {
     for (const auto& dbName : dbNames) {
         Lock::DBLock dbLock(opCtx, dbName, MODE_X);
         auto db = databaseHolder->openDb(opCtx, dbName);
-        db->checkForIdIndexesAndDropPendingCollections(opCtx);
+        // Recovering to the stable timestamp cannot remove the _id index of a collection that was
+        // not written to in the rolled-back oplog window, and every collection was already checked
+        // during startup. Limit the post-recovery _id index check to the namespaces this rollback
+        // actually touched. Drop-pending namespaces may predate the common point and are still
+        // gathered from every database, since the reaper state was cleared above.
+        db->checkForIdIndexesAndDropPendingCollections(opCtx, &_observerInfo.rollbackNamespaces);
     }
 }
 
@@ -367,15 +367,21 @@ TenantOplogApplier::OpTimePair TenantOplogApplier::_writeNoOpEntries(
     // what we want to return from this function.
     auto greatestOplogSlotUsed = OpTime();
     auto slotIter = oplogSlots.begin();
-    for (const auto& op : batch.ops) {
-        if (isResumeTokenNoop(op.entry)) {
-            // We do not want to set the recipient optime for resume token noop oplog entries since
-            // we won't actually apply them.
-            slotIter++;
-            continue;
+    {
+        // Take the mutex once for the whole batch rather than once per entry; this loop runs
+        // serially between the parallel apply and the parallel no-op writes, so per-entry lock
+        // round trips directly lengthen the batch.
+        stdx::lock_guard lk(_mutex);
+        for (const auto& op : batch.ops) {
+            if (isResumeTokenNoop(op.entry)) {
+                // We do not want to set the recipient optime for resume token noop oplog entries
+                // since we won't actually apply them.
+                slotIter++;
+                continue;
+            }
+            greatestOplogSlotUsed = *slotIter;
+            _setRecipientOpTime(lk, op.entry.getOpTime(), *slotIter++);
         }
-        greatestOplogSlotUsed = *slotIter;
-        _setRecipientOpTime(op.entry.getOpTime(), *slotIter++);
     }
     const size_t numOplogThreads = _writerPool->getStats().numThreads;
     const size_t numOpsPerThread = std::max(std::size_t(minOplogEntriesPerThread.load()),
@@ -448,9 +454,9 @@ OpTime TenantOplogApplier::_getRecipientOpTime(const OpTime& donorOpTime) {
     return times->recipientOpTime;
 }
 
-void TenantOplogApplier::_setRecipientOpTime(const OpTime& donorOpTime,
+void TenantOplogApplier::_setRecipientOpTime(WithLock,
+                                             const OpTime& donorOpTime,
                                              const OpTime& recipientOpTime) {
-    stdx::lock_guard lk(_mutex);
     // The _opTimeMapping is an array strictly ordered by donorOpTime; this uassert assures the
     // order remains intact.
     uassert(4886001,
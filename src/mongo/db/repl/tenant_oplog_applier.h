@@ -116,7 +116,7 @@ private:
     // This is a convenience call for getRecipientOpTime which handles boost::none and nulls.
     boost::optional<OpTime> _maybeGetRecipientOpTime(const boost::optional<OpTime>);
     // _setRecipientOpTime must be called in optime order.
-    void _setRecipientOpTime(const OpTime& donorOpTime, const OpTime& recipientOpTime);
+    void _setRecipientOpTime(WithLock, const OpTime& donorOpTime, const OpTime& recipientOpTime);
     /**
      * Sets the _finalStatus to the new status if and only if the old status is "OK".
      */
@@ -364,12 +364,23 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicyImpl::selectChunksToMo
         return MigrateInfoVector{};
     }
 
+    // Cluster-wide throttle on the number of migrations, which may be scheduled in parallel
+    // within this balancing round. Zero means the only limit is the one migration at a time, in
+    // which each individual shard can participate.
+    const int maxConcurrentMigrations =
+        Grid::get(opCtx)->getBalancerConfiguration()->getMaxConcurrentMigrations();
+
     MigrateInfoVector candidateChunks;
     std::set<ShardId> usedShards;
 
     std::shuffle(collections.begin(), collections.end(), _random);
 
     for (const auto& coll : collections) {
+        if (maxConcurrentMigrations > 0 &&
+            candidateChunks.size() >= static_cast<size_t>(maxConcurrentMigrations)) {
+            break;
+        }
+
         if (coll.getDropped()) {
             continue;
         }
@@ -406,6 +417,12 @@ StatusWith<MigrateInfoVector> BalancerChunkSelectionPolicyImpl::selectChunksToMo
                                std::make_move_iterator(candidatesStatus.getValue().end()));
     }
 
+    // A single collection may have contributed more candidates than the remaining budget allowed
+    if (maxConcurrentMigrations > 0 &&
+        candidateChunks.size() > static_cast<size_t>(maxConcurrentMigrations)) {
+        candidateChunks.resize(maxConcurrentMigrations);
+    }
+
     return candidateChunks;
 }
 
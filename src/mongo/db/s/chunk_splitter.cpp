@@ -33,6 +33,9 @@
 
 #include "mongo/db/s/chunk_splitter.h"
 
+#include <algorithm>
+
+#include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/client/dbclient_cursor.h"
 #include "mongo/client/query.h"
 #include "mongo/db/client.h"
@@ -40,6 +43,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/s/chunk_split_state_driver.h"
 #include "mongo/db/s/shard_filtering_metadata_refresh.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/s/sharding_state.h"
 #include "mongo/db/s/split_chunk.h"
 #include "mongo/db/s/split_vector.h"
@@ -49,6 +53,7 @@
 #include "mongo/s/catalog/type_chunk.h"
 #include "mongo/s/catalog_cache.h"
 #include "mongo/s/chunk_manager.h"
+#include "mongo/s/chunk_writes_tracker.h"
 #include "mongo/s/config_server_client.h"
 #include "mongo/s/grid.h"
 #include "mongo/s/shard_key_pattern.h"
@@ -195,6 +200,29 @@ BSONObj findExtremeKeyForShard(OperationContext* opCtx,
     return shardKeyPattern.extractShardKeyFromDoc(end);
 }
 
+/**
+ * Attempts to derive a split point for 'chunk' from the reservoir of shard keys sampled by the op
+ * observer as documents were written to it. Returns the sampled median as the single split point,
+ * halving the chunk, or an empty vector if the sample is not yet full or its median does not
+ * strictly separate the chunk bounds (e.g. for low cardinality keys or writes concentrated at one
+ * end of the chunk).
+ */
+std::vector<BSONObj> splitPointsFromSampledKeys(const Chunk& chunk) {
+    auto sampledKeys = chunk.getWritesTracker()->getSampledKeys();
+    if (sampledKeys.size() < ChunkWritesTracker::kSampledKeysCapacity) {
+        return {};
+    }
+
+    std::sort(
+        sampledKeys.begin(), sampledKeys.end(), SimpleBSONObjComparator::kInstance.makeLessThan());
+
+    auto median = sampledKeys[sampledKeys.size() / 2];
+    if (median.woCompare(chunk.getMin()) <= 0 || median.woCompare(chunk.getMax()) >= 0) {
+        return {};
+    }
+    return {median.getOwned()};
+}
+
 /**
  * Checks if autobalance is enabled on the current sharded collection.
  */
@@ -336,15 +364,25 @@ void ChunkSplitter::_runAutosplit(std::shared_ptr<ChunkSplitStateDriver> chunkSp
                     "maxChunkSizeBytes"_attr = maxChunkSizeBytes);
 
         chunkSplitStateDriver->prepareSplit();
-        auto splitPoints = splitVector(opCtx.get(),
-                                       nss,
-                                       shardKeyPattern.toBSON(),
-                                       chunk.getMin(),
-                                       chunk.getMax(),
-                                       false,
-                                       boost::none,
-                                       boost::none,
-                                       maxChunkSizeBytes);
+
+        // When enabled, first try to derive a split point from the shard keys sampled as
+        // documents were written to the chunk, which avoids scanning the shard key index. Fall
+        // back to splitVector whenever the sample cannot produce a usable point.
+        std::vector<BSONObj> splitPoints;
+        if (autoSplitUseSampledShardKeys.load()) {
+            splitPoints = splitPointsFromSampledKeys(chunk);
+        }
+        if (splitPoints.empty()) {
+            splitPoints = splitVector(opCtx.get(),
+                                      nss,
+                                      shardKeyPattern.toBSON(),
+                                      chunk.getMin(),
+                                      chunk.getMax(),
+                                      false,
+                                      boost::none,
+                                      boost::none,
+                                      maxChunkSizeBytes);
+        }
 
         if (splitPoints.empty()) {
             LOGV2_DEBUG(21907,
@@ -662,16 +662,18 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneLocs(OperationCon
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
     stdx::unique_lock<Latch> lk(_mutex);
-    auto iter = _cloneLocs.begin();
 
-    for (; iter != _cloneLocs.end(); ++iter) {
+    while (!_cloneLocs.empty()) {
         // We must always make progress in this method by at least one document because empty
         // return indicates there is no more initial clone data.
         if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
             break;
         }
 
-        auto nextRecordId = *iter;
+        // Claim the next record id under the mutex so that concurrent callers each drain a
+        // disjoint set of records and can fetch their documents without blocking each other.
+        auto nextRecordId = *_cloneLocs.begin();
+        _cloneLocs.erase(_cloneLocs.begin());
 
         lk.unlock();
 
@@ -681,7 +683,10 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneLocs(OperationCon
             // that we take into consideration the overhead of BSONArray indices.
             if (arrBuilder->arrSize() &&
                 (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
-
+                // The document does not fit in the current batch, so put the record back for
+                // the next one.
+                lk.lock();
+                _cloneLocs.insert(nextRecordId);
                 break;
             }
 
@@ -691,8 +696,6 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneLocs(OperationCon
 
         lk.lock();
     }
-
-    _cloneLocs.erase(_cloneLocs.begin(), iter);
 }
 
 uint64_t MigrationChunkClonerSourceLegacy::getCloneBatchBufferAllocationSize() {
@@ -710,9 +713,11 @@ Status MigrationChunkClonerSourceLegacy::nextCloneBatch(OperationContext* opCtx,
     dassert(opCtx->lockState()->isCollectionLockedForMode(_args.getNss(), MODE_IS));
 
     // If this chunk is too large to store records in _cloneLocs and the command args specify to
-    // attempt to move it, scan the collection directly.
+    // attempt to move it, scan the collection directly. The index scan executor is a single
+    // stream, so concurrent batch requests from the recipient must take turns.
     if (_jumboChunkCloneState && _forceJumbo) {
         try {
+            stdx::lock_guard<Latch> clonerLock(_jumboChunkCloneState->clonerMutex);
             _nextCloneBatchFromIndexScan(opCtx, collection, arrBuilder);
             return Status::OK();
         } catch (const DBException& ex) {
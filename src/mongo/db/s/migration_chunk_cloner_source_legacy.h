@@ -379,6 +379,10 @@ private:
     const bool _forceJumbo;
 
     struct JumboChunkCloneState {
+        // Serializes access to 'clonerExec', which is a single stream and so cannot produce
+        // batches for concurrent requests from the recipient.
+        Mutex clonerMutex = MONGO_MAKE_LATCH("JumboChunkCloneState::clonerMutex");
+
         // Plan executor for collection scan used to clone docs.
         std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> clonerExec;
 
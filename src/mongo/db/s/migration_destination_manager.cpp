@@ -445,7 +445,67 @@ Status MigrationDestinationManager::start(OperationContext* opCtx,
 repl::OpTime MigrationDestinationManager::cloneDocumentsFromDonor(
     OperationContext* opCtx,
     std::function<void(OperationContext*, BSONObj)> insertBatchFn,
-    std::function<BSONObj(OperationContext*)> fetchBatchFn) {
+    std::function<BSONObj(OperationContext*)> fetchBatchFn,
+    int concurrency) {
+
+    if (concurrency > 1) {
+        // Each worker thread fetches and inserts its own batches. The pipelining comes from
+        // having several batches in flight at once: while one worker waits on the donor, the
+        // others are inserting.
+        auto resultMutex = MONGO_MAKE_LATCH("cloneDocumentsFromDonor::resultMutex");
+        AtomicWord<bool> cloneFinished{false};
+        repl::OpTime lastOpApplied;
+
+        std::vector<stdx::thread> workers;
+        for (int i = 0; i < concurrency; i++) {
+            workers.emplace_back([&, i] {
+                const std::string threadName = str::stream() << "chunkInserter-" << i;
+                Client::initThread(threadName, opCtx->getServiceContext(), nullptr);
+                auto client = Client::getCurrent();
+                {
+                    stdx::lock_guard lk(*client);
+                    client->setSystemOperationKillableByStepdown(lk);
+                }
+
+                auto workerOpCtx = client->makeOperationContext();
+
+                try {
+                    while (!cloneFinished.load()) {
+                        auto nextBatch = fetchBatchFn(workerOpCtx.get());
+                        auto arr = nextBatch["objects"].Obj();
+                        if (arr.isEmpty()) {
+                            cloneFinished.store(true);
+                            break;
+                        }
+                        insertBatchFn(workerOpCtx.get(), arr);
+                    }
+
+                    stdx::lock_guard<Latch> lk(resultMutex);
+                    auto lastOp =
+                        repl::ReplClientInfo::forClient(workerOpCtx->getClient()).getLastOp();
+                    if (lastOpApplied < lastOp) {
+                        lastOpApplied = lastOp;
+                    }
+                } catch (...) {
+                    cloneFinished.store(true);
+                    stdx::lock_guard<Client> lk(*opCtx->getClient());
+                    opCtx->getServiceContext()->killOperation(lk, opCtx, ErrorCodes::Error(51008));
+                    LOGV2(5837122,
+                          "Batch fetch or insertion failed",
+                          "error"_attr = redact(exceptionToStatus()));
+                }
+            });
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        // This check is necessary because the worker threads use killOp to propagate errors to
+        // this thread.
+        opCtx->checkForInterrupt();
+        return lastOpApplied;
+    }
 
     SingleProducerSingleConsumerQueue<BSONObj>::Options options;
     options.maxQueueDepth = 1;
@@ -1118,9 +1178,16 @@ void MigrationDestinationManager::_migrateDriver(OperationContext* outerOpCtx) {
             return res.response;
         };
 
+        int concurrency = chunkMigrationConcurrency.load();
+        if (_writeConcern.needToWaitForOtherNodes()) {
+            // The secondary throttle waits for replication after each insert batch through the
+            // outer operation context, which cannot be shared by several inserter threads.
+            concurrency = 1;
+        }
+
         // If running on a replicated system, we'll need to flush the docs we cloned to the
         // secondaries
-        lastOpApplied = cloneDocumentsFromDonor(opCtx, insertBatchFn, fetchBatchFn);
+        lastOpApplied = cloneDocumentsFromDonor(opCtx, insertBatchFn, fetchBatchFn, concurrency);
 
         timing.done(3);
         migrateThreadHangAtStep3.pauseWhileSet();
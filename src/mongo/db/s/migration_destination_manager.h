@@ -114,12 +114,16 @@ public:
                  const WriteConcernOptions& writeConcern);
 
     /**
-     * Clones documents from a donor shard.
+     * Clones documents from a donor shard. With a concurrency of 1, batches are fetched by the
+     * calling thread and inserted by a dedicated inserter thread. With a higher concurrency,
+     * that many worker threads each fetch and insert their own batches, so several batches are
+     * in flight to the donor at once.
      */
     static repl::OpTime cloneDocumentsFromDonor(
         OperationContext* opCtx,
         std::function<void(OperationContext*, BSONObj)> insertBatchFn,
-        std::function<BSONObj(OperationContext*)> fetchBatchFn);
+        std::function<BSONObj(OperationContext*)> fetchBatchFn,
+        int concurrency = 1);
 
     /**
      * Idempotent method, which causes the current ongoing migration to abort only if it has the
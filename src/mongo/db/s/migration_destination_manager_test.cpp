@@ -105,6 +105,51 @@ TEST_F(MigrationDestinationManagerTest, CloneDocumentsFromDonorWorksCorrectly) {
     }
 }
 
+// Tests that all batches reach the insert logic exactly once when several worker threads fetch
+// and insert concurrently.
+TEST_F(MigrationDestinationManagerTest, CloneDocumentsFromDonorWorksCorrectlyInParallel) {
+    const int kConcurrency = 4;
+    const int kNumBatches = 10;
+
+    auto mutex = MONGO_MAKE_LATCH("CloneDocumentsFromDonorWorksCorrectlyInParallel::mutex");
+    int batchesReturned = 0;
+    std::vector<BSONObj> resultDocs;
+
+    auto fetchBatchFn = [&](OperationContext* opCtx) {
+        BSONObjBuilder fetchBatchResultBuilder;
+
+        stdx::lock_guard<Latch> lk(mutex);
+        if (batchesReturned >= kNumBatches) {
+            fetchBatchResultBuilder.append("objects", BSONObj());
+        } else {
+            BSONArrayBuilder arrayBuilder;
+            arrayBuilder.append(createDocument(batchesReturned));
+            fetchBatchResultBuilder.append("objects", arrayBuilder.arr());
+            batchesReturned++;
+        }
+
+        return fetchBatchResultBuilder.obj();
+    };
+
+    auto insertBatchFn = [&](OperationContext* opCtx, BSONObj docs) {
+        stdx::lock_guard<Latch> lk(mutex);
+        for (auto&& docToClone : docs) {
+            resultDocs.push_back(docToClone.Obj().getOwned());
+        }
+    };
+
+    MigrationDestinationManager::cloneDocumentsFromDonor(
+        operationContext(), insertBatchFn, fetchBatchFn, kConcurrency);
+
+    ASSERT_EQ(resultDocs.size(), static_cast<size_t>(kNumBatches));
+
+    std::set<int> clonedValues;
+    for (auto&& doc : resultDocs) {
+        clonedValues.insert(doc["_id"].numberInt());
+    }
+    ASSERT_EQ(clonedValues.size(), static_cast<size_t>(kNumBatches));
+}
+
 // Tests that an exception in the fetch logic will successfully throw an exception on the main
 // thread.
 TEST_F(MigrationDestinationManagerTest, CloneDocumentsThrowsFetchErrors) {
@@ -54,9 +54,11 @@
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner.h"
 #include "mongo/db/repl/repl_client_info.h"
+#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/wait_for_majority_service.h"
 #include "mongo/db/s/migration_util.h"
 #include "mongo/db/s/range_deletion_task_gen.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/s/sharding_statistics.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/remove_saver.h"
@@ -237,9 +239,40 @@ StatusWith<int> deleteNextBatch(OperationContext* opCtx,
 
     } while (++numDeleted < numDocsToRemovePerBatch);
 
+    if (numDeleted > 0) {
+        ShardingStatistics::get(opCtx).countBatchesDeletedOnDonor.addAndFetch(1);
+    }
+
     return numDeleted;
 }
 
+// Limits how far the adaptive batch sizing may grow the configured batch size.
+constexpr int kMaxBatchSizeGrowthFactor = 16;
+
+/**
+ * Returns the growth factor to apply to the configured batch size on the next deletion pass. While
+ * the majority commit point keeps up with the primary, the factor doubles every pass so that a
+ * healthy replica set tears through a backlog of orphaned ranges quickly. As soon as the majority
+ * replication lag exceeds rangeDeleterMaxReplicationLagSecs the factor drops back to one, which
+ * returns the deleter to its configured pace until the secondaries catch up. A threshold of zero
+ * disables the growth entirely.
+ */
+int nextBatchSizeGrowthFactor(OperationContext* opCtx, int currentGrowthFactor) {
+    const auto maxLagSecs = rangeDeleterMaxReplicationLagSecs.load();
+    if (maxLagSecs <= 0) {
+        return 1;
+    }
+
+    const auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    const auto lastApplied = replCoord->getMyLastAppliedOpTimeAndWallTime();
+    const auto lastCommitted = replCoord->getLastCommittedOpTimeAndWallTime();
+    if (lastApplied.wallTime - lastCommitted.wallTime > Seconds(maxLagSecs)) {
+        return 1;
+    }
+
+    return std::min(currentGrowthFactor * 2, kMaxBatchSizeGrowthFactor);
+}
+
 
 template <typename Callable>
 auto withTemporaryOperationContext(Callable&& callable) {
@@ -301,14 +334,19 @@ ExecutorFuture<void> deleteRangeInBatches(const std::shared_ptr<executor::TaskEx
                                           const boost::optional<UUID>& migrationId,
                                           int numDocsToRemovePerBatch,
                                           Milliseconds delayBetweenBatches) {
+    // Grown and shrunk across passes depending on how well the majority commit point keeps up
+    // with the deletions.
+    auto batchSizeGrowthFactor = std::make_shared<int>(1);
     return AsyncTry([=] {
                return withTemporaryOperationContext([=](OperationContext* opCtx) {
+                   const auto batchSize = numDocsToRemovePerBatch * (*batchSizeGrowthFactor);
+
                    LOGV2_DEBUG(5346200,
                                1,
                                "Starting batch deletion",
                                "namespace"_attr = nss,
                                "range"_attr = redact(range.toString()),
-                               "numDocsToRemovePerBatch"_attr = numDocsToRemovePerBatch,
+                               "numDocsToRemovePerBatch"_attr = batchSize,
                                "delayBetweenBatches"_attr = delayBetweenBatches);
 
                    if (migrationId) {
@@ -325,11 +363,11 @@ ExecutorFuture<void> deleteRangeInBatches(const std::shared_ptr<executor::TaskEx
                        "deletion task. No need to delete documents.",
                        !collectionUuidHasChanged(nss, collection.getCollection(), collectionUuid));
 
-                   auto numDeleted = uassertStatusOK(deleteNextBatch(opCtx,
-                                                                     collection.getCollection(),
-                                                                     keyPattern,
-                                                                     range,
-                                                                     numDocsToRemovePerBatch));
+                   auto numDeleted = uassertStatusOK(deleteNextBatch(
+                       opCtx, collection.getCollection(), keyPattern, range, batchSize));
+
+                   *batchSizeGrowthFactor =
+                       nextBatchSizeGrowthFactor(opCtx, *batchSizeGrowthFactor);
 
                    LOGV2_DEBUG(
                        23769,
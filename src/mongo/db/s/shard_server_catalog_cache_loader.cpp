@@ -46,6 +46,7 @@
 #include "mongo/db/read_concern.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/shard_metadata_util.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/s/sharding_state.h"
 #include "mongo/db/s/type_shard_collection.h"
 #include "mongo/db/s/type_shard_database.h"
@@ -652,6 +653,41 @@ ShardServerCatalogCacheLoader::_schedulePrimaryGetChunksSince(
         return getPersistedMaxChunkVersion(opCtx, nss);
     }();
 
+    // When the metadata the loader already has is strictly ahead of what the caller has, serve
+    // the refresh from the local copy and skip the round trip to the config server. This absorbs
+    // the refresh storm, which would otherwise hit the config servers when many shards restart
+    // with a cold in-memory cache, since their first refresh for each collection can be satisfied
+    // from the persisted config.cache.chunks collections. If the local copy is itself stale, the
+    // shard versioning protocol detects it and, because the served version then matches the
+    // loader's maximum, the subsequent refresh falls through to the config server below.
+    if (serveChunkRefreshesFromPersistedMetadata.load() && maxLoaderVersion.isSet() &&
+        (!catalogCacheSinceVersion.isSet() ||
+         catalogCacheSinceVersion.isOlderThan(maxLoaderVersion))) {
+        auto swLocalMetadata =
+            _getLoaderMetadata(opCtx, nss, catalogCacheSinceVersion, termScheduled);
+        if (swLocalMetadata.isOK()) {
+            const auto termAfterLocalRead = [&] {
+                stdx::lock_guard<Latch> lock(_mutex);
+                return _term;
+            }();
+
+            if (termAfterLocalRead == termScheduled) {
+                LOGV2_FOR_CATALOG_REFRESH(
+                    5837137,
+                    1,
+                    "Cache loader served refresh for collection {namespace} up to version "
+                    "{version} from the locally persisted metadata",
+                    "Cache loader served refresh for collection from the locally persisted "
+                    "metadata",
+                    "namespace"_attr = nss,
+                    "version"_attr = maxLoaderVersion);
+                return swLocalMetadata;
+            }
+        }
+
+        // On any failure to read the local copy just fall through to a config server refresh.
+    }
+
     // Refresh the loader's metadata from the config server. The caller's request will
     // then be serviced from the loader's up-to-date metadata.
     auto swCollectionAndChangedChunks =
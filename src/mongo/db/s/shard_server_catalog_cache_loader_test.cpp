@@ -287,6 +287,30 @@ TEST_F(ShardServerCatalogCacheLoaderTest, PrimaryLoadFromShardedAndFindNoDiffReq
     }
 }
 
+// A complete routing table request that the persisted metadata can satisfy must not reach the
+// remote loader at all.
+TEST_F(ShardServerCatalogCacheLoaderTest, PrimaryLoadRequestAllServedFromPersistedMetadata) {
+    // First set up the shard chunk loader as sharded.
+
+    vector<ChunkType> chunks = setUpChunkLoaderWithFiveChunks();
+
+    // Then make any remote refresh fail. Requesting the complete routing table must be served from
+    // the locally persisted metadata without contacting the config server.
+
+    Status errorStatus = Status(ErrorCodes::HostUnreachable, "config server unreachable");
+    _remoteLoaderMock->setCollectionRefreshReturnValue(errorStatus);
+    _remoteLoaderMock->setChunkRefreshReturnValue(errorStatus);
+
+    auto collAndChunksRes = _shardLoader->getChunksSince(kNss, ChunkVersion::UNSHARDED()).get();
+    ASSERT_EQUALS(collAndChunksRes.epoch, chunks.back().getVersion().epoch());
+    ASSERT_EQUALS(collAndChunksRes.changedChunks.size(), 5UL);
+    for (unsigned int i = 0; i < collAndChunksRes.changedChunks.size(); ++i) {
+        ASSERT_BSONOBJ_EQ(collAndChunksRes.changedChunks[i].getMin(), chunks[i].getMin());
+        ASSERT_BSONOBJ_EQ(collAndChunksRes.changedChunks[i].getMax(), chunks[i].getMax());
+        ASSERT_EQUALS(collAndChunksRes.changedChunks[i].getVersion(), chunks[i].getVersion());
+    }
+}
+
 TEST_F(ShardServerCatalogCacheLoaderTest, PrimaryLoadFromShardedAndFindDiff) {
     // First set up the shard chunk loader as sharded.
 
@@ -44,6 +44,7 @@
 #include "mongo/db/s/range_deletion_task_gen.h"
 #include "mongo/db/s/shard_identity_rollback_notifier.h"
 #include "mongo/db/s/sharding_initialization_mongod.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/s/sharding_state.h"
 #include "mongo/db/s/type_shard_collection.h"
 #include "mongo/db/s/type_shard_database.h"
@@ -192,6 +193,9 @@ void incrementChunkOnInsertOrUpdate(OperationContext* opCtx,
     auto chunk = chunkManager.findIntersectingChunkWithSimpleCollation(shardKey);
     auto chunkWritesTracker = chunk.getWritesTracker();
     chunkWritesTracker->addBytesWritten(dataWritten);
+    if (autoSplitUseSampledShardKeys.load()) {
+        chunkWritesTracker->sampleKeyWritten(shardKey);
+    }
     // Don't trigger chunk splits from inserts happening due to migration since
     // we don't necessarily own that chunk yet
     if (!fromMigrate) {
@@ -69,6 +69,10 @@ struct ShardingStatistics {
     // node by the rangeDeleter.
     AtomicWord<long long> countDocsDeletedOnDonor{0};
 
+    // Cumulative, always-increasing counter of how many batches of documents the rangeDeleter has
+    // deleted on the donor node.
+    AtomicWord<long long> countBatchesDeletedOnDonor{0};
+
     // Cumulative, always-increasing counter of how many chunks this node started to receive
     // (whether the receiving succeeded or not)
     AtomicWord<long long> countRecipientMoveChunkStarted{0};
@@ -40,11 +40,14 @@
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/repl/repl_client_info.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/s/transaction_coordinator_futures_util.h"
 #include "mongo/db/s/transaction_coordinator_worker_curop_repository.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/storage/flow_control.h"
 #include "mongo/db/write_concern.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/util/fail_point.h"
 
@@ -99,6 +102,149 @@ bool shouldRetryPersistingCoordinatorState(const StatusWith<T>& responseStatus)
         responseStatus != ErrorCodes::TransactionCoordinatorSteppingDown;
 }
 
+write_ops::UpdateOpEntry makeParticipantListUpdateEntry(
+    const OperationSessionInfo& sessionInfo, const std::vector<ShardId>& participantList) {
+    write_ops::UpdateOpEntry entry;
+
+    // Ensure that the document for the (lsid, txnNumber) either has no participant list or has the
+    // same participant list. The document may have the same participant list if an earlier attempt
+    // to write the participant list failed waiting for writeConcern.
+    BSONObj noParticipantList =
+        BSON(TransactionCoordinatorDocument::kParticipantsFieldName << BSON("$exists" << false));
+    BSONObj sameParticipantList =
+        BSON("$and" << buildParticipantListMatchesConditions(participantList));
+    entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
+                    << sessionInfo.toBSON() << "$or"
+                    << BSON_ARRAY(noParticipantList << sameParticipantList)));
+
+    // Update with participant list.
+    TransactionCoordinatorDocument doc;
+    doc.setId(sessionInfo);
+    doc.setParticipants(participantList);
+    entry.setU(write_ops::UpdateModification::parseFromClassicUpdate(doc.toBSON()));
+
+    entry.setUpsert(true);
+    return entry;
+}
+
+write_ops::UpdateOpEntry makeDecisionUpdateEntry(const OperationSessionInfo& sessionInfo,
+                                                 const std::vector<ShardId>& participantList,
+                                                 const CoordinatorCommitDecision& decision) {
+    write_ops::UpdateOpEntry entry;
+
+    // Ensure that the document for the (lsid, txnNumber) has the same participant list and either
+    // has no decision or the same decision. The document may have the same decision if an earlier
+    // attempt to write the decision failed waiting for writeConcern.
+    BSONObj noDecision =
+        BSON(TransactionCoordinatorDocument::kDecisionFieldName << BSON("$exists" << false));
+    BSONObj sameDecision =
+        BSON(TransactionCoordinatorDocument::kDecisionFieldName << decision.toBSON());
+
+    entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
+                    << sessionInfo.toBSON() << "$and"
+                    << buildParticipantListMatchesConditions(participantList) << "$or"
+                    << BSON_ARRAY(noDecision << sameDecision)));
+
+    entry.setUpsert(true);
+    entry.setU(write_ops::UpdateModification::parseFromClassicUpdate([&] {
+        TransactionCoordinatorDocument doc;
+        doc.setId(sessionInfo);
+        doc.setParticipants(participantList);
+        doc.setDecision(decision);
+        return doc.toBSON();
+    }()));
+
+    return entry;
+}
+
+/**
+ * Coalesces the coordinator state writes of concurrent two-phase commits into a single update
+ * command against config.transaction_coordinators, so that the transactions share one journal
+ * flush and one majority replication wait instead of performing them per transaction.
+ */
+class CoordinatorWriteBatcher {
+public:
+    /**
+     * Enqueues 'entry' and returns the opTime of the batched write which contained it. Returns
+     * boost::none if the outcome of this entry could not be determined from the batched response,
+     * in which case the caller must perform its single-document write instead.
+     */
+    boost::optional<repl::OpTime> write(OperationContext* opCtx, write_ops::UpdateOpEntry entry) {
+        auto pf = makePromiseFuture<boost::optional<repl::OpTime>>();
+
+        stdx::unique_lock<Latch> ul(_mutex);
+        _pendingWrites.push_back({std::move(entry), std::move(pf.promise)});
+
+        // If another thread is already flushing, it will pick up the entry enqueued above;
+        // otherwise this thread becomes the flusher and also drains any entries enqueued while its
+        // own batch was being written.
+        if (!_flushInProgress) {
+            _flushInProgress = true;
+            while (!_pendingWrites.empty()) {
+                std::vector<PendingWrite> batch;
+                batch.swap(_pendingWrites);
+
+                ul.unlock();
+                _flushBatch(opCtx, &batch);
+                ul.lock();
+            }
+            _flushInProgress = false;
+        }
+        ul.unlock();
+
+        return std::move(pf.future).get(opCtx);
+    }
+
+private:
+    struct PendingWrite {
+        write_ops::UpdateOpEntry entry;
+        Promise<boost::optional<repl::OpTime>> promise;
+    };
+
+    void _flushBatch(OperationContext* opCtx, std::vector<PendingWrite>* batch) noexcept {
+        boost::optional<repl::OpTime> result;
+
+        try {
+            DBDirectClient client(opCtx);
+
+            // Throws if serializing the request or deserializing the response fails.
+            const auto commandResponse = client.runCommand([&] {
+                write_ops::Update updateOp(NamespaceString::kTransactionCoordinatorsNamespace);
+                std::vector<write_ops::UpdateOpEntry> entries;
+                entries.reserve(batch->size());
+                for (const auto& pendingWrite : *batch) {
+                    entries.push_back(pendingWrite.entry);
+                }
+                updateOp.setUpdates(std::move(entries));
+                return updateOp.serialize({});
+            }());
+
+            // The batched response does not attribute matched counts or write errors to individual
+            // statements, so the batched opTime is only handed out when every statement succeeded.
+            // Otherwise each caller re-runs its own single-document write, which reports precise
+            // errors.
+            const auto commandReply = commandResponse->getCommandReply();
+            if (getStatusFromWriteCommandReply(commandReply).isOK() &&
+                commandReply.getIntField("n") == static_cast<int>(batch->size())) {
+                result = repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+            }
+        } catch (const DBException&) {
+            // Fall through and let each caller surface the error from its own write.
+        }
+
+        for (auto& pendingWrite : *batch) {
+            pendingWrite.promise.emplaceValue(result);
+        }
+    }
+
+    Mutex _mutex = MONGO_MAKE_LATCH("CoordinatorWriteBatcher::_mutex");
+    bool _flushInProgress{false};
+    std::vector<PendingWrite> _pendingWrites;
+};
+
+const auto coordinatorWriteBatcherDecoration =
+    ServiceContext::declareDecoration<CoordinatorWriteBatcher>();
+
 }  // namespace
 
 namespace {
@@ -122,64 +268,57 @@ repl::OpTime persistParticipantListBlocking(OperationContext* opCtx,
     sessionInfo.setSessionId(lsid);
     sessionInfo.setTxnNumber(txnNumber);
 
-    DBDirectClient client(opCtx);
-
-    // Throws if serializing the request or deserializing the response fails.
-    const auto commandResponse = client.runCommand([&] {
-        write_ops::Update updateOp(NamespaceString::kTransactionCoordinatorsNamespace);
-        updateOp.setUpdates({[&] {
-            write_ops::UpdateOpEntry entry;
-
-            // Ensure that the document for the (lsid, txnNumber) either has no participant list or
-            // has the same participant list. The document may have the same participant list if an
-            // earlier attempt to write the participant list failed waiting for writeConcern.
-            BSONObj noParticipantList = BSON(TransactionCoordinatorDocument::kParticipantsFieldName
-                                             << BSON("$exists" << false));
-            BSONObj sameParticipantList =
-                BSON("$and" << buildParticipantListMatchesConditions(participantList));
-            entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
-                            << sessionInfo.toBSON() << "$or"
-                            << BSON_ARRAY(noParticipantList << sameParticipantList)));
-
-            // Update with participant list.
-            TransactionCoordinatorDocument doc;
-            doc.setId(std::move(sessionInfo));
-            doc.setParticipants(std::move(participantList));
-            entry.setU(write_ops::UpdateModification::parseFromClassicUpdate(doc.toBSON()));
-
-            entry.setUpsert(true);
-            return entry;
-        }()});
-        return updateOp.serialize({});
-    }());
+    boost::optional<repl::OpTime> batchedOpTime;
+    if (batchTransactionCoordinatorStateWrites.load()) {
+        batchedOpTime =
+            coordinatorWriteBatcherDecoration(opCtx->getServiceContext())
+                .write(opCtx, makeParticipantListUpdateEntry(sessionInfo, participantList));
+    }
 
-    const auto upsertStatus = getStatusFromWriteCommandReply(commandResponse->getCommandReply());
+    if (!batchedOpTime) {
+        // The write was not satisfied by a batch, either because batching is disabled or because
+        // the outcome of this entry could not be verified from the batched response. Run it as a
+        // single-document write, which reports precise errors.
+        DBDirectClient client(opCtx);
+
+        // Throws if serializing the request or deserializing the response fails.
+        const auto commandResponse = client.runCommand([&] {
+            write_ops::Update updateOp(NamespaceString::kTransactionCoordinatorsNamespace);
+            updateOp.setUpdates({makeParticipantListUpdateEntry(sessionInfo, participantList)});
+            return updateOp.serialize({});
+        }());
+
+        const auto upsertStatus =
+            getStatusFromWriteCommandReply(commandResponse->getCommandReply());
+
+        // Convert a DuplicateKey error to an anonymous error.
+        if (upsertStatus.code() == ErrorCodes::DuplicateKey) {
+            // Attempt to include the document for this (lsid, txnNumber) in the error message, if
+            // one exists. Note that this is best-effort: the document may have been deleted or
+            // manually changed since the update above ran.
+            const auto doc = client.findOne(
+                NamespaceString::kTransactionCoordinatorsNamespace.toString(),
+                QUERY(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
+            uasserted(51025,
+                      str::stream()
+                          << "While attempting to write participant list "
+                          << buildParticipantListString(participantList) << " for " << lsid.getId()
+                          << ':' << txnNumber
+                          << ", found document with a different participant list: " << doc);
+        }
 
-    // Convert a DuplicateKey error to an anonymous error.
-    if (upsertStatus.code() == ErrorCodes::DuplicateKey) {
-        // Attempt to include the document for this (lsid, txnNumber) in the error message, if one
-        // exists. Note that this is best-effort: the document may have been deleted or manually
-        // changed since the update above ran.
-        const auto doc = client.findOne(
-            NamespaceString::kTransactionCoordinatorsNamespace.toString(),
-            QUERY(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
-        uasserted(51025,
-                  str::stream() << "While attempting to write participant list "
-                                << buildParticipantListString(participantList) << " for "
-                                << lsid.getId() << ':' << txnNumber
-                                << ", found document with a different participant list: " << doc);
+        // Throw any other error.
+        uassertStatusOK(upsertStatus);
     }
 
-    // Throw any other error.
-    uassertStatusOK(upsertStatus);
-
     LOGV2_DEBUG(22465,
                 3,
                 "{sessionId}:{txnNumber} Wrote participant list",
                 "sessionId"_attr = lsid.getId(),
                 "txnNumber"_attr = txnNumber);
 
-    return repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    return batchedOpTime ? *batchedOpTime
+                         : repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
 }
 }  // namespace
 
@@ -316,61 +455,48 @@ repl::OpTime persistDecisionBlocking(OperationContext* opCtx,
     sessionInfo.setSessionId(lsid);
     sessionInfo.setTxnNumber(txnNumber);
 
-    DBDirectClient client(opCtx);
-
-    // Throws if serializing the request or deserializing the response fails.
-    const auto commandResponse = client.runCommand([&] {
-        write_ops::Update updateOp(NamespaceString::kTransactionCoordinatorsNamespace);
-        updateOp.setUpdates({[&] {
-            write_ops::UpdateOpEntry entry;
-
-            // Ensure that the document for the (lsid, txnNumber) has the same participant list and
-            // either has no decision or the same decision. The document may have the same decision
-            // if an earlier attempt to write the decision failed waiting for writeConcern.
-            BSONObj noDecision = BSON(TransactionCoordinatorDocument::kDecisionFieldName
-                                      << BSON("$exists" << false));
-            BSONObj sameDecision =
-                BSON(TransactionCoordinatorDocument::kDecisionFieldName << decision.toBSON());
-
-            entry.setQ(BSON(TransactionCoordinatorDocument::kIdFieldName
-                            << sessionInfo.toBSON() << "$and"
-                            << buildParticipantListMatchesConditions(participantList) << "$or"
-                            << BSON_ARRAY(noDecision << sameDecision)));
-
-            entry.setUpsert(true);
-            entry.setU(write_ops::UpdateModification::parseFromClassicUpdate([&] {
-                TransactionCoordinatorDocument doc;
-                doc.setId(sessionInfo);
-                doc.setParticipants(std::move(participantList));
-                doc.setDecision(decision);
-                return doc.toBSON();
-            }()));
-
-            return entry;
-        }()});
-        return updateOp.serialize({});
-    }());
-
-    const auto commandReply = commandResponse->getCommandReply();
-    uassertStatusOK(getStatusFromWriteCommandReply(commandReply));
+    boost::optional<repl::OpTime> batchedOpTime;
+    if (batchTransactionCoordinatorStateWrites.load()) {
+        batchedOpTime =
+            coordinatorWriteBatcherDecoration(opCtx->getServiceContext())
+                .write(opCtx, makeDecisionUpdateEntry(sessionInfo, participantList, decision));
+    }
 
-    // If no document matched, throw an anonymous error. (The update itself will not have thrown an
-    // error, because it's legal for an update to match no documents.)
-    if (commandReply.getIntField("n") != 1) {
-        // Attempt to include the document for this (lsid, txnNumber) in the error message, if one
-        // exists. Note that this is best-effort: the document may have been deleted or manually
-        // changed since the update above ran.
-        const auto doc = client.findOne(
-            NamespaceString::kTransactionCoordinatorsNamespace.ns(),
-            QUERY(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
-        uasserted(51026,
-                  str::stream() << "While attempting to write decision "
-                                << (isCommit ? "'commit'" : "'abort'") << " for" << lsid.getId()
-                                << ':' << txnNumber
-                                << ", either failed to find document for this lsid:txnNumber or "
-                                   "document existed with a different participant list, decision "
-                                   "or commitTimestamp: "
-                                << doc);
+    if (!batchedOpTime) {
+        // The write was not satisfied by a batch, either because batching is disabled or because
+        // the outcome of this entry could not be verified from the batched response. Run it as a
+        // single-document write, which reports precise errors.
+        DBDirectClient client(opCtx);
+
+        // Throws if serializing the request or deserializing the response fails.
+        const auto commandResponse = client.runCommand([&] {
+            write_ops::Update updateOp(NamespaceString::kTransactionCoordinatorsNamespace);
+            updateOp.setUpdates({makeDecisionUpdateEntry(sessionInfo, participantList, decision)});
+            return updateOp.serialize({});
+        }());
+
+        const auto commandReply = commandResponse->getCommandReply();
+        uassertStatusOK(getStatusFromWriteCommandReply(commandReply));
+
+        // If no document matched, throw an anonymous error. (The update itself will not have
+        // thrown an error, because it's legal for an update to match no documents.)
+        if (commandReply.getIntField("n") != 1) {
+            // Attempt to include the document for this (lsid, txnNumber) in the error message, if
+            // one exists. Note that this is best-effort: the document may have been deleted or
+            // manually changed since the update above ran.
+            const auto doc = client.findOne(
+                NamespaceString::kTransactionCoordinatorsNamespace.ns(),
+                QUERY(TransactionCoordinatorDocument::kIdFieldName << sessionInfo.toBSON()));
+            uasserted(51026,
+                      str::stream()
+                          << "While attempting to write decision "
+                          << (isCommit ? "'commit'" : "'abort'") << " for" << lsid.getId() << ':'
+                          << txnNumber
+                          << ", either failed to find document for this lsid:txnNumber or "
+                             "document existed with a different participant list, decision "
+                             "or commitTimestamp: "
+                          << doc);
+        }
     }
 
     LOGV2_DEBUG(22469,
@@ -381,7 +507,8 @@ repl::OpTime persistDecisionBlocking(OperationContext* opCtx,
                 "txnNumber"_attr = txnNumber,
                 "decision"_attr = (isCommit ? "commit" : "abort"));
 
-    return repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+    return batchedOpTime ? *batchedOpTime
+                         : repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
 }
 }  // namespace
 
@@ -97,6 +97,7 @@ struct ServerGlobalParams {
     logv2::LogTimestampFormat logTimestampFormat = logv2::LogTimestampFormat::kISO8601Local;
 
     bool logAppend = false;         // True if logging to a file in append mode.
+    bool logAsync = false;          // True if file log writes happen on a dedicated thread.
     bool logRenameOnRotate = true;  // True if logging should rename log files on rotate
     bool logWithSyslog = false;     // True if logging to syslog; must not be set if logpath is set.
     int syslogFacility;             // Facility used when appending messages to the syslog.
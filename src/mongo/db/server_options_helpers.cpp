@@ -381,6 +381,10 @@ Status storeBaseOptions(const moe::Environment& params) {
         serverGlobalParams.logAppend = true;
     }
 
+    if (params.count("systemLog.async") && params["systemLog.async"].as<bool>() == true) {
+        serverGlobalParams.logAsync = true;
+    }
+
     if (params.count("systemLog.logRotate")) {
         std::string logRotateParam = params["systemLog.logRotate"].as<string>();
         if (logRotateParam == "reopen") {
@@ -0,0 +1,322 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/collection_impl.h"
+#include "mongo/db/catalog/database_holder.h"
+#include "mongo/db/catalog/database_holder_impl.h"
+#include "mongo/db/client_strand.h"
+#include "mongo/db/index/index_access_method_factory_impl.h"
+#include "mongo/db/index_builds_coordinator_mongod.h"
+#include "mongo/db/op_observer_registry.h"
+#include "mongo/db/read_write_concern_defaults_cache_lookup_mock.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/s/collection_sharding_state_factory_standalone.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/service_entry_point_mongod.h"
+#include "mongo/db/storage/control/storage_control.h"
+#include "mongo/db/storage/storage_engine_init.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/rpc/op_msg.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/periodic_runner_factory.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+namespace {
+
+constexpr auto kDbName = "ingress_bench"_sd;
+constexpr auto kCollName = "coll"_sd;
+
+// Max number of client threads to drive the entry point with.
+const int kMaxPerfThreads = 8;
+
+// Number of documents seeded for the point read and update benchmarks.
+const int kSeededDocuments = 1024;
+
+/**
+ * An in-process standalone mongod, equivalent to the fixture the OpMsgFuzzer uses but with a
+ * real (ephemeral) storage engine so find/insert/update commands actually execute. Requests
+ * enter through ServiceEntryPoint::handleRequest as serialized OpMsg bytes, covering the whole
+ * ingress path between the network layer and the storage engine.
+ */
+class IngressBenchmarkFixture {
+public:
+    IngressBenchmarkFixture() : _tempDir("service_entry_point_bm") {
+        storageGlobalParams.engine = "ephemeralForTest";
+        storageGlobalParams.engineSetByUser = true;
+        storageGlobalParams.dbpath = _tempDir.path();
+        // The ephemeralForTest storage engine does not support majority read concern.
+        serverGlobalParams.enableMajorityReadConcern = false;
+
+        // benchmark_main has already run the global initializers and installed the global
+        // service context, so build on top of that one.
+        _serviceContext = getGlobalServiceContext();
+        _serviceContext->setServiceEntryPoint(
+            std::make_unique<ServiceEntryPointMongod>(_serviceContext));
+        _serviceContext->setPeriodicRunner(makePeriodicRunner(_serviceContext));
+        _serviceContext->setOpObserver(std::make_unique<OpObserverRegistry>());
+
+        {
+            auto strand = ClientStrand::make(_serviceContext->makeClient("ingress bench setup"));
+            auto guard = strand->bind();
+            auto opCtx = _serviceContext->makeOperationContext(guard.get());
+            initializeStorageEngine(opCtx.get(),
+                                    StorageEngineInitFlags::kAllowNoLockFile |
+                                        StorageEngineInitFlags::kSkipMetadataFile);
+        }
+        StorageControl::startStorageControls(_serviceContext, true /*forTestOnly*/);
+
+        DatabaseHolder::set(_serviceContext, std::make_unique<DatabaseHolderImpl>());
+        IndexAccessMethodFactory::set(_serviceContext,
+                                      std::make_unique<IndexAccessMethodFactoryImpl>());
+        Collection::Factory::set(_serviceContext, std::make_unique<CollectionImpl::FactoryImpl>());
+        IndexBuildsCoordinator::set(_serviceContext,
+                                    std::make_unique<IndexBuildsCoordinatorMongod>());
+        CollectionShardingStateFactory::set(
+            _serviceContext,
+            std::make_unique<CollectionShardingStateFactoryStandalone>(_serviceContext));
+        ReadWriteConcernDefaults::create(_serviceContext, _lookupMock.getFetchDefaultsFn());
+
+        // Run in standalone mode so the benchmarks don't need an oplog.
+        repl::ReplicationCoordinator::set(_serviceContext,
+                                          std::make_unique<repl::ReplicationCoordinatorMock>(
+                                              _serviceContext, repl::ReplSettings()));
+
+        _serviceContext->getStorageEngine()->notifyStartupComplete();
+    }
+
+    ServiceContext* serviceContext() const {
+        return _serviceContext;
+    }
+
+    /**
+     * Run one request through the full entry point, as if its bytes had just been read off a
+     * socket, and return the reply body. Creates a fresh OperationContext per request like the
+     * real ingress path does.
+     */
+    BSONObj dispatch(Client* client, const Message& message) {
+        auto opCtx = _serviceContext->makeOperationContext(client);
+        auto dbResponse =
+            _serviceContext->getServiceEntryPoint()->handleRequest(opCtx.get(), message).get();
+        return OpMsg::parse(dbResponse.response).body.getOwned();
+    }
+
+    /**
+     * Drop and re-create the benchmark collection with kSeededDocuments documents of roughly
+     * 'docBytes' bytes each, with integer _ids [0, kSeededDocuments).
+     */
+    void recreateSeededCollection(Client* client, int docBytes) {
+        dropCollection(client);
+
+        const auto padding = std::string(docBytes, 'x');
+        const int batchSize = 100;
+        for (int start = 0; start < kSeededDocuments; start += batchSize) {
+            BSONObjBuilder bob;
+            bob.append("insert", kCollName);
+            {
+                BSONArrayBuilder docs(bob.subarrayStart("documents"));
+                for (int id = start; id < std::min(start + batchSize, kSeededDocuments); ++id) {
+                    docs.append(BSON("_id" << id << "padding" << padding));
+                }
+            }
+            assertWriteOK(dispatch(client, makeMessage(bob.obj())));
+        }
+    }
+
+    void dropCollection(Client* client) {
+        auto reply = dispatch(client, makeMessage(BSON("drop" << kCollName)));
+        // Dropping a collection that has never been created reports NamespaceNotFound.
+        invariant(reply["ok"].trueValue() ||
+                      reply["code"].safeNumberLong() == ErrorCodes::NamespaceNotFound,
+                  reply.toString());
+    }
+
+    static Message makeMessage(const BSONObj& body) {
+        return OpMsgRequest::fromDBAndBody(kDbName, body).serialize();
+    }
+
+    static void assertOK(const BSONObj& reply) {
+        invariant(reply["ok"].trueValue(), reply.toString());
+    }
+
+    static void assertWriteOK(const BSONObj& reply) {
+        invariant(reply["ok"].trueValue() && !reply.hasField("writeErrors"), reply.toString());
+    }
+
+private:
+    unittest::TempDir _tempDir;
+    ServiceContext* _serviceContext;
+    ReadWriteConcernDefaultsLookupMock _lookupMock;
+};
+
+/**
+ * The fixture stands up a whole (ephemeral) storage engine and service context, so it is
+ * created once and deliberately leaked rather than torn down between benchmark runs.
+ */
+IngressBenchmarkFixture& fixture() {
+    static auto* instance = new IngressBenchmarkFixture();
+    return *instance;
+}
+
+ClientStrandPtr makeBenchmarkClientStrand(benchmark::State& state) {
+    return ClientStrand::make(fixture().serviceContext()->makeClient(
+        str::stream() << "ingress bench thread " << state.thread_index));
+}
+
+/**
+ * Inserts batches of documents without _ids, so a single pre-built message can be replayed and
+ * the server generates fresh ObjectIds on every pass.
+ *
+ * Arguments: (approximate document size in bytes, documents per insert batch).
+ */
+void BM_IngressInsert(benchmark::State& state) {
+    const auto docBytes = state.range(0);
+    const auto batchSize = state.range(1);
+
+    auto strand = makeBenchmarkClientStrand(state);
+    auto guard = strand->bind();
+
+    if (state.thread_index == 0) {
+        fixture().dropCollection(guard.get());
+    }
+
+    BSONObjBuilder bob;
+    bob.append("insert", kCollName);
+    {
+        BSONArrayBuilder docs(bob.subarrayStart("documents"));
+        for (int i = 0; i < batchSize; ++i) {
+            docs.append(BSON("padding" << std::string(docBytes, 'x')));
+        }
+    }
+    const auto request = IngressBenchmarkFixture::makeMessage(bob.obj());
+
+    for (auto keepRunning : state) {
+        IngressBenchmarkFixture::assertWriteOK(fixture().dispatch(guard.get(), request));
+    }
+
+    state.SetItemsProcessed(state.iterations() * batchSize);
+    state.SetBytesProcessed(state.iterations() * batchSize * docBytes);
+}
+
+/**
+ * Point reads by _id against a seeded collection, cycling through the seeded documents.
+ *
+ * Arguments: (approximate document size in bytes).
+ */
+void BM_IngressFindOne(benchmark::State& state) {
+    auto strand = makeBenchmarkClientStrand(state);
+    auto guard = strand->bind();
+
+    if (state.thread_index == 0) {
+        fixture().recreateSeededCollection(guard.get(), state.range(0));
+    }
+
+    std::vector<Message> requests;
+    requests.reserve(kSeededDocuments);
+    for (int id = 0; id < kSeededDocuments; ++id) {
+        requests.push_back(IngressBenchmarkFixture::makeMessage(
+            BSON("find" << kCollName << "filter" << BSON("_id" << id) << "limit" << 1
+                        << "singleBatch" << true)));
+    }
+
+    // Stagger the threads so they do not all hit the same document at the same time.
+    size_t next = state.thread_index;
+    for (auto keepRunning : state) {
+        IngressBenchmarkFixture::assertOK(
+            fixture().dispatch(guard.get(), requests[next++ % requests.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Single-document $inc updates by _id against a seeded collection.
+ *
+ * Arguments: (approximate document size in bytes).
+ */
+void BM_IngressUpdateOne(benchmark::State& state) {
+    auto strand = makeBenchmarkClientStrand(state);
+    auto guard = strand->bind();
+
+    if (state.thread_index == 0) {
+        fixture().recreateSeededCollection(guard.get(), state.range(0));
+    }
+
+    std::vector<Message> requests;
+    requests.reserve(kSeededDocuments);
+    for (int id = 0; id < kSeededDocuments; ++id) {
+        requests.push_back(IngressBenchmarkFixture::makeMessage(
+            BSON("update" << kCollName << "updates"
+                          << BSON_ARRAY(BSON("q" << BSON("_id" << id) << "u"
+                                                 << BSON("$inc" << BSON("counter" << 1)))))));
+    }
+
+    size_t next = state.thread_index;
+    for (auto keepRunning : state) {
+        IngressBenchmarkFixture::assertWriteOK(
+            fixture().dispatch(guard.get(), requests[next++ % requests.size()]));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_IngressInsert)
+    ->Args({128, 1})
+    ->Args({128, 10})
+    ->Args({128, 100})
+    ->Args({4 * 1024, 1})
+    ->Args({4 * 1024, 10})
+    ->Args({4 * 1024, 100})
+    ->Args({64 * 1024, 1})
+    ->Args({64 * 1024, 10})
+    ->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK(BM_IngressFindOne)
+    ->Arg(128)
+    ->Arg(4 * 1024)
+    ->Arg(64 * 1024)
+    ->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK(BM_IngressUpdateOne)
+    ->Arg(128)
+    ->Arg(4 * 1024)
+    ->ThreadRange(1, kMaxPerfThreads);
+
+}  // namespace
+}  // namespace mongo
@@ -81,6 +81,7 @@
 #include "mongo/db/session_catalog_mongod.h"
 #include "mongo/db/stats/api_version_metrics.h"
 #include "mongo/db/stats/counters.h"
+#include "mongo/db/stats/query_shape_stats.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
 #include "mongo/db/stats/server_read_concern_metrics.h"
 #include "mongo/db/stats/top.h"
@@ -101,6 +102,7 @@
 #include "mongo/transport/hello_metrics.h"
 #include "mongo/transport/service_executor.h"
 #include "mongo/transport/session.h"
+#include "mongo/util/concurrency/admission_context.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
@@ -1333,6 +1335,12 @@ Future<void> ExecCommandDatabase::_initiateCommand() try {
     rpc::readRequestMetadata(opCtx, request.body, command->requiresAuth());
     rpc::TrackingMetadata::get(opCtx).initWithOperName(command->getName());
 
+    if (isLowPriorityAdmissionCommand(command->getName())) {
+        // Deprioritized commands take a concurrency ticket only when no normal priority
+        // operation is waiting for one; see AdmissionContext.
+        AdmissionContext::get(opCtx).setPriority(AdmissionContext::Priority::kLow);
+    }
+
     auto const replCoord = repl::ReplicationCoordinator::get(opCtx);
 
     _sessionOptions = initializeOperationSessionInfo(opCtx,
@@ -2309,6 +2317,13 @@ Future<void> HandleRequest::completeOperation() try {
             durationCount<Microseconds>(currentOp.elapsedTimeExcludingPauses()),
             currentOp.getReadWriteType());
 
+    if (auto queryHash = currentOp.debug().queryHash) {
+        QueryShapeStats::get(opCtx->getServiceContext())
+            .record(*queryHash,
+                    durationCount<Microseconds>(currentOp.elapsedTimeExcludingPauses()),
+                    currentOp.getReadWriteType());
+    }
+
     if (shouldProfile) {
         // Performance profiling is on
         if (opCtx->lockState()->isReadLocked()) {
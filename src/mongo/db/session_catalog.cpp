@@ -49,17 +49,21 @@ const auto operationSessionDecoration =
 }  // namespace
 
 SessionCatalog::~SessionCatalog() {
-    stdx::lock_guard<Latch> lg(_mutex);
-    for (const auto& entry : _sessions) {
-        ObservableSession session(lg, entry.second->session);
-        invariant(!session.currentOperation());
-        invariant(!session._killed());
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard<Latch> lg(stripe.mutex);
+        for (const auto& entry : stripe.sessions) {
+            ObservableSession session(lg, entry.second->session);
+            invariant(!session.currentOperation());
+            invariant(!session._killed());
+        }
     }
 }
 
 void SessionCatalog::reset_forTest() {
-    stdx::lock_guard<Latch> lg(_mutex);
-    _sessions.clear();
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard<Latch> lg(stripe.mutex);
+        stripe.sessions.clear();
+    }
 }
 
 SessionCatalog* SessionCatalog::get(OperationContext* opCtx) {
@@ -79,8 +83,9 @@ SessionCatalog::ScopedCheckedOutSession SessionCatalog::_checkOutSession(Operati
     invariant(!opCtx->lockState()->inAWriteUnitOfWork());
     invariant(!opCtx->lockState()->isLocked());
 
-    stdx::unique_lock<Latch> ul(_mutex);
-    auto sri = _getOrCreateSessionRuntimeInfo(ul, opCtx, *opCtx->getLogicalSessionId());
+    auto& stripe = _stripeForLsid(*opCtx->getLogicalSessionId());
+    stdx::unique_lock<Latch> ul(stripe.mutex);
+    auto sri = _getOrCreateSessionRuntimeInfo(ul, stripe, *opCtx->getLogicalSessionId());
 
     // Wait until the session is no longer checked out and until the previously scheduled kill has
     // completed
@@ -106,8 +111,9 @@ SessionCatalog::SessionToKill SessionCatalog::checkOutSessionForKill(OperationCo
     invariant(!operationSessionDecoration(opCtx));
     invariant(!opCtx->getTxnNumber());
 
-    stdx::unique_lock<Latch> ul(_mutex);
-    auto sri = _getOrCreateSessionRuntimeInfo(ul, opCtx, killToken.lsidToKill);
+    auto& stripe = _stripeForLsid(killToken.lsidToKill);
+    stdx::unique_lock<Latch> ul(stripe.mutex);
+    auto sri = _getOrCreateSessionRuntimeInfo(ul, stripe, killToken.lsidToKill);
     invariant(ObservableSession(ul, sri->session)._killed());
 
     // Wait until the session is no longer checked out
@@ -130,9 +136,10 @@ void SessionCatalog::scanSession(const LogicalSessionId& lsid,
     std::unique_ptr<SessionRuntimeInfo> sessionToReap;
 
     {
-        stdx::lock_guard<Latch> lg(_mutex);
-        auto it = _sessions.find(lsid);
-        if (it != _sessions.end()) {
+        auto& stripe = _stripeForLsid(lsid);
+        stdx::lock_guard<Latch> lg(stripe.mutex);
+        auto it = stripe.sessions.find(lsid);
+        if (it != stripe.sessions.end()) {
             auto& sri = it->second;
             ObservableSession osession(lg, sri->session);
             workerFn(osession);
@@ -140,7 +147,7 @@ void SessionCatalog::scanSession(const LogicalSessionId& lsid,
             if (osession._markedForReap && !osession._killed() && !osession.currentOperation() &&
                 !sri->numWaitingToCheckOut) {
                 sessionToReap = std::move(sri);
-                _sessions.erase(it);
+                stripe.sessions.erase(it);
             }
         }
     }
@@ -150,16 +157,16 @@ void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
                                   const ScanSessionsCallbackFn& workerFn) {
     std::vector<std::unique_ptr<SessionRuntimeInfo>> sessionsToReap;
 
-    {
-        stdx::lock_guard<Latch> lg(_mutex);
+    LOGV2_DEBUG(21976,
+                2,
+                "Scanning {sessionCount} sessions",
+                "Scanning sessions",
+                "sessionCount"_attr = size());
 
-        LOGV2_DEBUG(21976,
-                    2,
-                    "Scanning {sessionCount} sessions",
-                    "Scanning sessions",
-                    "sessionCount"_attr = _sessions.size());
+    for (auto& stripe : _stripes) {
+        stdx::lock_guard<Latch> lg(stripe.mutex);
 
-        for (auto it = _sessions.begin(); it != _sessions.end(); ++it) {
+        for (auto it = stripe.sessions.begin(); it != stripe.sessions.end();) {
             if (matcher.match(it->first)) {
                 auto& sri = it->second;
                 ObservableSession osession(lg, sri->session);
@@ -169,32 +176,48 @@ void SessionCatalog::scanSessions(const SessionKiller::Matcher& matcher,
                 if (osession._markedForReap && !osession._killed() &&
                     !osession.currentOperation() && !sri->numWaitingToCheckOut) {
                     sessionsToReap.emplace_back(std::move(sri));
-                    _sessions.erase(it++);
+                    it = stripe.sessions.erase(it);
+                    continue;
                 }
             }
+            ++it;
         }
     }
 }
 
 SessionCatalog::KillToken SessionCatalog::killSession(const LogicalSessionId& lsid) {
-    stdx::lock_guard<Latch> lg(_mutex);
-    auto it = _sessions.find(lsid);
-    uassert(ErrorCodes::NoSuchSession, "Session not found", it != _sessions.end());
+    auto& stripe = _stripeForLsid(lsid);
+    stdx::lock_guard<Latch> lg(stripe.mutex);
+    auto it = stripe.sessions.find(lsid);
+    uassert(ErrorCodes::NoSuchSession, "Session not found", it != stripe.sessions.end());
 
     auto& sri = it->second;
     return ObservableSession(lg, sri->session).kill();
 }
 
 size_t SessionCatalog::size() const {
-    stdx::lock_guard<Latch> lg(_mutex);
-    return _sessions.size();
+    size_t size = 0;
+    for (const auto& stripe : _stripes) {
+        stdx::lock_guard<Latch> lg(stripe.mutex);
+        size += stripe.sessions.size();
+    }
+    return size;
+}
+
+SessionCatalog::SessionStripe& SessionCatalog::_stripeForLsid(const LogicalSessionId& lsid) {
+    return _stripes[LogicalSessionIdHash{}(lsid) % kNumStripes];
+}
+
+const SessionCatalog::SessionStripe& SessionCatalog::_stripeForLsid(
+    const LogicalSessionId& lsid) const {
+    return _stripes[LogicalSessionIdHash{}(lsid) % kNumStripes];
 }
 
 SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getOrCreateSessionRuntimeInfo(
-    WithLock, OperationContext* opCtx, const LogicalSessionId& lsid) {
-    auto it = _sessions.find(lsid);
-    if (it == _sessions.end()) {
-        it = _sessions.emplace(lsid, std::make_unique<SessionRuntimeInfo>(lsid)).first;
+    WithLock, SessionStripe& stripe, const LogicalSessionId& lsid) {
+    auto it = stripe.sessions.find(lsid);
+    if (it == stripe.sessions.end()) {
+        it = stripe.sessions.emplace(lsid, std::make_unique<SessionRuntimeInfo>(lsid)).first;
     }
 
     return it->second.get();
@@ -202,11 +225,12 @@ SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getOrCreateSessionRuntimeIn
 
 void SessionCatalog::_releaseSession(SessionRuntimeInfo* sri,
                                      boost::optional<KillToken> killToken) {
-    stdx::lock_guard<Latch> lg(_mutex);
+    auto& stripe = _stripeForLsid(sri->session.getSessionId());
+    stdx::lock_guard<Latch> lg(stripe.mutex);
 
     // Make sure we have exactly the same session on the map and that it is still associated with an
     // operation context (meaning checked-out)
-    invariant(_sessions[sri->session.getSessionId()].get() == sri);
+    invariant(stripe.sessions[sri->session.getSessionId()].get() == sri);
     invariant(sri->session._checkoutOpCtx);
     sri->session._checkoutOpCtx = nullptr;
     sri->availableCondVar.notify_all();
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <boost/optional.hpp>
 #include <vector>
 
@@ -129,23 +130,42 @@ private:
         // sessions entries from the map.
         int numWaitingToCheckOut{0};
 
-        // Signaled when the state becomes available. Uses the transaction table's mutex to protect
+        // Signaled when the state becomes available. Uses the owning stripe's mutex to protect
         // the state transitions.
         stdx::condition_variable availableCondVar;
     };
     using SessionRuntimeInfoMap = LogicalSessionIdMap<std::unique_ptr<SessionRuntimeInfo>>;
 
+    /**
+     * The catalog is split into stripes, selected by lsid hash, each with its own mutex and map of
+     * sessions, so that session checkout on one session does not contend with checkout, release or
+     * reaping of unrelated sessions.
+     */
+    struct SessionStripe {
+        mutable Mutex mutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0),
+                                               "SessionCatalog::SessionStripe::mutex");
+
+        // Owns the Session objects for all current Sessions mapping to this stripe.
+        SessionRuntimeInfoMap sessions;
+    };
+
     /**
      * Blocking method, which checks-out the session set on 'opCtx'.
      */
     ScopedCheckedOutSession _checkOutSession(OperationContext* opCtx);
 
     /**
-     * Creates or returns the session runtime info for 'lsid' from the '_sessions' map. The returned
-     * pointer is guaranteed to be linked on the map for as long as the mutex is held.
+     * Returns the stripe owning 'lsid'.
+     */
+    SessionStripe& _stripeForLsid(const LogicalSessionId& lsid);
+    const SessionStripe& _stripeForLsid(const LogicalSessionId& lsid) const;
+
+    /**
+     * Creates or returns the session runtime info for 'lsid' from the stripe's map. The returned
+     * pointer is guaranteed to be linked on the map for as long as the stripe's mutex is held.
      */
     SessionRuntimeInfo* _getOrCreateSessionRuntimeInfo(WithLock,
-                                                       OperationContext* opCtx,
+                                                       SessionStripe& stripe,
                                                        const LogicalSessionId& lsid);
 
     /**
@@ -153,12 +173,10 @@ private:
      */
     void _releaseSession(SessionRuntimeInfo* sri, boost::optional<KillToken> killToken);
 
-    // Protects the state below
-    mutable Mutex _mutex =
-        MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "SessionCatalog::_mutex");
+    // Power of two so the stripe selection modulo compiles down to a mask.
+    static constexpr std::size_t kNumStripes = 16;
 
-    // Owns the Session objects for all current Sessions.
-    SessionRuntimeInfoMap _sessions;
+    std::array<SessionStripe, kNumStripes> _stripes;
 };
 
 /**
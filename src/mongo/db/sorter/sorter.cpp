@@ -49,8 +49,10 @@
 #include "mongo/db/sorter/sorter.h"
 
 #include <boost/filesystem/operations.hpp>
+#include <cstring>
 #include <snappy.h>
 #include <vector>
+#include <zstd.h>
 
 #include "mongo/base/string_data.h"
 #include "mongo/config.h"
@@ -59,8 +61,11 @@
 #include "mongo/db/storage/encryption_hooks.h"
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/platform/overflow_arithmetic.h"
 #include "mongo/s/is_mongos.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/destructor_guard.h"
 #include "mongo/util/str.h"
@@ -70,6 +75,15 @@ namespace mongo {
 
 namespace {
 
+/**
+ * Compressed spill blocks are prefixed with a one byte codec marker so the compression codec can
+ * evolve independently of the block framing. Blocks written without a marker by older versions
+ * cannot be read back; that only matters for spill files that outlive the process, such as those
+ * used by resumable index builds.
+ */
+constexpr char kSnappyBlockMarker = 1;
+constexpr char kZstdBlockMarker = 2;
+
 /**
  * Calculates and returns a new murmur hash value based on the prior murmur hash and a new piece
  * of data.
@@ -223,6 +237,9 @@ public:
                               << "' in file \"" << _fileFullPath
                               << "\": " << myErrnoWithDescription(),
                 _file.good());
+        _fileReadOffset = _fileStartOffset;
+        _readAheadPos = 0;
+        _readAheadEnd = 0;
     }
 
     void closeSource() {
@@ -255,8 +272,6 @@ public:
         verify(!_done);
         fillBufferIfNeeded();
 
-        const char* startOfNewData = static_cast<const char*>(_bufferReader->pos());
-
         // Note: calling read() on the _bufferReader buffer in the deserialize function advances the
         // buffer. Since Key comes before Value in the _bufferReader, and C++ makes no function
         // parameter evaluation order guarantees, we cannot deserialize Key and Value straight into
@@ -264,13 +279,6 @@ public:
         auto first = Key::deserializeForSorter(*_bufferReader, _settings.first);
         auto second = Value::deserializeForSorter(*_bufferReader, _settings.second);
 
-        // The difference of _bufferReader's position before and after reading the data
-        // will provide the length of the data that was just read.
-        const char* endOfNewData = static_cast<const char*>(_bufferReader->pos());
-
-        _afterReadChecksum =
-            addDataToChecksum(startOfNewData, endOfNewData - startOfNewData, _afterReadChecksum);
-
         return Data(std::move(first), std::move(second));
     }
 
@@ -325,53 +333,124 @@ private:
         }
 
         if (!compressed) {
+            _afterReadChecksum = addDataToChecksum(_buffer.get(), blockSize, _afterReadChecksum);
             _bufferReader.reset(new BufReader(_buffer.get(), blockSize));
             return;
         }
 
-        dassert(snappy::IsValidCompressedBuffer(_buffer.get(), blockSize));
-
-        size_t uncompressedSize;
-        uassert(17061,
-                "couldn't get uncompressed length",
-                snappy::GetUncompressedLength(_buffer.get(), blockSize, &uncompressedSize));
-
-        std::unique_ptr<char[]> decompressionBuffer(new char[uncompressedSize]);
-        uassert(17062,
-                "decompression failed",
-                snappy::RawUncompress(_buffer.get(), blockSize, decompressionBuffer.get()));
+        uassert(5837112, "compressed block too short", blockSize > 1);
+        const char codec = _buffer[0];
+        const char* compressedData = _buffer.get() + 1;
+        const int32_t compressedLen = blockSize - 1;
+
+        std::unique_ptr<char[]> decompressionBuffer;
+        size_t uncompressedSize = 0;
+        switch (codec) {
+            case kZstdBlockMarker: {
+                const unsigned long long contentSize =
+                    ZSTD_getFrameContentSize(compressedData, compressedLen);
+                uassert(5837113,
+                        "couldn't get uncompressed length",
+                        contentSize != ZSTD_CONTENTSIZE_ERROR &&
+                            contentSize != ZSTD_CONTENTSIZE_UNKNOWN);
+                uncompressedSize = static_cast<size_t>(contentSize);
+                decompressionBuffer.reset(new char[uncompressedSize]);
+                const size_t ret = ZSTD_decompress(
+                    decompressionBuffer.get(), uncompressedSize, compressedData, compressedLen);
+                uassert(5837114,
+                        "decompression failed",
+                        !ZSTD_isError(ret) && ret == uncompressedSize);
+                break;
+            }
+            case kSnappyBlockMarker: {
+                dassert(snappy::IsValidCompressedBuffer(compressedData, compressedLen));
+                uassert(17061,
+                        "couldn't get uncompressed length",
+                        snappy::GetUncompressedLength(
+                            compressedData, compressedLen, &uncompressedSize));
+                decompressionBuffer.reset(new char[uncompressedSize]);
+                uassert(17062,
+                        "decompression failed",
+                        snappy::RawUncompress(compressedData, compressedLen,
+                                              decompressionBuffer.get()));
+                break;
+            }
+            default:
+                uasserted(5837115,
+                          str::stream()
+                              << "unknown codec in compressed block: " << static_cast<int>(codec));
+        }
 
         // hold on to decompressed data and throw out compressed data at block exit
         _buffer.swap(decompressionBuffer);
+        // Checksumming whole blocks as they are loaded, rather than each datum as it is handed
+        // out, keeps the checksum cost off the per-record path. The writer accumulates its
+        // checksum the same way.
+        _afterReadChecksum = addDataToChecksum(_buffer.get(), uncompressedSize, _afterReadChecksum);
         _bufferReader.reset(new BufReader(_buffer.get(), uncompressedSize));
     }
 
     /**
-     * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
+     * Attempts to read data from disk. Sets _done to true when the logical read position reaches
+     * _fileEndOffset.
+     *
+     * Reads are staged through a larger read-ahead buffer refilled with big sequential file reads,
+     * so that merges pulling many small blocks from many ranges do not pay a disk read per block.
      *
      * Masserts on any file errors
      */
     void read(void* out, size_t size) {
         invariant(_file.is_open());
 
-        const std::streampos offset = _file.tellg();
-        uassert(51049,
-                str::stream() << "error reading file \"" << _fileFullPath
-                              << "\": " << myErrnoWithDescription(),
-                offset >= 0);
+        char* dest = static_cast<char*>(out);
+        size_t remainingToRead = size;
+        while (remainingToRead > 0) {
+            if (_readAheadPos == _readAheadEnd && !refillReadAheadBuffer()) {
+                // Reached _fileEndOffset. This is only valid on a block boundary, before any
+                // bytes of the current request have been copied out.
+                uassert(5837116,
+                        str::stream() << "file \"" << _fileFullPath
+                                      << "\" ends in the middle of a block",
+                        remainingToRead == size);
+                _done = true;
+                return;
+            }
 
-        if (offset >= _fileEndOffset) {
-            invariant(offset == _fileEndOffset);
-            _done = true;
-            return;
+            const size_t toCopy = std::min(_readAheadEnd - _readAheadPos, remainingToRead);
+            memcpy(dest, _readAheadBuffer.get() + _readAheadPos, toCopy);
+            _readAheadPos += toCopy;
+            dest += toCopy;
+            remainingToRead -= toCopy;
         }
+    }
 
-        _file.read(reinterpret_cast<char*>(out), size);
+    /**
+     * Refills the read-ahead buffer with the next sequential chunk of this iterator's range.
+     * Returns false if the range is exhausted.
+     */
+    bool refillReadAheadBuffer() {
+        const std::streamoff remainingInRange = _fileEndOffset - _fileReadOffset;
+        if (remainingInRange == 0)
+            return false;
+        invariant(remainingInRange > 0);
+
+        if (!_readAheadBuffer)
+            _readAheadBuffer.reset(new char[kReadAheadBufferSize]);
+
+        const size_t toRead =
+            std::min<std::streamoff>(static_cast<std::streamoff>(kReadAheadBufferSize),
+                                     remainingInRange);
+        _file.read(_readAheadBuffer.get(), toRead);
         uassert(16817,
                 str::stream() << "error reading file \"" << _fileFullPath
                               << "\": " << myErrnoWithDescription(),
                 _file.good());
-        verify(_file.gcount() == static_cast<std::streamsize>(size));
+        verify(_file.gcount() == static_cast<std::streamsize>(toRead));
+
+        _fileReadOffset += toRead;
+        _readAheadPos = 0;
+        _readAheadEnd = toRead;
+        return true;
     }
 
     const Settings _settings;
@@ -385,6 +464,14 @@ private:
     std::ifstream _file;
     boost::optional<std::string> _dbName;
 
+    // Read-ahead state. Blocks in a range are consumed strictly sequentially during a merge, so
+    // reads are staged through this buffer, which is refilled with large sequential file reads.
+    static constexpr size_t kReadAheadBufferSize = 256 * 1024;
+    std::unique_ptr<char[]> _readAheadBuffer;
+    size_t _readAheadPos = 0;
+    size_t _readAheadEnd = 0;
+    std::streampos _fileReadOffset;  // Next file offset the read-ahead buffer will be filled from.
+
     // Checksum value that is updated with each read of a data object from disk. We can compare
     // this value with _originalChecksum to check for data corruption if and only if the
     // FileIterator is exhausted.
@@ -541,6 +628,123 @@ private:
     STLComparator _greater;                      // named so calls make sense
 };
 
+// Minimum number of runs each merge worker must receive before a parallel two-level merge is
+// worth the threading overhead.
+const size_t kMinRunsPerMergeWorker = 4;
+
+/**
+ * Pumps a source iterator on a dedicated producer thread and hands its output to the consumer in
+ * batches through a bounded queue. Used as the intermediate level of a parallel two-level merge:
+ * each instance wraps a MergeIterator over a contiguous subset of the spilled runs, so the
+ * per-run decompression, checksumming and heap work happens on the producer threads while the
+ * consumer only merges a handful of pre-merged streams.
+ */
+template <typename Key, typename Value>
+class BackgroundMergeStream : public SortIteratorInterface<Key, Value> {
+public:
+    typedef std::pair<Key, Value> Data;
+
+    explicit BackgroundMergeStream(std::shared_ptr<SortIteratorInterface<Key, Value>> source)
+        : _source(std::move(source)) {}
+
+    ~BackgroundMergeStream() {
+        _stopProducer();
+    }
+
+    void openSource() {
+        invariant(!_producer.joinable());
+        _producer = stdx::thread([this] { _produce(); });
+    }
+
+    void closeSource() {
+        _stopProducer();
+    }
+
+    bool more() {
+        if (_batchPos < _batch.size())
+            return true;
+        _refillBatch();
+        return _batchPos < _batch.size();
+    }
+
+    Data next() {
+        verify(more());
+        return std::move(_batch[_batchPos++]);
+    }
+
+private:
+    static const size_t kBatchSize = 256;
+    static const size_t kMaxQueuedBatches = 4;
+
+    void _produce() {
+        try {
+            while (_source->more()) {
+                std::vector<Data> batch;
+                batch.reserve(kBatchSize);
+                while (batch.size() < kBatchSize && _source->more()) {
+                    batch.push_back(_source->next());
+                }
+
+                stdx::unique_lock<Latch> lk(_mutex);
+                _producerCanProceed.wait(
+                    lk, [&] { return _queue.size() < kMaxQueuedBatches || _consumerDone; });
+                if (_consumerDone)
+                    break;
+                _queue.push_back(std::move(batch));
+                _consumerCanProceed.notify_one();
+            }
+        } catch (...) {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _producerError = exceptionToStatus();
+        }
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        _producerDone = true;
+        _consumerCanProceed.notify_one();
+    }
+
+    void _refillBatch() {
+        _batch.clear();
+        _batchPos = 0;
+
+        stdx::unique_lock<Latch> lk(_mutex);
+        _consumerCanProceed.wait(lk, [&] { return !_queue.empty() || _producerDone; });
+        if (_queue.empty()) {
+            // The producer has finished; surface its failure, if any, on the consumer thread.
+            uassertStatusOK(_producerError);
+            return;
+        }
+        _batch = std::move(_queue.front());
+        _queue.pop_front();
+        _producerCanProceed.notify_one();
+    }
+
+    void _stopProducer() {
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _consumerDone = true;
+            _producerCanProceed.notify_one();
+        }
+        if (_producer.joinable())
+            _producer.join();
+    }
+
+    std::shared_ptr<SortIteratorInterface<Key, Value>> _source;
+    stdx::thread _producer;
+
+    // Batch currently being drained by the consumer; only touched from the consumer thread.
+    std::vector<Data> _batch;
+    size_t _batchPos = 0;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("BackgroundMergeStream::_mutex");
+    stdx::condition_variable _producerCanProceed;
+    stdx::condition_variable _consumerCanProceed;
+    std::deque<std::vector<Data>> _queue;
+    bool _producerDone = false;
+    bool _consumerDone = false;
+    Status _producerError = Status::OK();
+};
+
 template <typename Key, typename Value, typename Comparator>
 class NoLimitSorter : public Sorter<Key, Value> {
 public:
@@ -1058,19 +1262,11 @@ SortedFileWriter<Key, Value>::SortedFileWriter(const SortOptions& opts,
 
 template <typename Key, typename Value>
 void SortedFileWriter<Key, Value>::addAlreadySorted(const Key& key, const Value& val) {
-
-    // Offset that points to the place in the buffer where a new data object will be stored.
-    int _nextObjPos = _buffer.len();
-
-    // Add serialized key and value to the buffer.
+    // Add serialized key and value to the buffer. The checksum is accumulated over whole blocks
+    // when they are spilled rather than per datum here, keeping it off the per-record path.
     key.serializeForSorter(_buffer);
     val.serializeForSorter(_buffer);
 
-    // Serializing the key and value grows the buffer, but _buffer.buf() still points to the
-    // beginning. Use _buffer.len() to determine portion of buffer containing new datum.
-    _checksum =
-        addDataToChecksum(_buffer.buf() + _nextObjPos, _buffer.len() - _nextObjPos, _checksum);
-
     if (_buffer.len() > 64 * 1024)
         spill();
 }
@@ -1083,14 +1279,21 @@ void SortedFileWriter<Key, Value>::spill() {
     if (size == 0)
         return;
 
-    std::string compressed;
-    snappy::Compress(outBuffer, size, &compressed);
-    verify(compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
+    _checksum = addDataToChecksum(outBuffer, size, _checksum);
+
+    // Compressed blocks start with a one byte codec marker, followed by the compressed data.
+    const size_t compressBound = ZSTD_compressBound(size);
+    std::unique_ptr<char[]> compressed(new char[compressBound + 1]);
+    compressed[0] = kZstdBlockMarker;
+    const size_t compressedSize =
+        ZSTD_compress(compressed.get() + 1, compressBound, outBuffer, size, ZSTD_CLEVEL_DEFAULT);
 
-    const bool shouldCompress = compressed.size() < size_t(_buffer.len() / 10 * 9);
+    const bool shouldCompress =
+        !ZSTD_isError(compressedSize) && compressedSize + 1 < size_t(_buffer.len() / 10 * 9);
     if (shouldCompress) {
-        size = compressed.size();
-        outBuffer = const_cast<char*>(compressed.data());
+        verify(compressedSize + 1 <= size_t(std::numeric_limits<int32_t>::max()));
+        size = compressedSize + 1;
+        outBuffer = compressed.get();
     }
 
     std::unique_ptr<char[]> out;
@@ -1153,6 +1356,28 @@ SortIteratorInterface<Key, Value>* SortIteratorInterface<Key, Value>::merge(
     const std::vector<std::shared_ptr<SortIteratorInterface>>& iters,
     const SortOptions& opts,
     const Comparator& comp) {
+    // A two-level parallel merge only pays off when there are enough runs to give every worker a
+    // meaningful subset; otherwise fall through to the plain single-threaded merge.
+    const size_t parallelism = std::min(opts.maxMergeParallelism,
+                                        iters.size() / sorter::kMinRunsPerMergeWorker);
+    if (parallelism > 1) {
+        const size_t runsPerWorker = (iters.size() + parallelism - 1) / parallelism;
+        std::vector<std::shared_ptr<SortIteratorInterface>> intermediate;
+        intermediate.reserve(parallelism);
+        for (size_t begin = 0; begin < iters.size(); begin += runsPerWorker) {
+            const size_t end = std::min(begin + runsPerWorker, iters.size());
+            std::vector<std::shared_ptr<SortIteratorInterface>> group(iters.begin() + begin,
+                                                                      iters.begin() + end);
+            intermediate.push_back(std::make_shared<sorter::BackgroundMergeStream<Key, Value>>(
+                std::shared_ptr<SortIteratorInterface>(
+                    new sorter::MergeIterator<Key, Value, Comparator>(group, opts, comp))));
+        }
+
+        // Workers get contiguous subsets of the runs and the final merge breaks ties by input
+        // position, so the two-level merge is stable in the same way the single-level merge is.
+        return new sorter::MergeIterator<Key, Value, Comparator>(intermediate, opts, comp);
+    }
+
     return new sorter::MergeIterator<Key, Value, Comparator>(iters, opts, comp);
 }
 
@@ -114,7 +114,17 @@ struct SortOptions {
     // extSortAllowed is true.
     std::string tempDir;
 
-    SortOptions() : limit(0), maxMemoryUsageBytes(64 * 1024 * 1024), extSortAllowed(false) {}
+    // Maximum number of threads that may be used to merge spilled runs when iterating the sorted
+    // output. With a value of 1 the merge stays single-threaded. Larger values allow a two-level
+    // merge in which worker threads each pre-merge a contiguous subset of the runs; this only
+    // engages when there are enough runs to keep each worker busy.
+    size_t maxMergeParallelism;
+
+    SortOptions()
+        : limit(0),
+          maxMemoryUsageBytes(64 * 1024 * 1024),
+          extSortAllowed(false),
+          maxMergeParallelism(1) {}
 
     // Fluent API to support expressions like SortOptions().Limit(1000).ExtSortAllowed(true)
 
@@ -142,6 +152,11 @@ struct SortOptions {
         dbName = std::move(newDbName);
         return *this;
     }
+
+    SortOptions& MaxMergeParallelism(size_t newMaxMergeParallelism) {
+        maxMergeParallelism = newMaxMergeParallelism;
+        return *this;
+    }
 };
 
 /**
@@ -582,7 +582,8 @@ void startupRecovery(OperationContext* opCtx,
 
         if (replSettings.usingReplSets()) {
             // We only care about _id indexes and drop-pending collections if we are in a replset.
-            db->checkForIdIndexesAndDropPendingCollections(opCtx);
+            db->checkForIdIndexesAndDropPendingCollections(opCtx,
+                                                           nullptr /* idIndexNamespaceFilter */);
             // Ensure oplog is capped (mongodb does not guarantee order of inserts on noncapped
             // collections)
             if (db->name() == NamespaceString::kLocalDb) {
@@ -67,84 +67,72 @@ void OpCounters::gotOp(int op, bool isCommand) {
     }
 }
 
-void OpCounters::_checkWrap(CacheAligned<AtomicWord<long long>> OpCounters::*counter, int n) {
-    static constexpr auto maxCount = 1LL << 60;
-    auto oldValue = (this->*counter).fetchAndAddRelaxed(n);
+void OpCounters::_checkWrap(StripedCounter64 OpCounters::*counter, int n) {
+    // The historical wrap threshold is 2^60 on the counter's total; since increments only see
+    // the slot they landed on, check each slot against its share of that budget so the total
+    // cannot overflow before any slot trips.
+    static const auto maxCount = (1LL << 60) / StripedCounter64::numSlots();
+    auto oldValue = (this->*counter).increment(n);
     if (oldValue > maxCount) {
-        _insert.store(0);
-        _query.store(0);
-        _update.store(0);
-        _delete.store(0);
-        _getmore.store(0);
-        _command.store(0);
+        _insert.reset();
+        _query.reset();
+        _update.reset();
+        _delete.reset();
+        _getmore.reset();
+        _command.reset();
     }
 }
 
 BSONObj OpCounters::getObj() const {
     BSONObjBuilder b;
-    b.append("insert", _insert.loadRelaxed());
-    b.append("query", _query.loadRelaxed());
-    b.append("update", _update.loadRelaxed());
-    b.append("delete", _delete.loadRelaxed());
-    b.append("getmore", _getmore.loadRelaxed());
-    b.append("command", _command.loadRelaxed());
+    b.append("insert", _insert.sum());
+    b.append("query", _query.sum());
+    b.append("update", _update.sum());
+    b.append("delete", _delete.sum());
+    b.append("getmore", _getmore.sum());
+    b.append("command", _command.sum());
     return b.obj();
 }
 
-void NetworkCounter::hitPhysicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
+namespace {
+// Per-slot share of the historical 2^60 wrap threshold; see OpCounters::_checkWrap.
+int64_t networkCounterMax() {
+    static const int64_t max = (1LL << 60) / StripedCounter64::numSlots();
+    return max;
+}
+}  // namespace
 
+void NetworkCounter::hitPhysicalIn(long long bytes) {
     // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesIn.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesIn.store(bytes);
-    } else {
-        _physicalBytesIn.fetchAndAdd(bytes);
+    if (_physicalBytesIn.increment(bytes) > networkCounterMax()) {
+        _physicalBytesIn.reset(bytes);
     }
 }
 
 void NetworkCounter::hitPhysicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesOut.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesOut.store(bytes);
-    } else {
-        _physicalBytesOut.fetchAndAdd(bytes);
+    if (_physicalBytesOut.increment(bytes) > networkCounterMax()) {
+        _physicalBytesOut.reset(bytes);
     }
 }
 
 void NetworkCounter::hitLogicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _together.logicalBytesIn.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _together.logicalBytesIn.store(bytes);
+    if (_logicalBytesIn.increment(bytes) > networkCounterMax()) {
+        _logicalBytesIn.reset(bytes);
         // The requests field only gets incremented here (and not in hitPhysical) because the
         // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
         // functions would double-count the number of operations.
-        _together.requests.store(1);
+        _requests.reset(1);
     } else {
-        _together.logicalBytesIn.fetchAndAdd(bytes);
-        _together.requests.fetchAndAdd(1);
+        _requests.increment(1);
     }
 }
 
 void NetworkCounter::hitLogicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
     // don't care about the race as its just a counter
-    const bool overflow = _logicalBytesOut.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _logicalBytesOut.store(bytes);
-    } else {
-        _logicalBytesOut.fetchAndAdd(bytes);
+    if (_logicalBytesOut.increment(bytes) > networkCounterMax()) {
+        _logicalBytesOut.reset(bytes);
     }
 }
 
@@ -152,6 +140,11 @@ void NetworkCounter::incrementNumSlowDNSOperations() {
     _numSlowDNSOperations.fetchAndAdd(1);
 }
 
+void NetworkCounter::recordDNSResolution(Microseconds duration) {
+    _numDNSResolutions.fetchAndAdd(1);
+    _totalDNSResolutionTimeMicros.fetchAndAdd(durationCount<Microseconds>(duration));
+}
+
 void NetworkCounter::incrementNumSlowSSLOperations() {
     _numSlowSSLOperations.fetchAndAdd(1);
 }
@@ -161,13 +154,16 @@ void NetworkCounter::acceptedTFOIngress() {
 }
 
 void NetworkCounter::append(BSONObjBuilder& b) {
-    b.append("bytesIn", static_cast<long long>(_together.logicalBytesIn.loadRelaxed()));
-    b.append("bytesOut", static_cast<long long>(_logicalBytesOut.loadRelaxed()));
-    b.append("physicalBytesIn", static_cast<long long>(_physicalBytesIn.loadRelaxed()));
-    b.append("physicalBytesOut", static_cast<long long>(_physicalBytesOut.loadRelaxed()));
+    b.append("bytesIn", _logicalBytesIn.sum());
+    b.append("bytesOut", _logicalBytesOut.sum());
+    b.append("physicalBytesIn", _physicalBytesIn.sum());
+    b.append("physicalBytesOut", _physicalBytesOut.sum());
     b.append("numSlowDNSOperations", static_cast<long long>(_numSlowDNSOperations.loadRelaxed()));
     b.append("numSlowSSLOperations", static_cast<long long>(_numSlowSSLOperations.loadRelaxed()));
-    b.append("numRequests", static_cast<long long>(_together.requests.loadRelaxed()));
+    b.append("numDNSResolutions", static_cast<long long>(_numDNSResolutions.loadRelaxed()));
+    b.append("totalDNSResolutionTimeMicros",
+             static_cast<long long>(_totalDNSResolutionTimeMicros.loadRelaxed()));
+    b.append("numRequests", _requests.sum());
 
     BSONObjBuilder tfo;
 #ifdef __linux__
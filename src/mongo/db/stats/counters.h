@@ -37,8 +37,10 @@
 #include "mongo/platform/basic.h"
 #include "mongo/rpc/message.h"
 #include "mongo/util/concurrency/spin_lock.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/processinfo.h"
 #include "mongo/util/string_map.h"
+#include "mongo/util/striped_counter.h"
 #include "mongo/util/with_alignment.h"
 
 namespace mongo {
@@ -95,57 +97,59 @@ public:
         _checkWrap(&OpCounters::_acceptableErrorInCommand, 1);
     }
 
-    // thse are used by snmp, and other things, do not remove
-    const AtomicWord<long long>* getInsert() const {
-        return &_insert;
+    // These are used by snmp, and other things, do not remove. They return totals summed over
+    // the counter stripes rather than pointers to the underlying storage.
+    long long getInsert() const {
+        return _insert.sum();
     }
-    const AtomicWord<long long>* getQuery() const {
-        return &_query;
+    long long getQuery() const {
+        return _query.sum();
     }
-    const AtomicWord<long long>* getUpdate() const {
-        return &_update;
+    long long getUpdate() const {
+        return _update.sum();
     }
-    const AtomicWord<long long>* getDelete() const {
-        return &_delete;
+    long long getDelete() const {
+        return _delete.sum();
     }
-    const AtomicWord<long long>* getGetMore() const {
-        return &_getmore;
+    long long getGetMore() const {
+        return _getmore.sum();
     }
-    const AtomicWord<long long>* getCommand() const {
-        return &_command;
+    long long getCommand() const {
+        return _command.sum();
     }
-    const AtomicWord<long long>* getInsertOnExistingDoc() const {
-        return &_insertOnExistingDoc;
+    long long getInsertOnExistingDoc() const {
+        return _insertOnExistingDoc.sum();
     }
-    const AtomicWord<long long>* getUpdateOnMissingDoc() const {
-        return &_updateOnMissingDoc;
+    long long getUpdateOnMissingDoc() const {
+        return _updateOnMissingDoc.sum();
     }
-    const AtomicWord<long long>* getDeleteWasEmpty() const {
-        return &_deleteWasEmpty;
+    long long getDeleteWasEmpty() const {
+        return _deleteWasEmpty.sum();
     }
-    const AtomicWord<long long>* getDeleteFromMissingNamespace() const {
-        return &_deleteFromMissingNamespace;
+    long long getDeleteFromMissingNamespace() const {
+        return _deleteFromMissingNamespace.sum();
     }
-    const AtomicWord<long long>* getAcceptableErrorInCommand() const {
-        return &_acceptableErrorInCommand;
+    long long getAcceptableErrorInCommand() const {
+        return _acceptableErrorInCommand.sum();
     }
 
 private:
-    // Increment member `counter` by `n`, resetting all counters if it was > 2^60.
-    void _checkWrap(CacheAligned<AtomicWord<long long>> OpCounters::*counter, int n);
-
-    CacheAligned<AtomicWord<long long>> _insert;
-    CacheAligned<AtomicWord<long long>> _query;
-    CacheAligned<AtomicWord<long long>> _update;
-    CacheAligned<AtomicWord<long long>> _delete;
-    CacheAligned<AtomicWord<long long>> _getmore;
-    CacheAligned<AtomicWord<long long>> _command;
-
-    CacheAligned<AtomicWord<long long>> _insertOnExistingDoc;
-    CacheAligned<AtomicWord<long long>> _updateOnMissingDoc;
-    CacheAligned<AtomicWord<long long>> _deleteWasEmpty;
-    CacheAligned<AtomicWord<long long>> _deleteFromMissingNamespace;
-    CacheAligned<AtomicWord<long long>> _acceptableErrorInCommand;
+    // Increment member `counter` by `n`, resetting the main opcounters if the incremented slot
+    // grew past its share of the legacy 2^60 wrap threshold.
+    void _checkWrap(StripedCounter64 OpCounters::*counter, int n);
+
+    StripedCounter64 _insert;
+    StripedCounter64 _query;
+    StripedCounter64 _update;
+    StripedCounter64 _delete;
+    StripedCounter64 _getmore;
+    StripedCounter64 _command;
+
+    StripedCounter64 _insertOnExistingDoc;
+    StripedCounter64 _updateOnMissingDoc;
+    StripedCounter64 _deleteWasEmpty;
+    StripedCounter64 _deleteFromMissingNamespace;
+    StripedCounter64 _acceptableErrorInCommand;
 };
 
 extern OpCounters globalOpCounters;
@@ -165,6 +169,9 @@ public:
     // Increment the counter for the number of slow dns resolution operations.
     void incrementNumSlowDNSOperations();
 
+    // Record one egress DNS resolution and how long it took.
+    void recordDNSResolution(Microseconds duration);
+
     // Increment the counter for the number of slow ssl handshake operations.
     void incrementNumSlowSSLOperations();
 
@@ -186,24 +193,22 @@ public:
     void append(BSONObjBuilder& b);
 
 private:
-    CacheAligned<AtomicWord<long long>> _physicalBytesIn{0};
-    CacheAligned<AtomicWord<long long>> _physicalBytesOut{0};
-
-    // These two counters are always incremented at the same time, so
-    // we place them on the same cache line.
-    struct Together {
-        AtomicWord<long long> logicalBytesIn{0};
-        AtomicWord<long long> requests{0};
-    };
-    CacheAligned<Together> _together{};
-    static_assert(sizeof(decltype(_together)) <= stdx::hardware_constructive_interference_size,
-                  "cache line spill");
+    StripedCounter64 _physicalBytesIn;
+    StripedCounter64 _physicalBytesOut;
 
-    CacheAligned<AtomicWord<long long>> _logicalBytesOut{0};
+    // These two counters are always incremented at the same time (see hitLogicalIn); a thread
+    // lands on the same stripe index in both.
+    StripedCounter64 _logicalBytesIn;
+    StripedCounter64 _requests;
+
+    StripedCounter64 _logicalBytesOut;
 
     CacheAligned<AtomicWord<long long>> _numSlowDNSOperations{0};
     CacheAligned<AtomicWord<long long>> _numSlowSSLOperations{0};
 
+    CacheAligned<AtomicWord<long long>> _numDNSResolutions{0};
+    CacheAligned<AtomicWord<long long>> _totalDNSResolutionTimeMicros{0};
+
     struct TFO {
         // Counter of inbound connections at runtime.
         AtomicWord<std::int64_t> accepted{0};
@@ -36,6 +36,7 @@
 #include "mongo/db/concurrency/lock_stats.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/util/concurrency/admission_context.h"
 
 namespace mongo {
 namespace {
@@ -127,5 +128,35 @@ public:
 
 } lockStatsServerStatusSection;
 
+
+class AdmissionServerStatusSection : public ServerStatusSection {
+public:
+    AdmissionServerStatusSection() : ServerStatusSection("admission") {}
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder ret;
+
+        auto appendPriority = [&](StringData name, AdmissionContext::Priority priority) {
+            auto& stats = admissionStatsForPriority(priority);
+            BSONObjBuilder priorityBuilder(ret.subobjStart(name));
+            priorityBuilder.append("admissions", stats.admissions.load());
+            priorityBuilder.append("totalTimeQueuedMicros", stats.queueMicros.load());
+            priorityBuilder.append("shed", stats.shed.load());
+            priorityBuilder.done();
+        };
+
+        appendPriority("normalPriority", AdmissionContext::Priority::kNormal);
+        appendPriority("lowPriority", AdmissionContext::Priority::kLow);
+
+        return ret.obj();
+    }
+
+} admissionServerStatusSection;
+
 }  // namespace
 }  // namespace mongo
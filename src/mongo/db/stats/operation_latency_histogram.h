@@ -59,6 +59,12 @@ public:
      */
     void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
 
+    /**
+     * Adds the counts of 'other' into this histogram. Used to merge sharded histograms for
+     * reporting.
+     */
+    void add(const OperationLatencyHistogram& other);
+
 private:
     struct HistogramData {
         std::array<uint64_t, kMaxBuckets> buckets{};
@@ -78,6 +84,8 @@ private:
 
     void _incrementData(uint64_t latency, int bucket, HistogramData* data);
 
+    static void _addData(const HistogramData& other, HistogramData* data);
+
     HistogramData _reads, _writes, _commands, _transactions;
 };
 }  // namespace mongo
@@ -64,6 +64,27 @@ TEST(OperationLatencyHistogram, EnsureIncrementsStored) {
     ASSERT_EQUALS(out["transactions"]["ops"].Long(), kMaxBuckets);
 }
 
+TEST(OperationLatencyHistogram, AddMergesCountsAndLatency) {
+    OperationLatencyHistogram target, other;
+    for (int i = 0; i < kMaxBuckets; i++) {
+        target.increment(kLowerBounds[i], Command::ReadWriteType::kRead);
+        other.increment(kLowerBounds[i], Command::ReadWriteType::kRead);
+        other.increment(kLowerBounds[i], Command::ReadWriteType::kWrite);
+    }
+    target.add(other);
+
+    BSONObjBuilder outBuilder;
+    target.append(false, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    uint64_t boundsSum = std::accumulate(kLowerBounds.begin(), kLowerBounds.end(), 0ULL);
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), 2 * kMaxBuckets);
+    ASSERT_EQUALS(static_cast<uint64_t>(out["reads"]["latency"].Long()), 2 * boundsSum);
+    ASSERT_EQUALS(out["writes"]["ops"].Long(), kMaxBuckets);
+    ASSERT_EQUALS(static_cast<uint64_t>(out["writes"]["latency"].Long()), boundsSum);
+    ASSERT_EQUALS(out["commands"]["ops"].Long(), 0);
+    ASSERT_EQUALS(out["transactions"]["ops"].Long(), 0);
+}
+
 TEST(OperationLatencyHistogram, CheckBucketCountsAndTotalLatency) {
     OperationLatencyHistogram hist;
     // Increment at the boundary, boundary+1, and boundary-1.
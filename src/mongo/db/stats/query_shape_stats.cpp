@@ -0,0 +1,119 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/query_shape_stats.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/util/hex.h"
+
+namespace mongo {
+namespace {
+const auto getQueryShapeStats = ServiceContext::declareDecoration<QueryShapeStats>();
+}  // namespace
+
+QueryShapeStats& QueryShapeStats::get(ServiceContext* svc) {
+    return getQueryShapeStats(svc);
+}
+
+void QueryShapeStats::record(uint32_t queryHash,
+                             uint64_t latencyMicros,
+                             Command::ReadWriteType readWriteType) {
+    auto& stripe = _stripes[queryHash % kNumStripes];
+    {
+        stdx::lock_guard<Latch> lk(stripe.mutex);
+        auto it = stripe.shapes.find(queryHash);
+        if (it != stripe.shapes.end()) {
+            it->second.increment(latencyMicros, readWriteType);
+            return;
+        }
+        if (_trackedShapes.load() < static_cast<long long>(kMaxTrackedShapes)) {
+            _trackedShapes.fetchAndAdd(1);
+            stripe.shapes[queryHash].increment(latencyMicros, readWriteType);
+            return;
+        }
+    }
+
+    stdx::lock_guard<Latch> lk(_overflowMutex);
+    _overflowShapes.increment(latencyMicros, readWriteType);
+    _overflowOps.fetchAndAdd(1);
+}
+
+void QueryShapeStats::append(bool includeHistograms,
+                             bool slowMSBucketsOnly,
+                             BSONObjBuilder* builder) const {
+    for (auto&& stripe : _stripes) {
+        stdx::lock_guard<Latch> lk(stripe.mutex);
+        for (auto&& [queryHash, histogram] : stripe.shapes) {
+            BSONObjBuilder shapeBuilder(builder->subobjStart(zeroPaddedHex(queryHash)));
+            histogram.append(includeHistograms, slowMSBucketsOnly, &shapeBuilder);
+        }
+    }
+
+    if (_overflowOps.load() > 0) {
+        stdx::lock_guard<Latch> lk(_overflowMutex);
+        BSONObjBuilder overflowBuilder(builder->subobjStart("overflow"));
+        _overflowShapes.append(includeHistograms, slowMSBucketsOnly, &overflowBuilder);
+    }
+}
+
+namespace {
+
+/**
+ * Appends the per-shape latency statistics to the server status. Excluded by default since the
+ * output carries one entry per tracked shape; request it with
+ * {serverStatus: 1, queryShapeStats: {histograms: <bool>, slowBuckets: <bool>}}.
+ */
+class QueryShapeStatsServerStatusSection final : public ServerStatusSection {
+public:
+    QueryShapeStatsServerStatusSection() : ServerStatusSection("queryShapeStats") {}
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        BSONObjBuilder shapeStatsBuilder;
+        bool includeHistograms = false;
+        bool slowBuckets = false;
+        if (configElem.type() == BSONType::Object) {
+            includeHistograms = configElem.Obj()["histograms"].trueValue();
+            slowBuckets = configElem.Obj()["slowBuckets"].trueValue();
+        }
+        QueryShapeStats::get(opCtx->getServiceContext())
+            .append(includeHistograms, slowBuckets, &shapeStatsBuilder);
+        return shapeStatsBuilder.obj();
+    }
+} queryShapeStatsServerStatusSection;
+
+}  // namespace
+}  // namespace mongo
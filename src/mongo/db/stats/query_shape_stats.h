@@ -0,0 +1,93 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "mongo/db/service_context.h"
+#include "mongo/db/stats/operation_latency_histogram.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+
+namespace mongo {
+
+/**
+ * A service context decoration that aggregates operation latencies by query shape.
+ *
+ * Shapes are identified by the hash of the canonical query encoding that the planner already
+ * computes ('queryHash' in OpDebug), so recording a sample costs one striped hash table lookup
+ * and a histogram bucket increment. The registry is bounded: once kMaxTrackedShapes distinct
+ * shapes have been seen, operations with further shapes are aggregated into a single overflow
+ * histogram rather than growing the table.
+ */
+class QueryShapeStats {
+public:
+    static constexpr std::size_t kMaxTrackedShapes = 10000;
+
+    static QueryShapeStats& get(ServiceContext* svc);
+
+    QueryShapeStats() = default;
+
+    /**
+     * Records one completed operation with the given query shape hash.
+     */
+    void record(uint32_t queryHash, uint64_t latencyMicros, Command::ReadWriteType readWriteType);
+
+    /**
+     * Appends one subobject per tracked shape, keyed by the zero-padded hex shape hash, in the
+     * same format as the opLatencies section. Shapes seen after the registry filled up are
+     * reported under a single "overflow" key.
+     */
+    void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
+
+private:
+    // Power of two so the stripe selection modulo compiles down to a mask.
+    static constexpr std::size_t kNumStripes = 16;
+
+    struct Stripe {
+        mutable Mutex mutex = MONGO_MAKE_LATCH("QueryShapeStats::Stripe::mutex");
+        stdx::unordered_map<uint32_t, OperationLatencyHistogram> shapes;
+    };
+
+    std::array<Stripe, kNumStripes> _stripes;
+
+    // Total number of entries across all stripes, checked against kMaxTrackedShapes before
+    // admitting a new shape.
+    AtomicWord<long long> _trackedShapes;
+
+    // Aggregate for operations whose shapes arrived after the registry filled up.
+    mutable Mutex _overflowMutex = MONGO_MAKE_LATCH("QueryShapeStats::_overflowMutex");
+    OperationLatencyHistogram _overflowShapes;
+    AtomicWord<long long> _overflowOps;
+};
+
+}  // namespace mongo
@@ -0,0 +1,88 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/query_shape_stats.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/hex.h"
+
+namespace mongo {
+namespace {
+
+TEST(QueryShapeStatsTest, RecordAggregatesByShapeHash) {
+    QueryShapeStats stats;
+
+    stats.record(1, 100, Command::ReadWriteType::kRead);
+    stats.record(1, 200, Command::ReadWriteType::kRead);
+    stats.record(2, 300, Command::ReadWriteType::kWrite);
+
+    BSONObjBuilder builder;
+    stats.append(false, false, &builder);
+    BSONObj obj = builder.obj();
+
+    BSONObj firstShape = obj[zeroPaddedHex(uint32_t(1))].Obj();
+    ASSERT_EQUALS(2, firstShape["reads"]["ops"].numberLong());
+    ASSERT_EQUALS(300, firstShape["reads"]["latency"].numberLong());
+    ASSERT_EQUALS(0, firstShape["writes"]["ops"].numberLong());
+
+    BSONObj secondShape = obj[zeroPaddedHex(uint32_t(2))].Obj();
+    ASSERT_EQUALS(1, secondShape["writes"]["ops"].numberLong());
+    ASSERT_EQUALS(300, secondShape["writes"]["latency"].numberLong());
+
+    // No overflow entry until the registry fills up.
+    ASSERT_FALSE(obj.hasField("overflow"));
+}
+
+TEST(QueryShapeStatsTest, OverflowAggregatesExcessShapes) {
+    QueryShapeStats stats;
+
+    for (uint32_t hash = 0; hash < QueryShapeStats::kMaxTrackedShapes; ++hash) {
+        stats.record(hash, 1, Command::ReadWriteType::kCommand);
+    }
+
+    // The registry is full, so a new shape must land in the overflow histogram while an
+    // already-tracked shape keeps aggregating into its own entry.
+    stats.record(QueryShapeStats::kMaxTrackedShapes, 10, Command::ReadWriteType::kCommand);
+    stats.record(0, 1, Command::ReadWriteType::kCommand);
+
+    BSONObjBuilder builder;
+    stats.append(false, false, &builder);
+    BSONObj obj = builder.obj();
+
+    ASSERT_EQUALS(10, obj["overflow"]["commands"]["latency"].numberLong());
+    ASSERT_EQUALS(1, obj["overflow"]["commands"]["ops"].numberLong());
+    ASSERT_EQUALS(2, obj[zeroPaddedHex(uint32_t(0))]["commands"]["ops"].numberLong());
+    ASSERT_FALSE(obj.hasField(zeroPaddedHex(uint32_t(QueryShapeStats::kMaxTrackedShapes))));
+}
+
+}  // namespace
+}  // namespace mongo
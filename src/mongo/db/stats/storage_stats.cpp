@@ -37,18 +37,37 @@
 #include "mongo/db/db_raii.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/stats/storage_stats_gen.h"
 #include "mongo/db/timeseries/bucket_catalog.h"
 #include "mongo/db/views/view_catalog.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/string_map.h"
 
 #include "mongo/db/stats/storage_stats.h"
 
 namespace mongo {
-
-Status appendCollectionStorageStats(OperationContext* opCtx,
-                                    const NamespaceString& nss,
-                                    const BSONObj& param,
-                                    BSONObjBuilder* result) {
+namespace {
+
+// One previously computed collection storage stats payload. An entry may only be served while
+// it is younger than 'storageStatsCacheMaxAgeSeconds' and was computed with the same scale and
+// verbosity as the request at hand.
+struct CachedStorageStats {
+    int scale;
+    bool verbose;
+    Date_t refreshedAt;
+    BSONObj stats;
+};
+
+// Protects 'storageStatsCache'. Statistics are recomputed outside the mutex; it is only held
+// to look up or store a finished payload.
+Mutex storageStatsCacheMutex = MONGO_MAKE_LATCH("storageStatsCacheMutex");
+StringMap<CachedStorageStats> storageStatsCache;
+
+Status collectCollectionStorageStats(OperationContext* opCtx,
+                                     const NamespaceString& nss,
+                                     const BSONObj& param,
+                                     BSONObjBuilder* result) {
     int scale = 1;
     if (param["scale"].isNumber()) {
         scale = param["scale"].numberInt();
@@ -169,6 +188,50 @@ Status appendCollectionStorageStats(OperationContext* opCtx,
     return Status::OK();
 }
 
+}  // namespace
+
+Status appendCollectionStorageStats(OperationContext* opCtx,
+                                    const NamespaceString& nss,
+                                    const BSONObj& param,
+                                    BSONObjBuilder* result) {
+    const auto maxAge = Seconds(storageStatsCacheMaxAgeSeconds.load());
+    if (maxAge == Seconds::zero()) {
+        return collectCollectionStorageStats(opCtx, nss, param, result);
+    }
+
+    const int scale = param["scale"].isNumber() ? param["scale"].numberInt() : 1;
+    const bool verbose = param["verbose"].trueValue();
+    const auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+
+    {
+        stdx::lock_guard<Latch> lk(storageStatsCacheMutex);
+        auto it = storageStatsCache.find(nss.ns());
+        if (it != storageStatsCache.end()) {
+            const auto& entry = it->second;
+            if (entry.scale == scale && entry.verbose == verbose &&
+                now - entry.refreshedAt <= maxAge) {
+                result->appendElements(entry.stats);
+                return Status::OK();
+            }
+            storageStatsCache.erase(it);
+        }
+    }
+
+    BSONObjBuilder statsBuilder;
+    Status status = collectCollectionStorageStats(opCtx, nss, param, &statsBuilder);
+    BSONObj stats = statsBuilder.obj();
+    result->appendElements(stats);
+
+    // Failed lookups are not cached: an error payload either describes a missing namespace,
+    // which may be recreated at any time, or carries no statistics at all. Statistics gathering
+    // interrupted by lock timeouts likewise produces an (empty) payload not worth serving again.
+    if (status.isOK() && !stats.isEmpty()) {
+        stdx::lock_guard<Latch> lk(storageStatsCacheMutex);
+        storageStatsCache[nss.ns()] = {scale, verbose, now, std::move(stats)};
+    }
+    return status;
+}
+
 Status appendCollectionRecordCount(OperationContext* opCtx,
                                    const NamespaceString& nss,
                                    BSONObjBuilder* result) {
@@ -71,6 +71,12 @@ Top& Top::get(ServiceContext* service) {
     return getTop(service);
 }
 
+Top::UsageShard& Top::_myShard() {
+    static AtomicWord<unsigned> nextShard;
+    static thread_local const std::size_t myShard = nextShard.fetchAndAdd(1) % kNumUsageShards;
+    return _shards[myShard];
+}
+
 void Top::record(OperationContext* opCtx,
                  StringData ns,
                  LogicalOp logicalOp,
@@ -82,9 +88,10 @@ void Top::record(OperationContext* opCtx,
         return;
 
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    auto& shard = _shardForNs(hashedNs.hash());
+    stdx::lock_guard<SimpleMutex> lk(shard.lock);
 
-    CollectionData& coll = _usage[hashedNs];
+    CollectionData& coll = shard.usage[hashedNs];
     _record(opCtx, coll, logicalOp, lockType, micros, readWriteType);
 }
 
@@ -134,18 +141,27 @@ void Top::_record(OperationContext* opCtx,
 }
 
 void Top::collectionDropped(const NamespaceString& nss) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _usage.erase(nss.ns());
+    auto hashedNs = UsageMap::hasher().hashed_key(nss.ns());
+    auto& shard = _shardForNs(hashedNs.hash());
+    stdx::lock_guard<SimpleMutex> lk(shard.lock);
+    shard.usage.erase(hashedNs);
 }
 
 void Top::cloneMap(Top::UsageMap& out) const {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    out = _usage;
+    out.clear();
+    // Each namespace lives in exactly one shard, so inserting every shard's entries yields the
+    // same map the single-mutex implementation kept. The map is not a point-in-time snapshot
+    // across shards, which is fine for usage statistics.
+    for (auto&& shard : _shards) {
+        stdx::lock_guard<SimpleMutex> lk(shard.lock);
+        out.insert(shard.usage.begin(), shard.usage.end());
+    }
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _appendToUsageMap(b, _usage);
+    UsageMap merged;
+    cloneMap(merged);
+    _appendToUsageMap(b, merged);
 }
 
 void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
@@ -190,9 +206,10 @@ void Top::appendLatencyStats(const NamespaceString& nss,
                              bool includeHistograms,
                              BSONObjBuilder* builder) {
     auto hashedNs = UsageMap::hasher().hashed_key(nss.ns());
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    auto& shard = _shardForNs(hashedNs.hash());
+    stdx::lock_guard<SimpleMutex> lk(shard.lock);
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
+    shard.usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
     builder->append("ns", nss.ns());
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -203,20 +220,26 @@ void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
     if (!opCtx->shouldIncrementLatencyStats())
         return;
 
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
+    auto& shard = _myShard();
+    stdx::lock_guard<SimpleMutex> guard(shard.lock);
+    _incrementHistogram(opCtx, latency, &shard.globalHistogramStats, readWriteType);
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms,
                                    bool slowMSBucketsOnly,
                                    BSONObjBuilder* builder) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder);
+    OperationLatencyHistogram merged;
+    for (auto&& shard : _shards) {
+        stdx::lock_guard<SimpleMutex> guard(shard.lock);
+        merged.add(shard.globalHistogramStats);
+    }
+    merged.append(includeHistograms, slowMSBucketsOnly, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(uint64_t latency) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
+    auto& shard = _myShard();
+    stdx::lock_guard<SimpleMutex> guard(shard.lock);
+    shard.globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
 }
 
 void Top::_incrementHistogram(OperationContext* opCtx,
@@ -33,6 +33,8 @@
  * DB usage monitor.
  */
 
+#include <array>
+
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 #include "mongo/db/commands.h"
@@ -137,6 +139,34 @@ public:
                                   BSONObjBuilder* builder);
 
 private:
+    /**
+     * A slice of the usage statistics with its own mutex. Each namespace maps to exactly one
+     * shard, so a completing operation only contends with operations whose namespaces share its
+     * shard; readers lock and merge every shard.
+     */
+    struct UsageShard {
+        mutable SimpleMutex lock;
+        UsageMap usage;
+
+        // This shard's slice of the global (non per-collection) latency histogram. Writers pick
+        // a shard by thread rather than by namespace; readers merge all slices.
+        OperationLatencyHistogram globalHistogramStats;
+    };
+
+    UsageShard& _shardForNs(std::size_t nsHash) {
+        return _shards[nsHash % kNumUsageShards];
+    }
+
+    const UsageShard& _shardForNs(std::size_t nsHash) const {
+        return _shards[nsHash % kNumUsageShards];
+    }
+
+    /**
+     * The shard this thread's global histogram updates land on. Threads are dealt onto shards
+     * round-robin so long-lived workers spread evenly.
+     */
+    UsageShard& _myShard();
+
     void _appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const;
 
     void _appendStatsEntry(BSONObjBuilder& b, const char* statsName, const UsageData& map) const;
@@ -153,9 +183,10 @@ private:
                              OperationLatencyHistogram* histogram,
                              Command::ReadWriteType readWriteType);
 
-    mutable SimpleMutex _lock;
-    OperationLatencyHistogram _globalHistogramStats;
-    UsageMap _usage;
+    // Power of two so the shard selection modulo compiles down to a mask.
+    static constexpr std::size_t kNumUsageShards = 16;
+
+    std::array<UsageShard, kNumUsageShards> _shards;
 };
 
 }  // namespace mongo
@@ -33,9 +33,13 @@
 
 #include "mongo/db/storage/checkpointer.h"
 
+#include <algorithm>
+
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/kv/kv_engine.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/fail_point.h"
@@ -73,17 +77,33 @@ void Checkpointer::run() {
 
     while (true) {
         auto opCtx = tc->makeOperationContext();
+        bool dirtyDataTriggered = false;
 
         {
             stdx::unique_lock<Latch> lock(_mutex);
             MONGO_IDLE_THREAD_BLOCK;
 
             // Wait for 'storageGlobalParams.checkpointDelaySecs' seconds; or until either shutdown
-            // is signaled or a checkpoint is triggered.
-            _sleepCV.wait_for(lock,
-                              stdx::chrono::seconds(static_cast<std::int64_t>(
-                                  storageGlobalParams.checkpointDelaySecs)),
-                              [&] { return _shuttingDown || _triggerCheckpoint; });
+            // is signaled or a checkpoint is triggered. The wait is taken in one second slices so
+            // the thread can watch the engine's dirty data and start a checkpoint early once it
+            // crosses 'checkpointDirtyDataMaxMB', instead of letting a full interval's worth of
+            // writes drain in one large checkpoint.
+            const Date_t deadline = Date_t::now() +
+                Seconds(static_cast<std::int64_t>(storageGlobalParams.checkpointDelaySecs));
+            while (Date_t::now() < deadline && !_shuttingDown && !_triggerCheckpoint &&
+                   !dirtyDataTriggered) {
+                const Date_t wakeup = std::min(deadline, Date_t::now() + Seconds(1));
+                _sleepCV.wait_until(lock, wakeup.toSystemTimePoint(), [&] {
+                    return _shuttingDown || _triggerCheckpoint;
+                });
+
+                const auto maxDirtyMB = gCheckpointDirtyDataMaxMB.load();
+                if (maxDirtyMB > 0 &&
+                    _kvEngine->getCacheDirtyBytes() >=
+                        static_cast<int64_t>(maxDirtyMB) * 1024 * 1024) {
+                    dirtyDataTriggered = true;
+                }
+            }
 
             // If the checkpointDelaySecs is set to 0, that means we should skip checkpointing.
             // However, checkpointDelaySecs is adjustable by a runtime server parameter, so we
@@ -116,7 +136,18 @@ void Checkpointer::run() {
         // TODO SERVER-50861: Access the storage engine via the ServiceContext.
         _kvEngine->checkpoint();
 
-        const auto secondsElapsed = durationCount<Seconds>(Date_t::now() - startTime);
+        const auto millisElapsed = durationCount<Milliseconds>(Date_t::now() - startTime);
+        _numCheckpoints.fetchAndAdd(1);
+        if (dirtyDataTriggered) {
+            _numDirtyDataTriggered.fetchAndAdd(1);
+        }
+        _lastDurationMillis.store(millisElapsed);
+        _totalDurationMillis.fetchAndAdd(millisElapsed);
+        if (millisElapsed > _maxDurationMillis.load()) {
+            _maxDurationMillis.store(millisElapsed);
+        }
+
+        const auto secondsElapsed = millisElapsed / 1000;
         if (secondsElapsed >= 30) {
             LOGV2_DEBUG(22308,
                         1,
@@ -148,6 +179,16 @@ bool Checkpointer::hasTriggeredFirstStableCheckpoint() {
     return _hasTriggeredFirstStableCheckpoint;
 }
 
+void Checkpointer::appendStats(BSONObjBuilder& bob) const {
+    BSONObjBuilder subobj(bob.subobjStart("checkpoint"));
+    subobj.append("numCheckpoints", _numCheckpoints.load());
+    subobj.append("numTriggeredByDirtyData", _numDirtyDataTriggered.load());
+    subobj.append("lastDurationMillis", _lastDurationMillis.load());
+    subobj.append("maxDurationMillis", _maxDurationMillis.load());
+    subobj.append("totalDurationMillis", _totalDurationMillis.load());
+    subobj.done();
+}
+
 void Checkpointer::shutdown(const Status& reason) {
     LOGV2(22322, "Shutting down checkpoint thread");
 
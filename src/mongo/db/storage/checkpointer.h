@@ -29,12 +29,14 @@
 
 #pragma once
 
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/background.h"
 
 namespace mongo {
 
+class BSONObjBuilder;
 class KVEngine;
 class OperationContext;
 class ServiceContext;
@@ -87,6 +89,12 @@ public:
      */
     void shutdown(const Status& reason);
 
+    /**
+     * Appends a 'checkpoint' subobject with counts and durations of the checkpoints taken by this
+     * thread, including how many were started early because of accumulated dirty data.
+     */
+    void appendStats(BSONObjBuilder& bob) const;
+
 private:
     // A pointer to the KVEngine is maintained only due to unit testing limitations that don't fully
     // setup the ServiceContext.
@@ -109,6 +117,14 @@ private:
 
     // This flag allows the checkpoint thread to wake up early when _sleepCV is signaled.
     bool _triggerCheckpoint;
+
+    // Checkpoint activity metrics, reported by appendStats(). Written only by the checkpoint
+    // thread; read by serverStatus.
+    AtomicWord<long long> _numCheckpoints{0};
+    AtomicWord<long long> _numDirtyDataTriggered{0};
+    AtomicWord<long long> _lastDurationMillis{0};
+    AtomicWord<long long> _maxDurationMillis{0};
+    AtomicWord<long long> _totalDurationMillis{0};
 };
 
 }  // namespace mongo
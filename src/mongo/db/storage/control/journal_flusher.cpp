@@ -33,6 +33,9 @@
 
 #include "mongo/db/storage/control/journal_flusher.h"
 
+#include <algorithm>
+
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/client.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/recovery_unit.h"
@@ -100,8 +103,18 @@ void JournalFlusher::run() {
                 _uniqueCtx->get()->setShouldParticipateInFlowControl(false);
             });
 
+            const auto beforeFlush = Date_t::now();
             _uniqueCtx->get()->recoveryUnit()->waitUntilDurable(_uniqueCtx->get());
 
+            const auto millisElapsed = (Date_t::now() - beforeFlush).count();
+            _numRounds.fetchAndAdd(1);
+            if (_nextRoundTriggered) {
+                _numTriggeredRounds.fetchAndAdd(1);
+            }
+            _lastDurationMillis.store(millisElapsed);
+            _maxDurationMillis.store(std::max(_maxDurationMillis.load(), millisElapsed));
+            _totalDurationMillis.fetchAndAdd(millisElapsed);
+
             // Signal the waiters that a round completed.
             _currentSharedPromise->emplaceValue();
         } catch (const AssertionException& e) {
@@ -145,6 +158,7 @@ void JournalFlusher::run() {
             _stateChangeCV.notify_all();
         }
 
+        _nextRoundTriggered = _flushJournalNow;
         _flushJournalNow = false;
 
         if (_shuttingDown) {
@@ -229,6 +243,16 @@ void JournalFlusher::interruptJournalFlusherForReplStateChange() {
     }
 }
 
+void JournalFlusher::appendStats(BSONObjBuilder& bob) const {
+    BSONObjBuilder subobj(bob.subobjStart("journalFlusher"));
+    subobj.append("numRounds", _numRounds.load());
+    subobj.append("numTriggeredRounds", _numTriggeredRounds.load());
+    subobj.append("lastDurationMillis", _lastDurationMillis.load());
+    subobj.append("maxDurationMillis", _maxDurationMillis.load());
+    subobj.append("totalDurationMillis", _totalDurationMillis.load());
+    subobj.done();
+}
+
 void JournalFlusher::_waitForJournalFlushNoRetry() {
     auto myFuture = [&]() {
         stdx::unique_lock<Latch> lk(_stateMutex);
@@ -30,12 +30,14 @@
 #pragma once
 
 #include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/util/background.h"
 #include "mongo/util/future.h"
 
 namespace mongo {
 
+class BSONObjBuilder;
 class OperationContext;
 
 /**
@@ -121,6 +123,13 @@ public:
      */
     void interruptJournalFlusherForReplStateChange();
 
+    /**
+     * Appends flush round statistics as a 'journalFlusher' subobject of 'bob'. The observed
+     * durations reflect what the underlying device actually takes per fsync, which is useful when
+     * judging whether 'storageGlobalParams.journalCommitIntervalMs' suits the hardware.
+     */
+    void appendStats(BSONObjBuilder& bob) const;
+
 private:
     // Journal flusher internal states.
     enum class States {
@@ -174,6 +183,17 @@ private:
     // data flushes will only be executed upon explicit request, no longer periodically in addition
     // to upon request.
     bool _disablePeriodicFlushes;
+
+    // Remembers whether the upcoming flush round was explicitly requested rather than started by
+    // the periodic timer. Only accessed by the flusher thread.
+    bool _nextRoundTriggered = false;
+
+    // Statistics for serverStatus. Only written by the flusher thread; read by any thread.
+    AtomicWord<long long> _numRounds;
+    AtomicWord<long long> _numTriggeredRounds;
+    AtomicWord<long long> _lastDurationMillis;
+    AtomicWord<long long> _maxDurationMillis;
+    AtomicWord<long long> _totalDurationMillis;
 };
 
 }  // namespace mongo
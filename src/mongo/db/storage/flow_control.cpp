@@ -148,7 +148,7 @@ FlowControl::FlowControl(ServiceContext* service, repl::ReplicationCoordinator*
          [this](Client* client) {
              FlowControlTicketholder::get(client->getServiceContext())->refreshTo(getNumTickets());
          },
-         Seconds(1)});
+         Milliseconds(gFlowControlRefreshPeriodMs)});
     _jobAnchor.start();
 }
 
@@ -221,6 +221,9 @@ BSONObj FlowControl::generateSection(OperationContext* opCtx,
     bob.append("isLagged", _isLagged.load());
     bob.append("isLaggedCount", _isLaggedCount.load());
     bob.append("isLaggedTimeMicros", _isLaggedTimeMicros.load());
+    // Periods where the topology readings were not usable and the previous target was kept.
+    bob.append("inconclusiveDecisions", _inconclusiveDecisions.load());
+    bob.append("queueSize", FlowControlTicketholder::get(opCtx)->queueSize());
 
     return bob.obj();
 }
@@ -360,6 +363,10 @@ int FlowControl::getNumTickets(Date_t now) {
     int ret = 0;
     const auto thresholdLagMillis = getThresholdLagMillis();
 
+    // Several tuning parameters are denominated in tickets per second. When refreshing more often
+    // than once per second, scale them down so the aggregate rate is unchanged.
+    const double periodFactor = gFlowControlRefreshPeriodMs / 1000.0;
+
     // Successive lastCommitted and lastApplied wall clock time recordings are not guaranteed to be
     // monotonically increasing. Recordings that satisfy the following check result in a negative
     // value for lag, so ignore them.
@@ -379,7 +386,7 @@ int FlowControl::getNumTickets(Date_t now) {
         // The add/multiply technique is used to ensure ticket allocation can ramp up quickly,
         // particularly if there were very few tickets to begin with.
         ret = multiplyWithOverflowCheck(_lastTargetTicketsPermitted.load() +
-                                            gFlowControlTicketAdderConstant.load(),
+                                            gFlowControlTicketAdderConstant.load() * periodFactor,
                                         gFlowControlTicketMultiplierConstant.load(),
                                         kMaxTickets);
         _lastTimeSustainerAdvanced = Date_t::now();
@@ -408,12 +415,21 @@ int FlowControl::getNumTickets(Date_t now) {
         // expectations, or where the lag measure is nonsensical.
         ret = _lastTargetTicketsPermitted.load();
         _lastTimeSustainerAdvanced = Date_t::now();
+        _inconclusiveDecisions.fetchAndAddRelaxed(1);
         // Since this case does not give conclusive evidence that isLagged could have meaningfully
         // transitioned from true to false, it does not make sense to update the _isLagged*
         // variables here.
     }
 
-    ret = std::max(ret, gFlowControlMinTicketsPerSecond.load());
+    // Blend the new target with the previous one to dampen the oscillation between throttling
+    // hard and bursting. A factor of zero (the default) keeps the unsmoothed behavior.
+    const double smoothing = gFlowControlTicketSmoothingFactor.load();
+    if (smoothing > 0.0) {
+        ret = static_cast<int>(smoothing * _lastTargetTicketsPermitted.load() +
+                               (1.0 - smoothing) * ret);
+    }
+
+    ret = std::max(ret, static_cast<int>(gFlowControlMinTicketsPerSecond.load() * periodFactor));
 
     LOGV2_DEBUG(22220,
                 DEBUG_LOG_LEVEL,
@@ -151,6 +151,7 @@ private:
     AtomicWord<int> _lastSustainerAppliedCount{0};
     AtomicWord<bool> _isLagged{false};
     AtomicWord<int> _isLaggedCount{0};
+    AtomicWord<int> _inconclusiveDecisions{0};
     // Use an int64_t as this is serialized to bson which does not support unsigned 64-bit numbers.
     AtomicWord<std::int64_t> _isLaggedTimeMicros{0};
     AtomicWord<Date_t> _disableUntil;
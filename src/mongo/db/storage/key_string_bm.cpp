@@ -48,6 +48,7 @@ const int kStrLenMultiplier = 100;
 const int kArrLenMultiplier = 40;
 
 const Ordering ALL_ASCENDING = Ordering::make(BSONObj());
+const Ordering ONE_DESCENDING = Ordering::make(BSON("a" << -1));
 
 struct BsonsAndKeyStrings {
     int bsonSize = 0;
@@ -97,13 +98,14 @@ BSONObj generateBson(BsonValueType bsonValueType) {
 }
 
 static BsonsAndKeyStrings generateBsonsAndKeyStrings(BsonValueType bsonValueType,
-                                                     KeyString::Version version) {
+                                                     KeyString::Version version,
+                                                     Ordering ordering = ALL_ASCENDING) {
     BsonsAndKeyStrings result;
     result.bsonSize = 0;
     result.keystringSize = 0;
     for (int i = 0; i < kSampleSize; i++) {
         BSONObj bson = generateBson(bsonValueType);
-        KeyString::Builder ks(version, bson, ALL_ASCENDING);
+        KeyString::Builder ks(version, bson, ordering);
         result.bsonSize += bson.objsize();
         result.keystringSize += ks.getSize();
         result.bsons[i] = bson;
@@ -135,8 +137,10 @@ void BM_BSONToKeyString(benchmark::State& state,
 
 void BM_KeyStringToBSON(benchmark::State& state,
                         const KeyString::Version version,
-                        BsonValueType bsonType) {
-    const BsonsAndKeyStrings bsonsAndKeyStrings = generateBsonsAndKeyStrings(bsonType, version);
+                        BsonValueType bsonType,
+                        Ordering ordering = ALL_ASCENDING) {
+    const BsonsAndKeyStrings bsonsAndKeyStrings =
+        generateBsonsAndKeyStrings(bsonType, version, ordering);
     for (auto _ : state) {
         benchmark::ClobberMemory();
         for (size_t i = 0; i < kSampleSize; i++) {
@@ -144,7 +148,7 @@ void BM_KeyStringToBSON(benchmark::State& state,
             benchmark::DoNotOptimize(
                 KeyString::toBson(bsonsAndKeyStrings.keystrings[i].get(),
                                   bsonsAndKeyStrings.keystringLens[i],
-                                  ALL_ASCENDING,
+                                  ordering,
                                   KeyString::TypeBits::fromBuffer(version, &buf)));
         }
     }
@@ -245,5 +249,13 @@ BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_String, KeyString::Version::V1, STRING)
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Array, KeyString::Version::V0, ARRAY);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Array, KeyString::Version::V1, ARRAY);
 
+// Descending orderings exercise the inverted-string decode path.
+BENCHMARK_CAPTURE(
+    BM_KeyStringToBSON, V0_StringDesc, KeyString::Version::V0, STRING, ONE_DESCENDING);
+BENCHMARK_CAPTURE(
+    BM_KeyStringToBSON, V1_StringDesc, KeyString::Version::V1, STRING, ONE_DESCENDING);
+BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_ArrayDesc, KeyString::Version::V0, ARRAY, ONE_DESCENDING);
+BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_ArrayDesc, KeyString::Version::V1, ARRAY, ONE_DESCENDING);
+
 }  // namespace
 }  // namespace mongo
@@ -291,6 +291,15 @@ public:
 
     virtual void checkpoint() {}
 
+    /**
+     * Returns the number of dirty bytes currently held in the engine's cache, or 0 if the engine
+     * does not track dirty data. Used by the checkpoint thread to decide whether to start a
+     * checkpoint ahead of schedule.
+     */
+    virtual int64_t getCacheDirtyBytes() const {
+        return 0;
+    }
+
     virtual bool isDurable() const = 0;
 
     /**
@@ -111,10 +111,34 @@ public:
      */
     virtual boost::optional<Record> next() = 0;
 
+    /**
+     * Hints that the caller intends to read the next 'numRecords' records in this cursor's
+     * direction of travel. Storage engines may use the hint to start reading the corresponding
+     * pages into cache in the background so the upcoming next() calls do not block on I/O.
+     *
+     * This is purely an optimization: the default implementation does nothing, engines are free
+     * to ignore the hint, and callers may make no assumptions about its effect.
+     */
+    virtual void prefetch(int64_t numRecords) {}
+
     //
     // Saving and restoring state
     //
 
+    /**
+     * Requests that a cursor which has hit EOF be repositioned after the last record it returned
+     * by the next restore(), instead of remaining at EOF, so that records committed after the
+     * save() become visible to subsequent next() calls. Tailable scans use this to keep a single
+     * cursor across awaitData waits rather than rebuilding and re-seeking one on every wakeup.
+     *
+     * Returns true if the cursor supports resuming after EOF. The default implementation does
+     * not; such cursors stay at EOF once they reach it and callers must seek a new cursor to
+     * continue past the old end.
+     */
+    virtual bool enableResumeAfterEof() {
+        return false;
+    }
+
     /**
      * Prepares for state changes in underlying data in a way that allows the cursor's
      * current position to be restored.
@@ -381,8 +405,15 @@ public:
      * the same document more than once and, as a result, may return more documents than exist in
      * the record store. Implementations should avoid obvious biases toward older, newer, larger
      * smaller or other specific classes of documents.
-     */
-    virtual std::unique_ptr<RecordCursor> getRandomCursor(OperationContext* opCtx) const {
+     *
+     * When the caller knows how many samples it intends to draw, it may pass that number as
+     * 'sampleSizeHint'. Implementations can use the hint to spread successive samples more evenly
+     * across the record store and to account for skew in the underlying tree shape. A value of
+     * zero means the sample size is unknown. The hint does not bound how many records the cursor
+     * may return.
+     */
+    virtual std::unique_ptr<RecordCursor> getRandomCursor(OperationContext* opCtx,
+                                                          int64_t sampleSizeHint = 0) const {
         return {};
     }
 
@@ -0,0 +1,475 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/storage/storage_bm.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_options.h"
+#include "mongo/db/concurrency/write_conflict_exception.h"
+#include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/repl_settings.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/key_string.h"
+#include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/sorted_data_interface.h"
+#include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss("storage_bm.coll");
+const int kMaxPerfThreads = 8;
+
+// Number of entries written per WriteUnitOfWork while seeding datasets; seeding is untimed.
+const int kSeedBatchSize = 1000;
+
+/**
+ * A Client and OperationContext wired up with a RecoveryUnit from the benchmarked engine. One
+ * per benchmark thread, mirroring how each server operation gets its own recovery unit.
+ */
+struct BenchmarkThreadContext {
+    BenchmarkThreadContext(KVEngine* engine, const std::string& desc)
+        : client(getGlobalServiceContext()->makeClient(desc)),
+          opCtx(client->makeOperationContext()) {
+        opCtx->setRecoveryUnit(std::unique_ptr<RecoveryUnit>(engine->newRecoveryUnit()),
+                               WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
+    }
+
+    ServiceContext::UniqueClient client;
+    ServiceContext::UniqueOperationContext opCtx;
+};
+
+/**
+ * Owns the KVEngine under test plus the RecordStore or SortedDataInterface for the current
+ * benchmark run. The engine is created once via makeKVEngineForStorageBm() and deliberately
+ * leaked; the per-run store is created by thread 0 before the benchmark loop and destroyed by
+ * thread 0 after it, which the start/stop barriers in the benchmark framework make safe.
+ */
+class StorageBmFixture {
+public:
+    StorageBmFixture() : _tempDir("storage_bm") {
+        auto serviceContext = getGlobalServiceContext();
+        repl::ReplicationCoordinator::set(serviceContext,
+                                          std::make_unique<repl::ReplicationCoordinatorMock>(
+                                              serviceContext, repl::ReplSettings()));
+        _engine = makeKVEngineForStorageBm(_tempDir.path());
+        _engine->notifyStartupComplete();
+    }
+
+    KVEngine* engine() const {
+        return _engine.get();
+    }
+
+    RecordStore* recordStore() const {
+        return _recordStore.get();
+    }
+
+    SortedDataInterface* sortedData() const {
+        return _sortedData.get();
+    }
+
+    const std::vector<RecordId>& seededRecordIds() const {
+        return _seededRecordIds;
+    }
+
+    void createRecordStore(OperationContext* opCtx) {
+        _recordStoreIdent = str::stream() << "storage-bm-rs-" << _identCounter.fetchAndAdd(1);
+        invariant(_engine->createRecordStore(
+            opCtx, kNss.ns(), _recordStoreIdent, CollectionOptions()));
+        _recordStore =
+            _engine->getRecordStore(opCtx, kNss.ns(), _recordStoreIdent, CollectionOptions());
+    }
+
+    void seedRecordStore(OperationContext* opCtx, int64_t numRecords, int docBytes) {
+        const auto doc = makeDocument(docBytes);
+        _seededRecordIds.reserve(numRecords);
+        for (int64_t seeded = 0; seeded < numRecords;) {
+            WriteUnitOfWork wuow(opCtx);
+            for (int i = 0; i < kSeedBatchSize && seeded < numRecords; ++i, ++seeded) {
+                auto res =
+                    _recordStore->insertRecord(opCtx, doc.objdata(), doc.objsize(), Timestamp());
+                invariant(res.getStatus());
+                _seededRecordIds.push_back(std::move(res.getValue()));
+            }
+            wuow.commit();
+        }
+    }
+
+    void destroyRecordStore(OperationContext* opCtx) {
+        _recordStore.reset();
+        _seededRecordIds.clear();
+        _seededRecordIds.shrink_to_fit();
+        // Reclaims the dataset between runs so one run's leftovers cannot evict the next run's
+        // working set. Engines that defer the drop get a fresh ident next run regardless.
+        _engine->dropIdent(opCtx->recoveryUnit(), _recordStoreIdent).ignore();
+    }
+
+    void createSortedData(OperationContext* opCtx) {
+        _sortedDataIdent = str::stream() << "storage-bm-index-" << _identCounter.fetchAndAdd(1);
+        // The descriptor must outlive the SortedDataInterface created from it.
+        _sortedDataDesc = std::make_unique<IndexDescriptor>(
+            "",
+            BSON("v" << static_cast<int>(IndexDescriptor::kLatestIndexVersion) << "key"
+                     << BSON("a" << 1)));
+        invariant(_engine->createSortedDataInterface(
+            opCtx, CollectionOptions(), _sortedDataIdent, _sortedDataDesc.get()));
+        _sortedData =
+            _engine->getSortedDataInterface(opCtx, _sortedDataIdent, _sortedDataDesc.get());
+    }
+
+    void seedSortedData(OperationContext* opCtx, int64_t numKeys, int keyBytes) {
+        for (int64_t seeded = 0; seeded < numKeys;) {
+            WriteUnitOfWork wuow(opCtx);
+            for (int i = 0; i < kSeedBatchSize && seeded < numKeys; ++i, ++seeded) {
+                invariant(_sortedData->insert(
+                    opCtx,
+                    makeInsertKeyString(makeKey(keyBytes, seeded), RecordId(seeded + 1)),
+                    true /*dupsAllowed*/));
+            }
+            wuow.commit();
+        }
+    }
+
+    void destroySortedData(OperationContext* opCtx) {
+        _sortedData.reset();
+        _sortedDataDesc.reset();
+        _engine->dropIdent(opCtx->recoveryUnit(), _sortedDataIdent).ignore();
+    }
+
+    /**
+     * Builds a single-field index key of roughly 'keyBytes' whose sort order follows 'seq'.
+     */
+    BSONObj makeKey(int keyBytes, int64_t seq) const {
+        const std::string key = str::stream() << std::string(keyBytes, 'x') << seq;
+        return BSON("" << key);
+    }
+
+    KeyString::Value makeInsertKeyString(const BSONObj& key, RecordId rid) const {
+        KeyString::Builder builder(
+            _sortedData->getKeyStringVersion(), key, _sortedData->getOrdering());
+        builder.appendRecordId(rid);
+        return builder.getValueCopy();
+    }
+
+    KeyString::Value makeSeekKeyString(const BSONObj& key) const {
+        KeyString::Builder builder(_sortedData->getKeyStringVersion(),
+                                   key,
+                                   _sortedData->getOrdering(),
+                                   KeyString::Discriminator::kExclusiveBefore);
+        return builder.getValueCopy();
+    }
+
+    static BSONObj makeDocument(int docBytes) {
+        return BSON("_id" << OID::gen() << "padding" << std::string(docBytes, 'x'));
+    }
+
+private:
+    unittest::TempDir _tempDir;
+    std::unique_ptr<KVEngine> _engine;
+
+    AtomicWord<int> _identCounter{0};
+
+    std::string _recordStoreIdent;
+    std::unique_ptr<RecordStore> _recordStore;
+    std::vector<RecordId> _seededRecordIds;
+
+    std::string _sortedDataIdent;
+    std::unique_ptr<IndexDescriptor> _sortedDataDesc;
+    std::unique_ptr<SortedDataInterface> _sortedData;
+};
+
+StorageBmFixture& fixture() {
+    static auto* instance = new StorageBmFixture();
+    return *instance;
+}
+
+/**
+ * Cheap per-thread pseudo-random sequence so concurrent readers and updaters touch records all
+ * over the dataset rather than marching through it in insertion order.
+ */
+class RecordPicker {
+public:
+    explicit RecordPicker(int threadIndex) : _state(2 * threadIndex + 1) {}
+
+    size_t next(size_t size) {
+        _state = _state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<size_t>(_state >> 33) % size;
+    }
+
+private:
+    uint64_t _state;
+};
+
+/**
+ * Inserts one record per iteration, each in its own WriteUnitOfWork.
+ *
+ * Arguments: (approximate document size in bytes).
+ */
+void BM_StorageRecordStoreInsert(benchmark::State& state) {
+    auto& fix = fixture();
+    BenchmarkThreadContext threadContext(fix.engine(), "storage bm insert");
+    auto opCtx = threadContext.opCtx.get();
+    if (state.thread_index == 0) {
+        fix.createRecordStore(opCtx);
+    }
+
+    const auto doc = StorageBmFixture::makeDocument(state.range(0));
+    for (auto keepRunning : state) {
+        writeConflictRetry(opCtx, "storageBmInsert", kNss.ns(), [&] {
+            WriteUnitOfWork wuow(opCtx);
+            invariant(fix.recordStore()
+                          ->insertRecord(opCtx, doc.objdata(), doc.objsize(), Timestamp())
+                          .getStatus());
+            wuow.commit();
+        });
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * doc.objsize());
+    if (state.thread_index == 0) {
+        fix.destroyRecordStore(opCtx);
+    }
+}
+
+/**
+ * Point-reads pseudo-randomly chosen records from a seeded record store, one snapshot per
+ * iteration.
+ *
+ * Arguments: (number of seeded records, approximate document size in bytes). The larger
+ * combinations are meant to exceed the engine's cache.
+ */
+void BM_StorageRecordStoreSeekExact(benchmark::State& state) {
+    auto& fix = fixture();
+    BenchmarkThreadContext threadContext(fix.engine(), "storage bm seek");
+    auto opCtx = threadContext.opCtx.get();
+    if (state.thread_index == 0) {
+        fix.createRecordStore(opCtx);
+        fix.seedRecordStore(opCtx, state.range(0), state.range(1));
+    }
+
+    RecordPicker picker(state.thread_index);
+    for (auto keepRunning : state) {
+        const auto& ids = fix.seededRecordIds();
+        {
+            auto cursor = fix.recordStore()->getCursor(opCtx);
+            auto record = cursor->seekExact(ids[picker.next(ids.size())]);
+            invariant(record);
+            benchmark::DoNotOptimize(record->data.size());
+        }
+        opCtx->recoveryUnit()->abandonSnapshot();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index == 0) {
+        fix.destroyRecordStore(opCtx);
+    }
+}
+
+/**
+ * Scans a seeded record store end to end once per iteration and reports records/s.
+ *
+ * Arguments: (number of seeded records, approximate document size in bytes).
+ */
+void BM_StorageRecordStoreScan(benchmark::State& state) {
+    auto& fix = fixture();
+    BenchmarkThreadContext threadContext(fix.engine(), "storage bm scan");
+    auto opCtx = threadContext.opCtx.get();
+    if (state.thread_index == 0) {
+        fix.createRecordStore(opCtx);
+        fix.seedRecordStore(opCtx, state.range(0), state.range(1));
+    }
+
+    int64_t recordsScanned = 0;
+    for (auto keepRunning : state) {
+        {
+            auto cursor = fix.recordStore()->getCursor(opCtx);
+            while (auto record = cursor->next()) {
+                benchmark::DoNotOptimize(record->data.size());
+                ++recordsScanned;
+            }
+        }
+        opCtx->recoveryUnit()->abandonSnapshot();
+    }
+
+    state.SetItemsProcessed(recordsScanned);
+    if (state.thread_index == 0) {
+        fix.destroyRecordStore(opCtx);
+    }
+}
+
+/**
+ * Overwrites pseudo-randomly chosen records with a same-sized document, one WriteUnitOfWork per
+ * iteration. Concurrent threads occasionally collide on a record and exercise the engine's
+ * write-conflict path.
+ *
+ * Arguments: (number of seeded records, approximate document size in bytes).
+ */
+void BM_StorageRecordStoreUpdate(benchmark::State& state) {
+    auto& fix = fixture();
+    BenchmarkThreadContext threadContext(fix.engine(), "storage bm update");
+    auto opCtx = threadContext.opCtx.get();
+    if (state.thread_index == 0) {
+        fix.createRecordStore(opCtx);
+        fix.seedRecordStore(opCtx, state.range(0), state.range(1));
+    }
+
+    const auto doc = StorageBmFixture::makeDocument(state.range(1));
+    RecordPicker picker(state.thread_index);
+    for (auto keepRunning : state) {
+        const auto& ids = fix.seededRecordIds();
+        const auto& id = ids[picker.next(ids.size())];
+        writeConflictRetry(opCtx, "storageBmUpdate", kNss.ns(), [&] {
+            WriteUnitOfWork wuow(opCtx);
+            invariant(
+                fix.recordStore()->updateRecord(opCtx, id, doc.objdata(), doc.objsize()));
+            wuow.commit();
+        });
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index == 0) {
+        fix.destroyRecordStore(opCtx);
+    }
+}
+
+/**
+ * Inserts one index key per iteration into a standard (non-unique) index, each in its own
+ * WriteUnitOfWork. Threads insert disjoint, interleaved key ranges.
+ *
+ * Arguments: (approximate key size in bytes).
+ */
+void BM_StorageIndexInsert(benchmark::State& state) {
+    auto& fix = fixture();
+    BenchmarkThreadContext threadContext(fix.engine(), "storage bm index insert");
+    auto opCtx = threadContext.opCtx.get();
+    if (state.thread_index == 0) {
+        fix.createSortedData(opCtx);
+    }
+
+    const int keyBytes = state.range(0);
+    int64_t seq = state.thread_index;
+    for (auto keepRunning : state) {
+        auto keyString =
+            fix.makeInsertKeyString(fix.makeKey(keyBytes, seq), RecordId(seq + 1));
+        seq += state.threads;
+        writeConflictRetry(opCtx, "storageBmIndexInsert", kNss.ns(), [&] {
+            WriteUnitOfWork wuow(opCtx);
+            invariant(fix.sortedData()->insert(opCtx, keyString, true /*dupsAllowed*/));
+            wuow.commit();
+        });
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index == 0) {
+        fix.destroySortedData(opCtx);
+    }
+}
+
+/**
+ * Seeks to pseudo-randomly chosen existing keys in a seeded standard index, one snapshot per
+ * iteration.
+ *
+ * Arguments: (number of seeded keys, approximate key size in bytes).
+ */
+void BM_StorageIndexSeek(benchmark::State& state) {
+    auto& fix = fixture();
+    BenchmarkThreadContext threadContext(fix.engine(), "storage bm index seek");
+    auto opCtx = threadContext.opCtx.get();
+    if (state.thread_index == 0) {
+        fix.createSortedData(opCtx);
+        fix.seedSortedData(opCtx, state.range(0), state.range(1));
+    }
+
+    const int64_t numKeys = state.range(0);
+    const int keyBytes = state.range(1);
+    RecordPicker picker(state.thread_index);
+    for (auto keepRunning : state) {
+        {
+            auto cursor = fix.sortedData()->newCursor(opCtx);
+            auto entry = cursor->seek(
+                fix.makeSeekKeyString(fix.makeKey(keyBytes, picker.next(numKeys))));
+            invariant(entry);
+            benchmark::DoNotOptimize(entry->loc);
+        }
+        opCtx->recoveryUnit()->abandonSnapshot();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index == 0) {
+        fix.destroySortedData(opCtx);
+    }
+}
+
+BENCHMARK(BM_StorageRecordStoreInsert)
+    ->Args({256})
+    ->Args({1024})
+    ->Args({16 * 1024})
+    ->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK(BM_StorageRecordStoreSeekExact)
+    ->Args({1 << 10, 256})
+    ->Args({1 << 17, 1024})
+    ->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK(BM_StorageRecordStoreScan)
+    ->Args({1 << 10, 256})
+    ->Args({1 << 17, 1024})
+    ->Threads(1);
+
+BENCHMARK(BM_StorageRecordStoreUpdate)
+    ->Args({1 << 10, 256})
+    ->Args({1 << 17, 1024})
+    ->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK(BM_StorageIndexInsert)
+    ->Args({16})
+    ->Args({256})
+    ->ThreadRange(1, kMaxPerfThreads);
+
+BENCHMARK(BM_StorageIndexSeek)
+    ->Args({1 << 10, 16})
+    ->Args({1 << 20, 256})
+    ->ThreadRange(1, kMaxPerfThreads);
+
+}  // namespace
+}  // namespace mongo
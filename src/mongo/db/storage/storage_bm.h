@@ -0,0 +1,53 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "mongo/db/storage/kv/kv_engine.h"
+
+namespace mongo {
+
+/**
+ * Constructs the KVEngine exercised by the storage benchmark suite in storage_bm.cpp.
+ *
+ * The suite itself is engine-agnostic; each storage engine that wants to run it links the
+ * common 'storage_bm' library together with its own definition of this factory. See
+ * wiredtiger_storage_bm.cpp and ephemeral_for_test_storage_bm.cpp.
+ *
+ * Engines backed by files keep their data under 'dbpath'; in-memory engines may ignore it.
+ * Implementations with a block cache should configure it deliberately small so the larger
+ * benchmark datasets do not fit, letting the suite measure out-of-cache as well as in-cache
+ * behavior.
+ */
+std::unique_ptr<KVEngine> makeKVEngineForStorageBm(const std::string& dbpath);
+
+}  // namespace mongo
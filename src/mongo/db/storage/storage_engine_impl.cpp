@@ -45,13 +45,16 @@
 #include "mongo/db/storage/durable_catalog_feature_tracker.h"
 #include "mongo/db/storage/kv/kv_engine.h"
 #include "mongo/db/storage/kv/temporary_kv_record_store.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/db/storage/storage_repair_observer.h"
 #include "mongo/db/storage/storage_util.h"
 #include "mongo/db/storage/two_phase_index_build_knobs_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 
@@ -230,6 +233,21 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx, bool loadingFromUnc
         }
     }
 
+    // Opening every collection's table serially dominates startup time on nodes with large
+    // numbers of collections, so defer the opens to a pool of worker threads when more than one is
+    // available. Repair always uses the serial path: it initializes collections without record
+    // stores and may modify the catalog as it goes.
+    const size_t numCollectionLoadThreads = [&]() -> size_t {
+        if (_options.forRepair) {
+            return 1;
+        }
+        if (gStartupCollectionCatalogLoadThreads > 0) {
+            return gStartupCollectionCatalogLoadThreads;
+        }
+        return std::min<size_t>(ProcessInfo::getNumAvailableCores(), 16);
+    }();
+    std::vector<std::pair<DurableCatalog::Entry, Timestamp>> deferredCollections;
+
     KVPrefix maxSeenPrefix = KVPrefix::kNotPrefixed;
     for (DurableCatalog::Entry entry : catalogEntries) {
         if (loadingFromUncleanShutdownOrRepair) {
@@ -285,7 +303,11 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx, bool loadingFromUnc
             }
         }
 
-        _initCollection(opCtx, entry.catalogId, entry.nss, _options.forRepair, minVisibleTs);
+        if (numCollectionLoadThreads > 1) {
+            deferredCollections.emplace_back(entry, minVisibleTs);
+        } else {
+            _initCollection(opCtx, entry.catalogId, entry.nss, _options.forRepair, minVisibleTs);
+        }
         auto maxPrefixForCollection = _catalog->getMetaData(opCtx, entry.catalogId).getMaxPrefix();
         maxSeenPrefix = std::max(maxSeenPrefix, maxPrefixForCollection);
 
@@ -297,6 +319,10 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx, bool loadingFromUnc
         }
     }
 
+    if (!deferredCollections.empty()) {
+        _initCollectionsParallel(deferredCollections, numCollectionLoadThreads);
+    }
+
     KVPrefix::setLargestPrefix(maxSeenPrefix);
     opCtx->recoveryUnit()->abandonSnapshot();
 }
@@ -334,6 +360,59 @@ void StorageEngineImpl::_initCollection(OperationContext* opCtx,
     });
 }
 
+void StorageEngineImpl::_initCollectionsParallel(
+    const std::vector<std::pair<DurableCatalog::Entry, Timestamp>>& entries, size_t numThreads) {
+    LOGV2(5837111,
+          "Initializing collections in parallel",
+          "numCollections"_attr = entries.size(),
+          "numThreads"_attr = numThreads);
+
+    ThreadPool::Options options;
+    options.poolName = "StorageEngineCollectionLoader";
+    options.minThreads = 0;
+    options.maxThreads = numThreads;
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName.c_str());
+    };
+    ThreadPool pool(options);
+    pool.startup();
+
+    // Only the first failure is reported; the remaining tasks still run to completion so the pool
+    // can be joined safely.
+    auto firstError = Status::OK();
+    auto firstErrorMutex = MONGO_MAKE_LATCH("StorageEngineImpl::_initCollectionsParallel");
+
+    for (const auto& task : entries) {
+        pool.schedule([this, &task, &firstError, &firstErrorMutex](Status status) {
+            invariant(status);
+            try {
+                auto workerOpCtx = cc().makeOperationContext();
+                // During startup the storage engine has not yet been registered with the service
+                // context, so freshly created operation contexts carry noop recovery units. See
+                // the StorageClientObserver class.
+                if (workerOpCtx->recoveryUnit()->isNoop()) {
+                    workerOpCtx->setRecoveryUnit(
+                        std::unique_ptr<RecoveryUnit>(_engine->newRecoveryUnit()),
+                        WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork);
+                }
+                _initCollection(
+                    workerOpCtx.get(), task.first.catalogId, task.first.nss, false, task.second);
+            } catch (...) {
+                stdx::lock_guard<Latch> lk(firstErrorMutex);
+                if (firstError.isOK()) {
+                    firstError = exceptionToStatus();
+                }
+            }
+        });
+    }
+
+    pool.waitForIdle();
+    pool.shutdown();
+    pool.join();
+
+    uassertStatusOK(firstError);
+}
+
 void StorageEngineImpl::closeCatalog(OperationContext* opCtx) {
     dassert(opCtx->lockState()->isLocked());
     if (shouldLog(::mongo::logv2::LogComponent::kStorageRecovery, kCatalogLogLevel)) {
@@ -41,6 +41,7 @@ public:
     WiredTigerGlobalOptions()
         : cacheSizeGB(0),
           statisticsLogDelaySecs(0),
+          zstdCompressorLevel(0),
           directoryForIndexes(false),
           maxCacheOverflowFileSizeGBDeprecated(0),
           useCollectionPrefixCompression(false),
@@ -51,6 +52,7 @@ public:
     double cacheSizeGB;
     size_t statisticsLogDelaySecs;
     std::string journalCompressor;
+    int zstdCompressorLevel;
     bool directoryForIndexes;
     double maxCacheOverflowFileSizeGBDeprecated;
     std::string engineConfig;
@@ -51,6 +51,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor_helpers.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
@@ -494,7 +495,9 @@ Status WiredTigerIndex::compact(OperationContext* opCtx) {
     if (!cache->isEphemeral()) {
         WT_SESSION* s = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
         opCtx->recoveryUnit()->abandonSnapshot();
-        int ret = s->compact(s, uri().c_str(), "timeout=0");
+        const std::string config =
+            str::stream() << "timeout=" << gWiredTigerCompactTimeLimitSeconds.load();
+        int ret = s->compact(s, uri().c_str(), config.c_str());
         if (MONGO_unlikely(WTCompactIndexEBUSY.shouldFail())) {
             ret = EBUSY;
         }
@@ -504,6 +507,13 @@ Status WiredTigerIndex::compact(OperationContext* opCtx) {
                           str::stream() << "Compaction interrupted on " << uri().c_str()
                                         << " due to cache eviction pressure");
         }
+        if (ret == ETIMEDOUT) {
+            // The bounded compaction pass ran out of time; rerunning compact resumes the work.
+            LOGV2(5837150,
+                  "Compaction pass on the index reached its time limit",
+                  "uri"_attr = uri());
+            ret = 0;
+        }
         invariantWTOK(ret);
     }
     return Status::OK();
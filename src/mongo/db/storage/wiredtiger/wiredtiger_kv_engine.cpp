@@ -41,7 +41,9 @@
 #define NVALGRIND
 #endif
 
+#include <deque>
 #include <fmt/format.h>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 
@@ -242,6 +244,167 @@ private:
     stdx::condition_variable _condvar;
 };
 
+class WiredTigerKVEngine::WiredTigerSizeStorerFlusher : public BackgroundJob {
+public:
+    explicit WiredTigerSizeStorerFlusher(WiredTigerKVEngine* engine)
+        : BackgroundJob(false /* deleteSelf */), _engine(engine) {}
+
+    virtual string name() const {
+        return "WTSizeStorerFlusher";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOGV2_DEBUG(5837107, 1, "starting {name} thread", "name"_attr = name());
+
+        while (!_shuttingDown.load()) {
+            {
+                stdx::unique_lock<Latch> lock(_mutex);
+                MONGO_IDLE_THREAD_BLOCK;
+                _condvar.wait_for(lock, stdx::chrono::seconds(1));
+            }
+
+            // The tracker keeps the flush cadence that the inline flush in haveDropsQueued() used
+            // to provide.
+            if (_engine->_sizeStorerSyncTracker.intervalHasElapsed()) {
+                _engine->_sizeStorerSyncTracker.resetLastTime();
+                _engine->syncSizeInfo(false);
+            }
+        }
+        LOGV2_DEBUG(5837108, 1, "stopping {name} thread", "name"_attr = name());
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        {
+            stdx::unique_lock<Latch> lock(_mutex);
+            // Wake up the flusher thread early, we do not want the shutdown to wait for us too
+            // long.
+            _condvar.notify_one();
+        }
+        wait();
+    }
+
+private:
+    WiredTigerKVEngine* _engine;
+    AtomicWord<bool> _shuttingDown{false};
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerSizeStorerFlusher::_mutex");  // protects _condvar
+    // The flusher thread idles on this condition variable between flush checks. It can be
+    // triggered early to expedite shutdown.
+    stdx::condition_variable _condvar;
+};
+
+/**
+ * Background job that warms the WiredTiger cache on behalf of collection scans. Scans queue
+ * best-effort hints describing the range of records they are about to read; the prefetcher walks
+ * that range on a dedicated session so the page reads overlap with the scan's processing instead
+ * of being paid synchronously in next(). Hints are dropped when the queue is full; a scan that
+ * outruns the prefetcher simply faults its own pages in as it always has.
+ */
+class WiredTigerKVEngine::WiredTigerRecordPrefetcher : public BackgroundJob {
+public:
+    explicit WiredTigerRecordPrefetcher(WT_CONNECTION* conn)
+        : BackgroundJob(false /* deleteSelf */), _conn(conn) {}
+
+    virtual string name() const {
+        return "WTRecordPrefetcher";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOGV2_DEBUG(5837123, 1, "starting {name} thread", "name"_attr = name());
+
+        while (true) {
+            PrefetchTask task;
+            {
+                stdx::unique_lock<Latch> lock(_mutex);
+                MONGO_IDLE_THREAD_BLOCK;
+                _condvar.wait(lock, [&] { return _shuttingDown.load() || !_queue.empty(); });
+                if (_shuttingDown.load()) {
+                    break;
+                }
+                task = std::move(_queue.front());
+                _queue.pop_front();
+            }
+
+            try {
+                _prefetch(task);
+            } catch (const std::exception& e) {
+                // Prefetching is strictly an optimization; a failure only means the scan reads
+                // its own pages.
+                LOGV2_DEBUG(5837124,
+                            1,
+                            "Record prefetch failed",
+                            "uri"_attr = task.uri,
+                            "error"_attr = e.what());
+            }
+        }
+        LOGV2_DEBUG(5837125, 1, "stopping {name} thread", "name"_attr = name());
+    }
+
+    void enqueue(const std::string& uri, const RecordId& startId, int64_t numRecords) {
+        stdx::unique_lock<Latch> lock(_mutex);
+        if (_queue.size() >= kMaxQueuedTasks) {
+            // Best effort only. Dropping the hint is preferable to stalling the scan or queueing
+            // work we will finish too late to be useful.
+            return;
+        }
+        _queue.push_back({uri, startId, numRecords});
+        _condvar.notify_one();
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        {
+            stdx::unique_lock<Latch> lock(_mutex);
+            // Wake up the prefetcher thread early, we do not want the shutdown
+            // to wait for us too long.
+            _condvar.notify_one();
+        }
+        wait();
+    }
+
+private:
+    struct PrefetchTask {
+        std::string uri;
+        RecordId startId;
+        int64_t numRecords;
+    };
+
+    void _prefetch(const PrefetchTask& task) {
+        // A dedicated session keeps these reads off application transactions and out of the
+        // session cache's cursor caches.
+        WiredTigerSession session(_conn);
+        WT_CURSOR* cursor = session.getNewCursor(task.uri);
+
+        // 'startId' is the record the scan last returned, so position at (or just past) it and
+        // touch the records that follow. Any error, including a cache-pressure rollback, just
+        // ends the readahead early.
+        cursor->set_key(cursor, task.startId.repr());
+        int cmp;
+        if (cursor->search_near(cursor, &cmp) != 0) {
+            return;
+        }
+        for (int64_t i = 0; i < task.numRecords; i++) {
+            if (cursor->next(cursor) != 0) {
+                break;
+            }
+        }
+    }
+
+    WT_CONNECTION* _conn;  // not owned
+    AtomicWord<bool> _shuttingDown{false};
+
+    static constexpr size_t kMaxQueuedTasks = 16;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerRecordPrefetcher::_mutex");
+    // The prefetcher thread idles on this condition variable until a hint is queued. It can be
+    // triggered early to expedite shutdown.
+    stdx::condition_variable _condvar;
+    std::deque<PrefetchTask> _queue;  // protected by _mutex
+};
+
 std::string toString(const StorageEngine::OldestActiveTransactionTimestampResult& r) {
     if (r.isOK()) {
         if (r.getValue()) {
@@ -261,6 +424,245 @@ TicketHolder openWriteTransaction(128);
 TicketHolder openReadTransaction(128);
 }  // namespace
 
+/**
+ * Background job that hill-climbs the read and write ticket pool sizes from observed throughput.
+ * Every adjustment interval it measures how many tickets were released (operations finished) and,
+ * while a pool is saturated, keeps moving the pool size in the current direction as long as
+ * throughput improves, reversing direction when it regresses. This converges towards the
+ * concurrency level that maximizes operations finished per interval instead of relying on the
+ * static 128/128 defaults.
+ */
+class WiredTigerKVEngine::WiredTigerTicketAdmissionMonitor : public BackgroundJob {
+public:
+    WiredTigerTicketAdmissionMonitor()
+        : BackgroundJob(false /* deleteSelf */),
+          _write{&openWriteTransaction},
+          _read{&openReadTransaction} {}
+
+    virtual string name() const {
+        return "WTTicketAdmissionMonitor";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOGV2_DEBUG(5837101, 1, "starting {name} thread", "name"_attr = name());
+
+        while (!_shuttingDown.load()) {
+            {
+                stdx::unique_lock<Latch> lock(_mutex);
+                MONGO_IDLE_THREAD_BLOCK;
+                _condvar.wait_for(lock, stdx::chrono::seconds(kAdjustmentIntervalSecs));
+            }
+
+            _adjust(&_write);
+            _adjust(&_read);
+        }
+        LOGV2_DEBUG(5837102, 1, "stopping {name} thread", "name"_attr = name());
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        {
+            stdx::unique_lock<Latch> lock(_mutex);
+            // Wake up the monitor thread early, we do not want the shutdown to wait for us too
+            // long.
+            _condvar.notify_one();
+        }
+        wait();
+    }
+
+private:
+    static constexpr int kAdjustmentIntervalSecs = 5;
+    static constexpr int kTicketAdjustmentStep = 8;
+    static constexpr int kMinConcurrentTransactions = 16;
+    static constexpr int kMaxConcurrentTransactions = 512;
+
+    struct HolderState {
+        TicketHolder* holder;
+        int64_t lastNumFinished = 0;
+        int64_t lastThroughput = 0;
+        int direction = 1;
+    };
+
+    void _adjust(HolderState* state) {
+        const int64_t numFinished = state->holder->numFinishedProcessing();
+        const int64_t throughput = numFinished - state->lastNumFinished;
+        state->lastNumFinished = numFinished;
+
+        // Only climb while the pool is actually limiting admission; adjusting an unsaturated pool
+        // just chases noise.
+        if (state->holder->available() > 0) {
+            state->lastThroughput = throughput;
+            return;
+        }
+
+        if (throughput < state->lastThroughput) {
+            state->direction = -state->direction;
+        }
+        state->lastThroughput = throughput;
+
+        const int newSize =
+            std::max(kMinConcurrentTransactions,
+                     std::min(kMaxConcurrentTransactions,
+                              state->holder->outof() + state->direction * kTicketAdjustmentStep));
+        if (newSize == state->holder->outof()) {
+            return;
+        }
+
+        LOGV2_DEBUG(5837103,
+                    2,
+                    "Adjusting ticket pool size",
+                    "newSize"_attr = newSize,
+                    "throughput"_attr = throughput);
+        // Shrinking waits to reacquire the surrendered tickets; that is fine on this background
+        // thread as they free up when admitted operations finish.
+        fassert(5837104, state->holder->resize(newSize));
+    }
+
+    HolderState _write;
+    HolderState _read;
+    AtomicWord<bool> _shuttingDown{false};
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerTicketAdmissionMonitor::_mutex");  // protects
+                                                                                  // _condvar
+    // The monitor thread idles on this condition variable between adjustments. It can be
+    // triggered early to expedite shutdown.
+    stdx::condition_variable _condvar;
+};
+
+namespace {
+
+/**
+ * Reads the memory limit currently applied to the process, in MB. ProcessInfo only samples the
+ * limit once at startup, so this reads the cgroup interface files directly; container runtimes
+ * may rewrite them while the server is running. Returns boost::none on platforms where the limit
+ * cannot be observed at runtime.
+ */
+boost::optional<double> readLiveMemoryLimitMB() {
+#ifdef __linux__
+    // cgroups v1 and v2 interface files. A v2 limit of "max" (or any unparseable content) is
+    // treated as unconstrained and falls through to the next candidate.
+    static const char* const kLimitPaths[] = {"/sys/fs/cgroup/memory/memory.limit_in_bytes",
+                                              "/sys/fs/cgroup/memory.max"};
+    for (auto&& path : kLimitPaths) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            continue;
+        }
+        std::string line;
+        std::getline(file, line);
+        unsigned long long limitBytes;
+        if (line.empty() || !NumberParser{}(line, &limitBytes).isOK()) {
+            continue;
+        }
+        double limitMB = static_cast<double>(limitBytes) / (1024 * 1024);
+        return std::min(limitMB, static_cast<double>(ProcessInfo::getSystemMemSizeMB()));
+    }
+#endif
+    return boost::none;
+}
+
+}  // namespace
+
+/**
+ * Background job that keeps the WiredTiger cache size in step with the memory limit applied to
+ * the process. Container runtimes can change the limit while the server is running; when
+ * wiredTigerCacheAdaptiveSizing is enabled this job periodically re-reads it and, once the limit
+ * has moved far enough, applies the startup sizing formula to the new limit and resizes the cache
+ * through a live reconfiguration. Only started when the cache size was not explicitly configured.
+ */
+class WiredTigerKVEngine::WiredTigerCacheSizeGovernor : public BackgroundJob {
+public:
+    WiredTigerCacheSizeGovernor(WiredTigerKVEngine* engine, size_t initialCacheSizeMB)
+        : BackgroundJob(false /* deleteSelf */),
+          _engine(engine),
+          _cacheSizeMB(initialCacheSizeMB) {}
+
+    virtual string name() const {
+        return "WTCacheSizeGovernor";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOGV2_DEBUG(5837142, 1, "starting {name} thread", "name"_attr = name());
+
+        while (!_shuttingDown.load()) {
+            {
+                stdx::unique_lock<Latch> lock(_mutex);
+                MONGO_IDLE_THREAD_BLOCK;
+                _condvar.wait_for(lock, stdx::chrono::seconds(kCheckIntervalSecs));
+            }
+
+            if (_shuttingDown.load() || !gWiredTigerCacheAdaptiveSizing.load()) {
+                continue;
+            }
+
+            auto limitMB = readLiveMemoryLimitMB();
+            if (!limitMB) {
+                continue;
+            }
+
+            // The same formula used to size the cache at startup when no explicit size is given:
+            // half the memory over 1GB, with a 256MB floor.
+            auto targetMB = static_cast<size_t>(std::max((*limitMB - 1024.0) * 0.5, 256.0));
+
+            // Hysteresis: ignore drift below 5% of the current size so a flapping limit does not
+            // keep the eviction server busy with back-to-back resizes. The slow check cadence
+            // paces how often eviction has to absorb a shrink.
+            auto deltaMB =
+                targetMB > _cacheSizeMB ? targetMB - _cacheSizeMB : _cacheSizeMB - targetMB;
+            if (deltaMB * 20 < _cacheSizeMB) {
+                continue;
+            }
+
+            std::string config = str::stream() << "cache_size=" << targetMB << "M";
+            int ret = _engine->reconfigure(config.c_str());
+            if (ret != 0) {
+                LOGV2_WARNING(5837143,
+                              "Failed to resize the WiredTiger cache for the new memory limit",
+                              "targetMB"_attr = targetMB,
+                              "error"_attr = wiredtiger_strerror(ret));
+                continue;
+            }
+
+            LOGV2(5837144,
+                  "Resized the WiredTiger cache to match the process memory limit",
+                  "memoryLimitMB"_attr = *limitMB,
+                  "previousCacheSizeMB"_attr = _cacheSizeMB,
+                  "cacheSizeMB"_attr = targetMB);
+            _cacheSizeMB = targetMB;
+        }
+        LOGV2_DEBUG(5837145, 1, "stopping {name} thread", "name"_attr = name());
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        {
+            stdx::unique_lock<Latch> lock(_mutex);
+            // Wake up the governor thread early, we do not want the shutdown to wait for us too
+            // long.
+            _condvar.notify_one();
+        }
+        wait();
+    }
+
+private:
+    static constexpr int kCheckIntervalSecs = 10;
+
+    WiredTigerKVEngine* _engine;
+
+    // The cache size currently applied to the connection, in MB. Only accessed by the governor
+    // thread.
+    size_t _cacheSizeMB;
+
+    AtomicWord<bool> _shuttingDown{false};
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerCacheSizeGovernor::_mutex");  // protects _condvar
+    // The governor thread idles on this condition variable between limit checks. It can be
+    // triggered early to expedite shutdown.
+    stdx::condition_variable _condvar;
+};
+
 OpenWriteTransactionParam::OpenWriteTransactionParam(StringData name, ServerParameterType spt)
     : ServerParameter(name, spt), _data(&openWriteTransaction) {}
 
@@ -362,6 +764,8 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
     ss << "log=(enabled=true,archive=" << (_readOnly ? "false" : "true")
        << ",path=journal,compressor=";
     ss << wiredTigerGlobalOptions.journalCompressor << "),";
+    ss << "builtin_extension_config=(zstd=(compression_level="
+       << wiredTigerGlobalOptions.zstdCompressorLevel << ")),";
     ss << "file_manager=(close_idle_time=" << gWiredTigerFileHandleCloseIdleTime
        << ",close_scan_interval=" << gWiredTigerFileHandleCloseScanInterval
        << ",close_handle_minimum=" << gWiredTigerFileHandleCloseMinimum << "),";
@@ -510,6 +914,29 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
     _sessionSweeper = std::make_unique<WiredTigerSessionSweeper>(_sessionCache.get());
     _sessionSweeper->go();
 
+    if (!_readOnly) {
+        _sizeStorerFlusher = std::make_unique<WiredTigerSizeStorerFlusher>(this);
+        _sizeStorerFlusher->go();
+    }
+
+    if (!_ephemeral) {
+        // The ephemeral engine has no disk pages to warm.
+        _recordPrefetcher = std::make_unique<WiredTigerRecordPrefetcher>(_conn);
+        _recordPrefetcher->go();
+    }
+
+    if (gWiredTigerAdaptiveConcurrentTransactions) {
+        _ticketAdmissionMonitor = std::make_unique<WiredTigerTicketAdmissionMonitor>();
+        _ticketAdmissionMonitor->go();
+    }
+
+    if (!_readOnly && wiredTigerGlobalOptions.cacheSizeGB == 0) {
+        // Only govern the cache size when it was derived from the memory limit at startup; an
+        // explicitly configured size is the operator's choice.
+        _cacheSizeGovernor = std::make_unique<WiredTigerCacheSizeGovernor>(this, cacheSizeMB);
+        _cacheSizeGovernor->go();
+    }
+
     // Until the Replication layer installs a real callback, prevent truncating the oplog.
     setOldestActiveTransactionTimestampCallback(
         [](Timestamp) { return StatusWith(boost::make_optional(Timestamp::min())); });
@@ -695,6 +1122,15 @@ void WiredTigerKVEngine::_openWiredTiger(const std::string& path, const std::str
                         "details"_attr = wtRCToStatus(ret).reason());
 }
 
+void WiredTigerKVEngine::prefetchRecords(const std::string& uri,
+                                         const RecordId& startId,
+                                         int64_t numRecords) {
+    if (!_recordPrefetcher) {
+        return;
+    }
+    _recordPrefetcher->enqueue(uri, startId, numRecords);
+}
+
 void WiredTigerKVEngine::cleanShutdown() {
     LOGV2(22317, "WiredTigerKVEngine shutting down");
     WiredTigerUtil::resetTableLoggingInfo();
@@ -707,6 +1143,26 @@ void WiredTigerKVEngine::cleanShutdown() {
 
     // these must be the last things we do before _conn->close();
     haltOplogManager(/*oplogRecordStore=*/nullptr, /*shuttingDown=*/true);
+    if (_recordPrefetcher) {
+        LOGV2(5837126, "Shutting down record prefetcher thread");
+        _recordPrefetcher->shutdown();
+        LOGV2(5837127, "Finished shutting down record prefetcher thread");
+    }
+    if (_ticketAdmissionMonitor) {
+        LOGV2(5837105, "Shutting down ticket admission monitor thread");
+        _ticketAdmissionMonitor->shutdown();
+        LOGV2(5837106, "Finished shutting down ticket admission monitor thread");
+    }
+    if (_cacheSizeGovernor) {
+        LOGV2(5837146, "Shutting down cache size governor thread");
+        _cacheSizeGovernor->shutdown();
+        LOGV2(5837147, "Finished shutting down cache size governor thread");
+    }
+    if (_sizeStorerFlusher) {
+        LOGV2(5837109, "Shutting down size storer flusher thread");
+        _sizeStorerFlusher->shutdown();
+        LOGV2(5837110, "Finished shutting down size storer flusher thread");
+    }
     if (_sessionSweeper) {
         LOGV2(22318, "Shutting down session sweeper thread");
         _sessionSweeper->shutdown();
@@ -990,6 +1446,14 @@ Status WiredTigerKVEngine::disableIncrementalBackup(OperationContext* opCtx) {
         return wtRCToStatus(wtRet);
     }
 
+    // WiredTiger applies the force_stop side effect when the cursor is closed. Close it explicitly
+    // so a failure is reported rather than being swallowed by the session destructor.
+    wtRet = cursor->close(cursor);
+    if (wtRet != 0) {
+        LOGV2_ERROR(5837148, "Could not close the backup cursor that disables incremental backups");
+        return wtRCToStatus(wtRet);
+    }
+
     return Status::OK();
 }
 
@@ -1732,11 +2196,6 @@ bool WiredTigerKVEngine::haveDropsQueued() const {
     Date_t now = _clockSource->now();
     Milliseconds delta = now - _previousCheckedDropsQueued;
 
-    if (!_readOnly && _sizeStorerSyncTracker.intervalHasElapsed()) {
-        _sizeStorerSyncTracker.resetLastTime();
-        syncSizeInfo(false);
-    }
-
     // We only want to check the queue max once per second or we'll thrash
     if (delta < Milliseconds(1000))
         return false;
@@ -1797,6 +2256,23 @@ bool WiredTigerKVEngine::supportsDirectoryPerDB() const {
     return true;
 }
 
+int64_t WiredTigerKVEngine::getCacheDirtyBytes() const {
+    // Using a side session to avoid transactional issues
+    WiredTigerSession sessionWrapper(_conn);
+    auto result = WiredTigerUtil::getStatisticsValue(sessionWrapper.getSession(),
+                                                     "statistics:",
+                                                     "statistics=(fast)",
+                                                     WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    if (!result.isOK()) {
+        LOGV2_DEBUG(5837130,
+                    2,
+                    "Failed to read dirty cache statistics",
+                    "error"_attr = result.getStatus());
+        return 0;
+    }
+    return result.getValue();
+}
+
 void WiredTigerKVEngine::checkpoint() {
     const Timestamp stableTimestamp = getStableTimestamp();
     const Timestamp initialDataTimestamp = getInitialDataTimestamp();
@@ -1907,6 +2383,11 @@ std::vector<std::string> WiredTigerKVEngine::getAllIdents(OperationContext* opCt
         if (ident == "sizeStorer")
             continue;
 
+        // Sidecar table holding persisted oplog truncation markers; like the size storer it is
+        // not an ident the durable catalog knows about.
+        if (ident == "oplogStones")
+            continue;
+
         all.push_back(ident.toString());
     }
 
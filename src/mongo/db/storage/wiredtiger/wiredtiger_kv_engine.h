@@ -119,6 +119,8 @@ public:
 
     void checkpoint() override;
 
+    int64_t getCacheDirtyBytes() const override;
+
     bool isDurable() const override {
         return _durable;
     }
@@ -307,6 +309,14 @@ public:
 
     void syncSizeInfo(bool sync) const;
 
+    /**
+     * Queues a best-effort request to read the 'numRecords' records following 'startId' in the
+     * table identified by 'uri' into the WiredTiger cache. The reads happen on a dedicated
+     * background session; the hint is dropped if the prefetcher has fallen behind or was never
+     * started (ephemeral engine).
+     */
+    void prefetchRecords(const std::string& uri, const RecordId& startId, int64_t numRecords);
+
     /*
      * The oplog manager is always accessible, but this method will start the background thread to
      * control oplog entry visibility for reads.
@@ -387,6 +397,10 @@ public:
 
 private:
     class WiredTigerSessionSweeper;
+    class WiredTigerSizeStorerFlusher;
+    class WiredTigerTicketAdmissionMonitor;
+    class WiredTigerRecordPrefetcher;
+    class WiredTigerCacheSizeGovernor;
 
     struct IdentToDrop {
         std::string uri;
@@ -481,6 +495,22 @@ private:
 
     std::unique_ptr<WiredTigerSessionSweeper> _sessionSweeper;
 
+    // Periodically writes dirty size-storer entries back to the size storer table so that
+    // operation threads never pay for the flush inline.
+    std::unique_ptr<WiredTigerSizeStorerFlusher> _sizeStorerFlusher;
+
+    // Present only when wiredTigerAdaptiveConcurrentTransactions is enabled at startup.
+    std::unique_ptr<WiredTigerTicketAdmissionMonitor> _ticketAdmissionMonitor;
+
+    // Reads records that collection scans are about to need into the cache on a background
+    // session. Present only on persistent engines.
+    std::unique_ptr<WiredTigerRecordPrefetcher> _recordPrefetcher;
+
+    // Resizes the cache when the process memory limit changes, while
+    // wiredTigerCacheAdaptiveSizing is enabled. Present only when the cache size was derived from
+    // the memory limit at startup rather than configured explicitly.
+    std::unique_ptr<WiredTigerCacheSizeGovernor> _cacheSizeGovernor;
+
     std::string _rsOptions;
     std::string _indexOptions;
 
@@ -33,6 +33,7 @@
 
 #include <cstring>
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/concurrency/lock_state.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
@@ -41,6 +42,7 @@
 #include "mongo/platform/mutex.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -148,7 +150,12 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     // this wait excessively.
     ++_opsWaitingForOplogVisibilityUpdate;
     invariant(_opsWaitingForOplogVisibilityUpdate > 0);
-    auto exitGuard = makeGuard([&] { --_opsWaitingForOplogVisibilityUpdate; });
+    _numWaitsForVisibility.addAndFetch(1);
+    Timer waitTimer;
+    auto exitGuard = makeGuard([&] {
+        --_opsWaitingForOplogVisibilityUpdate;
+        _totalTimeWaitingForVisibilityMicros.addAndFetch(waitTimer.micros());
+    });
 
     // Out of order writes to the oplog always call triggerOplogVisibilityUpdate() on commit to
     // prompt the OplogVisibilityThread to run and update the oplog visibility. We simply need to
@@ -245,6 +252,7 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
                         2,
                         "No new oplog entries became visible.",
                         "aNoHolesOplogTimestamp"_attr = Timestamp(newTimestamp));
+            _numVisibilityUpdatesWithoutAdvance.addAndFetch(1);
             continue;
         }
 
@@ -253,6 +261,9 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
         auto currentVisibleTimestamp = getOplogReadTimestamp();
         if (newTimestamp > currentVisibleTimestamp) {
             _setOplogReadTimestamp(lk, newTimestamp);
+            _numVisibilityUpdates.addAndFetch(1);
+        } else {
+            _numVisibilityUpdatesWithoutAdvance.addAndFetch(1);
         }
         lk.unlock();
 
@@ -269,6 +280,13 @@ std::uint64_t WiredTigerOplogManager::getOplogReadTimestamp() const {
     return _oplogReadTimestamp.load();
 }
 
+void WiredTigerOplogManager::appendVisibilityStats(BSONObjBuilder& bob) const {
+    bob.append("visibilityUpdates", _numVisibilityUpdates.load());
+    bob.append("visibilityUpdatesWithoutAdvance", _numVisibilityUpdatesWithoutAdvance.load());
+    bob.append("visibilityWaits", _numWaitsForVisibility.load());
+    bob.append("totalTimeWaitingForVisibilityMicros", _totalTimeWaitingForVisibilityMicros.load());
+}
+
 void WiredTigerOplogManager::setOplogReadTimestamp(Timestamp ts) {
     stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
     _setOplogReadTimestamp(lk, ts.asULL());
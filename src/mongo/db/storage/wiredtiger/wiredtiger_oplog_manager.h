@@ -37,6 +37,7 @@
 
 namespace mongo {
 
+class BSONObjBuilder;
 class WiredTigerRecordStore;
 class WiredTigerSessionCache;
 
@@ -98,6 +99,12 @@ public:
     std::uint64_t getOplogReadTimestamp() const;
     void setOplogReadTimestamp(Timestamp ts);
 
+    /**
+     * Appends oplog visibility statistics - update round counts and the time operations have
+     * spent waiting for oplog entries to become visible - to 'bob'.
+     */
+    void appendVisibilityStats(BSONObjBuilder& bob) const;
+
 private:
     /**
      * Runs the oplog visibility updates when signaled by triggerOplogVisibilityUpdate() until
@@ -132,5 +139,12 @@ private:
     // Incremented when a caller is waiting for more of the oplog to become visible, to avoid update
     // delays for batching.
     int64_t _opsWaitingForOplogVisibilityUpdate = 0;
+
+    // Statistics reported by appendVisibilityStats(). An update round that found the all_durable
+    // timestamp unchanged (or moved backward) publishes nothing and is counted separately.
+    AtomicWord<long long> _numVisibilityUpdates{0};
+    AtomicWord<long long> _numVisibilityUpdatesWithoutAdvance{0};
+    AtomicWord<long long> _numWaitsForVisibility{0};
+    AtomicWord<long long> _totalTimeWaitingForVisibilityMicros{0};
 };
 }  // namespace mongo
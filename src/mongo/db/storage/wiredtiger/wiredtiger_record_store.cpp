@@ -56,6 +56,7 @@
 #include "mongo/db/stats/resource_consumption_metrics.h"
 #include "mongo/db/storage/oplog_hack.h"
 #include "mongo/db/storage/wiredtiger/oplog_stone_parameters_gen.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor_helpers.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
@@ -189,6 +190,7 @@ public:
         _oplogStones->_currentBytes.store(0);
 
         stdx::lock_guard<Latch> lk(_oplogStones->_mutex);
+        _oplogStones->_totalBytes.store(0);
         _oplogStones->_stones.clear();
     }
 
@@ -272,13 +274,8 @@ void WiredTigerRecordStore::OplogStones::awaitHasExcessStonesOrDead() {
 }
 
 bool WiredTigerRecordStore::OplogStones::hasExcessStones_inlock() const {
-    int64_t totalBytes = 0;
-    for (auto&& stone : _stones) {
-        totalBytes += stone.bytes;
-    }
-
     // check that oplog stones is at capacity
-    if (totalBytes <= _rs->cappedMaxSize()) {
+    if (_totalBytes.load() <= _rs->cappedMaxSize()) {
         return false;
     }
 
@@ -311,6 +308,7 @@ WiredTigerRecordStore::OplogStones::peekOldestStoneIfNeeded() const {
 
 void WiredTigerRecordStore::OplogStones::popOldestStone() {
     stdx::lock_guard<Latch> lk(_mutex);
+    _totalBytes.subtractAndFetch(_stones.front().bytes);
     _stones.pop_front();
 }
 
@@ -352,6 +350,7 @@ void WiredTigerRecordStore::OplogStones::createNewStoneIfNeeded(OperationContext
     }
 
     OplogStones::Stone stone(_currentRecords.swap(0), _currentBytes.swap(0), lastRecord, wallTime);
+    _totalBytes.addAndFetch(stone.bytes);
     _stones.push_back(stone);
 
     LOGV2_DEBUG(22381,
@@ -398,6 +397,7 @@ void WiredTigerRecordStore::OplogStones::updateStonesAfterCappedTruncateAfter(
 
     // Remove the stones corresponding to the records that were deleted.
     int64_t offset = _stones.size() - numStonesToRemove;
+    _totalBytes.subtractAndFetch(bytesInStonesToRemove);
     _stones.erase(_stones.begin() + offset, _stones.end());
 
     // Account for any remaining records from a partially truncated stone in the stone currently
@@ -445,6 +445,14 @@ void WiredTigerRecordStore::OplogStones::_calculateStones(OperationContext* opCt
         return;
     }
 
+    // Stone boundaries persisted at the last clean shutdown can be restored without touching the
+    // oplog itself, as long as they still describe its contents. The persisted state is consumed
+    // by the attempt, so an unclean shutdown or an oplog changed by recovery falls through to the
+    // usual calculation below.
+    if (_tryRestorePersistedStones(opCtx, numRecords, dataSize)) {
+        return;
+    }
+
     // Only use sampling to estimate where to place the oplog stones if the number of samples drawn
     // is less than 5% of the collection.
     const uint64_t kMinSampleRatioForRandCursor = 20;
@@ -487,8 +495,10 @@ void WiredTigerRecordStore::OplogStones::_calculateStonesByScanning(OperationCon
                         "Marking oplog entry as a potential future oplog truncation point",
                         "wall"_attr = wallTime);
 
-            _stones.emplace_back(
-                _currentRecords.swap(0), _currentBytes.swap(0), record->id, wallTime);
+            auto records = _currentRecords.swap(0);
+            auto bytes = _currentBytes.swap(0);
+            _totalBytes.addAndFetch(bytes);
+            _stones.emplace_back(records, bytes, record->id, wallTime);
         }
 
         numRecords++;
@@ -612,6 +622,7 @@ void WiredTigerRecordStore::OplogStones::_calculateStonesBySampling(OperationCon
                     "wall"_attr = wallTime,
                     "ts"_attr = id);
 
+        _totalBytes.addAndFetch(estBytesPerStone);
         _stones.emplace_back(estRecordsPerStone, estBytesPerStone, id, wallTime);
     }
 
@@ -645,6 +656,182 @@ void WiredTigerRecordStore::OplogStones::adjust(int64_t maxSize) {
     _pokeReclaimThreadIfNeeded();
 }
 
+namespace {
+
+// Sidecar table holding the oplog stone boundaries across clean shutdowns. Like the size storer
+// table, it is created with the default key and value formats and is excluded from the idents the
+// durable catalog knows about.
+const char kOplogStonesStorageUri[] = "table:oplogStones";
+const char kOplogStonesStorageKey[] = "oplogStones";
+const int kOplogStonesStorageVersion = 1;
+
+// Reads the id of the newest oplog record through 'session', outside of any transaction. Returns
+// false if the oplog is empty or unreadable.
+bool readTopOfOplog(WT_SESSION* session, const std::string& uri, int64_t* topRecordId) {
+    WT_CURSOR* cursor;
+    if (session->open_cursor(session, uri.c_str(), nullptr, nullptr, &cursor) != 0) {
+        return false;
+    }
+    int ret = cursor->prev(cursor);
+    if (ret == 0) {
+        ret = cursor->get_key(cursor, topRecordId);
+    }
+    cursor->close(cursor);
+    return ret == 0;
+}
+
+}  // namespace
+
+void WiredTigerRecordStore::OplogStones::persistToDisk() {
+    if (!_rs->_kvEngine || _rs->_isEphemeral || _rs->_prefix.isPrefixed() ||
+        storageGlobalParams.readOnly) {
+        return;
+    }
+
+    WiredTigerSession session(_rs->_kvEngine->getConnection());
+    WT_SESSION* s = session.getSession();
+
+    // Record the id of the newest oplog record so that a restart can detect whether the oplog
+    // changed after this state was written. An empty oplog leaves nothing worth persisting.
+    int64_t topRecordId;
+    if (!readTopOfOplog(s, _rs->getURI(), &topRecordId)) {
+        return;
+    }
+
+    BSONObj state;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        BSONObjBuilder bob;
+        bob.append("version", kOplogStonesStorageVersion);
+        bob.append("minBytesPerStone", static_cast<long long>(_minBytesPerStone));
+        bob.append("numRecords", _rs->numRecords(nullptr));
+        bob.append("dataSize", _rs->dataSize(nullptr));
+        bob.append("topRecordId", static_cast<long long>(topRecordId));
+        bob.append("currentRecords", _currentRecords.load());
+        bob.append("currentBytes", _currentBytes.load());
+        bob.append("firstRecord", static_cast<long long>(firstRecord.repr()));
+        {
+            BSONArrayBuilder stonesBuilder(bob.subarrayStart("stones"));
+            for (const auto& stone : _stones) {
+                BSONObjBuilder stoneBuilder(stonesBuilder.subobjStart());
+                stoneBuilder.append("records", static_cast<long long>(stone.records));
+                stoneBuilder.append("bytes", static_cast<long long>(stone.bytes));
+                stoneBuilder.append("lastRecord", static_cast<long long>(stone.lastRecord.repr()));
+                stoneBuilder.appendDate("wall", stone.wallTime);
+            }
+        }
+        state = bob.obj();
+    }
+
+    std::string config = WiredTigerCustomizationHooks::get(getGlobalServiceContext())
+                             ->getTableCreateConfig(kOplogStonesStorageUri);
+    WT_CURSOR* cursor;
+    int ret = s->create(s, kOplogStonesStorageUri, config.c_str());
+    if (ret == 0) {
+        ret = s->open_cursor(s, kOplogStonesStorageUri, nullptr, "overwrite=true", &cursor);
+    }
+    if (ret != 0) {
+        LOGV2_DEBUG(5837152, 1, "Failed to persist the oplog truncation markers at shutdown");
+        return;
+    }
+    WT_ITEM key = {kOplogStonesStorageKey, sizeof(kOplogStonesStorageKey) - 1};
+    WT_ITEM value = {state.objdata(), static_cast<size_t>(state.objsize())};
+    cursor->set_key(cursor, &key);
+    cursor->set_value(cursor, &value);
+    ret = cursor->insert(cursor);
+    cursor->close(cursor);
+    if (ret != 0) {
+        LOGV2_DEBUG(5837152, 1, "Failed to persist the oplog truncation markers at shutdown");
+    }
+}
+
+bool WiredTigerRecordStore::OplogStones::_tryRestorePersistedStones(OperationContext* opCtx,
+                                                                    long long numRecords,
+                                                                    long long dataSize) {
+    if (!_rs->_kvEngine || _rs->_isEphemeral || _rs->_prefix.isPrefixed()) {
+        return false;
+    }
+
+    WiredTigerSession session(_rs->_kvEngine->getConnection());
+    WT_SESSION* s = session.getSession();
+
+    WT_CURSOR* cursor;
+    if (s->open_cursor(s, kOplogStonesStorageUri, nullptr, nullptr, &cursor) != 0) {
+        // The table only exists if a previous clean shutdown persisted the stone boundaries.
+        return false;
+    }
+    ON_BLOCK_EXIT([&] { cursor->close(cursor); });
+
+    WT_ITEM key = {kOplogStonesStorageKey, sizeof(kOplogStonesStorageKey) - 1};
+    cursor->set_key(cursor, &key);
+    if (cursor->search(cursor) != 0) {
+        return false;
+    }
+    WT_ITEM value;
+    if (cursor->get_value(cursor, &value) != 0) {
+        return false;
+    }
+    BSONObj state = BSONObj(static_cast<const char*>(value.data)).getOwned();
+
+    // Consume the persisted state immediately. Once this startup begins accepting writes the
+    // boundaries go stale, and a later unclean shutdown must not be able to reuse them.
+    if (!storageGlobalParams.readOnly) {
+        cursor->remove(cursor);
+    }
+
+    auto discard = [](StringData reason) {
+        LOGV2(5837153,
+              "Discarding the oplog truncation markers persisted at the last clean shutdown",
+              "reason"_attr = reason);
+        return false;
+    };
+
+    if (state["version"].numberInt() != kOplogStonesStorageVersion) {
+        return discard("unexpected version");
+    }
+    if (state["minBytesPerStone"].numberLong() != _minBytesPerStone) {
+        return discard("the stone size has changed");
+    }
+    if (state["numRecords"].numberLong() != numRecords ||
+        state["dataSize"].numberLong() != dataSize) {
+        return discard("the oplog record counts have changed");
+    }
+    if (state["stones"].type() != Array) {
+        return discard("malformed state");
+    }
+
+    int64_t topRecordId;
+    if (!readTopOfOplog(s, _rs->getURI(), &topRecordId)) {
+        return discard("could not read the newest oplog record");
+    }
+    if (state["topRecordId"].numberLong() != topRecordId) {
+        return discard("the oplog contents have changed");
+    }
+
+    // The caller holds '_mutex'; the members can be filled in directly.
+    for (auto&& elem : state["stones"].Obj()) {
+        if (elem.type() != Object) {
+            _stones.clear();
+            _totalBytes.store(0);
+            return discard("malformed state");
+        }
+        BSONObj stone = elem.Obj();
+        _stones.emplace_back(stone["records"].numberLong(),
+                             stone["bytes"].numberLong(),
+                             RecordId(stone["lastRecord"].numberLong()),
+                             stone["wall"].Date());
+        _totalBytes.addAndFetch(stone["bytes"].numberLong());
+    }
+    _currentRecords.store(state["currentRecords"].numberLong());
+    _currentBytes.store(state["currentBytes"].numberLong());
+    firstRecord = RecordId(state["firstRecord"].numberLong());
+
+    LOGV2(5837151,
+          "Restored the oplog truncation markers persisted at the last clean shutdown",
+          "numStones"_attr = _stones.size());
+    return true;
+}
+
 StatusWith<std::string> WiredTigerRecordStore::parseOptionsField(const BSONObj options) {
     StringBuilder ss;
     BSONForEach(elem, options) {
@@ -907,6 +1094,10 @@ WiredTigerRecordStore::~WiredTigerRecordStore() {
     }
 
     if (_oplogStones) {
+        // Save the stone boundaries so the next startup can skip recalculating them. If this
+        // destruction is not part of a clean shutdown, the persisted state fails validation at
+        // restore time and is discarded.
+        _oplogStones->persistToDisk();
         _oplogStones->kill();
     }
 
@@ -1540,21 +1731,32 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
 
     Record highestIdRecord;
     invariant(nRecords != 0);
-    for (size_t i = 0; i < nRecords; i++) {
-        auto& record = records[i];
-        if (_isOplog) {
+
+    if (_isOplog) {
+        for (size_t i = 0; i < nRecords; i++) {
+            auto& record = records[i];
             StatusWith<RecordId> status =
                 oploghack::extractKey(record.data.data(), record.data.size());
             if (!status.isOK())
                 return status.getStatus();
             record.id = status.getValue();
-        } else {
-            record.id = _nextId(opCtx);
+            dassert(record.id > highestIdRecord.id);
+            highestIdRecord = record;
+        }
+    } else {
+        // Reserve the whole RecordId block with one atomic increment so large batches do not
+        // serialize on _nextIdNum. The resulting keys are contiguous and monotonically increasing,
+        // which keeps the inserts below appending to the right-hand edge of the tree.
+        int64_t firstId = _nextId(opCtx, nRecords).repr();
+        for (size_t i = 0; i < nRecords; i++) {
+            auto& record = records[i];
+            record.id = RecordId(firstId + static_cast<int64_t>(i));
+            dassert(record.id > highestIdRecord.id);
+            highestIdRecord = record;
         }
-        dassert(record.id > highestIdRecord.id);
-        highestIdRecord = record;
     }
 
+    Timestamp lastAppliedTimestamp;
     for (size_t i = 0; i < nRecords; i++) {
         auto& record = records[i];
         Timestamp ts;
@@ -1570,9 +1772,12 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
         } else {
             ts = timestamps[i];
         }
-        if (!ts.isNull()) {
+        if (!ts.isNull() && ts != lastAppliedTimestamp) {
+            // Batched inserts usually share a single commit timestamp; only touch the recovery
+            // unit when the timestamp actually changes.
             LOGV2_DEBUG(22403, 4, "inserting record with timestamp {ts}", "ts"_attr = ts);
             fassert(39001, opCtx->recoveryUnit()->setTimestamp(ts));
+            lastAppliedTimestamp = ts;
         }
         setKey(c, record.id);
         WiredTigerItem value(record.data.data(), record.data.size());
@@ -1807,8 +2012,14 @@ StatusWith<RecordData> WiredTigerRecordStore::updateWithDamages(
 }
 
 std::unique_ptr<RecordCursor> WiredTigerRecordStore::getRandomCursor(
-    OperationContext* opCtx) const {
-    const char* extraConfig = "";
+    OperationContext* opCtx, int64_t sampleSizeHint) const {
+    std::string extraConfig = "";
+    if (sampleSizeHint > 0) {
+        // Inform the random cursor of the number of samples the caller intends to take. This
+        // allows it to account for skew in the tree shape and to spread successive samples more
+        // evenly across the table.
+        extraConfig = str::stream() << "next_random_sample_size=" << sampleSizeHint;
+    }
     return getRandomCursorWithOptions(opCtx, extraConfig);
 }
 
@@ -1841,7 +2052,9 @@ Status WiredTigerRecordStore::compact(OperationContext* opCtx) {
     if (!cache->isEphemeral()) {
         WT_SESSION* s = WiredTigerRecoveryUnit::get(opCtx)->getSession()->getSession();
         opCtx->recoveryUnit()->abandonSnapshot();
-        int ret = s->compact(s, getURI().c_str(), "timeout=0");
+        const std::string config =
+            str::stream() << "timeout=" << gWiredTigerCompactTimeLimitSeconds.load();
+        int ret = s->compact(s, getURI().c_str(), config.c_str());
         if (MONGO_unlikely(WTCompactRecordStoreEBUSY.shouldFail())) {
             ret = EBUSY;
         }
@@ -1851,6 +2064,14 @@ Status WiredTigerRecordStore::compact(OperationContext* opCtx) {
                           str::stream() << "Compaction interrupted on " << getURI().c_str()
                                         << " due to cache eviction pressure");
         }
+        if (ret == ETIMEDOUT) {
+            // A bounded pass reached wiredTigerCompactTimeLimitSeconds. The space reclaimed so far
+            // is kept; a later compact call picks up where this pass stopped.
+            LOGV2(5837149,
+                  "Compaction pass on the record store reached its time limit",
+                  "uri"_attr = getURI());
+            ret = 0;
+        }
         invariantWTOK(ret);
     }
     return Status::OK();
@@ -2033,10 +2254,11 @@ void WiredTigerRecordStore::_initNextIdIfNeeded(OperationContext* opCtx) {
     _nextIdNum.store(nextId);
 }
 
-RecordId WiredTigerRecordStore::_nextId(OperationContext* opCtx) {
+RecordId WiredTigerRecordStore::_nextId(OperationContext* opCtx, size_t nIds) {
     invariant(!_isOplog);
+    invariant(nIds > 0);
     _initNextIdIfNeeded(opCtx);
-    RecordId out = RecordId(_nextIdNum.fetchAndAdd(1));
+    RecordId out = RecordId(_nextIdNum.fetchAndAdd(nIds));
     invariant(out.isNormal());
     return out;
 }
@@ -2072,7 +2294,9 @@ void WiredTigerRecordStore::_changeNumRecords(OperationContext* opCtx, int64_t d
     }
 
     opCtx->recoveryUnit()->registerChange(std::make_unique<NumRecordsChange>(this, diff));
-    if (_sizeInfo->numRecords.fetchAndAdd(diff) < 0)
+    // The counters are approximate by design; relaxed ordering avoids paying for a fence on every
+    // document write.
+    if (_sizeInfo->numRecords.fetchAndAddRelaxed(diff) < 0)
         _sizeInfo->numRecords.store(std::max(diff, int64_t(0)));
 }
 
@@ -2101,7 +2325,7 @@ void WiredTigerRecordStore::_increaseDataSize(OperationContext* opCtx, int64_t a
     if (opCtx)
         opCtx->recoveryUnit()->registerChange(std::make_unique<DataSizeChange>(this, amount));
 
-    if (_sizeInfo->dataSize.fetchAndAdd(amount) < 0)
+    if (_sizeInfo->dataSize.fetchAndAddRelaxed(amount) < 0)
         _sizeInfo->dataSize.store(std::max(amount, int64_t(0)));
 
     if (_sizeStorer)
@@ -2134,6 +2358,15 @@ void WiredTigerRecordStore::setDataSize(long long dataSize) {
     _sizeStorer->flush(syncToDisk);
 }
 
+void WiredTigerRecordStore::prefetchRecords(const RecordId& startId, int64_t numRecords) const {
+    // Unit-test harnesses construct record stores without a KV engine; there is nothing to warm
+    // there anyway.
+    if (!_kvEngine) {
+        return;
+    }
+    _kvEngine->prefetchRecords(_uri, startId, numRecords);
+}
+
 void WiredTigerRecordStore::cappedTruncateAfter(OperationContext* opCtx,
                                                 RecordId end,
                                                 bool inclusive) {
@@ -2393,9 +2626,16 @@ bool WiredTigerRecordStoreCursorBase::restore() {
     _skipNextAdvance = false;
     _hasRestored = true;
 
-    // If we've hit EOF, then this iterator is done and need not be restored.
-    if (_eof)
-        return true;
+    // If we've hit EOF, then this iterator is done and need not be restored, unless the caller
+    // asked to resume after EOF and there is a last returned record to re-position behind. In
+    // that case fall through to the seek below so that records committed after the save become
+    // visible.
+    if (_eof) {
+        if (!_resumeAfterEof || _lastReturnedId.isNull()) {
+            return true;
+        }
+        _eof = false;
+    }
 
     if (_lastReturnedId.isNull()) {
         initCursorToBeginning();
@@ -2492,6 +2732,15 @@ WiredTigerRecordStoreStandardCursor::WiredTigerRecordStoreStandardCursor(
     OperationContext* opCtx, const WiredTigerRecordStore& rs, bool forward)
     : WiredTigerRecordStoreCursorBase(opCtx, rs, forward) {}
 
+void WiredTigerRecordStoreStandardCursor::prefetch(int64_t numRecords) {
+    // The background reader only walks forward, and before the first record has been returned
+    // there is no position to read ahead from.
+    if (!_forward || _eof || _lastReturnedId.isNull()) {
+        return;
+    }
+    _rs.prefetchRecords(_lastReturnedId, numRecords);
+}
+
 void WiredTigerRecordStoreStandardCursor::setKey(WT_CURSOR* cursor, RecordId id) const {
     cursor->set_key(cursor, id.repr());
 }
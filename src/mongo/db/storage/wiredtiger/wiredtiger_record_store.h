@@ -165,7 +165,8 @@ public:
     virtual std::unique_ptr<SeekableRecordCursor> getCursor(OperationContext* opCtx,
                                                             bool forward) const = 0;
 
-    std::unique_ptr<RecordCursor> getRandomCursor(OperationContext* opCtx) const final;
+    std::unique_ptr<RecordCursor> getRandomCursor(OperationContext* opCtx,
+                                                  int64_t sampleSizeHint = 0) const final;
 
     virtual std::unique_ptr<RecordCursor> getRandomCursorWithOptions(
         OperationContext* opCtx, StringData extraConfig) const = 0;
@@ -225,6 +226,13 @@ public:
         return _uri;
     }
 
+    /**
+     * Queues a best-effort request with the KV engine to read the 'numRecords' records following
+     * 'startId' into the WiredTiger cache on a background session. The hint may be dropped if the
+     * prefetcher is backed up or was never started.
+     */
+    void prefetchRecords(const RecordId& startId, int64_t numRecords) const;
+
     uint64_t tableId() const {
         return _tableId;
     }
@@ -297,7 +305,12 @@ private:
                           const Timestamp* timestamps,
                           size_t nRecords);
 
-    RecordId _nextId(OperationContext* opCtx);
+    /**
+     * Reserves a contiguous block of 'nIds' RecordIds and returns the first one. Batched inserts
+     * reserve their whole block up front so a large batch performs a single atomic increment and
+     * writes monotonically increasing keys, keeping WiredTiger appending to the same leaf page.
+     */
+    RecordId _nextId(OperationContext* opCtx, size_t nIds);
     bool cappedAndNeedDelete() const;
     RecordData _getData(const WiredTigerCursor& cursor) const;
 
@@ -450,6 +463,11 @@ public:
 
     boost::optional<Record> seekExact(const RecordId& id);
 
+    bool enableResumeAfterEof() final {
+        _resumeAfterEof = true;
+        return true;
+    }
+
     void save();
 
     void saveUnpositioned();
@@ -485,6 +503,9 @@ protected:
     bool _skipNextAdvance = false;
     boost::optional<WiredTigerCursor> _cursor;
     bool _eof = false;
+    // When set, restore() repositions a cursor that hit EOF after _lastReturnedId rather than
+    // leaving it at EOF. See RecordCursor::enableResumeAfterEof().
+    bool _resumeAfterEof = false;
     RecordId _lastReturnedId;  // If null, need to seek to first/last record.
     bool _hasRestored = true;
 
@@ -505,6 +526,8 @@ public:
                                         const WiredTigerRecordStore& rs,
                                         bool forward = true);
 
+    void prefetch(int64_t numRecords) override;
+
 protected:
     virtual RecordId getKey(WT_CURSOR* cursor) const override;
 
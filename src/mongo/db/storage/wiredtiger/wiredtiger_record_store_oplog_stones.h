@@ -94,6 +94,12 @@ public:
     // Resize oplog size
     void adjust(int64_t maxSize);
 
+    // Persists the current stone boundaries in a sidecar table so that the next startup can
+    // restore them without scanning or sampling the oplog. Called when the record store is
+    // destroyed on clean shutdown; any failure is non-fatal and simply means the next startup
+    // recalculates the stones.
+    void persistToDisk();
+
     // The start point of where to truncate next. Used by the background reclaim thread to
     // efficiently truncate records with WiredTiger by skipping over tombstones, etc.
     RecordId firstRecord;
@@ -122,6 +128,15 @@ private:
     class TruncateChange;
 
     void _calculateStones(OperationContext* opCtx, size_t size);
+
+    // Attempts to restore stone boundaries persisted by persistToDisk() on the last clean
+    // shutdown. The persisted state is consumed by this call and is only used when it still
+    // matches the oplog's contents; returns false when the stones must instead be recalculated
+    // by scanning or sampling.
+    bool _tryRestorePersistedStones(OperationContext* opCtx,
+                                    long long numRecords,
+                                    long long dataSize);
+
     void _calculateStonesByScanning(OperationContext* opCtx);
     void _calculateStonesBySampling(OperationContext* opCtx,
                                     int64_t estRecordsPerStone,
@@ -146,6 +161,10 @@ private:
 
     AtomicWord<long long> _currentRecords;     // Number of records in the stone being filled.
     AtomicWord<long long> _currentBytes;       // Number of bytes in the stone being filled.
+    AtomicWord<long long> _totalBytes;         // Total bytes in all whole stones. Kept in sync with
+                                               // '_stones' so the excess-stones check is O(1)
+                                               // instead of summing the deque on every insert
+                                               // commit and reclaim pass.
     AtomicWord<int64_t> _totalTimeProcessing;  // Amount of time spent scanning and/or sampling the
                                                // oplog during start up, if any.
     AtomicWord<bool> _processBySampling;       // Whether the oplog was sampled or scanned.
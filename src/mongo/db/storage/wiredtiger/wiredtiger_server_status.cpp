@@ -37,6 +37,8 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
+#include "mongo/db/storage/checkpointer.h"
+#include "mongo/db/storage/control/journal_flusher.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
@@ -94,8 +96,15 @@ BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
         BSONObjBuilder subsection(bob.subobjStart("oplog"));
         subsection.append("visibility timestamp",
                           Timestamp(_engine->getOplogManager()->getOplogReadTimestamp()));
+        _engine->getOplogManager()->appendVisibilityStats(subsection);
     }
 
+    if (auto checkpointer = Checkpointer::get(opCtx)) {
+        checkpointer->appendStats(bob);
+    }
+
+    JournalFlusher::get(opCtx)->appendStats(bob);
+
     return bob.obj();
 }
 
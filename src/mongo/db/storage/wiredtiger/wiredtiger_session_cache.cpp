@@ -33,6 +33,8 @@
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 
 #include "mongo/base/error_codes.h"
@@ -112,16 +114,25 @@ void _openCursor(WT_SESSION* session,
 }  // namespace
 
 WT_CURSOR* WiredTigerSession::getCachedCursor(const std::string& uri, uint64_t id) {
-    // Find the most recently used cursor
-    for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
-        if (i->_id == id) {
-            WT_CURSOR* c = i->_cursor;
-            _cursors.erase(i);
-            _cursorsOut++;
-            return c;
-        }
+    // Any cached cursor for this table id will do; take one with a single hash probe rather than
+    // walking the list.
+    auto it = _cursorIndex.find(id);
+    if (it == _cursorIndex.end()) {
+        return nullptr;
+    }
+
+    auto& entries = it->second;
+    invariant(!entries.empty());
+    CursorCache::iterator pos = entries.back();
+    entries.pop_back();
+    if (entries.empty()) {
+        _cursorIndex.erase(it);
     }
-    return nullptr;
+
+    WT_CURSOR* c = pos->_cursor;
+    _cursors.erase(pos);
+    _cursorsOut++;
+    return c;
 }
 
 WT_CURSOR* WiredTigerSession::getNewCursor(const std::string& uri, const char* config) {
@@ -140,17 +151,38 @@ void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
 
     // Cursors are pushed to the front of the list and removed from the back
     _cursors.push_front(WiredTigerCachedCursor(id, _cursorGen++, cursor));
+    _cursorIndex[id].push_back(_cursors.begin());
 
     // A negative value for wiredTigercursorCacheSize means to use hybrid caching.
     std::uint32_t cacheSize = abs(gWiredTigerCursorCacheSize.load());
 
     while (!_cursors.empty() && _cursorGen - _cursors.back()._gen > cacheSize) {
         cursor = _cursors.back()._cursor;
+        _dropFromCursorIndex(std::prev(_cursors.end()));
         _cursors.pop_back();
         invariantWTOK(cursor->close(cursor));
     }
 }
 
+void WiredTigerSession::_dropFromCursorIndex(CursorCache::iterator pos) {
+    auto it = _cursorIndex.find(pos->_id);
+    invariant(it != _cursorIndex.end());
+    auto& entries = it->second;
+    auto entry = std::find(entries.begin(), entries.end(), pos);
+    invariant(entry != entries.end());
+    entries.erase(entry);
+    if (entries.empty()) {
+        _cursorIndex.erase(it);
+    }
+}
+
+void WiredTigerSession::_rebuildCursorIndex() {
+    _cursorIndex.clear();
+    for (auto i = _cursors.begin(); i != _cursors.end(); ++i) {
+        _cursorIndex[i->_id].push_back(i);
+    }
+}
+
 void WiredTigerSession::closeCursor(WT_CURSOR* cursor) {
     invariant(_session);
     invariant(cursor);
@@ -167,6 +199,7 @@ void WiredTigerSession::closeAllCursors(const std::string& uri) {
         WT_CURSOR* cursor = i->_cursor;
         if (cursor && (all || uri == cursor->uri)) {
             invariantWTOK(cursor->close(cursor));
+            _dropFromCursorIndex(i);
             i = _cursors.erase(i);
         } else
             ++i;
@@ -179,6 +212,11 @@ void WiredTigerSession::closeCursorsForQueuedDrops(WiredTigerKVEngine* engine) {
     _cursorEpoch = _cache->getCursorEpoch();
     auto toDrop = engine->filterCursorsWithQueuedDrops(&_cursors);
 
+    // The engine erased entries from '_cursors' directly; recompute the id index.
+    if (!toDrop.empty()) {
+        _rebuildCursorIndex();
+    }
+
     for (auto i = toDrop.begin(); i != toDrop.end(); i++) {
         WT_CURSOR* cursor = i->_cursor;
         if (cursor) {
@@ -374,9 +412,11 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 
 
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        for (auto session : partition.sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
@@ -384,15 +424,21 @@ void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        for (auto session : partition.sessions) {
+            session->closeCursorsForQueuedDrops(_engine);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        count += partition.sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -404,14 +450,14 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = partition.sessions.begin(); it != partition.sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = partition.sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
@@ -427,13 +473,17 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
+    // Increment the epoch as we are now closing all sessions with this epoch. The epoch must be
+    // bumped before draining any partition: releaseSession() rechecks the epoch under its
+    // partition's lock, so a session from the old epoch either makes it into a partition before we
+    // drain it or is deleted by releaseSession() itself.
+    _epoch.fetchAndAdd(1);
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+    SessionCache swap;
+    for (auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        swap.insert(swap.end(), partition.sessions.begin(), partition.sessions.end());
+        partition.sessions.clear();
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -445,22 +495,50 @@ bool WiredTigerSessionCache::isEphemeral() {
     return _engine && _engine->isEphemeral();
 }
 
+WiredTigerSessionCache::SessionCachePartition& WiredTigerSessionCache::_getHomePartition() {
+    // Hash the thread id so that threads spread across the partitions and, absent stealing, a
+    // thread keeps checking the same sessions in and out.
+    static thread_local const size_t partitionIndex =
+        std::hash<stdx::thread::id>{}(stdx::this_thread::get_id()) % kSessionCachePartitions;
+    return _partitions[partitionIndex];
+}
+
 UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // We should never be able to get here after _shuttingDown is set, because no new
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
-            // Get the most recently used session so that if we discard sessions, we're
-            // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
-            // Reset the idle time
-            cachedSession->setIdleExpireTime(Date_t::min());
-            return UniqueWiredTigerSession(cachedSession);
+    auto popFromPartition = [](SessionCachePartition& partition) -> WiredTigerSession* {
+        stdx::lock_guard<Latch> lock(partition.lock);
+        if (partition.sessions.empty()) {
+            return nullptr;
         }
+        // Get the most recently used session so that if we discard sessions, we're
+        // discarding older ones
+        WiredTigerSession* cachedSession = partition.sessions.back();
+        partition.sessions.pop_back();
+        return cachedSession;
+    };
+
+    auto& home = _getHomePartition();
+    WiredTigerSession* cachedSession = popFromPartition(home);
+
+    // If the home partition is empty, steal from the others before paying for a new WT session.
+    if (!cachedSession) {
+        for (auto& partition : _partitions) {
+            if (&partition == &home) {
+                continue;
+            }
+            if ((cachedSession = popFromPartition(partition))) {
+                break;
+            }
+        }
+    }
+
+    if (cachedSession) {
+        // Reset the idle time
+        cachedSession->setIdleExpireTime(Date_t::min());
+        return UniqueWiredTigerSession(cachedSession);
     }
 
     // Outside of the cache partition lock, but on release will be put back on the cache
@@ -518,10 +596,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        auto& partition = _getHomePartition();
+        stdx::lock_guard<Latch> lock(partition.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            partition.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
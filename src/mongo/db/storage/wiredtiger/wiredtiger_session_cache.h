@@ -29,8 +29,10 @@
 
 #pragma once
 
+#include <array>
 #include <list>
 #include <string>
+#include <vector>
 
 #include <wiredtiger.h>
 
@@ -38,7 +40,9 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_snapshot_manager.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/spin_lock.h"
+#include "mongo/util/with_alignment.h"
 
 namespace mongo {
 
@@ -182,6 +186,18 @@ private:
     // The cursor cache is a list of pairs that contain an ID and cursor
     typedef std::list<WiredTigerCachedCursor> CursorCache;
 
+    /**
+     * Removes the index entry pointing at the given cached cursor. Must be called before erasing
+     * the cursor from '_cursors'.
+     */
+    void _dropFromCursorIndex(CursorCache::iterator pos);
+
+    /**
+     * Rebuilds '_cursorIndex' from '_cursors'. Used after code outside this class has erased
+     * entries from the list directly.
+     */
+    void _rebuildCursorIndex();
+
     // Used internally by WiredTigerSessionCache
     uint64_t _getEpoch() const {
         return _epoch;
@@ -197,6 +213,13 @@ private:
     WiredTigerSessionCache* _cache;  // not owned
     WT_SESSION* _session;            // owned
     CursorCache _cursors;            // owned
+
+    // Maps table ids to the cached cursors for that table, so that the hot-path lookup in
+    // getCachedCursor() is a hash probe instead of a linear walk of '_cursors'. The list remains
+    // the owner and keeps the generation order used for eviction; list iterators stay valid until
+    // the entry is erased, at which point it is removed from this index too.
+    stdx::unordered_map<uint64_t, std::vector<CursorCache::iterator>> _cursorIndex;
+
     uint64_t _cursorGen;
     int _cursorsOut;
     bool _dropQueuedIdentsAtSessionEnd = true;
@@ -376,9 +399,24 @@ private:
     AtomicWord<unsigned> _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // The cache of released sessions is sharded into partitions, each protected by its own latch,
+    // so that concurrent getSession/releaseSession pairs on large machines do not all serialize
+    // through a single mutex. Threads hash to a home partition; getSession() steals from the other
+    // partitions when its home partition is empty.
+    struct SessionCachePartition {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::SessionCachePartition::lock");
+        SessionCache sessions;
+    };
+    static constexpr size_t kSessionCachePartitions = 8;
+
+    /**
+     * Returns the partition that the calling thread checks sessions in and out of.
+     */
+    SessionCachePartition& _getHomePartition();
+
+    std::array<CacheAligned<SessionCachePartition>, kSessionCachePartitions> _partitions;
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
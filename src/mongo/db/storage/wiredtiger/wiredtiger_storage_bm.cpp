@@ -0,0 +1,63 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/storage/storage_bm.h"
+
+#include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
+#include "mongo/util/clock_source_mock.h"
+
+namespace mongo {
+namespace {
+
+// Deliberately small so the larger benchmark datasets overflow the cache and the suite measures
+// eviction and read-back, not just in-cache operations.
+const size_t kCacheSizeMB = 64;
+
+}  // namespace
+
+std::unique_ptr<KVEngine> makeKVEngineForStorageBm(const std::string& dbpath) {
+    // The engine keeps a pointer to the clock source, and the fixture never tears the engine
+    // down, so the clock is leaked alongside it.
+    auto* clockSource = new ClockSourceMock();
+    return std::make_unique<WiredTigerKVEngine>(kWiredTigerEngineName,
+                                                dbpath,
+                                                clockSource,
+                                                "",
+                                                kCacheSizeMB,
+                                                0,
+                                                false /*durable*/,
+                                                false /*ephemeral*/,
+                                                false /*repair*/,
+                                                false /*readOnly*/);
+}
+
+}  // namespace mongo
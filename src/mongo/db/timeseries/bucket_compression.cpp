@@ -0,0 +1,167 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/timeseries/bucket_compression.h"
+
+#include <zlib.h>
+
+#include "mongo/base/data_view.h"
+#include "mongo/bson/bson_validate.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/util/builder.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+namespace timeseries {
+namespace {
+
+constexpr StringData kBucketControlFieldName = "control"_sd;
+constexpr StringData kBucketControlVersionFieldName = "version"_sd;
+constexpr StringData kBucketDataFieldName = "data"_sd;
+
+/**
+ * Returns a copy of 'bucketDoc' with control.version set to 'version' and the 'data' field
+ * replaced by whatever 'appendData' appends to the builder. All other fields are preserved.
+ */
+template <typename AppendData>
+BSONObj _rewriteBucket(const BSONObj& bucketDoc, int version, const AppendData& appendData) {
+    BSONObjBuilder builder;
+    for (auto&& elem : bucketDoc) {
+        auto fieldName = elem.fieldNameStringData();
+        if (fieldName == kBucketControlFieldName) {
+            BSONObjBuilder control(builder.subobjStart(kBucketControlFieldName));
+            control.append(kBucketControlVersionFieldName, version);
+            for (auto&& controlElem : elem.Obj()) {
+                if (controlElem.fieldNameStringData() != kBucketControlVersionFieldName) {
+                    control.append(controlElem);
+                }
+            }
+        } else if (fieldName == kBucketDataFieldName) {
+            appendData(&builder);
+        } else {
+            builder.append(elem);
+        }
+    }
+    return builder.obj();
+}
+
+int _controlVersion(const BSONObj& bucketDoc) {
+    return bucketDoc[kBucketControlFieldName][kBucketControlVersionFieldName].numberInt();
+}
+
+}  // namespace
+
+StatusWith<BSONObj> compressBucket(const BSONObj& bucketDoc) {
+    if (_controlVersion(bucketDoc) != kTimeseriesControlUncompressedVersion) {
+        return Status(ErrorCodes::BadValue,
+                      "Can only compress time-series buckets with control.version 1");
+    }
+
+    auto dataElem = bucketDoc[kBucketDataFieldName];
+    if (dataElem.type() != BSONType::Object) {
+        return Status(ErrorCodes::BadValue,
+                      "Time-series bucket is missing the 'data' object to compress");
+    }
+    const BSONObj dataObj = dataElem.Obj();
+
+    // The payload is the uncompressed size as a little-endian int32 followed by the deflated
+    // bytes of the column-oriented data region.
+    uLongf compressedSize = compressBound(dataObj.objsize());
+    BufBuilder payload(sizeof(int32_t) + compressedSize);
+    payload.appendNum(static_cast<int>(dataObj.objsize()));
+    auto ret = ::compress2(reinterpret_cast<Bytef*>(payload.skip(compressedSize)),
+                           &compressedSize,
+                           reinterpret_cast<const Bytef*>(dataObj.objdata()),
+                           dataObj.objsize(),
+                           Z_DEFAULT_COMPRESSION);
+    if (ret != Z_OK) {
+        return Status(ErrorCodes::InternalError,
+                      str::stream() << "Failed to compress time-series bucket data: zlib error "
+                                    << ret);
+    }
+    payload.setlen(sizeof(int32_t) + compressedSize);
+
+    return _rewriteBucket(
+        bucketDoc, kTimeseriesControlCompressedVersion, [&payload](BSONObjBuilder* builder) {
+            builder->appendBinData(
+                kBucketDataFieldName, payload.len(), BinDataGeneral, payload.buf());
+        });
+}
+
+StatusWith<BSONObj> decompressBucket(const BSONObj& bucketDoc) {
+    if (_controlVersion(bucketDoc) != kTimeseriesControlCompressedVersion) {
+        return Status(ErrorCodes::BadValue,
+                      "Can only decompress time-series buckets with control.version 2");
+    }
+
+    auto dataElem = bucketDoc[kBucketDataFieldName];
+    if (dataElem.type() != BSONType::BinData) {
+        return Status(ErrorCodes::BadValue,
+                      "Compressed time-series bucket is missing the 'data' BinData payload");
+    }
+
+    int payloadLen = 0;
+    const char* payload = dataElem.binData(payloadLen);
+    if (payloadLen < static_cast<int>(sizeof(int32_t))) {
+        return Status(ErrorCodes::BadValue, "Compressed time-series bucket payload is truncated");
+    }
+
+    uLongf uncompressedSize = ConstDataView(payload).read<LittleEndian<int32_t>>();
+    if (uncompressedSize < BSONObj::kMinBSONLength ||
+        uncompressedSize > static_cast<uLongf>(BSONObjMaxInternalSize)) {
+        return Status(ErrorCodes::BadValue,
+                      "Compressed time-series bucket has an invalid uncompressed size");
+    }
+
+    BufBuilder uncompressed(uncompressedSize);
+    auto ret = ::uncompress(reinterpret_cast<Bytef*>(uncompressed.skip(uncompressedSize)),
+                            &uncompressedSize,
+                            reinterpret_cast<const Bytef*>(payload + sizeof(int32_t)),
+                            payloadLen - sizeof(int32_t));
+    if (ret != Z_OK || uncompressedSize != static_cast<uLongf>(uncompressed.len())) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "Failed to decompress time-series bucket data: zlib error "
+                                    << ret);
+    }
+
+    if (auto status = validateBSON(uncompressed.buf(), uncompressed.len()); !status.isOK()) {
+        return status.withContext("Decompressed time-series bucket data is not valid BSON");
+    }
+    BSONObj dataObj(uncompressed.buf());
+
+    return _rewriteBucket(
+        bucketDoc, kTimeseriesControlUncompressedVersion, [&dataObj](BSONObjBuilder* builder) {
+            builder->append(kBucketDataFieldName, dataObj);
+        });
+}
+
+}  // namespace timeseries
+}  // namespace mongo
@@ -0,0 +1,63 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/base/status_with.h"
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+namespace timeseries {
+
+// control.version of uncompressed buckets as written by the insert path.
+constexpr int kTimeseriesControlUncompressedVersion = 1;
+
+// control.version of buckets whose data region has been compressed by compressBucket().
+constexpr int kTimeseriesControlCompressedVersion = 2;
+
+/**
+ * Returns a copy of the given version 1 bucket document with its column-oriented 'data' region
+ * replaced by a single BinData field holding the zlib-compressed BSON of that region, and with
+ * control.version set to 2. The measurements of a bucket column compress well together since
+ * values of the same field tend to be of the same type and close in value.
+ *
+ * All other top-level fields (_id, control.min/max, meta) are preserved unchanged so that
+ * bucket-level predicates keep working on compressed buckets.
+ */
+StatusWith<BSONObj> compressBucket(const BSONObj& bucketDoc);
+
+/**
+ * The inverse of compressBucket(). Returns a version 1 bucket document with the uncompressed
+ * 'data' region. Fails if the given document is not a version 2 bucket or if the compressed
+ * payload is corrupt.
+ */
+StatusWith<BSONObj> decompressBucket(const BSONObj& bucketDoc);
+
+}  // namespace timeseries
+}  // namespace mongo
@@ -0,0 +1,89 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/timeseries/bucket_compression.h"
+
+#include "mongo/bson/oid.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+BSONObj makeBucketDoc() {
+    return BSON("_id" << OID::gen() << "control"
+                      << BSON("version" << timeseries::kTimeseriesControlUncompressedVersion
+                                        << "min" << BSON("time" << Date_t() << "a" << 1) << "max"
+                                        << BSON("time" << Date_t() << "a" << 3))
+                      << "meta"
+                      << "sensor1"
+                      << "data"
+                      << BSON("time" << BSON("0" << Date_t() << "1" << Date_t() << "2" << Date_t())
+                                     << "a" << BSON("0" << 1 << "1" << 2 << "2" << 3)));
+}
+
+TEST(TimeseriesBucketCompression, RoundTrip) {
+    auto bucketDoc = makeBucketDoc();
+
+    auto compressed = timeseries::compressBucket(bucketDoc);
+    ASSERT_OK(compressed.getStatus());
+    ASSERT_EQ(compressed.getValue()["control"]["version"].numberInt(),
+              timeseries::kTimeseriesControlCompressedVersion);
+    ASSERT_EQ(compressed.getValue()["data"].type(), BSONType::BinData);
+    // Everything but control.version and data is preserved.
+    ASSERT_BSONELT_EQ(compressed.getValue()["_id"], bucketDoc["_id"]);
+    ASSERT_BSONELT_EQ(compressed.getValue()["meta"], bucketDoc["meta"]);
+    ASSERT_BSONELT_EQ(compressed.getValue()["control"]["min"], bucketDoc["control"]["min"]);
+
+    auto decompressed = timeseries::decompressBucket(compressed.getValue());
+    ASSERT_OK(decompressed.getStatus());
+    ASSERT_BSONOBJ_EQ(decompressed.getValue(), bucketDoc);
+}
+
+TEST(TimeseriesBucketCompression, RejectsWrongVersion) {
+    auto bucketDoc = makeBucketDoc();
+    ASSERT_NOT_OK(timeseries::decompressBucket(bucketDoc).getStatus());
+
+    auto compressed = timeseries::compressBucket(bucketDoc);
+    ASSERT_OK(compressed.getStatus());
+    ASSERT_NOT_OK(timeseries::compressBucket(compressed.getValue()).getStatus());
+}
+
+TEST(TimeseriesBucketCompression, RejectsCorruptPayload) {
+    auto bucketDoc = makeBucketDoc();
+    auto corrupt = BSON("_id" << bucketDoc["_id"].OID() << "control"
+                              << BSON("version" << timeseries::kTimeseriesControlCompressedVersion)
+                              << "data"
+                              << BSONBinData("garbage", 7, BinDataGeneral));
+    ASSERT_NOT_OK(timeseries::decompressBucket(corrupt).getStatus());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -493,6 +493,25 @@ void TransactionParticipant::Participant::beginOrContinue(OperationContext* opCt
                                                           TxnNumber txnNumber,
                                                           boost::optional<bool> autocommit,
                                                           boost::optional<bool> startTransaction) {
+    if (!autocommit && txnNumber == o().activeTxnNumber &&
+        o().txnState.isInRetryableWriteMode()) {
+        // This is a retry of the already-active retryable write. Nothing on this path mutates any
+        // transaction state, so there is no transaction number update that the RSTL would need to
+        // make atomic with the writability check below; skip the RSTL round trip and check
+        // writability with the _UNSAFE variant, which exists for exactly this kind of early
+        // error. The statement itself re-checks writability under the proper locks when it
+        // executes.
+        invariant(!startTransaction);
+        if (opCtx->writesAreReplicated()) {
+            uassert(ErrorCodes::NotWritablePrimary,
+                    "Not primary so we cannot begin or continue a transaction",
+                    repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesForDatabase_UNSAFE(
+                        opCtx, "admin"));
+        }
+        invariant(p().autoCommit == boost::none);
+        return;
+    }
+
     // Make sure we are still a primary. We need to hold on to the RSTL through the end of this
     // method, as we otherwise risk stepping down in the interim and incorrectly updating the
     // transaction number, which can abort active transactions.
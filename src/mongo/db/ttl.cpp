@@ -33,6 +33,8 @@
 
 #include "mongo/db/ttl.h"
 
+#include <boost/optional.hpp>
+
 #include "mongo/base/counter.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/auth/user_name.h"
@@ -42,6 +44,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/commands/fsync_locked.h"
 #include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/concurrency/locker.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/exec/delete.h"
@@ -265,6 +268,11 @@ private:
     /**
      * Removes documents from the collection using the specified TTL index after a sufficient amount
      * of time has passed according to its expiry specification.
+     *
+     * Deletion proceeds in batches of up to 'ttlMonitorBatchSize' documents. The collection lock
+     * is released and reacquired between batches so foreground operations are not starved for the
+     * duration of a large pass; the bounded index scan restarts at the lower bound each time,
+     * which is naturally resumable because the previous batch's entries are gone.
      */
     void doTTLForIndex(OperationContext* opCtx, NamespaceString collectionNSS, BSONObj idx) {
         if (collectionNSS.isDropPendingNamespace()) {
@@ -297,6 +305,34 @@ private:
                     "key"_attr = key,
                     "name"_attr = name);
 
+        long long totalDeleted = 0;
+        while (true) {
+            const auto batchSize = ttlMonitorBatchSize.load();
+            auto numDeleted = _deleteExpiredBatch(opCtx, collectionNSS, idx, key, name, batchSize);
+            if (!numDeleted) {
+                return;
+            }
+            totalDeleted += *numDeleted;
+            if (batchSize <= 0 || *numDeleted < batchSize) {
+                break;
+            }
+            _yieldBetweenBatches(opCtx);
+        }
+        LOGV2_DEBUG(22536, 1, "deleted: {numDeleted}", "numDeleted"_attr = totalDeleted);
+    }
+
+    /**
+     * Deletes up to 'batchSize' expired documents (everything eligible if 'batchSize' is 0) using
+     * the TTL index 'name', holding the collection lock for the duration of the batch. Returns
+     * the number of documents removed, or boost::none if the collection or index is no longer
+     * eligible and the caller should stop.
+     */
+    boost::optional<long long> _deleteExpiredBatch(OperationContext* opCtx,
+                                                   const NamespaceString& collectionNSS,
+                                                   BSONObj idx,
+                                                   const BSONObj& key,
+                                                   StringData name,
+                                                   int batchSize) {
         AutoGetCollection collection(opCtx, collectionNSS, MODE_IX);
         if (MONGO_unlikely(hangTTLMonitorWithLock.shouldFail())) {
             LOGV2(22534, "Hanging due to hangTTLMonitorWithLock fail point");
@@ -305,11 +341,11 @@ private:
 
         if (!collection) {
             // Collection was dropped.
-            return;
+            return boost::none;
         }
 
         if (!repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, collectionNSS)) {
-            return;
+            return boost::none;
         }
 
         ResourceConsumption::ScopedMetricsCollector scopedMetrics(opCtx,
@@ -322,7 +358,7 @@ private:
                         "index not found (index build in progress? index dropped?), skipping ttl "
                         "job for: {idx}",
                         "idx"_attr = idx);
-            return;
+            return boost::none;
         }
 
         // Re-read 'idx' from the descriptor, in case the collection or index definition changed
@@ -334,7 +370,7 @@ private:
                         "special index can't be used as a ttl index, skipping ttl job for: {index}",
                         "Special index can't be used as a TTL index, skipping TTL job",
                         "index"_attr = idx);
-            return;
+            return boost::none;
         }
 
         BSONElement secondsExpireElt = idx[IndexDescriptor::kExpireAfterSecondsFieldName];
@@ -346,7 +382,7 @@ private:
                         "field"_attr = IndexDescriptor::kExpireAfterSecondsFieldName,
                         "type"_attr = typeName(secondsExpireElt.type()),
                         "index"_attr = idx);
-            return;
+            return boost::none;
         }
 
         const Date_t kDawnOfTime =
@@ -374,6 +410,9 @@ private:
         auto params = std::make_unique<DeleteStageParams>();
         params->isMulti = true;
         params->canonicalQuery = canonicalQuery.getValue().get();
+        // Returning the deleted documents lets us count them as they stream out and stop the
+        // executor once the batch is full.
+        params->returnDeleted = batchSize > 0;
 
         auto exec =
             InternalPlanner::deleteWithIndexScan(opCtx,
@@ -387,20 +426,46 @@ private:
                                                  direction);
 
         try {
-            const auto numDeleted = exec->executeDelete();
+            long long numDeleted = 0;
+            if (batchSize > 0) {
+                BSONObj deletedObj;
+                while (numDeleted < batchSize &&
+                       exec->getNext(&deletedObj, nullptr) == PlanExecutor::ADVANCED) {
+                    numDeleted++;
+                }
+            } else {
+                numDeleted = exec->executeDelete();
+            }
             ttlDeletedDocuments.increment(numDeleted);
-            LOGV2_DEBUG(22536, 1, "deleted: {numDeleted}", "numDeleted"_attr = numDeleted);
+            return numDeleted;
         } catch (const ExceptionFor<ErrorCodes::QueryPlanKilled>&) {
             // It is expected that a collection drop can kill a query plan while the TTL monitor is
             // deleting an old document, so ignore this error.
-            return;
+            return boost::none;
         } catch (const DBException& exception) {
             LOGV2_WARNING(22543,
                           "ttl query execution for index {index} failed with status: {error}",
                           "TTL query execution failed",
                           "index"_attr = idx,
                           "error"_attr = redact(exception.toStatus()));
-            return;
+            return boost::none;
+        }
+    }
+
+    /**
+     * Backs off between delete batches so foreground operations can acquire the collection lock
+     * and throttling tickets the monitor just released. The fixed pause is extended while the
+     * global write tickets are exhausted, bounded so a permanently saturated server still makes
+     * TTL progress.
+     */
+    void _yieldBetweenBatches(OperationContext* opCtx) {
+        const Milliseconds pause{ttlMonitorBatchPauseMS.load()};
+        opCtx->sleepFor(pause);
+
+        static constexpr int kMaxThrottlePauses = 100;
+        const Milliseconds throttlePause = pause > Milliseconds(0) ? pause : Milliseconds(10);
+        for (int i = 0; i < kMaxThrottlePauses && Locker::isGlobalThrottlingExhausted(); i++) {
+            opCtx->sleepFor(throttlePause);
         }
     }
 
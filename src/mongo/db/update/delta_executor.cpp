@@ -32,8 +32,10 @@
 #include "mongo/db/update/delta_executor.h"
 
 #include "mongo/bson/mutable/document.h"
+#include "mongo/db/field_ref.h"
 #include "mongo/db/update/object_replace_executor.h"
 #include "mongo/db/update/update_oplog_entry_serialization.h"
+#include "mongo/db/update_index_data.h"
 
 namespace mongo {
 
@@ -41,6 +43,10 @@ DeltaExecutor::ApplyResult DeltaExecutor::applyUpdate(
     UpdateExecutor::ApplyParams applyParams) const {
     const auto originalDoc = applyParams.element.getDocument().getObject();
 
+    if (auto inPlaceResult = _tryApplyInPlace(applyParams)) {
+        return *inPlaceResult;
+    }
+
     auto applyDiffOutput = doc_diff::applyDiff(originalDoc, _diff, applyParams.indexData);
     const auto& postImage = applyDiffOutput.postImage;
     auto postImageHasId = postImage.hasField("_id");
@@ -51,4 +57,69 @@ DeltaExecutor::ApplyResult DeltaExecutor::applyUpdate(
     result.oplogEntry = _outputOplogEntry;
     return result;
 }
+
+boost::optional<UpdateExecutor::ApplyResult> DeltaExecutor::_tryApplyInPlace(
+    const ApplyParams& applyParams) const {
+    // The in-place path does not run the storage validation and immutable path checks that the
+    // replacement path performs. Deltas are only applied internally, where both are disabled, so
+    // this only excludes unusual callers.
+    if (applyParams.validateForStorage || !applyParams.immutablePaths.empty()) {
+        return boost::none;
+    }
+
+    // Unless the document accepts in-place updates there are no damage events to be gained by
+    // avoiding the replacement path.
+    if (!applyParams.element.getDocument().isInPlaceModeEnabled()) {
+        return boost::none;
+    }
+
+    // Anything that changes the shape of the document -- inserts, deletes, sub-document or array
+    // diffs, or an update which adds a previously missing field -- must go through the full
+    // applyDiff() path. This pass makes that determination without modifying the document, so
+    // that bailing out leaves the pre image untouched for the replacement path.
+    {
+        doc_diff::DocumentDiffReader probe(_diff);
+        if (probe.nextDelete() || probe.nextInsert() || probe.nextSubDiff()) {
+            return boost::none;
+        }
+        for (auto update = probe.nextUpdate(); update; update = probe.nextUpdate()) {
+            if (!applyParams.element[update->fieldNameStringData()].ok()) {
+                return boost::none;
+            }
+        }
+    }
+
+    ApplyResult result;
+    result.indexesAffected = false;
+    result.noop = true;
+
+    doc_diff::DocumentDiffReader reader(_diff);
+    for (auto update = reader.nextUpdate(); update; update = reader.nextUpdate()) {
+        const auto fieldName = update->fieldNameStringData();
+
+        // Like applyDiff(), consider the indexes affected whenever an update touches a possibly
+        // indexed path, without regard to whether the value actually changes.
+        if (!result.indexesAffected && applyParams.indexData &&
+            applyParams.indexData->mightBeIndexed(FieldRef(fieldName))) {
+            result.indexesAffected = true;
+        }
+
+        auto element = applyParams.element[fieldName];
+
+        // If 'element' is deserialized, then element.getValue() will be EOO, which will never
+        // equal the new value.
+        if (element.getValue().ok() && element.getValue().binaryEqualValues(*update)) {
+            continue;
+        }
+
+        // This records a damage event when the new value has the same size as the old one, and
+        // otherwise disables in-place mode so the caller rewrites the whole document, exactly as
+        // modifier-style updates do.
+        invariant(element.setValueBSONElement(*update));
+        result.noop = false;
+    }
+
+    result.oplogEntry = _outputOplogEntry;
+    return result;
+}
 }  // namespace mongo
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "mongo/db/update/update_executor.h"
 
 #include "mongo/db/update/document_diff_applier.h"
@@ -59,6 +61,16 @@ public:
     }
 
 private:
+    /**
+     * Attempts to apply the diff by mutating the pre image document directly, so that same-sized
+     * value changes are recorded as damage events and can be written out via
+     * RecordStore::updateWithDamages() rather than rewriting the whole document. Only diffs that
+     * assign new values to fields which already exist at the top level of the document qualify.
+     * Returns boost::none, leaving the document untouched, when the diff does not qualify and
+     * must be applied through the full replacement path.
+     */
+    boost::optional<ApplyResult> _tryApplyInPlace(const ApplyParams& applyParams) const;
+
     doc_diff::Diff _diff;
 
     // Although the delta executor is only used for applying $v:2 oplog entries on secondaries, it
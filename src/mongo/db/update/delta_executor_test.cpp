@@ -32,6 +32,7 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/bson/json.h"
+#include "mongo/bson/mutable/damage_vector.h"
 #include "mongo/bson/mutable/document.h"
 #include "mongo/db/update/delta_executor.h"
 #include "mongo/logv2/log.h"
@@ -144,6 +145,87 @@ TEST(DeltaExecutorTest, Update) {
     }
 }
 
+TEST(DeltaExecutorTest, UpdateOfExistingFieldsAppliesInPlace) {
+    BSONObj preImage(fromjson("{a: 1, b: 2, c: 3}"));
+    UpdateIndexData indexData;
+    indexData.addPath(FieldRef("b"));
+    FieldRefSet fieldRefSet;
+    {
+        // Same-size updates to existing unindexed fields are recorded as damage events.
+        auto doc = mutablebson::Document(preImage, mutablebson::Document::kInPlaceEnabled);
+        UpdateExecutor::ApplyParams params(doc.root(), fieldRefSet);
+        params.indexData = &indexData;
+        params.validateForStorage = false;
+        DeltaExecutor test(fromjson("{u: {a: 2, c: 4}}"));
+        auto result = test.applyUpdate(params);
+        ASSERT(!result.noop);
+        ASSERT(!result.indexesAffected);
+        ASSERT_BSONOBJ_BINARY_EQ(params.element.getDocument().getObject(),
+                                 fromjson("{a: 2, b: 2, c: 4}"));
+
+        mutablebson::DamageVector damages;
+        const char* source = nullptr;
+        ASSERT(doc.getInPlaceUpdates(&damages, &source));
+        ASSERT_EQUALS(damages.size(), 2U);
+    }
+    {
+        // An update that touches an indexed field reports indexesAffected.
+        auto doc = mutablebson::Document(preImage, mutablebson::Document::kInPlaceEnabled);
+        UpdateExecutor::ApplyParams params(doc.root(), fieldRefSet);
+        params.indexData = &indexData;
+        params.validateForStorage = false;
+        DeltaExecutor test(fromjson("{u: {b: 5}}"));
+        auto result = test.applyUpdate(params);
+        ASSERT(!result.noop);
+        ASSERT(result.indexesAffected);
+        ASSERT_BSONOBJ_BINARY_EQ(params.element.getDocument().getObject(),
+                                 fromjson("{a: 1, b: 5, c: 3}"));
+    }
+    {
+        // Updates which assign the existing values are a noop.
+        auto doc = mutablebson::Document(preImage, mutablebson::Document::kInPlaceEnabled);
+        UpdateExecutor::ApplyParams params(doc.root(), fieldRefSet);
+        params.indexData = &indexData;
+        params.validateForStorage = false;
+        DeltaExecutor test(fromjson("{u: {a: 1, c: 3}}"));
+        auto result = test.applyUpdate(params);
+        ASSERT(result.noop);
+
+        mutablebson::DamageVector damages;
+        const char* source = nullptr;
+        ASSERT(doc.getInPlaceUpdates(&damages, &source));
+        ASSERT(damages.empty());
+    }
+    {
+        // An update that adds a missing field falls back to the replacement path.
+        auto doc = mutablebson::Document(preImage, mutablebson::Document::kInPlaceEnabled);
+        UpdateExecutor::ApplyParams params(doc.root(), fieldRefSet);
+        params.indexData = &indexData;
+        params.validateForStorage = false;
+        DeltaExecutor test(fromjson("{u: {a: 2, x: 5}}"));
+        auto result = test.applyUpdate(params);
+        ASSERT(!result.noop);
+        ASSERT_BSONOBJ_BINARY_EQ(params.element.getDocument().getObject(),
+                                 fromjson("{a: 2, b: 2, c: 3, x: 5}"));
+    }
+    {
+        // A value of a different size still applies, but no longer in place.
+        auto doc = mutablebson::Document(preImage, mutablebson::Document::kInPlaceEnabled);
+        UpdateExecutor::ApplyParams params(doc.root(), fieldRefSet);
+        params.indexData = &indexData;
+        params.validateForStorage = false;
+        DeltaExecutor test(fromjson("{u: {a: 'long string value'}}"));
+        auto result = test.applyUpdate(params);
+        ASSERT(!result.noop);
+        ASSERT_BSONOBJ_BINARY_EQ(params.element.getDocument().getObject(),
+                                 fromjson("{a: 'long string value', b: 2, c: 3}"));
+
+        mutablebson::DamageVector damages;
+        const char* source = nullptr;
+        ASSERT(!doc.getInPlaceUpdates(&damages, &source));
+    }
+}
+
 TEST(DeltaExecutorTest, Insert) {
     UpdateIndexData indexData;
     indexData.addPath(FieldRef("p.a.b"));
@@ -62,7 +62,7 @@ public:
         _queryServiceContext->getServiceContext()->setPreciseClockSource(
             std::make_unique<ClockSourceMock>());
 
-        _cursorManager.setPreciseClockSource(
+        _cursorManager.setClockSource(
             _queryServiceContext->getServiceContext()->getPreciseClockSource());
     }
 
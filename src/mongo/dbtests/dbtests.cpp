@@ -205,7 +205,7 @@ int dbtestsMain(int argc, char** argv) {
     auto preciseClock = std::make_unique<ClockSourceMock>();
     // See above.
     preciseClock->advance(Seconds(1));
-    CursorManager::get(service)->setPreciseClockSource(preciseClock.get());
+    CursorManager::get(service)->setClockSource(preciseClock.get());
     service->setPreciseClockSource(std::move(preciseClock));
 
     service->setTransportLayer(
@@ -161,6 +161,7 @@ public:
                                         cq,
                                         plannerParams,
                                         decisionWorks,
+                                        0 /* trialsWithoutReplan */,
                                         std::move(mockChild));
 
         // This should succeed after triggering a replan.
@@ -215,6 +216,7 @@ TEST_F(QueryStageCachedPlan, QueryStageCachedPlanFailureMemoryLimitExceeded) {
                                     cq.get(),
                                     plannerParams,
                                     decisionWorks,
+                                    0 /* trialsWithoutReplan */,
                                     std::move(mockChild));
 
     // This should succeed after triggering a replan.
@@ -268,6 +270,7 @@ TEST_F(QueryStageCachedPlan, QueryStageCachedPlanHitMaxWorks) {
                                     cq.get(),
                                     plannerParams,
                                     decisionWorks,
+                                    0 /* trialsWithoutReplan */,
                                     std::move(mockChild));
 
     // This should succeed after triggering a replan.
@@ -437,6 +440,51 @@ TEST_F(QueryStageCachedPlan, EntriesAreNotDeactivatedWhenInactiveEntriesDisabled
     ASSERT_EQ(cache->get(*shapeCq).state, PlanCache::CacheEntryState::kPresentActive);
 }
 
+TEST_F(QueryStageCachedPlan, SkipsTrialPeriodGivenSufficientReplanFreeHistory) {
+    internalQueryCacheTrialSkipThreshold.store(3);
+    ON_BLOCK_EXIT([] { internalQueryCacheTrialSkipThreshold.store(0); });
+
+    AutoGetCollectionForReadCommand collection(&_opCtx, nss);
+    ASSERT(collection);
+
+    const auto cq =
+        canonicalQueryFromFilterObj(opCtx(), nss, fromjson("{a: {$gte: 8}, b: {$gte: 8}}"));
+
+    QueryPlannerParams plannerParams;
+    fillOutPlannerParams(&_opCtx, collection.getCollection(), cq.get(), &plannerParams);
+
+    // A child which would exhaust the trial period's work budget and trigger a replan, were the
+    // trial period to run.
+    const size_t decisionWorks = 10;
+    const size_t mockWorks =
+        1U + static_cast<size_t>(internalQueryCacheEvictionRatio * decisionWorks);
+    auto mockChild = std::make_unique<MockStage>(_expCtx.get(), &_ws);
+    for (size_t i = 0; i < mockWorks; i++) {
+        mockChild->enqueueStateCode(PlanStage::NEED_TIME);
+    }
+
+    CachedPlanStage cachedPlanStage(_expCtx.get(),
+                                    collection.getCollection(),
+                                    &_ws,
+                                    cq.get(),
+                                    plannerParams,
+                                    decisionWorks,
+                                    3 /* trialsWithoutReplan */,
+                                    std::move(mockChild));
+
+    NoopYieldPolicy yieldPolicy(_opCtx.getServiceContext()->getFastClockSource());
+    ASSERT_OK(cachedPlanStage.pickBestPlan(&yieldPolicy));
+
+    // The trial period was skipped: the mock child was neither worked nor replaced with a
+    // replanned tree, and no replan reason was recorded.
+    auto stats = cachedPlanStage.getStats();
+    const auto* cachedStats = static_cast<const CachedPlanStats*>(stats->specific.get());
+    ASSERT_FALSE(cachedStats->replanReason);
+    ASSERT_EQ(stats->children.size(), 1U);
+    ASSERT_EQ(stats->children[0]->stageType, STAGE_MOCK);
+    ASSERT_EQ(stats->children[0]->common.works, 0U);
+}
+
 TEST_F(QueryStageCachedPlan, ThrowsOnYieldRecoveryWhenIndexIsDroppedBeforePlanSelection) {
     // Create an index which we will drop later on.
     BSONObj keyPattern = BSON("c" << 1);
@@ -468,6 +516,7 @@ TEST_F(QueryStageCachedPlan, ThrowsOnYieldRecoveryWhenIndexIsDroppedBeforePlanSe
                                     cq.get(),
                                     plannerParams,
                                     decisionWorks,
+                                    0 /* trialsWithoutReplan */,
                                     std::make_unique<MockStage>(_expCtx.get(), &_ws));
 
     // Drop an index while the CachedPlanStage is in a saved state. Restoring should fail, since we
@@ -512,6 +561,7 @@ TEST_F(QueryStageCachedPlan, DoesNotThrowOnYieldRecoveryWhenIndexIsDroppedAferPl
                                     cq.get(),
                                     plannerParams,
                                     decisionWorks,
+                                    0 /* trialsWithoutReplan */,
                                     std::make_unique<MockStage>(_expCtx.get(), &_ws));
 
     NoopYieldPolicy yieldPolicy(_opCtx.getServiceContext()->getFastClockSource());
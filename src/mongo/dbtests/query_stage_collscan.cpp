@@ -250,6 +250,45 @@ TEST_F(QueryStageCollectionScanTest, QueryStageCollscanObjectsInOrderBackward) {
     ASSERT_EQUALS(numObj(), count);
 }
 
+// Drain the scan through the batched API and make sure the same documents come back, in the same
+// order, as with the one-at-a-time API.
+TEST_F(QueryStageCollectionScanTest, QueryStageCollscanWorkBatch) {
+    AutoGetCollectionForReadCommand collection(&_opCtx, nss);
+
+    CollectionScanParams params;
+    params.direction = CollectionScanParams::FORWARD;
+    params.tailable = false;
+
+    // Filter out half the documents so the batches also terminate on the NEED_TIME path.
+    BSONObj filterObj = BSON("foo" << BSON("$lt" << 25));
+    StatusWithMatchExpression statusWithMatcher = MatchExpressionParser::parse(filterObj, _expCtx);
+    ASSERT_OK(statusWithMatcher.getStatus());
+    unique_ptr<MatchExpression> filterExpr = std::move(statusWithMatcher.getValue());
+
+    WorkingSet ws;
+    CollectionScan scan(_expCtx.get(), collection.getCollection(), params, &ws, filterExpr.get());
+
+    const size_t kBatchSize = 8;
+    int count = 0;
+    while (!scan.isEOF()) {
+        vector<WorkingSetID> batch;
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state = scan.workBatch(kBatchSize, &batch, &id);
+
+        // A batch may only be cut short by a state other than ADVANCED.
+        if (PlanStage::ADVANCED == state) {
+            ASSERT_EQUALS(kBatchSize, batch.size());
+        }
+
+        for (WorkingSetID memberId : batch) {
+            WorkingSetMember* member = ws.get(memberId);
+            ASSERT_EQUALS(count, member->doc.value()["foo"].getInt());
+            ++count;
+        }
+    }
+    ASSERT_EQUALS(25, count);
+}
+
 // Scan through half the objects, delete the one we're about to fetch, then expect to get the "next"
 // object we would have gotten after that.
 TEST_F(QueryStageCollectionScanTest, QueryStageCollscanDeleteUpcomingObject) {
@@ -150,6 +150,51 @@ public:
     }
 };
 
+//
+// Check that the batched API counts the same keys as work(), dedup included
+//
+class QueryStageCountScanWorkBatch : public CountBase {
+public:
+    void run() {
+        dbtests::WriteContextForTests ctx(&_opCtx, ns().ns());
+
+        // Insert docs, including a multikey one so the scan must deduplicate
+        for (int i = 0; i < 10; ++i) {
+            insert(BSON("a" << i));
+        }
+        insert(BSON("a" << BSON_ARRAY(3 << 4)));
+
+        // Add an index on a:1
+        addIndex(BSON("a" << 1));
+
+        // Set up the count stage
+        auto params = makeCountScanParams(&_opCtx, getIndex(ctx.db(), BSON("a" << 1)));
+        params.startKey = BSON("a" << 0);
+        params.startKeyInclusive = true;
+        params.endKey = BSON("a" << 9);
+        params.endKeyInclusive = true;
+
+        WorkingSet ws;
+        CountScan count(_expCtx.get(), getCollection(), params, &ws);
+
+        // Drain the stage through the batched API
+        const size_t kBatchSize = 4;
+        int numCounted = 0;
+        WorkingSetID wsid;
+        PlanStage::StageState state;
+        do {
+            std::vector<WorkingSetID> batch;
+            state = count.workBatch(kBatchSize, &batch, &wsid);
+            ASSERT_NOT_EQUALS(PlanStage::NEED_YIELD, state);
+            ASSERT_LESS_THAN_OR_EQUALS(batch.size(), kBatchSize);
+            numCounted += batch.size();
+        } while (PlanStage::IS_EOF != state);
+
+        // Ten distinct documents, with the multikey doc counted once.
+        ASSERT_EQUALS(11, numCounted);
+    }
+};
+
 //
 // Check that expected results are returned with inclusive bounds
 //
@@ -591,6 +636,7 @@ public:
 
     void setupTests() {
         add<QueryStageCountScanDups>();
+        add<QueryStageCountScanWorkBatch>();
         add<QueryStageCountScanInclusiveBounds>();
         add<QueryStageCountScanExclusiveBounds>();
         add<QueryStageCountScanLowerBound>();
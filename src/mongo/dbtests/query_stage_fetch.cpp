@@ -160,6 +160,69 @@ public:
     }
 };
 
+//
+// Test that the batched API buffers a batch of RecordIds, fetches them all, and re-emits them in
+// the child's order.
+//
+class FetchStageWorkBatch : public QueryStageFetchBase {
+public:
+    void run() {
+        dbtests::WriteContextForTests ctx(&_opCtx, ns());
+        Database* db = ctx.db();
+        CollectionPtr coll =
+            CollectionCatalog::get(&_opCtx)->lookupCollectionByNamespace(&_opCtx, nss());
+        if (!coll) {
+            WriteUnitOfWork wuow(&_opCtx);
+            coll = db->createCollection(&_opCtx, nss());
+            wuow.commit();
+        }
+
+        WorkingSet ws;
+
+        static const int kNumDocs = 5;
+        for (int i = 0; i < kNumDocs; ++i) {
+            insert(BSON("foo" << i));
+        }
+        set<RecordId> recordIds;
+        getRecordIds(&recordIds, coll);
+        ASSERT_EQUALS(size_t(kNumDocs), recordIds.size());
+
+        // Feed the RecordIds to the fetch stage in reverse order, so that the buffered fetch has
+        // to reorder them internally while preserving the emission order.
+        auto mockStage = std::make_unique<QueuedDataStage>(_expCtx.get(), &ws);
+        vector<RecordId> reversed(recordIds.rbegin(), recordIds.rend());
+        for (const auto& recordId : reversed) {
+            WorkingSetID id = ws.allocate();
+            WorkingSetMember* mockMember = ws.get(id);
+            mockMember->recordId = recordId;
+            ws.transitionToRecordIdAndIdx(id);
+            mockStage->pushBack(id);
+        }
+
+        auto fetchStage =
+            std::make_unique<FetchStage>(_expCtx.get(), &ws, std::move(mockStage), nullptr, coll);
+
+        std::vector<WorkingSetID> batch;
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state;
+        while (batch.size() < size_t(kNumDocs)) {
+            state = fetchStage->workBatch(kNumDocs, &batch, &id);
+            ASSERT_NOT_EQUALS(PlanStage::IS_EOF, state);
+        }
+        ASSERT_EQUALS(size_t(kNumDocs), batch.size());
+
+        // Each member was fetched, and the batch preserves the child's (reversed) order.
+        for (int i = 0; i < kNumDocs; ++i) {
+            WorkingSetMember* member = ws.get(batch[i]);
+            ASSERT_TRUE(member->hasObj());
+            ASSERT_EQUALS(kNumDocs - 1 - i, member->doc.value()["foo"].getInt());
+        }
+
+        state = fetchStage->workBatch(kNumDocs, &batch, &id);
+        ASSERT_EQUALS(PlanStage::IS_EOF, state);
+    }
+};
+
 //
 // Test matching with fetch.
 //
@@ -232,6 +295,7 @@ public:
 
     void setupTests() {
         add<FetchStageAlreadyFetched>();
+        add<FetchStageWorkBatch>();
         add<FetchStageFilter>();
     }
 };
@@ -130,6 +130,10 @@ void ConnectionPool::ControllerInterface::init(ConnectionPool* pool) {
     _pool = pool;
 }
 
+Date_t ConnectionPool::ControllerInterface::now() const {
+    return _pool->_factory->now();
+}
+
 std::string ConnectionPool::ConnectionControls::toString() const {
     return "{{ maxPending: {}, target: {}, }}"_format(maxPendingConnections, targetConnections);
 }
@@ -160,7 +164,8 @@ public:
         const auto minConns = getPool()->_options.minConnections;
         const auto maxConns = getPool()->_options.maxConnections;
 
-        data.target = stats.requests + stats.active;
+        data.target = data.demandTracker.update(
+            stats.requests + stats.active, now(), getPool()->_options.warmTargetDecayInterval);
         if (data.target < minConns) {
             data.target = minConns;
         } else if (data.target > maxConns) {
@@ -202,6 +207,7 @@ protected:
     struct PoolData {
         HostAndPort host;
         size_t target = 0;
+        PeakDemandTracker demandTracker;
     };
 
     Mutex _mutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "LimitController::_mutex");
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <queue>
@@ -139,6 +140,15 @@ public:
          */
         Milliseconds hostTimeout = kDefaultHostTimeout;
 
+        /**
+         * Amount of time without a new demand peak before a host's learned warm connection
+         * target is halved. The learned target keeps a pool sized for its recent bursts so
+         * that the next burst (or a refill after connections are dropped) does not pay
+         * connection establishment inline with user requests. Zero (the default) disables
+         * warm target learning and sizes the pool purely from current demand.
+         */
+        Milliseconds warmTargetDecayInterval = Milliseconds(0);
+
         /**
          * An egress tag closer manager which will provide global access to this connection pool.
          * The manager set's tags and potentially drops connections that don't match those tags.
@@ -226,6 +236,36 @@ public:
         std::string toString() const;
     };
 
+    /**
+     * A decaying peak of connection demand for a single pool
+     *
+     * Controllers feed each demand observation (requests + active connections) through update()
+     * and use the returned value as their sizing target. The peak observation is remembered and
+     * halved towards the current demand after each decayInterval without a new peak, so a pool
+     * keeps enough warm connections to absorb a repeat of its recent bursts while unused
+     * capacity is still released over time.
+     */
+    struct PeakDemandTracker {
+        size_t update(size_t demand, Date_t now, Milliseconds decayInterval) {
+            if (decayInterval <= Milliseconds{0}) {
+                return demand;
+            }
+
+            if (demand >= peak) {
+                peak = demand;
+                lastDecay = now;
+            } else if (now - lastDecay >= decayInterval) {
+                peak = std::max(demand, peak / 2);
+                lastDecay = now;
+            }
+
+            return peak;
+        }
+
+        size_t peak = 0;
+        Date_t lastDecay;
+    };
+
     /**
      * A set of hosts and a flag canShutdown for if the group can shutdown
      *
@@ -493,6 +533,11 @@ public:
     }
 
 protected:
+    /**
+     * Get the current time according to the pool's DependentTypeFactoryInterface
+     */
+    Date_t now() const;
+
     ConnectionPool* _pool = nullptr;
 };
 
@@ -1165,6 +1165,69 @@ TEST_F(ConnectionPoolTest, hostTimeoutHappensCheckoutDelays) {
 /**
  * Verify that drop connections works
  */
+/**
+ * Verify that the learned warm connection target replenishes a pool after its connections are
+ * dropped, rather than letting the pool shrink back to minConnections while demand is quiet.
+ */
+TEST_F(ConnectionPoolTest, warmTargetReplenishesAfterDrop) {
+    ConnectionPool::Options options;
+    options.minConnections = 1;
+    options.maxConnections = 5;
+    options.refreshRequirement = Milliseconds(5000);
+    options.refreshTimeout = Milliseconds(6000);
+    options.warmTargetDecayInterval = Milliseconds(1000);
+    auto pool = makePool(options);
+
+    auto now = Date_t::now();
+    PoolImpl::setNow(now);
+
+    size_t setups = 0;
+    for (int i = 0; i < 8; i++) {
+        ConnectionImpl::pushSetup([&]() {
+            ++setups;
+            return Status::OK();
+        });
+    }
+
+    // Check out three connections at once so the controller observes a demand peak of three.
+    ConnectionPool::ConnectionHandle conn1;
+    ConnectionPool::ConnectionHandle conn2;
+    ConnectionPool::ConnectionHandle conn3;
+    pool->get_forTest(HostAndPort(),
+                      Milliseconds(1000),
+                      [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                          ASSERT(swConn.isOK());
+                          conn1 = std::move(swConn.getValue());
+                      });
+    pool->get_forTest(HostAndPort(),
+                      Milliseconds(2000),
+                      [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                          ASSERT(swConn.isOK());
+                          conn2 = std::move(swConn.getValue());
+                      });
+    pool->get_forTest(HostAndPort(),
+                      Milliseconds(3000),
+                      [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                          ASSERT(swConn.isOK());
+                          conn3 = std::move(swConn.getValue());
+                      });
+    ASSERT(conn1);
+    ASSERT(conn2);
+    ASSERT(conn3);
+    ASSERT_EQ(setups, 3u);
+
+    doneWith(conn1);
+    doneWith(conn2);
+    doneWith(conn3);
+
+    // Drop everything, as a deploy or stepdown would.
+    pool->dropConnections(HostAndPort());
+
+    // The pool replenishes to the learned warm target of three in the background, not just
+    // minConnections.
+    ASSERT_EQ(setups, 6u);
+}
+
 TEST_F(ConnectionPoolTest, dropConnections) {
     ConnectionPool::Options options;
 
@@ -542,10 +542,14 @@ Status NetworkInterfaceTL::startCommand(const TaskExecutor::CallbackHandle& cbHa
             continue;
         }
 
-        // Otherwise, schedule the request.
-        std::move(connFuture).thenRunOn(_reactor).getAsync([cmdState = cmdState, idx](auto swConn) {
-            cmdState->requestManager->trySend(std::move(swConn), idx);
-        });
+        // Otherwise, schedule the request. Send from the caller's baton when it has one, so an
+        // operation thread that is going to block on the result runs the send and receive itself
+        // instead of paying a context switch to and from the reactor for every round-trip.
+        std::move(connFuture)
+            .thenRunOn(makeGuaranteedExecutor(baton, _reactor))
+            .getAsync([cmdState = cmdState, idx](auto swConn) {
+                cmdState->requestManager->trySend(std::move(swConn), idx);
+            });
     }
 
     return Status::OK();
@@ -646,6 +650,12 @@ void NetworkInterfaceTL::RequestManager::killOperationsForPendingRequests() {
             continue;
         }
 
+        if (!requestState->sent) {
+            // A hedged request that is still waiting out its hedging delay has not started any
+            // remote operation, so there is nothing to kill.
+            continue;
+        }
+
         // If the request was sent, send a remote command request to the target host
         // to kill the operation started by the request.
 
@@ -693,7 +703,8 @@ void NetworkInterfaceTL::RequestManager::trySend(
             if (reactor->onReactorThread()) {
                 cmdState->fulfillFinalPromise(std::move(swConn.getStatus()));
             } else {
-                ExecutorFuture<void>(reactor, swConn.getStatus())
+                ExecutorFuture<void>(makeGuaranteedExecutor(cmdState->baton, reactor),
+                                     swConn.getStatus())
                     .getAsync([this, anchor = cmdState->shared_from_this()](Status status) {
                         cmdState->fulfillFinalPromise(std::move(status));
                     });
@@ -763,16 +774,49 @@ void NetworkInterfaceTL::RequestManager::trySend(
             invariant(hm);
             hm->incrementNumTotalHedgedOperations();
         }
+
+        auto hedgingDelay = Milliseconds(request->hedgeOptions->delayMS);
+        if (hedgingDelay > Milliseconds(0)) {
+            // Delay dispatching the hedged request. If the original request completes within
+            // the delay, the hedge is skipped entirely rather than sending duplicate work to
+            // the remote host.
+            LOGV2_DEBUG(5837121,
+                        2,
+                        "Delaying hedged request",
+                        "requestId"_attr = cmdState->requestOnAny.id,
+                        "target"_attr = cmdState->requestOnAny.target[idx],
+                        "delay"_attr = hedgingDelay);
+            requestState->hedgeTimer = cmdState->interface->_reactor->makeTimer();
+            requestState->hedgeTimer
+                ->waitUntil(cmdState->interface->now() + hedgingDelay, cmdState->baton)
+                .getAsync([this, requestState](Status status) {
+                    if (!status.isOK() || cmdState->finishLine.isReady()) {
+                        // The command was satisfied or canceled while this hedge was waiting,
+                        // so there is nothing left to send.
+                        requestState->returnConnection(Status::OK());
+                        return;
+                    }
+                    sendRequest(std::move(requestState));
+                });
+            return;
+        }
     }
 
+    sendRequest(std::move(requestState));
+}
+
+void NetworkInterfaceTL::RequestManager::sendRequest(
+    std::shared_ptr<RequestState> requestState) noexcept {
+    auto request = &requestState->request.get();
+
     if (request->timeout != RemoteCommandRequest::kNoTimeout &&
         WireSpec::instance().get()->isInternalClient) {
         LOGV2_DEBUG(4924402,
                     2,
                     "Set maxTimeMSOpOnly for request",
                     "maxTimeMSOpOnly"_attr = request->timeout,
-                    "requestId"_attr = cmdState->requestOnAny.id,
-                    "target"_attr = cmdState->requestOnAny.target[idx]);
+                    "requestId"_attr = request->id,
+                    "target"_attr = request->target);
 
         BSONObjBuilder updatedCmdBuilder;
         updatedCmdBuilder.appendElements(request->cmdObj);
@@ -793,6 +837,7 @@ void NetworkInterfaceTL::RequestManager::trySend(
         counters->recordSent();
     }
 
+    requestState->sent = true;
     requestState->resolve(cmdState->sendRequest(requestState));
 }
 
@@ -1012,10 +1057,13 @@ Status NetworkInterfaceTL::startExhaustCommand(const TaskExecutor::CallbackHandl
             continue;
         }
 
-        // For every connection future we didn't have immediately ready, schedule
-        std::move(connFuture).thenRunOn(_reactor).getAsync([cmdState, idx](auto swConn) {
-            cmdState->requestManager->trySend(std::move(swConn), idx);
-        });
+        // For every connection future we didn't have immediately ready, schedule on the baton
+        // when one is available and on the reactor otherwise.
+        std::move(connFuture)
+            .thenRunOn(makeGuaranteedExecutor(baton, _reactor))
+            .getAsync([cmdState, idx](auto swConn) {
+                cmdState->requestManager->trySend(std::move(swConn), idx);
+            });
     }
 
     return Status::OK();
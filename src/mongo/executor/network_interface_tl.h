@@ -234,6 +234,7 @@ private:
         RequestManager(CommandStateBase* cmdState);
 
         void trySend(StatusWith<ConnectionPool::ConnectionHandle> swConn, size_t idx) noexcept;
+        void sendRequest(std::shared_ptr<RequestState> requestState) noexcept;
         void cancelRequests();
         void killOperationsForPendingRequests();
 
@@ -303,6 +304,14 @@ private:
         // True if this request is an additional request sent to hedge the operation.
         bool isHedge{false};
 
+        // Set once the request has actually been dispatched to the remote host. A hedged
+        // request with a hedging delay may hold a connection without ever being sent.
+        bool sent{false};
+
+        // Timer used to delay dispatching this request if it is a hedge and a hedging delay
+        // is configured.
+        std::unique_ptr<transport::ReactorTimer> hedgeTimer;
+
         // Set to true if the response to the request is used to fulfill the command's
         // promise (i.e. arrives before the responses to all other requests and is not
         // a MaxTimeMSExpired error response if this is a hedged request).
@@ -47,6 +47,10 @@ struct RemoteCommandRequestBase {
     struct HedgeOptions {
         size_t count = 0;
         int maxTimeMSForHedgedReads = 0;
+
+        // Time to wait before dispatching each additional request. If the original request
+        // completes within the delay, the additional request is never sent.
+        int delayMS = 0;
     };
 
     enum FireAndForgetMode { kOn, kOff };
@@ -41,14 +41,42 @@
 #include "mongo/logv2/tagged_severity_filter.h"
 #include "mongo/logv2/text_formatter.h"
 #include "mongo/logv2/uassert_sink.h"
+#include "mongo/platform/atomic_word.h"
 
 #include <boost/core/null_deleter.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/log/core.hpp>
 #include <boost/log/sinks.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
+#include <boost/log/sinks/bounded_fifo_queue.hpp>
 
 namespace mongo::logv2 {
 
+namespace {
+
+// Counts log records shed by the asynchronous file sink when its bounded queue is full. Global so
+// the tally survives reconfiguration of the sinks.
+AtomicWord<int64_t> droppedAsyncRecords;
+
+// Overflow strategy for the asynchronous sink's bounded queue. Discards the record like
+// boost::log::sinks::drop_on_overflow, but keeps count of how many records were shed so overload
+// is observable. Blocking is not an option here as the whole point of the asynchronous mode is
+// that logging never back-pressures the threads doing the logging.
+class CountingDropOnOverflow {
+public:
+    template <typename LockT>
+    static bool on_overflow(boost::log::record_view const&, LockT&) {
+        droppedAsyncRecords.fetchAndAdd(1);
+        return false;
+    }
+
+    static void on_queue_space_available() {}
+
+    static void interrupt() {}
+};
+
+}  // namespace
+
 void LogDomainGlobal::ConfigurationOptions::makeDisabled() {
     consoleEnabled = false;
 }
@@ -69,6 +97,13 @@ struct LogDomainGlobal::Impl {
     typedef CompositeBackend<FileRotateSink, RamLogSink, RamLogSink, UserAssertSink>
         RotatableFileBackend;
 
+    // Upper bound on records buffered by the asynchronous file sink before records get shed.
+    static constexpr std::size_t kAsyncMaxQueuedRecords = 16384;
+    typedef boost::log::sinks::asynchronous_sink<
+        RotatableFileBackend,
+        boost::log::sinks::bounded_fifo_queue<kAsyncMaxQueuedRecords, CountingDropOnOverflow>>
+        AsyncRotatableFileSink;
+
     Impl(LogDomainGlobal& parent);
     Status configure(LogDomainGlobal::ConfigurationOptions const& options);
     Status rotate(bool rename, StringData renameSuffix);
@@ -82,6 +117,7 @@ struct LogDomainGlobal::Impl {
     ConfigurationOptions _config;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<ConsoleBackend>> _consoleSink;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<RotatableFileBackend>> _rotatableFileSink;
+    boost::shared_ptr<AsyncRotatableFileSink> _asyncRotatableFileSink;
 #ifndef _WIN32
     boost::shared_ptr<boost::log::sinks::unlocked_sink<SyslogBackend>> _syslogSink;
 #endif
@@ -172,20 +208,39 @@ Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions co
         backend->setFilter<2>(
             TaggedSeverityFilter(_parent, {LogTag::kStartupWarnings}, LogSeverity::Log()));
 
-        _rotatableFileSink =
-            boost::make_shared<boost::log::sinks::unlocked_sink<RotatableFileBackend>>(backend);
-        _rotatableFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
+        if (options.asyncEnabled) {
+            // The asynchronous frontend starts a dedicated thread that dequeues records, formats
+            // them and feeds the backend, so a slow or syncing disk never blocks logging threads.
+            _asyncRotatableFileSink = boost::make_shared<AsyncRotatableFileSink>(backend);
+            _asyncRotatableFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
+
+            boost::log::core::get()->add_sink(_asyncRotatableFileSink);
+        } else {
+            _rotatableFileSink =
+                boost::make_shared<boost::log::sinks::unlocked_sink<RotatableFileBackend>>(backend);
+            _rotatableFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
 
-        boost::log::core::get()->add_sink(_rotatableFileSink);
-    } else if (_rotatableFileSink) {
-        boost::log::core::get()->remove_sink(_rotatableFileSink);
-        _rotatableFileSink.reset();
+            boost::log::core::get()->add_sink(_rotatableFileSink);
+        }
+    } else {
+        if (_rotatableFileSink) {
+            boost::log::core::get()->remove_sink(_rotatableFileSink);
+            _rotatableFileSink.reset();
+        }
+        if (_asyncRotatableFileSink) {
+            boost::log::core::get()->remove_sink(_asyncRotatableFileSink);
+            _asyncRotatableFileSink->stop();
+            _asyncRotatableFileSink->flush();
+            _asyncRotatableFileSink.reset();
+        }
     }
 
     auto setFormatters = [this](auto&& mkFmt) {
         _consoleSink->set_formatter(mkFmt());
         if (_rotatableFileSink)
             _rotatableFileSink->set_formatter(mkFmt());
+        if (_asyncRotatableFileSink)
+            _asyncRotatableFileSink->set_formatter(mkFmt());
 #ifndef _WIN32
         if (_syslogSink)
             _syslogSink->set_formatter(mkFmt());
@@ -227,6 +282,10 @@ Status LogDomainGlobal::Impl::rotate(bool rename, StringData renameSuffix) {
         auto backend = _rotatableFileSink->locked_backend()->lockedBackend<0>();
         return backend->rotate(rename, renameSuffix);
     }
+    if (_asyncRotatableFileSink) {
+        auto backend = _asyncRotatableFileSink->locked_backend()->lockedBackend<0>();
+        return backend->rotate(rename, renameSuffix);
+    }
     return Status::OK();
 }
 
@@ -287,4 +346,8 @@ LogComponentSettings& LogDomainGlobal::settings() {
     return _impl->_settings;
 }
 
+int64_t LogDomainGlobal::droppedAsyncLogRecords() {
+    return droppedAsyncRecords.load();
+}
+
 }  // namespace mongo::logv2
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "mongo/logv2/constants.h"
 #include "mongo/logv2/log_domain_internal.h"
 #include "mongo/logv2/log_format.h"
@@ -42,6 +44,10 @@ public:
 
         bool consoleEnabled{true};
         bool fileEnabled{false};
+        // When set together with fileEnabled, log records are queued and written to the file by
+        // a dedicated thread instead of synchronously by the logging thread. If the queue fills
+        // up records are discarded rather than blocking; see droppedAsyncLogRecords().
+        bool asyncEnabled{false};
         std::string filePath;
         RotationMode fileRotationMode{RotationMode::kRename};
         OpenMode fileOpenMode{OpenMode::kTruncate};
@@ -66,6 +72,12 @@ public:
 
     LogComponentSettings& settings();
 
+    /**
+     * Number of log records discarded by the asynchronous file sink because its queue was full.
+     * Always zero unless asyncEnabled was configured.
+     */
+    static int64_t droppedAsyncLogRecords();
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
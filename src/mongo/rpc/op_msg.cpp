@@ -127,7 +127,12 @@ void OpMsg::appendChecksum(Message* message) {
 #endif
 }
 
-OpMsg OpMsg::parse(const Message& message) try {
+namespace {
+
+// Parses the message, optionally making each parsed BSONObj share ownership of 'ownedBuffer' as
+// it is encountered. Sharing during the parse avoids a second walk over the sections, which
+// matters for messages carrying large document sequences.
+OpMsg parseImpl(const Message& message, const ConstSharedBuffer* ownedBuffer) try {
     // It is the caller's responsibility to call the correct parser for a given message type.
     invariant(!message.empty());
     invariant(message.operation() == dbMsg);
@@ -161,6 +166,8 @@ OpMsg OpMsg::parse(const Message& message) try {
                 uassert(40430, "Multiple body sections in message", !haveBody);
                 haveBody = true;
                 msg.body = sectionsBuf.read<Validated<BSONObj>>();
+                if (ownedBuffer)
+                    msg.body.shareOwnershipWith(*ownedBuffer);
                 break;
             }
 
@@ -183,7 +190,10 @@ OpMsg OpMsg::parse(const Message& message) try {
 
                 msg.sequences.push_back({name.toString()});
                 while (!seqBuf.atEof()) {
-                    msg.sequences.back().objs.push_back(seqBuf.read<Validated<BSONObj>>());
+                    BSONObj obj = seqBuf.read<Validated<BSONObj>>();
+                    if (ownedBuffer)
+                        obj.shareOwnershipWith(*ownedBuffer);
+                    msg.sequences.back().objs.push_back(std::move(obj));
                 }
                 break;
             }
@@ -229,6 +239,17 @@ OpMsg OpMsg::parse(const Message& message) try {
     throw;
 }
 
+}  // namespace
+
+OpMsg OpMsg::parse(const Message& message) {
+    return parseImpl(message, nullptr);
+}
+
+OpMsg OpMsg::parseOwned(const Message& message) {
+    auto buffer = message.sharedBuffer();
+    return parseImpl(message, &buffer);
+}
+
 namespace {
 void serializeHelper(const std::vector<OpMsg::DocumentSequence>& sequences,
                      const BSONObj& body,
@@ -105,18 +105,17 @@ struct OpMsg {
     }
 
     /**
-     * Parses and returns an OpMsg containing unowned BSON.
+     * Parses and returns an OpMsg containing unowned BSON pointing into the message's buffer,
+     * without copying any document bytes.
      */
     static OpMsg parse(const Message& message);
 
     /**
-     * Parses and returns an OpMsg containing owned BSON.
+     * Parses and returns an OpMsg containing owned BSON. The BSON still points into the message's
+     * buffer, sharing ownership of it rather than copying. Ownership is shared during the parse
+     * itself, avoiding a second walk over potentially large document sequences.
      */
-    static OpMsg parseOwned(const Message& message) {
-        auto msg = parse(message);
-        msg.shareOwnershipWith(message.sharedBuffer());
-        return msg;
-    }
+    static OpMsg parseOwned(const Message& message);
 
     Message serialize() const;
 
@@ -241,6 +241,43 @@ TEST_F(OpMsgParser, SucceedsWithSequenceThenBody) {
     ASSERT_BSONOBJ_EQ(msg.sequences[0].objs[0], fromjson("{a: 1}"));
 }
 
+TEST_F(OpMsgParser, ParseIsZeroCopyAndParseOwnedSharesMessageBuffer) {
+    auto message = OpMsgBytes{
+        kNoFlags,  //
+        kBodySection,
+        fromjson("{ping: 1}"),
+
+        kDocSequenceSection,
+        Sized{
+            "docs",  //
+            fromjson("{a: 1}"),
+            fromjson("{a: 2}"),
+        },
+    }.done();
+
+    auto inBuffer = [&](const BSONObj& obj) {
+        return obj.objdata() >= message.buf() && obj.objdata() < message.buf() + message.size();
+    };
+
+    // parse() returns unowned views into the message buffer.
+    auto unowned = OpMsg::parse(message);
+    ASSERT(!unowned.body.isOwned());
+    ASSERT(inBuffer(unowned.body));
+    for (auto&& obj : unowned.sequences[0].objs) {
+        ASSERT(!obj.isOwned());
+        ASSERT(inBuffer(obj));
+    }
+
+    // parseOwned() shares ownership of the message buffer without copying document bytes.
+    auto owned = OpMsg::parseOwned(message);
+    ASSERT(owned.body.isOwned());
+    ASSERT(inBuffer(owned.body));
+    for (auto&& obj : owned.sequences[0].objs) {
+        ASSERT(obj.isOwned());
+        ASSERT(inBuffer(obj));
+    }
+}
+
 TEST_F(OpMsgParser, SucceedsWithSequenceThenBodyThenSequence) {
     auto msg =
         OpMsgBytes{
@@ -34,6 +34,7 @@
 #include "mongo/s/balancer_configuration.h"
 
 #include <algorithm>
+#include <limits>
 #include <boost/date_time/gregorian/gregorian_types.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
@@ -77,6 +78,7 @@ const char kMode[] = "mode";
 const char kActiveWindow[] = "activeWindow";
 const char kWaitForDelete[] = "_waitForDelete";
 const char kAttemptToBalanceJumboChunks[] = "attemptToBalanceJumboChunks";
+const char kMaxConcurrentMigrations[] = "maxConcurrentMigrations";
 
 }  // namespace
 
@@ -181,6 +183,11 @@ bool BalancerConfiguration::attemptToBalanceJumboChunks() const {
     return _balancerSettings.attemptToBalanceJumboChunks();
 }
 
+int BalancerConfiguration::getMaxConcurrentMigrations() const {
+    stdx::lock_guard<Latch> lk(_balancerSettingsMutex);
+    return _balancerSettings.getMaxConcurrentMigrations();
+}
+
 Status BalancerConfiguration::refreshAndCheck(OperationContext* opCtx) {
     // Balancer configuration
     Status balancerSettingsStatus = _refreshBalancerSettings(opCtx);
@@ -387,6 +394,22 @@ StatusWith<BalancerSettingsType> BalancerSettingsType::fromBSON(const BSONObj& o
         settings._attemptToBalanceJumboChunks = attemptToBalanceJumboChunks;
     }
 
+    {
+        long long maxConcurrentMigrations;
+        Status status = bsonExtractIntegerFieldWithDefault(
+            obj, kMaxConcurrentMigrations, 0, &maxConcurrentMigrations);
+        if (!status.isOK())
+            return status;
+        if (maxConcurrentMigrations < 0 ||
+            maxConcurrentMigrations > std::numeric_limits<int>::max()) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << maxConcurrentMigrations << " is not a valid value for "
+                                        << kMaxConcurrentMigrations);
+        }
+
+        settings._maxConcurrentMigrations = static_cast<int>(maxConcurrentMigrations);
+    }
+
     return settings;
 }
 
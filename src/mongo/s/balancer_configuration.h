@@ -52,7 +52,8 @@ class StatusWith;
  * balancer: {
  *  stopped: <true|false>,
  *  mode: <full|autoSplitOnly|off>,         // Only consulted if "stopped" is missing or false
- *  activeWindow: { start: "<HH:MM>", stop: "<HH:MM>" }
+ *  activeWindow: { start: "<HH:MM>", stop: "<HH:MM>" },
+ *  maxConcurrentMigrations: <positive integer, 0 for no limit>
  * }
  */
 class BalancerSettingsType {
@@ -116,6 +117,15 @@ public:
         return _attemptToBalanceJumboChunks;
     }
 
+    /**
+     * Returns the maximum number of migrations, which the balancer may have in flight at any
+     * moment across the entire cluster. A value of zero means no cluster-wide limit beyond the
+     * one migration at a time, in which each individual shard can participate.
+     */
+    int getMaxConcurrentMigrations() const {
+        return _maxConcurrentMigrations;
+    }
+
 private:
     BalancerSettingsType();
 
@@ -129,6 +139,8 @@ private:
     bool _waitForDelete{false};
 
     bool _attemptToBalanceJumboChunks{false};
+
+    int _maxConcurrentMigrations{0};
 };
 
 /**
@@ -253,6 +265,12 @@ public:
      */
     bool attemptToBalanceJumboChunks() const;
 
+    /**
+     * Returns the cluster-wide cap on the number of concurrent chunk migrations, which the
+     * balancer may schedule within a single balancing round. Zero means no limit.
+     */
+    int getMaxConcurrentMigrations() const;
+
     /**
      * Returns the max chunk size after which a chunk would be considered jumbo.
      */
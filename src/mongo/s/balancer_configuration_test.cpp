@@ -238,6 +238,21 @@ TEST(BalancerSettingsType, AllValidBalancerModeOptions) {
                   .getMode());
 }
 
+TEST(BalancerSettingsType, MaxConcurrentMigrations) {
+    ASSERT_EQ(0,
+              assertGet(BalancerSettingsType::fromBSON(BSONObj())).getMaxConcurrentMigrations());
+    ASSERT_EQ(16,
+              assertGet(BalancerSettingsType::fromBSON(BSON("maxConcurrentMigrations" << 16)))
+                  .getMaxConcurrentMigrations());
+}
+
+TEST(BalancerSettingsType, InvalidMaxConcurrentMigrations) {
+    ASSERT_EQ(ErrorCodes::BadValue,
+              BalancerSettingsType::fromBSON(BSON("maxConcurrentMigrations" << -1))
+                  .getStatus()
+                  .code());
+}
+
 TEST(BalancerSettingsType, InvalidBalancerModeOption) {
     ASSERT_EQ(ErrorCodes::BadValue,
               BalancerSettingsType::fromBSON(BSON("mode"
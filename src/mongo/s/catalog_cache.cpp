@@ -401,6 +401,14 @@ void CatalogCache::report(BSONObjBuilder* builder) const {
     _collectionCache.reportStats(&cacheStatsBuilder);
 }
 
+std::vector<NamespaceString> CatalogCache::getCachedCollectionNamespaces() const {
+    std::vector<NamespaceString> namespaces;
+    for (auto&& info : _collectionCache.getCacheInfo()) {
+        namespaces.push_back(std::move(info.key));
+    }
+    return namespaces;
+}
+
 void CatalogCache::checkAndRecordOperationBlockedByRefresh(OperationContext* opCtx,
                                                            mongo::LogicalOp opType) {
     if (!isMongos() || !operationBlockedBehindCatalogCacheRefresh(opCtx)) {
@@ -207,6 +207,12 @@ public:
      */
     void report(BSONObjBuilder* builder) const;
 
+    /**
+     * Returns the namespaces of all collections currently present in the cache, sharded or not.
+     * The result is a point-in-time snapshot; entries may be added or invalidated concurrently.
+     */
+    std::vector<NamespaceString> getCachedCollectionNamespaces() const;
+
     /**
      * Checks if the current operation was ever marked as needing refresh. If the curent operation
      * was marked as needing refresh, updates the relevant counters inside the Stats struct.
@@ -33,6 +33,8 @@
 
 #include "mongo/s/chunk_manager.h"
 
+#include <cstring>
+
 #include "mongo/base/owned_pointer_vector.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/db/matcher/extensions_callback_noop.h"
@@ -42,6 +44,7 @@
 #include "mongo/db/query/query_planner_common.h"
 #include "mongo/db/storage/key_string.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/endian.h"
 #include "mongo/s/chunk_writes_tracker.h"
 #include "mongo/s/mongod_and_mongos_server_parameters_gen.h"
 #include "mongo/s/shard_invalidated_for_targeting_exception.h"
@@ -58,6 +61,16 @@ bool allElementsAreOfType(BSONType type, const BSONObj& obj) {
     return true;
 }
 
+// Packs the first eight bytes of a KeyString into an integer whose comparison agrees with the
+// lexicographic comparison of the original strings as far as the prefix goes. Keys shorter than
+// the prefix are zero-padded, which preserves the ordering because a prefix tie always falls back
+// to a comparison of the full KeyStrings.
+uint64_t makeKeyStringPrefix(StringData keyString) {
+    uint64_t prefix = 0;
+    std::memcpy(&prefix, keyString.rawData(), std::min(keyString.size(), sizeof(prefix)));
+    return endian::bigToNative(prefix);
+}
+
 void checkAllElementsAreOfType(BSONType type, const BSONObj& o) {
     uassert(ErrorCodes::ConflictingOperationInProgress,
             str::stream() << "Not all elements of " << o << " are of type " << typeName(type),
@@ -115,13 +128,13 @@ std::vector<std::shared_ptr<ChunkInfo>> flatten(const std::vector<ChunkType>& ch
 
 ShardVersionMap ChunkMap::constructShardVersionMap() const {
     ShardVersionMap shardVersions;
-    ChunkVector::const_iterator current = _chunkMap.cbegin();
+    Position current{};
 
     boost::optional<BSONObj> firstMin = boost::none;
     boost::optional<BSONObj> lastMax = boost::none;
 
-    while (current != _chunkMap.cend()) {
-        const auto& firstChunkInRange = *current;
+    while (current != _endPosition()) {
+        const auto& firstChunkInRange = _chunkAt(current);
         const auto& currentRangeShardId = firstChunkInRange->getShardIdAt(boost::none);
 
         // Tracks the max shard version for the shard on which the current range will reside
@@ -137,20 +150,18 @@ ShardVersionMap ChunkMap::constructShardVersionMap() const {
 
         auto& maxShardVersion = shardVersionIt->second.shardVersion;
 
-        current =
-            std::find_if(current,
-                         _chunkMap.cend(),
-                         [&currentRangeShardId, &maxShardVersion](const auto& currentChunk) {
-                             if (currentChunk->getShardIdAt(boost::none) != currentRangeShardId)
-                                 return true;
+        auto rangeLast = firstChunkInRange;
+        do {
+            const auto& currentChunk = _chunkAt(current);
+            if (currentChunk->getShardIdAt(boost::none) != currentRangeShardId)
+                break;
 
-                             if (maxShardVersion.isOlderThan(currentChunk->getLastmod()))
-                                 maxShardVersion = currentChunk->getLastmod();
+            if (maxShardVersion.isOlderThan(currentChunk->getLastmod()))
+                maxShardVersion = currentChunk->getLastmod();
 
-                             return false;
-                         });
-
-        const auto rangeLast = *std::prev(current);
+            rangeLast = currentChunk;
+            current = _nextPosition(current);
+        } while (current != _endPosition());
 
         const auto& rangeMin = firstChunkInRange->getMin();
         const auto& rangeMax = rangeLast->getMax();
@@ -179,7 +190,7 @@ ShardVersionMap ChunkMap::constructShardVersionMap() const {
         invariant(maxShardVersion.isSet());
     }
 
-    if (!_chunkMap.empty()) {
+    if (!_slices.empty()) {
         invariant(!shardVersions.empty());
         invariant(firstMin.is_initialized());
         invariant(lastMax.is_initialized());
@@ -192,17 +203,80 @@ ShardVersionMap ChunkMap::constructShardVersionMap() const {
 }
 
 void ChunkMap::appendChunk(const std::shared_ptr<ChunkInfo>& chunk) {
-    appendChunkTo(_chunkMap, chunk);
+    const auto* lastChunk = _lastChunk();
+    if (lastChunk && chunk->getRange().overlaps((*lastChunk)->getRange())) {
+        if ((*lastChunk)->getLastmod().isOlderThan(chunk->getLastmod())) {
+            _popLastChunk();
+            _pushChunk(chunk);
+        }
+    } else {
+        _pushChunk(chunk);
+    }
 
     if (_collectionVersion.isOlderThan(chunk->getLastmod()))
         _collectionVersion = chunk->getLastmod();
 }
 
+void ChunkMap::ChunkSlice::reserve(size_t n) {
+    chunks.reserve(n);
+    maxKeyStringPrefixes.reserve(n);
+}
+
+void ChunkMap::ChunkSlice::push(const std::shared_ptr<ChunkInfo>& chunk) {
+    chunks.push_back(chunk);
+    maxKeyStringPrefixes.push_back(makeKeyStringPrefix(chunk->getMaxKeyString()));
+}
+
+void ChunkMap::ChunkSlice::pop() {
+    chunks.pop_back();
+    maxKeyStringPrefixes.pop_back();
+}
+
+const std::shared_ptr<ChunkInfo>* ChunkMap::_lastChunk() const {
+    if (_slices.empty())
+        return nullptr;
+    return &_slices.back()->chunks.back();
+}
+
+void ChunkMap::_pushChunk(const std::shared_ptr<ChunkInfo>& chunk) {
+    // Start a new slice if the last one is full or is shared with another map, since shared
+    // slices must never be mutated.
+    if (_slices.empty() || _slices.back()->chunks.size() >= _maxChunkSliceSize ||
+        _slices.back().use_count() > 1) {
+        _slices.push_back(std::make_shared<ChunkSlice>());
+        _slices.back()->reserve(_maxChunkSliceSize);
+    }
+
+    _slices.back()->push(chunk);
+    ++_size;
+}
+
+void ChunkMap::_popLastChunk() {
+    invariant(!_slices.empty());
+
+    auto& lastSlice = _slices.back();
+    if (lastSlice.use_count() > 1) {
+        // The slice is shared with another map, so copy it before mutating.
+        lastSlice = std::make_shared<ChunkSlice>(*lastSlice);
+    }
+
+    lastSlice->pop();
+    if (lastSlice->chunks.empty())
+        _slices.pop_back();
+    --_size;
+}
+
+void ChunkMap::_adoptSlice(std::shared_ptr<ChunkSlice> slice) {
+    invariant(!slice->chunks.empty());
+    _size += slice->chunks.size();
+    _slices.push_back(std::move(slice));
+}
+
 std::shared_ptr<ChunkInfo> ChunkMap::findIntersectingChunk(const BSONObj& shardKey) const {
-    const auto it = _findIntersectingChunk(shardKey);
+    const auto pos = _findIntersectingChunk(shardKey);
 
-    if (it != _chunkMap.end())
-        return *it;
+    if (pos != _endPosition())
+        return _chunkAt(pos);
 
     return std::shared_ptr<ChunkInfo>();
 }
@@ -218,41 +292,62 @@ void validateChunk(const std::shared_ptr<ChunkInfo>& chunk, const ChunkVersion&
 
 ChunkMap ChunkMap::createMerged(
     const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks) const {
-    size_t chunkMapIndex = 0;
     size_t changedChunkIndex = 0;
 
-    ChunkMap updatedChunkMap(
-        getVersion().epoch(), getVersion().getTimestamp(), _chunkMap.size() + changedChunks.size());
+    ChunkMap updatedChunkMap(getVersion().epoch(), getVersion().getTimestamp(), _maxChunkSliceSize);
 
-    while (chunkMapIndex < _chunkMap.size() || changedChunkIndex < changedChunks.size()) {
-        if (chunkMapIndex >= _chunkMap.size()) {
-            validateChunk(changedChunks[changedChunkIndex], getVersion());
-            updatedChunkMap.appendChunk(changedChunks[changedChunkIndex++]);
-            continue;
+    // Chunks in slices adopted wholesale below never pass through appendChunk, so seed the
+    // version with this map's collection version, which is the max across all of its chunks;
+    // appended chunks can only raise it.
+    updatedChunkMap._collectionVersion = _collectionVersion;
+
+    // KeyString of the min bound of changedChunks[changedChunkIndex], computed lazily when
+    // deciding whether a slice can be adopted.
+    boost::optional<std::string> changedMinKeyString;
+
+    for (const auto& slice : _slices) {
+        if (changedChunkIndex < changedChunks.size() && !changedMinKeyString) {
+            changedMinKeyString =
+                ShardKeyPattern::toKeyString(changedChunks[changedChunkIndex]->getMin());
         }
 
-        if (changedChunkIndex >= changedChunks.size()) {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
+        // A slice whose chunks all sort before the next changed chunk ends up in the updated map
+        // untouched, so adopt it instead of copying it chunk by chunk. The changed chunks are
+        // disjoint and ordered by max key, so no later one can land inside this slice either.
+        // The first chunk of the slice must also not overlap what has been appended so far,
+        // since appendChunk would drop one of the two.
+        const bool sliceIsBeforeNextChange = changedChunkIndex >= changedChunks.size() ||
+            slice->chunks.back()->getMaxKeyString() <= *changedMinKeyString;
+        const auto* lastChunk = updatedChunkMap._lastChunk();
+        if (sliceIsBeforeNextChange &&
+            !(lastChunk && (*lastChunk)->getRange().overlaps(slice->chunks.front()->getRange()))) {
+            updatedChunkMap._adoptSlice(slice);
             continue;
         }
 
-        auto overlap = _chunkMap[chunkMapIndex]->getRange().overlaps(
-            changedChunks[changedChunkIndex]->getRange());
+        for (const auto& chunkInfo : slice->chunks) {
+            while (changedChunkIndex < changedChunks.size() &&
+                   chunkInfo->getRange().overlaps(changedChunks[changedChunkIndex]->getRange())) {
+                const auto& changedChunk = changedChunks[changedChunkIndex++];
+                changedMinKeyString = boost::none;
 
-        if (overlap) {
-            auto& changedChunk = changedChunks[changedChunkIndex++];
-            auto& chunkInfo = _chunkMap[chunkMapIndex];
+                auto bytesInReplacedChunk = chunkInfo->getWritesTracker()->getBytesWritten();
+                changedChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
 
-            auto bytesInReplacedChunk = chunkInfo->getWritesTracker()->getBytesWritten();
-            changedChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
+                validateChunk(changedChunk, getVersion());
+                updatedChunkMap.appendChunk(changedChunk);
+            }
 
-            validateChunk(changedChunk, getVersion());
-            updatedChunkMap.appendChunk(changedChunk);
-        } else {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
+            updatedChunkMap.appendChunk(chunkInfo);
         }
     }
 
+    while (changedChunkIndex < changedChunks.size()) {
+        const auto& changedChunk = changedChunks[changedChunkIndex++];
+        validateChunk(changedChunk, getVersion());
+        updatedChunkMap.appendChunk(changedChunk);
+    }
+
     return updatedChunkMap;
 }
 
@@ -260,48 +355,100 @@ BSONObj ChunkMap::toBSON() const {
     BSONObjBuilder builder;
 
     builder.append("startingVersion"_sd, getVersion().toBSON());
-    builder.append("chunkCount", static_cast<int64_t>(_chunkMap.size()));
+    builder.append("chunkCount", static_cast<int64_t>(size()));
 
     {
         BSONArrayBuilder arrayBuilder(builder.subarrayStart("chunks"_sd));
-        for (const auto& chunk : _chunkMap) {
-            arrayBuilder.append(chunk->toString());
+        for (const auto& slice : _slices) {
+            for (const auto& chunk : slice->chunks) {
+                arrayBuilder.append(chunk->toString());
+            }
         }
     }
 
     return builder.obj();
 }
 
-ChunkMap::ChunkVector::const_iterator ChunkMap::_findIntersectingChunk(const BSONObj& shardKey,
-                                                                       bool isMaxInclusive) const {
+ChunkMap::Position ChunkMap::_findIntersectingChunk(const BSONObj& shardKey,
+                                                    bool isMaxInclusive) const {
     auto shardKeyString = ShardKeyPattern::toKeyString(shardKey);
+    const auto shardKeyPrefix = makeKeyStringPrefix(shardKeyString);
 
+    // First locate the slice whose last chunk's max places the key inside the slice, then repeat
+    // the same search across the chunks of that slice. Both levels probe the fixed-size
+    // KeyString prefixes and only compare the full KeyStrings on a prefix tie.
     if (!isMaxInclusive) {
-        return std::lower_bound(_chunkMap.begin(),
-                                _chunkMap.end(),
-                                shardKey,
-                                [&shardKeyString](const auto& chunkInfo, const BSONObj& shardKey) {
-                                    return chunkInfo->getMaxKeyString() < shardKeyString;
-                                });
+        auto sliceIt = std::lower_bound(_slices.begin(),
+                                        _slices.end(),
+                                        shardKey,
+                                        [&](const auto& slice, const BSONObj&) {
+                                            const auto slicePrefix =
+                                                slice->maxKeyStringPrefixes.back();
+                                            if (slicePrefix != shardKeyPrefix)
+                                                return slicePrefix < shardKeyPrefix;
+                                            return slice->chunks.back()->getMaxKeyString() <
+                                                shardKeyString;
+                                        });
+        if (sliceIt == _slices.end())
+            return _endPosition();
+
+        const auto& slice = **sliceIt;
+        const auto& prefixes = slice.maxKeyStringPrefixes;
+        auto chunkIt = std::lower_bound(
+            prefixes.begin(),
+            prefixes.end(),
+            shardKeyPrefix,
+            [&](const uint64_t& chunkPrefix, uint64_t keyPrefix) {
+                if (chunkPrefix != keyPrefix)
+                    return chunkPrefix < keyPrefix;
+                // Prefix tie; locate the entry's chunk and compare the full KeyStrings.
+                const size_t chunkIndex = &chunkPrefix - prefixes.data();
+                return slice.chunks[chunkIndex]->getMaxKeyString() < shardKeyString;
+            });
+        return {static_cast<size_t>(sliceIt - _slices.begin()),
+                static_cast<size_t>(chunkIt - prefixes.begin())};
     } else {
-        return std::upper_bound(_chunkMap.begin(),
-                                _chunkMap.end(),
-                                shardKey,
-                                [&shardKeyString](const BSONObj& shardKey, const auto& chunkInfo) {
-                                    return shardKeyString < chunkInfo->getMaxKeyString();
-                                });
+        auto sliceIt = std::upper_bound(_slices.begin(),
+                                        _slices.end(),
+                                        shardKey,
+                                        [&](const BSONObj&, const auto& slice) {
+                                            const auto slicePrefix =
+                                                slice->maxKeyStringPrefixes.back();
+                                            if (slicePrefix != shardKeyPrefix)
+                                                return shardKeyPrefix < slicePrefix;
+                                            return shardKeyString <
+                                                slice->chunks.back()->getMaxKeyString();
+                                        });
+        if (sliceIt == _slices.end())
+            return _endPosition();
+
+        const auto& slice = **sliceIt;
+        const auto& prefixes = slice.maxKeyStringPrefixes;
+        auto chunkIt = std::upper_bound(
+            prefixes.begin(),
+            prefixes.end(),
+            shardKeyPrefix,
+            [&](uint64_t keyPrefix, const uint64_t& chunkPrefix) {
+                if (chunkPrefix != keyPrefix)
+                    return keyPrefix < chunkPrefix;
+                // Prefix tie; locate the entry's chunk and compare the full KeyStrings.
+                const size_t chunkIndex = &chunkPrefix - prefixes.data();
+                return shardKeyString < slice.chunks[chunkIndex]->getMaxKeyString();
+            });
+        return {static_cast<size_t>(sliceIt - _slices.begin()),
+                static_cast<size_t>(chunkIt - prefixes.begin())};
     }
 }
 
-std::pair<ChunkMap::ChunkVector::const_iterator, ChunkMap::ChunkVector::const_iterator>
-ChunkMap::_overlappingBounds(const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const {
-    const auto itMin = _findIntersectingChunk(min);
-    const auto itMax = [&]() {
-        auto it = _findIntersectingChunk(max, isMaxInclusive);
-        return it == _chunkMap.end() ? it : ++it;
+std::pair<ChunkMap::Position, ChunkMap::Position> ChunkMap::_overlappingBounds(
+    const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const {
+    const auto posMin = _findIntersectingChunk(min);
+    const auto posMax = [&]() {
+        auto pos = _findIntersectingChunk(max, isMaxInclusive);
+        return pos == _endPosition() ? pos : _nextPosition(pos);
     }();
 
-    return {itMin, itMax};
+    return {posMin, posMax};
 }
 
 ShardVersionTargetingInfo::ShardVersionTargetingInfo(const OID& epoch,
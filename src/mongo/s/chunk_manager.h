@@ -76,15 +76,20 @@ class ChunkMap {
     using ChunkVector = std::vector<std::shared_ptr<ChunkInfo>>;
 
 public:
+    // The default maximum number of chunks held by a single slice of the map. Bounding the slice
+    // size caps the work createMerged() performs per changed chunk, since only the slices a
+    // change touches are copied while the rest are shared with the source map.
+    static constexpr size_t kDefaultMaxChunkSliceSize = 512;
+
     explicit ChunkMap(OID epoch,
                       const boost::optional<Timestamp>& timestamp,
-                      size_t initialCapacity = 0)
-        : _collectionVersion(0, 0, epoch, timestamp) {
-        _chunkMap.reserve(initialCapacity);
+                      size_t maxChunkSliceSize = kDefaultMaxChunkSliceSize)
+        : _collectionVersion(0, 0, epoch, timestamp), _maxChunkSliceSize(maxChunkSliceSize) {
+        invariant(_maxChunkSliceSize > 0);
     }
 
     size_t size() const {
-        return _chunkMap.size();
+        return _size;
     }
 
     ChunkVersion getVersion() const {
@@ -93,10 +98,10 @@ public:
 
     template <typename Callable>
     void forEach(Callable&& handler, const BSONObj& shardKey = BSONObj()) const {
-        auto it = shardKey.isEmpty() ? _chunkMap.begin() : _findIntersectingChunk(shardKey);
+        auto pos = shardKey.isEmpty() ? Position{} : _findIntersectingChunk(shardKey);
 
-        for (; it != _chunkMap.end(); ++it) {
-            if (!handler(*it))
+        for (; pos != _endPosition(); pos = _nextPosition(pos)) {
+            if (!handler(_chunkAt(pos)))
                 break;
         }
     }
@@ -108,8 +113,8 @@ public:
                                  Callable&& handler) const {
         const auto bounds = _overlappingBounds(min, max, isMaxInclusive);
 
-        for (auto it = bounds.first; it != bounds.second; ++it) {
-            if (!handler(*it))
+        for (auto pos = bounds.first; pos != bounds.second; pos = _nextPosition(pos)) {
+            if (!handler(_chunkAt(pos)))
                 break;
         }
     }
@@ -124,15 +129,75 @@ public:
     BSONObj toBSON() const;
 
 private:
-    ChunkVector::const_iterator _findIntersectingChunk(const BSONObj& shardKey,
-                                                       bool isMaxInclusive = true) const;
-    std::pair<ChunkVector::const_iterator, ChunkVector::const_iterator> _overlappingBounds(
-        const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const;
+    // A position in the map, given by a slice index and the index of a chunk within that slice.
+    // One past the last slice (with chunk index zero) is the end position.
+    struct Position {
+        size_t sliceIndex = 0;
+        size_t chunkIndex = 0;
+
+        bool operator==(const Position& other) const {
+            return sliceIndex == other.sliceIndex && chunkIndex == other.chunkIndex;
+        }
+        bool operator!=(const Position& other) const {
+            return !(*this == other);
+        }
+    };
+
+    // A contiguous slice of the chunk vector, together with a flat sidecar array holding a
+    // fixed-size prefix of each chunk's max KeyString. The binary searches probe the prefix
+    // array, which fits many entries per cache line, and only fall back to comparing the full
+    // KeyStrings of the ChunkInfo on a prefix tie.
+    struct ChunkSlice {
+        ChunkVector chunks;
+        std::vector<uint64_t> maxKeyStringPrefixes;
+
+        void reserve(size_t n);
+        void push(const std::shared_ptr<ChunkInfo>& chunk);
+        void pop();
+    };
+
+    const std::shared_ptr<ChunkInfo>& _chunkAt(const Position& pos) const {
+        return _slices[pos.sliceIndex]->chunks[pos.chunkIndex];
+    }
+
+    Position _nextPosition(Position pos) const {
+        if (++pos.chunkIndex >= _slices[pos.sliceIndex]->chunks.size()) {
+            ++pos.sliceIndex;
+            pos.chunkIndex = 0;
+        }
+        return pos;
+    }
+
+    Position _endPosition() const {
+        return {_slices.size(), 0};
+    }
+
+    Position _findIntersectingChunk(const BSONObj& shardKey, bool isMaxInclusive = true) const;
+    std::pair<Position, Position> _overlappingBounds(const BSONObj& min,
+                                                     const BSONObj& max,
+                                                     bool isMaxInclusive) const;
 
-    ChunkVector _chunkMap;
+    // Returns a pointer to the last chunk in the map, or nullptr if the map is empty.
+    const std::shared_ptr<ChunkInfo>* _lastChunk() const;
+
+    void _pushChunk(const std::shared_ptr<ChunkInfo>& chunk);
+    void _popLastChunk();
+    void _adoptSlice(std::shared_ptr<ChunkSlice> slice);
+
+    // Contiguous, never-empty slices of the chunk vector, ordered by max key, holding at most
+    // _maxChunkSliceSize chunks each. createMerged() shares the slices its changes do not touch
+    // with the map it produces, so a routing table update is proportional to the number of
+    // changed chunks rather than to the size of the whole map.
+    std::vector<std::shared_ptr<ChunkSlice>> _slices;
+
+    // Total number of chunks across all slices.
+    size_t _size{0};
 
     // Max version across all chunks
     ChunkVersion _collectionVersion;
+
+    // Upper bound on the number of chunks a single slice may hold.
+    size_t _maxChunkSliceSize;
 };
 
 /**
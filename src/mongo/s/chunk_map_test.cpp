@@ -165,4 +165,156 @@ TEST_F(ChunkMapTest, TestEnumerateOverlappingChunks) {
     ASSERT_EQ(count, 3);
 }
 
+TEST_F(ChunkMapTest, TestIntersectingChunkWithLongCommonKeyPrefix) {
+    const OID epoch = OID::gen();
+    ChunkVersion version{1, 0, epoch, boost::none /* timestamp */};
+    ChunkMap chunkMap{epoch, boost::none /* timestamp */};
+
+    // Split points share a common prefix far longer than the fixed-size KeyString prefix probed
+    // by the binary search, forcing the full-comparison fallback on every probe.
+    const std::string commonPrefix = "someVeryLongSharedShardKeyPrefix-";
+
+    auto newChunkMap = chunkMap.createMerged(
+        {std::make_shared<ChunkInfo>(ChunkType{kNss,
+                                               ChunkRange{getShardKeyPattern().globalMin(),
+                                                          BSON("a" << commonPrefix + "b")},
+                                               version,
+                                               kThisShard}),
+
+         std::make_shared<ChunkInfo>(ChunkType{kNss,
+                                               ChunkRange{BSON("a" << commonPrefix + "b"),
+                                                          BSON("a" << commonPrefix + "d")},
+                                               version,
+                                               kThisShard}),
+
+         std::make_shared<ChunkInfo>(ChunkType{kNss,
+                                               ChunkRange{BSON("a" << commonPrefix + "d"),
+                                                          getShardKeyPattern().globalMax()},
+                                               version,
+                                               kThisShard})});
+
+    auto intersectingChunk = newChunkMap.findIntersectingChunk(BSON("a" << commonPrefix + "c"));
+    ASSERT(intersectingChunk);
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMin() ==
+                                                       BSON("a" << commonPrefix + "b")));
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMax() ==
+                                                       BSON("a" << commonPrefix + "d")));
+
+    // A key equal to a chunk's max bound belongs to the next chunk.
+    intersectingChunk = newChunkMap.findIntersectingChunk(BSON("a" << commonPrefix + "d"));
+    ASSERT(intersectingChunk);
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMin() ==
+                                                       BSON("a" << commonPrefix + "d")));
+}
+
+TEST_F(ChunkMapTest, TestEnumerateChunksAcrossSlices) {
+    const OID epoch = OID::gen();
+    ChunkVersion version{1, 0, epoch, boost::none /* timestamp */};
+    ChunkMap chunkMap{epoch, boost::none /* timestamp */, 2 /* maxChunkSliceSize */};
+
+    std::vector<std::shared_ptr<ChunkInfo>> chunks;
+    auto min = getShardKeyPattern().globalMin();
+    for (int i = 0; i < 6; ++i) {
+        auto max = i == 5 ? getShardKeyPattern().globalMax() : BSON("a" << (i + 1) * 10);
+        chunks.push_back(
+            std::make_shared<ChunkInfo>(ChunkType{kNss, ChunkRange{min, max}, version, kThisShard}));
+        min = max;
+    }
+
+    auto newChunkMap = chunkMap.createMerged(chunks);
+    ASSERT_EQ(newChunkMap.size(), 6);
+
+    int count = 0;
+    auto lastMax = getShardKeyPattern().globalMin();
+
+    newChunkMap.forEach([&](const auto& chunkInfo) {
+        ASSERT(SimpleBSONObjComparator::kInstance.evaluate(chunkInfo->getMax() > lastMax));
+        lastMax = chunkInfo->getMax();
+        count++;
+
+        return true;
+    });
+
+    ASSERT_EQ(count, newChunkMap.size());
+
+    // A lookup that lands in the middle of a slice and one landing in the last slice.
+    auto intersectingChunk = newChunkMap.findIntersectingChunk(BSON("a" << 25));
+    ASSERT(intersectingChunk);
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMin() ==
+                                                       BSON("a" << 20)));
+
+    intersectingChunk = newChunkMap.findIntersectingChunk(BSON("a" << 55));
+    ASSERT(intersectingChunk);
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMin() ==
+                                                       BSON("a" << 50)));
+
+    // An overlap scan spanning a slice boundary.
+    count = 0;
+    newChunkMap.forEachOverlappingChunk(BSON("a" << 15), BSON("a" << 35), true, [&](const auto&) {
+        count++;
+        return true;
+    });
+    ASSERT_EQ(count, 3);
+}
+
+TEST_F(ChunkMapTest, TestSplitChunkInMapWithSmallSlices) {
+    const OID epoch = OID::gen();
+    ChunkVersion version{1, 0, epoch, boost::none /* timestamp */};
+    ChunkMap chunkMap{epoch, boost::none /* timestamp */, 2 /* maxChunkSliceSize */};
+
+    std::vector<std::shared_ptr<ChunkInfo>> chunks;
+    auto min = getShardKeyPattern().globalMin();
+    for (int i = 0; i < 6; ++i) {
+        auto max = i == 5 ? getShardKeyPattern().globalMax() : BSON("a" << (i + 1) * 10);
+        chunks.push_back(
+            std::make_shared<ChunkInfo>(ChunkType{kNss, ChunkRange{min, max}, version, kThisShard}));
+        min = max;
+    }
+
+    auto newChunkMap = chunkMap.createMerged(chunks);
+
+    // Split the chunk [20, 30) in the middle of the map; the surrounding slices are unchanged.
+    ChunkVersion splitVersion{2, 0, epoch, boost::none /* timestamp */};
+    auto updatedChunkMap = newChunkMap.createMerged(
+        {std::make_shared<ChunkInfo>(
+             ChunkType{kNss, ChunkRange{BSON("a" << 20), BSON("a" << 25)}, splitVersion, kThisShard}),
+
+         std::make_shared<ChunkInfo>(
+             ChunkType{kNss,
+                       ChunkRange{BSON("a" << 25), BSON("a" << 30)},
+                       ChunkVersion{2, 1, epoch, boost::none /* timestamp */},
+                       kThisShard})});
+
+    ASSERT_EQ(updatedChunkMap.size(), 7);
+    ASSERT(updatedChunkMap.getVersion() ==
+           ChunkVersion(2, 1, epoch, boost::none /* timestamp */));
+
+    int count = 0;
+    auto lastMax = getShardKeyPattern().globalMin();
+
+    updatedChunkMap.forEach([&](const auto& chunkInfo) {
+        ASSERT(SimpleBSONObjComparator::kInstance.evaluate(chunkInfo->getMax() > lastMax));
+        lastMax = chunkInfo->getMax();
+        count++;
+
+        return true;
+    });
+
+    ASSERT_EQ(count, updatedChunkMap.size());
+
+    auto intersectingChunk = updatedChunkMap.findIntersectingChunk(BSON("a" << 27));
+    ASSERT(intersectingChunk);
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMin() ==
+                                                       BSON("a" << 25)));
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMax() ==
+                                                       BSON("a" << 30)));
+
+    // The original map is unaffected by the update.
+    ASSERT_EQ(newChunkMap.size(), 6);
+    intersectingChunk = newChunkMap.findIntersectingChunk(BSON("a" << 27));
+    ASSERT(intersectingChunk);
+    ASSERT(SimpleBSONObjComparator::kInstance.evaluate(intersectingChunk->getMin() ==
+                                                       BSON("a" << 20)));
+}
+
 }  // namespace mongo
\ No newline at end of file
@@ -42,6 +42,29 @@ uint64_t ChunkWritesTracker::clearBytesWritten() {
     return _bytesWritten.swap(0);
 }
 
+void ChunkWritesTracker::sampleKeyWritten(const BSONObj& shardKey) {
+    stdx::lock_guard<Latch> lk(_mtx);
+    auto n = ++_keysWritten;
+    if (_sampledKeys.size() < kSampledKeysCapacity) {
+        _sampledKeys.push_back(shardKey.getOwned());
+        return;
+    }
+    auto slot = static_cast<size_t>(_prng.nextInt64(n));
+    if (slot < kSampledKeysCapacity) {
+        _sampledKeys[slot] = shardKey.getOwned();
+    }
+}
+
+std::vector<BSONObj> ChunkWritesTracker::getSampledKeys() {
+    stdx::lock_guard<Latch> lk(_mtx);
+    return _sampledKeys;
+}
+
+uint64_t ChunkWritesTracker::getKeysWritten() {
+    stdx::lock_guard<Latch> lk(_mtx);
+    return _keysWritten;
+}
+
 bool ChunkWritesTracker::shouldSplit(uint64_t maxChunkSize) {
     if (_isLockedForSplitting) {
         return false;
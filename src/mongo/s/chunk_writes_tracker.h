@@ -29,8 +29,12 @@
 
 #pragma once
 
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/platform/random.h"
 
 namespace mongo {
 
@@ -42,6 +46,11 @@ public:
      */
     static constexpr uint64_t kSplitTestFactor = 5;
 
+    /**
+     * The number of shard keys retained in the reservoir sample of keys written to the chunk.
+     */
+    static constexpr size_t kSampledKeysCapacity = 128;
+
     /**
      * Add more bytes written to the chunk.
      */
@@ -62,6 +71,23 @@ public:
      */
     uint64_t clearBytesWritten();
 
+    /**
+     * Offers the shard key of a document written to the chunk to the reservoir sample. Every key
+     * offered since the tracker was created has an equal probability of being retained,
+     * irrespective of arrival order.
+     */
+    void sampleKeyWritten(const BSONObj& shardKey);
+
+    /**
+     * Returns a copy of the sampled shard keys, in no particular order.
+     */
+    std::vector<BSONObj> getSampledKeys();
+
+    /**
+     * Returns the number of keys that have been offered to the reservoir so far.
+     */
+    uint64_t getKeysWritten();
+
     /**
      * Returns whether or not this chunk is ready to be split based on the
      * maximum allowable size of a chunk.
@@ -87,7 +113,7 @@ private:
     AtomicWord<unsigned long long> _bytesWritten{0};
 
     /**
-     * Protects _splitState when starting a split.
+     * Protects _splitState when starting a split, as well as the sampled keys reservoir.
      */
     Mutex _mtx = MONGO_MAKE_LATCH("ChunkWritesTracker::_mtx");
 
@@ -95,6 +121,14 @@ private:
      * Whether or not a current split is in progress for this chunk.
      */
     bool _isLockedForSplitting{false};
+
+    /**
+     * Reservoir sample (algorithm R) of the shard keys written to this chunk, and the total
+     * number of keys offered to it.
+     */
+    std::vector<BSONObj> _sampledKeys;
+    uint64_t _keysWritten{0};
+    PseudoRandom _prng{SecureRandom().nextInt64()};
 };
 
 }  // namespace mongo
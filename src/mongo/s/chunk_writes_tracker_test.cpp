@@ -31,6 +31,7 @@
 
 #include "mongo/s/chunk_writes_tracker.h"
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/unittest.h"
 
@@ -84,6 +85,31 @@ TEST(ChunkWritesTrackerTest, ShouldSplitReturnsTrueWithBytesWrittenGreaterThanMa
     ASSERT_TRUE(wt.shouldSplit(maxChunkSize));
 }
 
+TEST(ChunkWritesTrackerTest, SampledKeysStartEmpty) {
+    ChunkWritesTracker wt;
+    ASSERT_EQ(wt.getSampledKeys().size(), 0ull);
+    ASSERT_EQ(wt.getKeysWritten(), 0ull);
+}
+
+TEST(ChunkWritesTrackerTest, SampleKeyWrittenRetainsEveryKeyUntilCapacity) {
+    ChunkWritesTracker wt;
+    for (size_t i = 0; i < ChunkWritesTracker::kSampledKeysCapacity; ++i) {
+        wt.sampleKeyWritten(BSON("a" << static_cast<long long>(i)));
+    }
+    ASSERT_EQ(wt.getSampledKeys().size(), ChunkWritesTracker::kSampledKeysCapacity);
+    ASSERT_EQ(wt.getKeysWritten(), ChunkWritesTracker::kSampledKeysCapacity);
+}
+
+TEST(ChunkWritesTrackerTest, SampleKeyWrittenDoesNotGrowPastCapacity) {
+    ChunkWritesTracker wt;
+    const size_t keysToWrite = ChunkWritesTracker::kSampledKeysCapacity * 3;
+    for (size_t i = 0; i < keysToWrite; ++i) {
+        wt.sampleKeyWritten(BSON("a" << static_cast<long long>(i)));
+    }
+    ASSERT_EQ(wt.getSampledKeys().size(), ChunkWritesTracker::kSampledKeysCapacity);
+    ASSERT_EQ(wt.getKeysWritten(), keysToWrite);
+}
+
 TEST(ChunkWritesTrackerTest, ShouldSplitReturnsFalseWithBytesWrittenLessThanThreshold) {
     ChunkWritesTracker wt;
     uint64_t maxChunkSize{10};
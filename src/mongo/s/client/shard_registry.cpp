@@ -54,6 +54,22 @@ namespace {
 
 const Seconds kRefreshPeriod(30);
 
+/**
+ * Per-client cache of the last registry snapshot seen by the "NoReload" accessors. It is
+ * revalidated against the registry's snapshot generation on every use, so its only effect is to
+ * avoid contending on the snapshot's atomic reference count from every dispatch thread.
+ */
+struct ClientSnapshotCache {
+    long long generation{0};
+    std::shared_ptr<const ShardRegistryData> data;
+};
+
+const auto clientSnapshotCache = Client::declareDecoration<ClientSnapshotCache>();
+
+// Generation numbers for published registry snapshots are drawn from a single process-wide
+// counter so that a given generation value can never refer to two different snapshots.
+AtomicWord<long long> nextSnapshotGeneration{0};
+
 /**
  * Whether or not the actual topologyTime should be used.  When this is false, the
  * topologyTime part of the cache's Time will stay fixed and not advance.
@@ -111,8 +127,10 @@ void ShardRegistry::init(ServiceContext* service) {
                 "configServers"_attr = _initConfigServerCS.toString());
     {
         stdx::lock_guard<Latch> lk(_mutex);
-        _configShardData = ShardRegistryData::createWithConfigShardOnly(
-            _shardFactory->createShard(ShardId::kConfigServerId, _initConfigServerCS));
+        atomic_store(&_configShardData,
+                     std::make_shared<const ShardRegistryData>(
+                         ShardRegistryData::createWithConfigShardOnly(_shardFactory->createShard(
+                             ShardId::kConfigServerId, _initConfigServerCS))));
         _latestConnStrings[_initConfigServerCS.getSetName()] = _initConfigServerCS;
     }
 
@@ -210,6 +228,11 @@ ShardRegistry::Cache::LookupResult ShardRegistry::_lookup(OperationContext* opCt
                 "Finished ShardRegistry::_lookup",
                 "returnData"_attr = returnData.toBSON(),
                 "returnTime"_attr = returnTime);
+
+    // Make the new data available to the lock-free "NoReload" accessors before handing it over to
+    // the cache.
+    _publishSnapshot(returnData);
+
     return Cache::LookupResult{returnData, returnTime};
 }
 
@@ -320,8 +343,7 @@ ConnectionString ShardRegistry::getConfigServerConnectionString() const {
 }
 
 std::shared_ptr<Shard> ShardRegistry::getConfigShard() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    return _configShardData.findShard(ShardId::kConfigServerId);
+    return _getConfigShardData()->findShard(ShardId::kConfigServerId);
 }
 
 StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opCtx,
@@ -333,11 +355,8 @@ StatusWith<std::shared_ptr<Shard>> ShardRegistry::getShard(OperationContext* opC
     }
 
     // then check if this is a config shard (this call is blocking in any case)
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (auto shard = _configShardData.findShard(shardId)) {
-            return shard;
-        }
+    if (auto shard = _getConfigShardData()->findShard(shardId)) {
+        return shard;
     }
 
     // Reload and try again if the shard was not in the registry
@@ -403,10 +422,12 @@ void ShardRegistry::updateReplSetHosts(const ConnectionString& givenConnString,
 
         _latestConnStrings[setName] = newConnString;
 
-        if (auto shard = _configShardData.findByRSName(setName)) {
-            auto newData = ShardRegistryData::createFromExisting(
-                _configShardData, newConnString, _shardFactory.get());
-            _configShardData = newData;
+        auto configShardData = _getConfigShardData();
+        if (auto shard = configShardData->findByRSName(setName)) {
+            atomic_store(&_configShardData,
+                         std::make_shared<const ShardRegistryData>(
+                             ShardRegistryData::createFromExisting(
+                                 *configShardData, newConnString, _shardFactory.get())));
 
         } else {
             auto value = _rsmIncrement.addAndFetch(1);
@@ -446,10 +467,7 @@ void ShardRegistry::toBSON(BSONObjBuilder* result) const {
     BSONObjBuilder connStrings;
     auto data = _getCachedData();
     data->toBSON(&map, &hosts, &connStrings);
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        _configShardData.toBSON(&map, &hosts, &connStrings);
-    }
+    _getConfigShardData()->toBSON(&map, &hosts, &connStrings);
     result->append("map", map.obj());
     result->append("hosts", hosts.obj());
     result->append("connStrings", connStrings.obj());
@@ -466,6 +484,10 @@ void ShardRegistry::reload(OperationContext* opCtx) {
 
 void ShardRegistry::clearEntries() {
     _cache->invalidateAll();
+
+    // Also reset the snapshot served by the "NoReload" accessors, so that they keep behaving as
+    // if the registry were empty until the next lookup completes.
+    _publishSnapshot(ShardRegistryData());
 }
 
 void ShardRegistry::updateReplicaSetOnConfigServer(ServiceContext* serviceContext,
@@ -553,51 +575,84 @@ ShardRegistry::Cache::ValueHandle ShardRegistry::_getCachedData() const {
     return _cache->peekLatestCached(_kSingleton);
 }
 
+std::shared_ptr<const ShardRegistryData> ShardRegistry::_getConfigShardData() const {
+    static const auto kEmptyData = std::make_shared<const ShardRegistryData>();
+    auto data = atomic_load(&_configShardData);
+    return data ? data : kEmptyData;
+}
+
+void ShardRegistry::_publishSnapshot(ShardRegistryData data) {
+    // The new snapshot must become visible before the generation it will be validated against,
+    // so that a reader which observes the new generation is guaranteed to load at least this
+    // snapshot.
+    atomic_store(&_latestSnapshot, std::make_shared<const ShardRegistryData>(std::move(data)));
+    _snapshotGeneration.store(nextSnapshotGeneration.addAndFetch(1));
+}
+
+std::shared_ptr<const ShardRegistryData> ShardRegistry::_getSnapshot() const {
+    const auto generation = _snapshotGeneration.load();
+    if (generation == 0) {
+        // No lookup has completed yet.
+        return nullptr;
+    }
+
+    auto* const client = Client::getCurrent();
+    if (!client) {
+        return atomic_load(&_latestSnapshot);
+    }
+
+    auto& cached = clientSnapshotCache(client);
+    if (cached.generation != generation || !cached.data) {
+        cached.generation = generation;
+        cached.data = atomic_load(&_latestSnapshot);
+    }
+    return cached.data;
+}
+
 std::shared_ptr<Shard> ShardRegistry::getShardNoReload(const ShardId& shardId) const {
     // First check if this is a config shard lookup.
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (auto shard = _configShardData.findShard(shardId)) {
-            return shard;
-        }
+    if (auto shard = _getConfigShardData()->findShard(shardId)) {
+        return shard;
     }
-    auto data = _getCachedData();
-    return data->findShard(shardId);
+    if (auto data = _getSnapshot()) {
+        return data->findShard(shardId);
+    }
+    return nullptr;
 }
 
 std::shared_ptr<Shard> ShardRegistry::getShardForHostNoReload(const HostAndPort& host) const {
     // First check if this is a config shard lookup.
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (auto shard = _configShardData.findByHostAndPort(host)) {
-            return shard;
-        }
+    if (auto shard = _getConfigShardData()->findByHostAndPort(host)) {
+        return shard;
     }
-    auto data = _getCachedData();
-    return data->findByHostAndPort(host);
+    if (auto data = _getSnapshot()) {
+        return data->findByHostAndPort(host);
+    }
+    return nullptr;
 }
 
 std::vector<ShardId> ShardRegistry::getAllShardIdsNoReload() const {
-    auto shardIds = _getCachedData()->getAllShardIds();
+    auto data = _getSnapshot();
+    auto shardIds = data ? data->getAllShardIds() : std::vector<ShardId>();
     // Many logic in the codebase rely on this vector to be sorted.
     std::sort(shardIds.begin(), shardIds.end());
     return shardIds;
 }
 
 int ShardRegistry::getNumShardsNoReload() const {
-    return _getCachedData()->getAllShardIds().size();
+    auto data = _getSnapshot();
+    return data ? data->getAllShardIds().size() : 0;
 }
 
 std::shared_ptr<Shard> ShardRegistry::_getShardForRSNameNoReload(const std::string& name) const {
     // First check if this is a config shard lookup.
-    {
-        stdx::lock_guard<Latch> lk(_mutex);
-        if (auto shard = _configShardData.findByRSName(name)) {
-            return shard;
-        }
+    if (auto shard = _getConfigShardData()->findByRSName(name)) {
+        return shard;
     }
-    auto data = _getCachedData();
-    return data->findByRSName(name);
+    if (auto data = _getSnapshot()) {
+        return data->findByRSName(name);
+    }
+    return nullptr;
 }
 
 ////////////// ShardRegistryData //////////////////
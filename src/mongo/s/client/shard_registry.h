@@ -413,6 +413,24 @@ private:
      */
     Cache::ValueHandle _getCachedData() const;
 
+    /**
+     * Returns an immutable snapshot containing the config shard. Never returns nullptr, even
+     * before init() has run.
+     */
+    std::shared_ptr<const ShardRegistryData> _getConfigShardData() const;
+
+    /**
+     * Publishes 'data' as the new immutable snapshot served by the "NoReload" accessors.
+     */
+    void _publishSnapshot(ShardRegistryData data);
+
+    /**
+     * Returns the latest published snapshot without taking any locks, preferring the copy cached
+     * on the current Client when it is not stale. Returns nullptr if no lookup has completed yet.
+     * TODO SERVER-50206: Remove usage of this non-causally consistent accessor.
+     */
+    std::shared_ptr<const ShardRegistryData> _getSnapshot() const;
+
     /**
      * Lookup shard by replica set name. Returns nullptr if the name can't be found.
      * Note: this doesn't refresh the table if the name isn't found, so it's possible that a
@@ -463,11 +481,20 @@ private:
     AtomicWord<Increment> _rsmIncrement{0};
     AtomicWord<Increment> _forceReloadIncrement{0};
 
-    // Protects _configShardData, and _latestNewConnStrings.
+    // Protects _latestConnStrings and serializes replacements of _configShardData.
     mutable Mutex _mutex = MONGO_MAKE_LATCH("ShardRegistry::_mutex");
 
-    // Store a reference to the configShard.
-    ShardRegistryData _configShardData;
+    // Immutable snapshot containing the config shard. Read lock-free (via atomic loads of the
+    // shared_ptr) on the dispatch path of every sharded operation and replaced wholesale under
+    // '_mutex' on the rare occasions the config server connection string changes.
+    std::shared_ptr<const ShardRegistryData> _configShardData;
+
+    // Latest-known registry data, published as an immutable snapshot every time a lookup
+    // completes and read lock-free by the "NoReload" accessors. The generation is drawn from a
+    // process-wide counter on each publish and lets readers validate the snapshot copy cached on
+    // their Client. Zero means no snapshot has been published yet.
+    std::shared_ptr<const ShardRegistryData> _latestSnapshot;
+    AtomicWord<long long> _snapshotGeneration{0};
 
     // The key is replset name (the type is ShardId just to take advantage of its hasher).
     LatestConnStrings _latestConnStrings;
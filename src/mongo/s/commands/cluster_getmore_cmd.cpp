@@ -102,6 +102,12 @@ public:
             auto bob = reply->getBodyBuilder();
             auto response = uassertStatusOK(ClusterFind::runGetMore(opCtx, _request));
             response.addToBSON(CursorResponse::ResponseType::SubsequentResponse, &bob);
+
+            if (response.getCursorId() != 0 && opCtx->isExhaust()) {
+                // Indicate that an exhaust message should be generated and the previous BSONObj
+                // command parameters should be reused as the next BSONObj command parameters.
+                reply->setNextInvocation(boost::none);
+            }
         }
 
         const GetMoreRequest _request;
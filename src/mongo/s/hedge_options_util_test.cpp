@@ -92,11 +92,14 @@ protected:
 
     static inline const std::string kReadHedgingModeFieldName = "readHedgingMode";
     static inline const std::string kMaxTimeMSForHedgedReadsFieldName = "maxTimeMSForHedgedReads";
+    static inline const std::string kHedgingDelayMSFieldName = "hedgingDelayMS";
     static inline const int kMaxTimeMSForHedgedReadsDefault = 10;
+    static inline const int kHedgingDelayMSDefault = 0;
 
     static inline const BSONObj kDefaultParameters =
         BSON(kReadHedgingModeFieldName << "on" << kMaxTimeMSForHedgedReadsFieldName
-                                       << kMaxTimeMSForHedgedReadsDefault);
+                                       << kMaxTimeMSForHedgedReadsDefault
+                                       << kHedgingDelayMSFieldName << kHedgingDelayMSDefault);
 
 private:
     ServiceContext::UniqueServiceContext _serviceCtx = ServiceContext::make();
@@ -122,6 +125,21 @@ TEST_F(HedgeOptionsUtilTestFixture, ImplicitOperationHedging) {
     checkHedgeOptions(parameters, cmdObj, rspObj, true);
 }
 
+TEST_F(HedgeOptionsUtilTestFixture, HedgingDelay) {
+    const auto parameters = BSON(kHedgingDelayMSFieldName << 25);
+    const auto cmdObj = BSON("find" << kCollName);
+    const auto rspObj = BSON("mode"
+                             << "nearest"
+                             << "hedge" << BSONObj());
+
+    setParameters(parameters);
+
+    auto readPref = uassertStatusOK(ReadPreferenceSetting::fromInnerBSON(rspObj));
+    auto hedgeOptions = extractHedgeOptions(cmdObj, readPref);
+    ASSERT_TRUE(hedgeOptions.has_value());
+    ASSERT_EQ(hedgeOptions->delayMS, 25);
+}
+
 TEST_F(HedgeOptionsUtilTestFixture, BlacklistAggregate) {
     const auto parameters = BSONObj();
     const auto cmdObj =
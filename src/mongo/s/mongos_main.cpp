@@ -467,6 +467,8 @@ Status initializeSharding(OperationContext* opCtx) {
 
     Grid::get(opCtx)->setShardingInitialized();
 
+    startRoutingTableSnapshotTask(opCtx->getServiceContext());
+
     return Status::OK();
 }
 
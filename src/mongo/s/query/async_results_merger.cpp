@@ -93,6 +93,16 @@ int compareSortKeys(BSONObj leftSortKey, BSONObj rightSortKey, BSONObj sortKeyPa
     return leftSortKey.woCompare(rightSortKey, sortKeyPattern, rules);
 }
 
+/**
+ * Encodes 'sortKey' with KeyString, baking the sort directions in 'ordering' into the encoding.
+ * The resulting values order the same way the corresponding BSON sort keys do under
+ * compareSortKeys(), but compare with a single memcmp.
+ */
+KeyString::Value encodeSortKey(BSONObj sortKey, const Ordering& ordering) {
+    KeyString::Builder builder(KeyString::Version::kLatestVersion, sortKey, ordering);
+    return builder.getValueCopy();
+}
+
 }  // namespace
 
 AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
@@ -105,8 +115,8 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(params.getTailableMode().value_or(TailableModeEnum::kNormal)),
       _params(std::move(params)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _sortKeyOrdering(Ordering::make(_params.getSort().value_or(BSONObj()))),
+      _mergeQueue(MergingComparator(_remotes)),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (params.getTxnNumber()) {
         invariant(params.getSessionId());
@@ -371,6 +381,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
 
     ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
     _remotes[smallestRemote].docBuffer.pop();
+    _remotes[smallestRemote].sortKeyBuffer.pop();
 
     // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
     // next result.
@@ -389,7 +400,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     return front;
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock lk) {
     size_t remotesAttempted = 0;
     while (remotesAttempted < _remotes.size()) {
         // It is illegal to call this method if there is an error received from any shard.
@@ -405,6 +416,16 @@ ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
                 // means that the next value returned should be boost::none to indicate the end of
                 // the batch.
                 _eofNext = true;
+            } else if (_tailableMode == TailableModeEnum::kNormal && _opCtx &&
+                       !_remotes[_gettingFromRemote].hasNext() &&
+                       !_remotes[_gettingFromRemote].exhausted() &&
+                       !_remotes[_gettingFromRemote].cbHandle.isValid()) {
+                // We just drained this remote's buffer. Eagerly ask it for its next batch so the
+                // fetch happens while the caller consumes the results buffered from the other
+                // shards, instead of stalling for a full round trip to the slowest shard once
+                // every buffer runs dry. If the attempt to schedule fails, the error is dropped
+                // here and will resurface on the next nextEvent() call.
+                _askForNextBatch(lk, _gettingFromRemote).ignore();
             }
 
             return front;
@@ -709,6 +730,8 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
         remote.partialResultsReturned = (remote.status != ErrorCodes::ExchangePassthrough);
         std::queue<ClusterQueryResult> emptyBuffer;
         std::swap(remote.docBuffer, emptyBuffer);
+        std::queue<KeyString::Value> emptySortKeyBuffer;
+        std::swap(remote.sortKeyBuffer, emptySortKeyBuffer);
         remote.status = Status::OK();
         remote.cursorId = 0;
     }
@@ -785,6 +808,10 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
 
         ClusterQueryResult result(obj);
         remote.docBuffer.push(result);
+        if (_params.getSort()) {
+            remote.sortKeyBuffer.push(encodeSortKey(
+                extractSortKey(obj, _params.getCompareWholeSortKey()), _sortKeyOrdering));
+        }
         ++remote.fetchedCount;
     }
 
@@ -898,12 +925,9 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
 //
 
 bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
-
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+    // The sort directions are baked into the KeyString encodings, so the encoded keys order the
+    // same way their BSON counterparts would under the sort pattern.
+    return _remotes[lhs].sortKeyBuffer.front().compare(_remotes[rhs].sortKeyBuffer.front()) > 0;
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
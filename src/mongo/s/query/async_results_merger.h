@@ -35,7 +35,9 @@
 
 #include "mongo/base/status_with.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/ordering.h"
 #include "mongo/db/cursor_id.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/executor/task_executor.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/s/query/async_results_merger_params_gen.h"
@@ -306,6 +308,12 @@ private:
         // The buffer of results that have been retrieved but not yet returned to the caller.
         std::queue<ClusterQueryResult> docBuffer;
 
+        // When merging in sorted order, kept in lockstep with 'docBuffer': holds each buffered
+        // document's sort key, KeyString-encoded once on receipt so that the merge queue can
+        // order documents with a memcmp per comparison rather than a BSON comparison. Empty for
+        // unsorted merges.
+        std::queue<KeyString::Value> sortKeyBuffer;
+
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
@@ -320,22 +328,13 @@ private:
 
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        explicit MergingComparator(const std::vector<RemoteCursorData>& remotes)
+            : _remotes(remotes) {}
 
         bool operator()(const size_t& lhs, const size_t& rhs);
 
     private:
         const std::vector<RemoteCursorData>& _remotes;
-
-        const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -478,6 +477,10 @@ private:
     TailableModeEnum _tailableMode;
     AsyncResultsMergerParams _params;
 
+    // The sort directions from '_params.getSort()', baked into each buffered document's
+    // KeyString-encoded sort key. All ascending when there is no sort.
+    const Ordering _sortKeyOrdering;
+
     // Must be acquired before accessing any data members (other than _params, which is read-only).
     mutable Mutex _mutex = MONGO_MAKE_LATCH("AsyncResultsMerger::_mutex");
 
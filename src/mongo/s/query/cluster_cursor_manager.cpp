@@ -248,7 +248,7 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
     AuthCheck checkSessionAuth) {
     const auto now = _clockSource->now();
 
-    stdx::lock_guard<Latch> lk(_mutex);
+    stdx::unique_lock<Latch> lk(_mutex);
     _log.push({LogEvent::Type::kCheckoutAttempt, cursorId, now, nss});
 
     if (_inShutdown) {
@@ -282,6 +282,15 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
 
     auto cursorGuard = entry->releaseCursor(opCtx);
 
+    _log.push({LogEvent::Type::kCheckoutComplete, cursorId, now, nss});
+
+    // The cursor is now checked out to this operation, so no other thread can observe or reclaim
+    // it through the manager. The remaining bookkeeping is on the cursor itself and must not hold
+    // the manager mutex: vivifying the logical session record serializes on the session cache,
+    // and keeping that out of the critical section keeps the hot getMore path down to the map
+    // lookup itself.
+    lk.unlock();
+
     // We use pinning of a cursor as a proxy for active, user-initiated use of a cursor.  Therefore,
     // we pass down to the logical session cache and vivify the record (updating last use).
     if (cursorGuard->getLsid()) {
@@ -293,7 +302,6 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
     }
     cursorGuard->reattachToOperationContext(opCtx);
 
-    _log.push({LogEvent::Type::kCheckoutComplete, cursorId, now, nss});
     return PinnedCursor(this, std::move(cursorGuard), nss, cursorId);
 }
 
@@ -128,11 +128,20 @@ bool isValidShardKeyElementForStorage(const BSONElement& element) {
     return true;
 }
 
-BSONElement extractKeyElementFromDoc(const BSONObj& obj, StringData pathStr) {
+BSONElement extractKeyElementFromDoc(const BSONObj& obj, const FieldRef& path) {
     // Any arrays found get immediately returned. We are equipped up the call stack to specifically
     // deal with array values.
+    if (path.numParts() == 1) {
+        // The common non-nested case is a plain field lookup, which does not need the dotted path
+        // traversal machinery.
+        return obj.getField(path.dottedField());
+    }
     size_t idxPath;
-    return getFieldDottedOrArray(obj, FieldRef(pathStr), &idxPath);
+    return getFieldDottedOrArray(obj, path, &idxPath);
+}
+
+BSONElement extractKeyElementFromDoc(const BSONObj& obj, StringData pathStr) {
+    return extractKeyElementFromDoc(obj, FieldRef(pathStr));
 }
 
 BSONElement findEqualityElement(const EqualityMatches& equalities, const FieldRef& path) {
@@ -345,8 +354,11 @@ BSONObj ShardKeyPattern::extractShardKeyFromIndexKeyData(
 
 BSONObj ShardKeyPattern::extractShardKeyFromDoc(const BSONObj& doc) const {
     BSONObjBuilder keyBuilder;
-    for (auto&& patternEl : _keyPattern.toBSON()) {
-        BSONElement matchEl = extractKeyElementFromDoc(doc, patternEl.fieldNameStringData());
+    // Iterate the parsed paths to avoid re-parsing the (potentially dotted) field names for every
+    // document - this method sits on the per-document insert path of mongos.
+    for (auto it = _keyPatternPaths.begin(); it != _keyPatternPaths.end(); ++it) {
+        const FieldRef& patternPath = **it;
+        BSONElement matchEl = extractKeyElementFromDoc(doc, patternPath);
 
         if (matchEl.eoo()) {
             matchEl = kNullObj.firstElement();
@@ -356,14 +368,14 @@ BSONObj ShardKeyPattern::extractShardKeyFromDoc(const BSONObj& doc) const {
             return BSONObj();
         }
 
-        if (isHashedPatternEl(patternEl)) {
+        if (_hashedField && _hashedField.fieldNameStringData() == patternPath.dottedField()) {
             keyBuilder.append(
-                patternEl.fieldName(),
+                patternPath.dottedField(),
                 BSONElementHasher::hash64(matchEl, BSONElementHasher::DEFAULT_HASH_SEED));
         } else {
             // NOTE: The matched element may *not* have the same field name as the path -
             // index keys don't contain field names, for example
-            keyBuilder.appendAs(matchEl, patternEl.fieldName());
+            keyBuilder.appendAs(matchEl, patternPath.dottedField());
         }
     }
 
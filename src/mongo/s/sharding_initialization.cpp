@@ -33,10 +33,15 @@
 
 #include "mongo/s/sharding_initialization.h"
 
+#include <fstream>
 #include <memory>
 #include <string>
 
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
 #include "mongo/base/status.h"
+#include "mongo/bson/bson_validate.h"
 #include "mongo/db/audit.h"
 #include "mongo/db/keys_collection_client_sharded.h"
 #include "mongo/db/keys_collection_manager.h"
@@ -74,6 +79,7 @@
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/exit.h"
 #include "mongo/util/net/socket_utils.h"
+#include "mongo/util/periodic_runner.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -149,6 +155,108 @@ void preWarmConnections(OperationContext* opCtx, std::vector<HostAndPort> allHos
                        Milliseconds(gWarmMinConnectionsInShardingTaskExecutorPoolOnStartupWaitMS));
 }
 
+// Keeps the routing table snapshot job alive for the lifetime of the process.
+PeriodicJobAnchor routingTableSnapshotJob;
+
+/**
+ * Writes a snapshot document listing the namespaces currently present in the routing table
+ * cache to 'routingTableSnapshotPath'. The file is written to a temporary sibling and renamed
+ * into place so readers never observe a partially written snapshot.
+ */
+void writeRoutingTableSnapshot(Client* client) {
+    BSONObjBuilder snapshotBuilder;
+    snapshotBuilder.append("version", 1);
+    snapshotBuilder.appendDate("writtenAt", Date_t::now());
+    {
+        BSONArrayBuilder collections(snapshotBuilder.subarrayStart("collections"));
+        auto catalogCache = Grid::get(client->getServiceContext())->catalogCache();
+        for (const auto& nss : catalogCache->getCachedCollectionNamespaces()) {
+            collections.append(nss.ns());
+        }
+    }
+    const auto snapshot = snapshotBuilder.obj();
+
+    const boost::filesystem::path path(gRoutingTableSnapshotPath);
+    auto tempPath = path;
+    tempPath += ".tmp";
+
+    {
+        std::ofstream file(tempPath.string(), std::ios::binary | std::ios::trunc);
+        if (!file) {
+            LOGV2_WARNING(5837132,
+                          "Unable to open temporary routing table snapshot file for writing",
+                          "path"_attr = tempPath.string());
+            return;
+        }
+        file.write(snapshot.objdata(), snapshot.objsize());
+    }
+
+    boost::system::error_code ec;
+    boost::filesystem::rename(tempPath, path, ec);
+    if (ec) {
+        LOGV2_WARNING(5837133,
+                      "Unable to move routing table snapshot file into place",
+                      "path"_attr = path.string(),
+                      "error"_attr = ec.message());
+    }
+}
+
+/**
+ * Reads the snapshot document left at 'routingTableSnapshotPath' by a previous process. Returns
+ * boost::none if the file does not exist; any other failure is returned as a non-OK status.
+ */
+StatusWith<boost::optional<BSONObj>> readRoutingTableSnapshot() {
+    const boost::filesystem::path path(gRoutingTableSnapshotPath);
+    if (!boost::filesystem::exists(path)) {
+        return {boost::none};
+    }
+
+    std::ifstream file(path.string(), std::ios::binary);
+    if (!file) {
+        return Status(ErrorCodes::FileOpenFailed,
+                      str::stream() << "Unable to open routing table snapshot file "
+                                    << path.string());
+    }
+
+    std::string buffer{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    auto validateStatus = validateBSON(buffer.data(), buffer.size());
+    if (!validateStatus.isOK()) {
+        return validateStatus.withContext(str::stream() << "Invalid routing table snapshot file "
+                                                        << path.string());
+    }
+
+    return {boost::optional<BSONObj>(BSONObj(buffer.data()).getOwned())};
+}
+
+/**
+ * Warms the catalog cache with the namespaces listed in 'snapshot'. Failures to load individual
+ * namespaces are expected (collections may have been dropped since the snapshot was taken) and
+ * do not fail the warm-up.
+ */
+void warmRoutingTableFromSnapshot(OperationContext* opCtx, const BSONObj& snapshot) {
+    auto catalogCache = Grid::get(opCtx)->catalogCache();
+
+    int warmedCollections = 0;
+    for (const auto& element : snapshot["collections"].Obj()) {
+        const NamespaceString nss(element.String());
+        auto swRoutingInfo = catalogCache->getCollectionRoutingInfoWithRefresh(opCtx, nss);
+        if (swRoutingInfo.isOK()) {
+            ++warmedCollections;
+        } else {
+            LOGV2_DEBUG(5837134,
+                        1,
+                        "Unable to warm routing information for namespace from snapshot",
+                        "namespace"_attr = nss,
+                        "error"_attr = swRoutingInfo.getStatus());
+        }
+    }
+
+    LOGV2(5837135,
+          "Warmed routing table cache from snapshot",
+          "collections"_attr = warmedCollections,
+          "writtenAt"_attr = snapshot["writtenAt"].Date());
+}
+
 }  // namespace
 
 std::unique_ptr<executor::TaskExecutor> makeShardingTaskExecutor(
@@ -250,6 +358,23 @@ Status preCacheMongosRoutingInfo(OperationContext* opCtx) {
         return Status::OK();
     }
 
+    // If a previous process left a routing table snapshot behind, warm only the namespaces it
+    // lists (the working set of this mongos) rather than loading routing information for every
+    // sharded collection in the cluster. Versions in the cache are still validated lazily against
+    // the config server the first time each namespace is used, as usual.
+    if (!gRoutingTableSnapshotPath.empty()) {
+        auto swSnapshot = readRoutingTableSnapshot();
+        if (!swSnapshot.isOK()) {
+            LOGV2_WARNING(5837136,
+                          "Unable to read routing table snapshot file; falling back to loading "
+                          "all sharded collections",
+                          "error"_attr = swSnapshot.getStatus());
+        } else if (auto& snapshot = swSnapshot.getValue()) {
+            warmRoutingTableFromSnapshot(opCtx, *snapshot);
+            return Status::OK();
+        }
+    }
+
     auto grid = Grid::get(opCtx);
     auto catalogClient = grid->catalogClient();
     auto catalogCache = grid->catalogCache();
@@ -310,4 +435,16 @@ Status preWarmConnectionPool(OperationContext* opCtx) {
     return Status::OK();
 }
 
+void startRoutingTableSnapshotTask(ServiceContext* serviceContext) {
+    if (gRoutingTableSnapshotPath.empty()) {
+        return;
+    }
+
+    routingTableSnapshotJob = serviceContext->getPeriodicRunner()->makeJob(
+        PeriodicRunner::PeriodicJob("RoutingTableSnapshot",
+                                    writeRoutingTableSnapshot,
+                                    Seconds(gRoutingTableSnapshotIntervalSecs)));
+    routingTableSnapshotJob.start();
+}
+
 }  // namespace mongo
@@ -42,6 +42,7 @@ namespace mongo {
 class CatalogCache;
 class ConnectionString;
 class OperationContext;
+class ServiceContext;
 class ShardFactory;
 class Status;
 class ShardingCatalogClient;
@@ -89,4 +90,12 @@ Status preCacheMongosRoutingInfo(OperationContext* opCtx);
 
 Status preWarmConnectionPool(OperationContext* opCtx);
 
+/**
+ * If 'routingTableSnapshotPath' is set, starts the periodic job which snapshots the namespaces
+ * in the routing table cache to that file, so the next process can warm its cache from them.
+ * Must be called after the periodic runner is set up and sharding is initialized.
+ */
+
+void startRoutingTableSnapshotTask(ServiceContext* serviceContext);
+
 }  // namespace mongo
@@ -215,8 +215,12 @@ auto ShardingTaskExecutorPoolController::updateHost(PoolId id, const HostState&
     const size_t minConns = gParameters.minConnections.load();
     const size_t maxConns = gParameters.maxConnections.load();
 
-    // Update the target for just the pool first
-    poolData.target = stats.requests + stats.active;
+    // Update the target for just the pool first, sizing for the decaying peak of demand so
+    // that the pool stays warm enough to absorb a repeat of its recent bursts
+    poolData.target =
+        poolData.demandTracker.update(stats.requests + stats.active,
+                                      now(),
+                                      Milliseconds{gParameters.warmTargetDecayIntervalMS.load()});
 
     if (poolData.target < minConns) {
         poolData.target = minConns;
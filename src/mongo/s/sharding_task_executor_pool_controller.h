@@ -86,6 +86,7 @@ public:
         AtomicWord<int> hostTimeoutMS;
         AtomicWord<int> pendingTimeoutMS;
         AtomicWord<int> toRefreshTimeoutMS;
+        AtomicWord<int> warmTargetDecayIntervalMS;
 
         synchronized_value<std::string> matchingStrategyString;
         AtomicWord<MatchingStrategy> matchingStrategy;
@@ -177,6 +178,9 @@ private:
         // The number of connections the host should maintain
         size_t target = 0;
 
+        // The decaying peak of demand for this host, used to keep connections warm for bursts
+        executor::ConnectionPool::PeakDemandTracker demandTracker;
+
         // This host is able to shutdown
         bool isAbleToShutdown = false;
     };
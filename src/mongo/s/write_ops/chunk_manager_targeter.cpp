@@ -336,6 +336,11 @@ ChunkManagerTargeter::ChunkManagerTargeter(OperationContext* opCtx,
 
 void ChunkManagerTargeter::_init(OperationContext* opCtx) {
     createShardDatabase(opCtx, _nss.db());
+
+    // The chunk boundaries and shard versions this cache was built against may be changing.
+    _lastTargetedRange = boost::none;
+    _lastTargetedEndpoint = boost::none;
+
     _cm = uassertStatusOK(getCollectionRoutingInfoForTxnCmd(opCtx, _nss));
 
     if (_targetEpoch) {
@@ -562,9 +567,25 @@ StatusWith<std::vector<ShardEndpoint>> ChunkManagerTargeter::_targetQuery(
 StatusWith<ShardEndpoint> ChunkManagerTargeter::_targetShardKey(const BSONObj& shardKey,
                                                                 const BSONObj& collation,
                                                                 long long estDataSize) const {
+    // With the simple collation the chunk a key targets depends only on the chunk boundaries,
+    // so when the previously targeted chunk covers this key it can be reused without probing
+    // the chunk map again. Batched inserts commonly arrive in shard key order and hit this
+    // cache nearly every time.
+    const bool isSimpleCollation =
+        SimpleBSONObjComparator::kInstance.evaluate(collation == CollationSpec::kSimpleSpec);
+    if (isSimpleCollation && _lastTargetedRange && _lastTargetedRange->containsKey(shardKey)) {
+        return *_lastTargetedEndpoint;
+    }
+
     try {
         auto chunk = _cm->findIntersectingChunk(shardKey, collation);
-        return ShardEndpoint(chunk.getShardId(), _cm->getVersion(chunk.getShardId()), boost::none);
+        ShardEndpoint endpoint(
+            chunk.getShardId(), _cm->getVersion(chunk.getShardId()), boost::none);
+        if (isSimpleCollation) {
+            _lastTargetedRange.emplace(chunk.getMin().getOwned(), chunk.getMax().getOwned());
+            _lastTargetedEndpoint = endpoint;
+        }
+        return endpoint;
     } catch (const DBException& ex) {
         return ex.toStatus();
     }
@@ -162,6 +162,14 @@ private:
 
     // remote db version reported from stale errors
     boost::optional<DatabaseVersion> _remoteDbVersion;
+
+    // The chunk range and endpoint targeted by the most recent simple-collation shard key
+    // lookup. Bulk inserts commonly carry shard keys in sorted or clustered order, so
+    // consecutive documents tend to fall in the same chunk and can be targeted without another
+    // probe of the chunk map. Cleared whenever the routing information is (re)loaded, since
+    // both the chunk boundaries and the cached shard version may have changed.
+    mutable boost::optional<ChunkRange> _lastTargetedRange;
+    mutable boost::optional<ShardEndpoint> _lastTargetedEndpoint;
 };
 
 }  // namespace mongo
@@ -306,7 +306,7 @@ ScriptingFunction Scope::createFunction(const char* code) {
         }
     }
 
-    FunctionCacheMap::iterator i = _cachedFunctions.find(code);
+    FunctionCacheMap::iterator i = _cachedFunctions.find(StringData(code));
     if (i != _cachedFunctions.end())
         return i->second;
 
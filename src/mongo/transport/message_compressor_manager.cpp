@@ -38,6 +38,7 @@
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/rpc/message.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/session.h"
@@ -74,6 +75,45 @@ struct CompressionHeader {
 
 const transport::Session::Decoration<MessageCompressorManager> getForSession =
     transport::Session::declareDecoration<MessageCompressorManager>();
+
+// Messages with payloads smaller than this are never compressed: for tiny messages the CPU spent
+// and the extra compression header outweigh any savings on the wire.
+constexpr size_t kMinMessageSizeToCompress = 1024;
+
+// Messages with payloads at least this large have a small slice compressed as a probe first. If
+// the probe does not shrink its input meaningfully, the payload is assumed to be incompressible
+// (e.g. a batch of documents carrying already-compressed binary data) and the message is sent
+// as-is rather than spending CPU compressing the full payload for no gain.
+constexpr size_t kMinMessageSizeToProbe = 128 * 1024;
+constexpr size_t kProbeSize = 1024;
+
+// A probe must shrink its input below this fraction of its original size for the full message to
+// be worth compressing.
+constexpr double kMaxUsefulProbeRatio = 0.95;
+
+AtomicWord<long long> gMessagesSkippedBelowSizeFloor{0};
+AtomicWord<long long> gMessagesSkippedIncompressible{0};
+AtomicWord<long long> gMessagesProbed{0};
+AtomicWord<long long> gMessagesCompressed{0};
+
+bool probeSuggestsIncompressible(MessageCompressorBase* compressor, const Message& msg) {
+    // Probe a slice from the middle of the payload. The head of a message holds the command
+    // envelope and field names, which compress unusually well and would bias the probe.
+    const auto dataView = msg.singleData();
+    const char* probeStart = dataView.data() + (dataView.dataLen() - kProbeSize) / 2;
+    ConstDataRange probeInput(probeStart, probeStart + kProbeSize);
+
+    auto probeBuffer = SharedBuffer::allocate(compressor->getMaxCompressedSize(kProbeSize));
+    DataRange probeOutput(probeBuffer.get(), probeBuffer.get() + probeBuffer.capacity());
+
+    auto swProbeSize = compressor->compressData(probeInput, probeOutput);
+    if (!swProbeSize.isOK()) {
+        // Let the full compression attempt surface the error.
+        return false;
+    }
+
+    return swProbeSize.getValue() >= kProbeSize * kMaxUsefulProbeRatio;
+}
 }  // namespace
 
 MessageCompressorManager::MessageCompressorManager()
@@ -95,6 +135,24 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
         return {msg};
     }
 
+    const auto dataLen = static_cast<size_t>(msg.dataSize());
+    if (dataLen < kMinMessageSizeToCompress) {
+        gMessagesSkippedBelowSizeFloor.fetchAndAdd(1);
+        return {msg};
+    }
+
+    if (dataLen >= kMinMessageSizeToProbe) {
+        gMessagesProbed.fetchAndAdd(1);
+        if (probeSuggestsIncompressible(compressor, msg)) {
+            gMessagesSkippedIncompressible.fetchAndAdd(1);
+            LOGV2_DEBUG(5837129,
+                        3,
+                        "Message payload looks incompressible, sending it uncompressed",
+                        "compressor"_attr = compressor->getName());
+            return {msg};
+        }
+    }
+
     LOGV2_DEBUG(22925,
                 3,
                 "Compressing message with {compressor}",
@@ -139,6 +197,7 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
     auto realCompressedSize = sws.getValue();
     outMessage.setLen(realCompressedSize + CompressionHeader::size() + MsgData::MsgDataHeaderSize);
 
+    gMessagesCompressed.fetchAndAdd(1);
     return {Message(outputMessageBuffer)};
 }
 
@@ -329,4 +388,11 @@ MessageCompressorManager& MessageCompressorManager::forSession(
     return getForSession(session.get());
 }
 
+MessageCompressionDecisionStats getMessageCompressionDecisionStats() {
+    return {gMessagesSkippedBelowSizeFloor.load(),
+            gMessagesSkippedIncompressible.load(),
+            gMessagesProbed.load(),
+            gMessagesCompressed.load()};
+}
+
 }  // namespace mongo
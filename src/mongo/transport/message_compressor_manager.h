@@ -131,4 +131,17 @@ private:
     MessageCompressorRegistry* _registry;
 };
 
+/**
+ * Process-wide counters describing the outcome of per-message compression decisions, exposed
+ * under the compression section of serverStatus.
+ */
+struct MessageCompressionDecisionStats {
+    long long messagesSkippedBelowSizeFloor;
+    long long messagesSkippedIncompressible;
+    long long messagesProbed;
+    long long messagesCompressed;
+};
+
+MessageCompressionDecisionStats getMessageCompressionDecisionStats();
+
 }  // namespace mongo
@@ -36,6 +36,7 @@
 #include <vector>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/random.h"
 #include "mongo/rpc/message.h"
 #include "mongo/transport/message_compressor_manager.h"
 #include "mongo/transport/message_compressor_noop.h"
@@ -167,8 +168,7 @@ void checkOverflow(std::unique_ptr<MessageCompressorBase> compressor) {
         compressor->decompressData(tooSmallRange, DataRange(scratch.data(), scratch.size())));
 }
 
-Message buildMessage() {
-    const auto data = std::string{"Hello, world!"};
+Message buildMessageWithData(const std::string& data) {
     const auto bufferSize = MsgData::MsgDataHeaderSize + data.size();
     auto buf = SharedBuffer::allocate(bufferSize);
     MsgData::View testView(buf.get());
@@ -180,6 +180,16 @@ Message buildMessage() {
     return Message{buf};
 }
 
+Message buildMessage() {
+    // Repeat the text so the payload clears the size floor below which compressMessage sends
+    // messages uncompressed.
+    std::string data;
+    while (data.size() < 2048u) {
+        data += "Hello, world!";
+    }
+    return buildMessageWithData(data);
+}
+
 TEST(MessageCompressorManager, NoCompressionRequested) {
     auto input = BSON("isMaster" << 1);
     checkServerNegotiation(input, {});
@@ -220,6 +230,59 @@ TEST(MessageCompressorManager, FullNormalCompression) {
     clientManager.clientFinish(serverObj);
 }
 
+TEST(MessageCompressorManager, MessagesBelowSizeFloorAreNotCompressed) {
+    MessageCompressorRegistry registry;
+    auto compressor = std::make_unique<SnappyMessageCompressor>();
+    std::vector<std::string> compressorList = {compressor->getName()};
+    registry.setSupportedCompressors(std::move(compressorList));
+    registry.registerImplementation(std::move(compressor));
+    ASSERT_OK(registry.finalizeSupportedCompressors());
+
+    MessageCompressorManager mgr(&registry);
+    auto negotiator = BSON("isMaster" << 1 << "compression" << BSON_ARRAY("snappy"));
+    BSONObjBuilder negotiatorOut;
+    mgr.serverNegotiate(negotiator, &negotiatorOut);
+    checkNegotiationResult(negotiatorOut.done(), {"snappy"});
+
+    auto smallMessage = buildMessageWithData("Hello, world!");
+    auto swm = mgr.compressMessage(smallMessage);
+    ASSERT_OK(swm.getStatus());
+    ASSERT_EQ(swm.getValue().operation(), dbQuery);
+}
+
+TEST(MessageCompressorManager, IncompressibleMessagesAreNotCompressed) {
+    MessageCompressorRegistry registry;
+    auto compressor = std::make_unique<SnappyMessageCompressor>();
+    std::vector<std::string> compressorList = {compressor->getName()};
+    registry.setSupportedCompressors(std::move(compressorList));
+    registry.registerImplementation(std::move(compressor));
+    ASSERT_OK(registry.finalizeSupportedCompressors());
+
+    MessageCompressorManager mgr(&registry);
+    auto negotiator = BSON("isMaster" << 1 << "compression" << BSON_ARRAY("snappy"));
+    BSONObjBuilder negotiatorOut;
+    mgr.serverNegotiate(negotiator, &negotiatorOut);
+    checkNegotiationResult(negotiatorOut.done(), {"snappy"});
+
+    // Fill the payload with pseudo-random bytes that no compressor can shrink, as a stand-in for
+    // a batch of documents carrying already-compressed binary data.
+    const size_t dataSize = 256 * 1024;
+    PseudoRandom random(1234);
+    std::string data(dataSize, '\0');
+    for (auto& c : data) {
+        c = static_cast<char>(random.nextInt32());
+    }
+
+    auto swm = mgr.compressMessage(buildMessageWithData(data));
+    ASSERT_OK(swm.getStatus());
+    ASSERT_EQ(swm.getValue().operation(), dbQuery);
+
+    // A compressible payload of the same size still gets compressed.
+    swm = mgr.compressMessage(buildMessageWithData(std::string(dataSize, 'a')));
+    ASSERT_OK(swm.getStatus());
+    ASSERT_EQ(swm.getValue().operation(), dbCompressed);
+}
+
 TEST(NoopMessageCompressor, Fidelity) {
     auto testMessage = buildMessage();
     checkFidelity(testMessage, std::make_unique<NoopMessageCompressor>());
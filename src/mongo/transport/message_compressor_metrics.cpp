@@ -30,6 +30,7 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/transport/message_compressor_manager.h"
 #include "mongo/transport/message_compressor_registry.h"
 
 namespace mongo {
@@ -61,6 +62,14 @@ void appendMessageCompressionStats(BSONObjBuilder* b) {
         decompressorSection.doneFast();
         base.doneFast();
     }
+
+    const auto decisions = getMessageCompressionDecisionStats();
+    BSONObjBuilder decisionSection(compressionSection.subobjStart("decisions"));
+    decisionSection << "skippedBelowSizeFloor" << decisions.messagesSkippedBelowSizeFloor
+                    << "skippedIncompressible" << decisions.messagesSkippedIncompressible
+                    << "probed" << decisions.messagesProbed << "compressed"
+                    << decisions.messagesCompressed;
+    decisionSection.doneFast();
     compressionSection.doneFast();
 }
 
@@ -130,7 +130,13 @@ size_t getSupportedMax() {
 }
 
 ServiceEntryPointImpl::ServiceEntryPointImpl(ServiceContext* svcCtx)
-    : _svcCtx(svcCtx), _maxNumConnections(getSupportedMax()) {}
+    : _svcCtx(svcCtx),
+      _sessionsShards(std::max<size_t>(1, ProcessInfo::getNumAvailableCores())),
+      _maxNumConnections(getSupportedMax()) {}
+
+auto ServiceEntryPointImpl::_shardFor(const transport::SessionHandle& session) -> SessionsShard& {
+    return _sessionsShards[session->id() % _sessionsShards.size()];
+}
 
 Status ServiceEntryPointImpl::start() {
     if (auto status = transport::ServiceExecutorSynchronous::get(_svcCtx)->start();
@@ -166,30 +172,29 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
 
     const bool quiet = serverGlobalParams.quiet.load();
 
-    size_t connectionCount;
-    auto maybeSsmIt = [&]() -> boost::optional<SSMListIterator> {
-        stdx::lock_guard lk(_sessionsMutex);
-        connectionCount = _currentConnections.load();
-        if (connectionCount > _maxNumConnections && !canOverrideMaxConns) {
-            return boost::none;
-        }
-
-        auto it = _sessions.emplace(_sessions.begin(), std::move(client));
-        connectionCount = _sessions.size();
-        _currentConnections.store(connectionCount);
-        _createdConnections.addAndFetch(1);
-        return it;
-    }();
-
-    if (!maybeSsmIt) {
+    // Admission control runs on the connection count alone so that a storm of new connections
+    // is turned away without ever touching a session shard.
+    const auto previousConnections = _currentConnections.fetchAndAdd(1);
+    if (previousConnections > _maxNumConnections && !canOverrideMaxConns) {
+        _currentConnections.subtractAndFetch(1);
         if (!quiet) {
             LOGV2(22942,
                   "Connection refused because there are too many open connections",
                   "remote"_attr = session->remote(),
-                  "connectionCount"_attr = connectionCount);
+                  "connectionCount"_attr = previousConnections);
         }
         return;
-    } else if (!quiet) {
+    }
+    const auto connectionCount = previousConnections + 1;
+    _createdConnections.addAndFetch(1);
+
+    auto& shard = _shardFor(session);
+    auto ssmIt = [&] {
+        stdx::lock_guard lk(shard.mutex);
+        return shard.sessions.emplace(shard.sessions.begin(), std::move(client));
+    }();
+
+    if (!quiet) {
         LOGV2(22943,
               "Connection accepted",
               "remote"_attr = session->remote(),
@@ -197,16 +202,13 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
               "connectionCount"_attr = connectionCount);
     }
 
-    auto ssmIt = *maybeSsmIt;
-    ssmIt->setCleanupHook([this, ssmIt, quiet, session = std::move(session)] {
-        size_t connectionCount;
+    ssmIt->setCleanupHook([this, ssmIt, &shard, quiet, session = std::move(session)] {
         auto remote = session->remote();
         {
-            stdx::lock_guard<decltype(_sessionsMutex)> lk(_sessionsMutex);
-            _sessions.erase(ssmIt);
-            connectionCount = _sessions.size();
-            _currentConnections.store(connectionCount);
+            stdx::lock_guard lk(shard.mutex);
+            shard.sessions.erase(ssmIt);
         }
+        const auto connectionCount = _currentConnections.subtractAndFetch(1);
 
         if (!quiet) {
             LOGV2(22944,
@@ -216,7 +218,13 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
                   "connectionCount"_attr = connectionCount);
         }
 
-        _sessionsCV.notify_one();
+        if (connectionCount == 0) {
+            // Pairs with the wait in _waitForNoSessions(): taking _sessionsMutex between the
+            // decrement and the notification ensures a waiter that just observed a non-zero
+            // count has reached its wait before the notification is sent.
+            stdx::lock_guard lk(_sessionsMutex);
+            _sessionsCV.notify_all();
+        }
     });
 
     auto seCtx = transport::ServiceExecutorContext{};
@@ -226,11 +234,11 @@ void ServiceEntryPointImpl::startSession(transport::SessionHandle session) {
 }
 
 void ServiceEntryPointImpl::endAllSessions(transport::Session::TagMask tags) {
-    // While holding the _sesionsMutex, loop over all the current connections, and if their tags
-    // do not match the requested tags to skip, terminate the session.
-    {
-        stdx::unique_lock<decltype(_sessionsMutex)> lk(_sessionsMutex);
-        for (auto& ssm : _sessions) {
+    // Loop over all the current connections one shard at a time, and if their tags do not match
+    // the requested tags to skip, terminate the session.
+    for (auto& shard : _sessionsShards) {
+        stdx::lock_guard lk(shard.mutex);
+        for (auto& ssm : shard.sessions) {
             ssm.terminateIfTagsDontMatch(tags);
         }
     }
@@ -250,14 +258,14 @@ bool ServiceEntryPointImpl::shutdown(Milliseconds timeout) {
 bool ServiceEntryPointImpl::shutdownAndWait(Milliseconds timeout) {
     auto deadline = _svcCtx->getPreciseClockSource()->now() + timeout;
 
-    stdx::unique_lock<decltype(_sessionsMutex)> lk(_sessionsMutex);
-
-    // Request that all sessions end, while holding the _sesionsMutex, loop over all the current
-    // connections and terminate them. Then wait for the number of active connections to reach zero
-    // with a condition_variable that notifies in the session cleanup hook. If we haven't closed
+    // Request that all sessions end by looping over all the current connections and terminating
+    // them. Then wait for the number of active connections to reach zero with a
+    // condition_variable that notifies in the session cleanup hook. If we haven't closed
     // drained all active operations within the deadline, just keep going with shutdown: the OS will
     // do it for us when the process terminates.
-    _terminateAll(lk);
+    _terminateAll();
+
+    stdx::unique_lock<decltype(_sessionsMutex)> lk(_sessionsMutex);
     auto result = _waitForNoSessions(lk, deadline);
     lk.unlock();
 
@@ -278,13 +286,15 @@ bool ServiceEntryPointImpl::shutdownAndWait(Milliseconds timeout) {
 }
 
 void ServiceEntryPointImpl::endAllSessionsNoTagMask() {
-    auto lk = stdx::unique_lock<decltype(_sessionsMutex)>(_sessionsMutex);
-    _terminateAll(lk);
+    _terminateAll();
 }
 
-void ServiceEntryPointImpl::_terminateAll(WithLock) {
-    for (auto& ssm : _sessions) {
-        ssm.terminate();
+void ServiceEntryPointImpl::_terminateAll() {
+    for (auto& shard : _sessionsShards) {
+        stdx::lock_guard lk(shard.mutex);
+        for (auto& ssm : shard.sessions) {
+            ssm.terminate();
+        }
     }
 }
 
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
@@ -85,19 +86,36 @@ public:
     }
 
 private:
-    void _terminateAll(WithLock);
-    bool _waitForNoSessions(stdx::unique_lock<Mutex>& lk, Date_t deadline);
-
     using SSMList = std::list<transport::ServiceStateMachine>;
     using SSMListIterator = SSMList::iterator;
 
+    /**
+     * One shard of the session registry. Sessions are spread over a fixed number of shards,
+     * each with its own lock and list, so that the churn of a mass connect or disconnect
+     * spreads across the shards instead of convoying on a single registry-wide mutex.
+     * Admission control and reporting read _currentConnections and never touch the shards.
+     */
+    struct SessionsShard {
+        mutable Mutex mutex = MONGO_MAKE_LATCH("ServiceEntryPointImpl::SessionsShard::mutex");
+        SSMList sessions;
+    };
+
+    SessionsShard& _shardFor(const transport::SessionHandle& session);
+    void _terminateAll();
+    bool _waitForNoSessions(stdx::unique_lock<Mutex>& lk, Date_t deadline);
+
     ServiceContext* const _svcCtx;
     AtomicWord<std::size_t> _nWorkers;
 
+    // Sized to the number of available cores at construction and never resized, so references
+    // to individual shards remain stable.
+    std::vector<SessionsShard> _sessionsShards;
+
+    // Pairs with _sessionsCV to wait for _currentConnections to drop to zero; it guards no
+    // other state.
     mutable Mutex _sessionsMutex =
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "ServiceEntryPointImpl::_sessionsMutex");
     stdx::condition_variable _sessionsCV;
-    SSMList _sessions;
 
     const size_t _maxNumConnections{DEFAULT_MAX_CONN};
     AtomicWord<size_t> _currentConnections{0};
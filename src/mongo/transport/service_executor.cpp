@@ -38,6 +38,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/transport/service_entry_point.h"
 #include "mongo/transport/service_executor_fixed.h"
+#include "mongo/transport/service_executor_gen.h"
 #include "mongo/transport/service_executor_reserved.h"
 #include "mongo/transport/service_executor_synchronous.h"
 #include "mongo/util/processinfo.h"
@@ -53,6 +54,11 @@ static constexpr auto kThreadingModelBorrowedStr = "borrowed"_sd;
 
 auto gInitialThreadingModel = ServiceExecutor::ThreadingModel::kDedicated;
 
+// How long a session's operations are accumulated before its rate is compared against the
+// adaptive migration thresholds. Long enough to smooth over bursty workloads, short enough that
+// an idle session releases its dedicated thread promptly.
+constexpr auto kMigrationCheckInterval = Seconds{1};
+
 auto getServiceExecutorStats =
     ServiceContext::declareDecoration<synchronized_value<ServiceExecutorStats>>();
 auto getServiceExecutorContext =
@@ -223,9 +229,64 @@ void ServiceExecutorContext::setCanUseReserved(bool canUseReserved) noexcept {
     }
 }
 
+void ServiceExecutorContext::recordOperation() noexcept {
+    ++_opsSinceMigrationCheck;
+}
+
+void ServiceExecutorContext::_migrateThreadingModelIfNeeded() noexcept {
+    if (!adaptiveServiceExecutorMigrationEnabled.load()) {
+        return;
+    }
+
+    auto now = _client->getServiceContext()->getFastClockSource()->now();
+    if (_lastMigrationCheck == Date_t{}) {
+        // This is the first call for this Client; start the measurement window.
+        _lastMigrationCheck = now;
+        return;
+    }
+
+    auto elapsed = now - _lastMigrationCheck;
+    if (elapsed < kMigrationCheckInterval) {
+        return;
+    }
+
+    auto opsPerSecond = static_cast<double>(_opsSinceMigrationCheck) * 1000.0 /
+        durationCount<Milliseconds>(elapsed);
+    _opsSinceMigrationCheck = 0;
+    _lastMigrationCheck = now;
+
+    auto migrateTo = [&]() -> boost::optional<ThreadingModel> {
+        if (_threadingModel == ThreadingModel::kDedicated &&
+            opsPerSecond < adaptiveServiceExecutorColdOpsPerSecond.load()) {
+            // This session is mostly idle, so stop holding a dedicated thread for it between
+            // operations and let it wait for data on the borrowed thread pool instead.
+            return ThreadingModel::kBorrowed;
+        }
+        if (_threadingModel == ThreadingModel::kBorrowed &&
+            opsPerSecond >= adaptiveServiceExecutorHotOpsPerSecond.load()) {
+            // This session is hot, so give it back a dedicated thread to avoid the scheduling
+            // latency of the borrowed thread pool.
+            return ThreadingModel::kDedicated;
+        }
+        return boost::none;
+    }();
+
+    if (migrateTo) {
+        LOGV2_DEBUG(5837128,
+                    3,
+                    "Migrating client between service executors",
+                    "client"_attr = _client->desc(),
+                    "opsPerSecond"_attr = opsPerSecond,
+                    "threadingModel"_attr = *migrateTo);
+        setThreadingModel(*migrateTo);
+    }
+}
+
 ServiceExecutor* ServiceExecutorContext::getServiceExecutor() noexcept {
     invariant(_client);
 
+    _migrateThreadingModelIfNeeded();
+
     switch (_threadingModel) {
         case ThreadingModel::kBorrowed:
             return ServiceExecutorFixed::get(_client->getServiceContext());
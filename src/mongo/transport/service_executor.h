@@ -222,13 +222,36 @@ public:
      */
     ServiceExecutor* getServiceExecutor() noexcept;
 
+    /**
+     * Note the arrival of one client operation for the associated Client.
+     *
+     * The observed operation rate drives adaptive threading model migration in
+     * getServiceExecutor(): frequently active sessions are kept on dedicated threads while
+     * mostly idle sessions are parked on the borrowed thread pool.
+     *
+     * This function is only valid to invoke from the associated Client thread.
+     */
+    void recordOperation() noexcept;
+
 private:
+    /**
+     * Switch the ThreadingModel if the operation rate observed since the last check warrants it.
+     *
+     * This function is only valid to invoke from the associated Client thread.
+     */
+    void _migrateThreadingModelIfNeeded() noexcept;
+
     Client* _client = nullptr;
     ServiceEntryPoint* _sep = nullptr;
 
     ThreadingModel _threadingModel = ThreadingModel::kDedicated;
     bool _canUseReserved = false;
     bool _hasUsedSynchronous = false;
+
+    // State for adaptive threading model migration. Like _hasUsedSynchronous, this is only
+    // accessed from the associated Client thread.
+    size_t _opsSinceMigrationCheck = 0;
+    Date_t _lastMigrationCheck;
 };
 
 /**
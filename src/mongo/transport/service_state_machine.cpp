@@ -375,6 +375,10 @@ void ServiceStateMachine::Impl::sourceCallback(Status status) {
     if (status.isOK()) {
         _state.store(State::Process);
 
+        // Feed the per-session operation rate that drives adaptive migration between the
+        // dedicated and borrowed service executors.
+        ServiceExecutorContext::get(_clientStrand->getClientPointer())->recordOperation();
+
         // If the sourceMessage succeeded then we can move to on to process the message. We simply
         // return from here and the future chain in startNewLoop() will continue to the next state
         // normally.
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
 
 #include "mongo/base/system_error.h"
@@ -38,6 +39,7 @@
 #include "mongo/transport/baton.h"
 #include "mongo/transport/ssl_connection_context.h"
 #include "mongo/transport/transport_layer_asio.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/net/socket_utils.h"
 #ifdef MONGO_CONFIG_SSL
@@ -420,9 +422,40 @@ private:
         return _socket;
     }
 
+    Status validateMessageLength(size_t msgLen) {
+        static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
+
+        if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
+            StringBuilder sb;
+            sb << "recv(): message msgLen " << msgLen << " is invalid. "
+               << "Min " << kHeaderSize << " Max: " << MaxMessageSizeBytes;
+            LOGV2(4615638,
+                  "recv(): message msgLen {msgLen} is invalid. Min: {min} Max: {max}",
+                  "recv(): message mstLen is invalid.",
+                  "msgLen"_attr = msgLen,
+                  "min"_attr = kHeaderSize,
+                  "max"_attr = MaxMessageSizeBytes);
+
+            return Status(ErrorCodes::ProtocolError, sb.str());
+        }
+        return Status::OK();
+    }
+
     Future<Message> sourceMessageImpl(const BatonHandle& baton = nullptr) {
         static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
 
+#ifdef MONGO_CONFIG_SSL
+        // The first read on an ingress session may have to sniff out a TLS handshake, which
+        // read() does with an exactly-header-sized buffer. Only read ahead once the session's
+        // encryption state has been settled.
+        const bool canReadAhead = _ranHandshake || _sslSocket;
+#else
+        const bool canReadAhead = true;
+#endif
+        if (canReadAhead) {
+            return sourceMessageWithReadAhead(baton);
+        }
+
         auto headerBuffer = SharedBuffer::allocate(kHeaderSize);
         auto ptr = headerBuffer.get();
         return read(asio::buffer(ptr, kHeaderSize), baton)
@@ -432,19 +465,8 @@ private:
                 }
 
                 const auto msgLen = size_t(MSGHEADER::View(headerBuffer.get()).getMessageLength());
-                if (msgLen < kHeaderSize || msgLen > MaxMessageSizeBytes) {
-                    StringBuilder sb;
-                    sb << "recv(): message msgLen " << msgLen << " is invalid. "
-                       << "Min " << kHeaderSize << " Max: " << MaxMessageSizeBytes;
-                    const auto str = sb.str();
-                    LOGV2(4615638,
-                          "recv(): message msgLen {msgLen} is invalid. Min: {min} Max: {max}",
-                          "recv(): message mstLen is invalid.",
-                          "msgLen"_attr = msgLen,
-                          "min"_attr = kHeaderSize,
-                          "max"_attr = MaxMessageSizeBytes);
-
-                    return Future<Message>::makeReady(Status(ErrorCodes::ProtocolError, str));
+                if (auto status = validateMessageLength(msgLen); !status.isOK()) {
+                    return Future<Message>::makeReady(std::move(status));
                 }
 
                 if (msgLen == kHeaderSize) {
@@ -469,6 +491,93 @@ private:
             });
     }
 
+    /**
+     * Sources a message using speculative reads: rather than issuing one read for the header and
+     * another for the body, read at least a header's worth of bytes into a larger buffer in the
+     * hope of receiving the body (and possibly the start of the next message) in the same
+     * syscall. Bytes received past the end of the sourced message are kept in the '_readAhead'
+     * buffer and consumed by the next call before reading from the socket again.
+     */
+    Future<Message> sourceMessageWithReadAhead(const BatonHandle& baton) {
+        static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
+        // Large enough to capture a typical command message (header and body) in a single
+        // syscall, while staying small relative to the session's other per-connection costs; the
+        // buffer is held for the duration of the read, including any wait for the next message.
+        static constexpr auto kReadAheadSizeBytes = size_t{4096};
+
+        if (_readAheadSize < kHeaderSize) {
+            // Not enough buffered bytes to know the next message's length; top the buffer up with
+            // a speculative read.
+            auto speculative = SharedBuffer::allocate(kReadAheadSizeBytes);
+            const auto have = _readAheadSize;
+            if (have) {
+                memcpy(speculative.get(), _readAhead.get() + _readAheadOffset, have);
+            }
+            _readAhead = {};
+            _readAheadOffset = 0;
+            _readAheadSize = 0;
+
+            return readAtLeast(asio::mutable_buffer(speculative.get() + have,
+                                                    kReadAheadSizeBytes - have),
+                               kHeaderSize - have,
+                               baton)
+                .then([speculative = std::move(speculative), have, baton, this](
+                          size_t bytesRead) mutable {
+                    _readAhead = std::move(speculative);
+                    _readAheadOffset = 0;
+                    _readAheadSize = have + bytesRead;
+                    return sourceMessageWithReadAhead(baton);
+                });
+        }
+
+        // A full header is buffered, so the message's length is known.
+        auto headerPtr = _readAhead.get() + _readAheadOffset;
+        if (checkForHTTPRequest(asio::buffer(headerPtr, kHeaderSize))) {
+            return sendHTTPResponse(baton);
+        }
+
+        const auto msgLen = size_t(MSGHEADER::View(headerPtr).getMessageLength());
+        if (auto status = validateMessageLength(msgLen); !status.isOK()) {
+            return Future<Message>::makeReady(std::move(status));
+        }
+
+        auto buffer = SharedBuffer::allocate(msgLen);
+        const auto copied = std::min(_readAheadSize, msgLen);
+        memcpy(buffer.get(), headerPtr, copied);
+        _readAheadOffset += copied;
+        _readAheadSize -= copied;
+        if (!_readAheadSize) {
+            _readAhead = {};
+            _readAheadOffset = 0;
+        }
+
+        if (copied == msgLen) {
+            if (_isIngressSession) {
+                networkCounter.hitPhysicalIn(msgLen);
+            }
+            return Future<Message>::makeReady(Message(std::move(buffer)));
+        }
+
+        return read(asio::buffer(buffer.get() + copied, msgLen - copied), baton)
+            .then([this, buffer = std::move(buffer), msgLen]() mutable {
+                if (_isIngressSession) {
+                    networkCounter.hitPhysicalIn(msgLen);
+                }
+                return Message(std::move(buffer));
+            });
+    }
+
+    Future<size_t> readAtLeast(const asio::mutable_buffer& buffer,
+                               size_t atLeast,
+                               const BatonHandle& baton = nullptr) {
+#ifdef MONGO_CONFIG_SSL
+        if (_sslSocket) {
+            return opportunisticReadAtLeast(*_sslSocket, buffer, atLeast, baton);
+        }
+#endif
+        return opportunisticReadAtLeast(_socket, buffer, atLeast, baton);
+    }
+
     template <typename MutableBufferSequence>
     Future<void> read(const MutableBufferSequence& buffers, const BatonHandle& baton = nullptr) {
         // TODO SERVER-47229 Guard active ops for cancelation here.
@@ -581,6 +690,80 @@ private:
         }
     }
 
+    /**
+     * Reads at least 'atLeast' bytes into 'buffers', returning however many bytes were actually
+     * received, which may be as many as fit into 'buffers'. This is the read primitive behind the
+     * speculative path in sourceMessageWithReadAhead(); it mirrors opportunisticRead(), except
+     * that completion is governed by 'atLeast' rather than by filling the buffer sequence.
+     */
+    template <typename Stream, typename MutableBufferSequence>
+    Future<size_t> opportunisticReadAtLeast(Stream& stream,
+                                            const MutableBufferSequence& buffers,
+                                            size_t atLeast,
+                                            const BatonHandle& baton = nullptr) {
+        std::error_code ec;
+        size_t size;
+
+        if (MONGO_unlikely(transportLayerASIOshortOpportunisticReadWrite.shouldFail()) &&
+            _blockingMode == Async) {
+            asio::mutable_buffer localBuffer = buffers;
+
+            if (buffers.size()) {
+                localBuffer = asio::mutable_buffer(buffers.data(), 1);
+            }
+
+            do {
+                size = asio::read(stream, localBuffer, ec);
+            } while (ec == asio::error::interrupted);  // retry syscall EINTR
+
+            if (!ec && atLeast > 1) {
+                ec = asio::error::would_block;
+            }
+        } else {
+            do {
+                size = asio::read(stream, buffers, asio::transfer_at_least(atLeast), ec);
+            } while (ec == asio::error::interrupted);  // retry syscall EINTR
+        }
+
+        if (((ec == asio::error::would_block) || (ec == asio::error::try_again)) &&
+            (_blockingMode == Async)) {
+            // asio::read is a loop internally, so some of buffers may have been read into already.
+            // So we need to adjust the buffers passed into the continuation to be offset by size,
+            // if size is > 0.
+            MutableBufferSequence asyncBuffers(buffers);
+            if (size > 0) {
+                asyncBuffers += size;
+            }
+            const auto remaining = atLeast - size;
+
+            if (auto networkingBaton = baton ? baton->networking() : nullptr;
+                networkingBaton && networkingBaton->canWait()) {
+                return networkingBaton->addSession(*this, NetworkingBaton::Type::In)
+                    .onError([](Status error) {
+                        if (ErrorCodes::isShutdownError(error)) {
+                            // If the baton has detached, it will cancel its polling. We catch that
+                            // error here and return Status::OK so that we invoke
+                            // opportunisticReadAtLeast() again and switch to asio::async_read()
+                            // below.
+                            return Status::OK();
+                        }
+
+                        return error;
+                    })
+                    .then([&stream, asyncBuffers, remaining, size, baton, this] {
+                        return opportunisticReadAtLeast(stream, asyncBuffers, remaining, baton)
+                            .then([size](size_t more) { return size + more; });
+                    });
+            }
+
+            return asio::async_read(stream, asyncBuffers, asio::transfer_at_least(remaining),
+                                    UseFuture{})
+                .then([size](size_t more) { return size + more; });
+        } else {
+            return futurize(ec, size);
+        }
+    }
+
     /**
      * moreToSend checks the ssl socket after an opportunisticWrite.  If there are still bytes to
      * send, we manually send them off the underlying socket.  Then we hook that up with a future
@@ -719,8 +902,37 @@ private:
             }
 
             _sslSocket.emplace(std::move(_socket), *_sslContext->ingress, "");
-            auto doHandshake = [&] {
+            auto doHandshake = [&]() -> Future<size_t> {
                 if (_blockingMode == Sync) {
+                    if (auto* offloadPool = _tl->_ingressHandshakePool.get()) {
+                        // The private key operations in the handshake are CPU-intensive. Run the
+                        // handshake on the offload pool and park this thread until it completes,
+                        // so that a storm of new TLS connections contends for the pool's few
+                        // threads instead of starving threads that are running operations.
+                        // Waiting synchronously keeps the rest of session establishment, and the
+                        // first read, on this thread. The socket stays in blocking mode and is
+                        // not touched by this thread until the handshake resolves.
+                        auto pf = makePromiseFuture<size_t>();
+                        offloadPool->schedule(
+                            [this, buffer, promise = std::move(pf.promise)](Status status) mutable {
+                                if (!status.isOK()) {
+                                    promise.setError(std::move(status));
+                                    return;
+                                }
+                                std::error_code ec;
+                                _sslSocket->handshake(asio::ssl::stream_base::server, buffer, ec);
+                                if (ec) {
+                                    promise.setError(errorCodeToStatus(ec));
+                                } else {
+                                    promise.emplaceValue(asio::buffer_size(buffer));
+                                }
+                            });
+                        auto swSize = std::move(pf.future).getNoThrow();
+                        if (!swSize.isOK()) {
+                            return Future<size_t>::makeReady(swSize.getStatus());
+                        }
+                        return Future<size_t>::makeReady(swSize.getValue());
+                    }
                     std::error_code ec;
                     _sslSocket->handshake(asio::ssl::stream_base::server, buffer, ec);
                     return futurize(ec, asio::buffer_size(buffer));
@@ -829,6 +1041,13 @@ private:
     boost::optional<Milliseconds> _socketTimeout;
 
     GenericSocket _socket;
+
+    // Bytes received past the end of the last sourced message by a speculative read. They form
+    // the beginning of the next message and are consumed before reading from the socket again.
+    SharedBuffer _readAhead;
+    size_t _readAheadOffset = 0;
+    size_t _readAheadSize = 0;
+
 #ifdef MONGO_CONFIG_SSL
     boost::optional<asio::ssl::stream<decltype(_socket)>> _sslSocket;
     bool _ranHandshake = false;
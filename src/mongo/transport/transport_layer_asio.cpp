@@ -50,6 +50,7 @@
 #include "mongo/transport/asio_utils.h"
 #include "mongo/transport/service_entry_point.h"
 #include "mongo/transport/transport_options_gen.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/errno_util.h"
 #include "mongo/util/hierarchical_acquisition.h"
 #include "mongo/util/net/hostandport.h"
@@ -57,6 +58,7 @@
 #include "mongo/util/net/ssl_manager.h"
 #include "mongo/util/net/ssl_options.h"
 #include "mongo/util/options_parser/startup_options.h"
+#include "mongo/util/string_map.h"
 
 #ifdef MONGO_CONFIG_SSL
 #include "mongo/util/net/ssl.hpp"
@@ -324,6 +326,68 @@ private:
 };
 
 using Resolver = asio::ip::tcp::resolver;
+
+/**
+ * A process-wide cache of recent egress DNS resolutions, shared by every resolver instance and
+ * thus by every connection pool. Entries are stored and served only while the corresponding TTL
+ * server parameter is nonzero, so the cache is inert by default. Successful and failed
+ * resolutions age out independently, letting an operator briefly reuse known-good addresses
+ * during a resolver degradation without also pinning failures.
+ */
+class DNSResolutionCache {
+public:
+    using EndpointVector = std::vector<WrappedEndpoint>;
+
+    boost::optional<StatusWith<EndpointVector>> lookup(const HostAndPort& peer) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto it = _entries.find(peer.toString());
+        if (it == _entries.end()) {
+            return boost::none;
+        }
+        if (Date_t::now() >= it->second.expiration) {
+            _entries.erase(it);
+            return boost::none;
+        }
+        if (!it->second.status.isOK()) {
+            return StatusWith<EndpointVector>(it->second.status);
+        }
+        return StatusWith<EndpointVector>(it->second.endpoints);
+    }
+
+    void store(const HostAndPort& peer, const StatusWith<EndpointVector>& swEndpoints) {
+        const auto ttl = Seconds(swEndpoints.isOK() ? gEgressDNSCachePositiveTTLSeconds.load()
+                                                    : gEgressDNSCacheNegativeTTLSeconds.load());
+        if (ttl == Seconds::zero()) {
+            return;
+        }
+
+        Entry entry;
+        entry.expiration = Date_t::now() + ttl;
+        if (swEndpoints.isOK()) {
+            entry.endpoints = swEndpoints.getValue();
+        } else {
+            entry.status = swEndpoints.getStatus();
+        }
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        _entries[peer.toString()] = std::move(entry);
+    }
+
+private:
+    struct Entry {
+        Date_t expiration;
+        Status status = Status::OK();
+        EndpointVector endpoints;
+    };
+
+    // The key space is bounded by the set of hosts this process connects to, so entries are only
+    // evicted when a lookup finds them expired; there is no background sweeper.
+    Mutex _mutex = MONGO_MAKE_LATCH("DNSResolutionCache::_mutex");
+    StringMap<Entry> _entries;
+};
+
+DNSResolutionCache dnsResolutionCache;
+
 class WrappedResolver {
 public:
     using Flags = Resolver::flags;
@@ -343,15 +407,21 @@ public:
         // (see SERVER-1579).
         const auto flags = Resolver::numeric_service;
 
+        if (auto cached = dnsResolutionCache.lookup(peer)) {
+            return std::move(*cached);
+        }
+
         // We resolve in two steps, the first step tries to resolve the hostname as an IP address -
         // that way if there's a DNS timeout, we can still connect to IP addresses quickly.
         // (See SERVER-1709)
         //
         // Then, if the numeric (IP address) lookup failed, we fall back to DNS or return the error
         // from the resolver.
-        return _resolve(peer, flags | Resolver::numeric_host, enableIPv6)
-            .onError([=](Status) { return _resolve(peer, flags, enableIPv6); })
-            .getNoThrow();
+        auto swEndpoints = _resolve(peer, flags | Resolver::numeric_host, enableIPv6)
+                               .onError([=](Status) { return _resolve(peer, flags, enableIPv6); })
+                               .getNoThrow();
+        dnsResolutionCache.store(peer, swEndpoints);
+        return swEndpoints;
     }
 
     Future<EndpointVector> asyncResolve(const HostAndPort& peer, bool enableIPv6) {
@@ -359,12 +429,22 @@ public:
             return *unixEp;
         }
 
+        if (auto cached = dnsResolutionCache.lookup(peer)) {
+            if (!cached->isOK()) {
+                return cached->getStatus();
+            }
+            return std::move(cached->getValue());
+        }
+
         // We follow the same numeric -> hostname fallback procedure as the synchronous resolver
         // function for setting resolver flags (see above).
         const auto flags = Resolver::numeric_service;
-        return _asyncResolve(peer, flags | Resolver::numeric_host, enableIPv6).onError([=](Status) {
-            return _asyncResolve(peer, flags, enableIPv6);
-        });
+        return _asyncResolve(peer, flags | Resolver::numeric_host, enableIPv6)
+            .onError([=](Status) { return _asyncResolve(peer, flags, enableIPv6); })
+            .onCompletion([peer](StatusWith<EndpointVector> swEndpoints) {
+                dnsResolutionCache.store(peer, swEndpoints);
+                return swEndpoints;
+            });
     }
 
     void cancel() {
@@ -474,6 +554,7 @@ StatusWith<SessionHandle> TransportLayerASIO::connect(
     Date_t timeBefore = Date_t::now();
     auto swEndpoints = resolver.resolve(peer, _listenerOptions.enableIPv6);
     Date_t timeAfter = Date_t::now();
+    networkCounter.recordDNSResolution(timeAfter - timeBefore);
     if (timeAfter - timeBefore > kSlowOperationThreshold) {
         networkCounter.incrementNumSlowDNSOperations();
     }
@@ -669,6 +750,7 @@ Future<SessionHandle> TransportLayerASIO::asyncConnect(
         .then([connector, timeBefore](WrappedResolver::EndpointVector results) {
             try {
                 Date_t timeAfter = Date_t::now();
+                networkCounter.recordDNSResolution(timeAfter - timeBefore);
                 if (timeAfter - timeBefore > kSlowOperationThreshold) {
                     LOGV2_WARNING(23019,
                                   "DNS resolution while connecting to {peer} took {duration}",
@@ -1126,6 +1208,18 @@ Status TransportLayerASIO::start() {
     invariant(!_isShutdown);
 
     if (_listenerOptions.isIngress()) {
+#ifdef MONGO_CONFIG_SSL
+        if (gIngressTLSHandshakeOffloadThreads > 0 &&
+            _sslMode() != SSLParams::SSLMode_disabled) {
+            ThreadPool::Options options;
+            options.poolName = "TLSHandshake";
+            options.threadNamePrefix = "TLSHandshake";
+            options.minThreads = 0;
+            options.maxThreads = static_cast<size_t>(gIngressTLSHandshakeOffloadThreads);
+            _ingressHandshakePool = std::make_unique<ThreadPool>(std::move(options));
+            _ingressHandshakePool->startup();
+        }
+#endif
         _listener.thread = stdx::thread([this] { _runListener(); });
         _listener.cv.wait(lk, [&] { return _isShutdown || _listener.active; });
         return Status::OK();
@@ -1164,6 +1258,16 @@ void TransportLayerASIO::shutdown() {
     // Release the lock and wait for the thread to die
     lk.unlock();
     thread.join();
+
+#ifdef MONGO_CONFIG_SSL
+    // Drain the handshake offload pool once the listener is gone so no new sessions arrive to
+    // use it. The pool object stays alive; late schedule() calls from sessions that are still
+    // winding down see a shutdown error rather than a dangling pointer.
+    if (_ingressHandshakePool) {
+        _ingressHandshakePool->shutdown();
+        _ingressHandshakePool->join();
+    }
+#endif
 }
 
 ReactorHandle TransportLayerASIO::getReactor(WhichReactor which) {
@@ -66,6 +66,7 @@ namespace mongo {
 
 class ServiceContext;
 class ServiceEntryPoint;
+class ThreadPool;
 
 namespace transport {
 
@@ -230,6 +231,11 @@ private:
 
 #ifdef MONGO_CONFIG_SSL
     synchronized_value<std::shared_ptr<const SSLConnectionContext>> _sslContext;
+
+    // Completes ingress TLS handshakes when ingressTLSHandshakeOffloadThreads is non-zero. A
+    // burst of new TLS connections then contends for this pool's threads rather than burning
+    // handshake CPU on threads that are servicing operations.
+    std::unique_ptr<ThreadPool> _ingressHandshakePool;
 #endif
 
     std::vector<std::pair<SockAddr, GenericAcceptor>> _acceptors;
@@ -35,8 +35,14 @@
 
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <tmmintrin.h>
+#define MONGO_BASE64_SSSE3 1
+#endif
+
 namespace mongo::base64 {
 namespace {
 
@@ -64,6 +70,122 @@ bool valid(unsigned char x) {
     return kDecodeTable[x] != kInvalid;
 }
 
+#ifdef MONGO_BASE64_SSSE3
+
+/**
+ * Vectorized kernels using the lookup-shuffle technique. They are compiled with a per-function
+ * target attribute so the baseline build flags need not enable SSSE3, and are only selected when
+ * the CPU reports support at runtime.
+ */
+bool ssse3Available() {
+    static const bool available = __builtin_cpu_supports("ssse3");
+    return available;
+}
+
+/**
+ * Encodes four octet groups at once: reads 16 bytes from 'in' (of which the first 12 are
+ * consumed) and writes exactly 16 base64 characters to 'out'. The caller must guarantee that 16
+ * bytes are readable.
+ */
+__attribute__((target("ssse3"))) void encodeGroupsSsse3(const char* in, char* out) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+
+    // Spread each 3-byte group over 4 bytes, then split the four sextets of every group into
+    // their own bytes with masked multiplies.
+    const __m128i shuf = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    block = _mm_shuffle_epi8(block, shuf);
+    const __m128i t0 = _mm_and_si128(block, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(block, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Translate the 6-bit indices to ASCII by adding a per-range offset picked with a shuffle,
+    // mirroring the ranges of kEncodeTable.
+    __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8('a' - 26,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '0' - 52,
+                                          '+' - 62,
+                                          '/' - 63,
+                                          'A',
+                                          0,
+                                          0);
+    result = _mm_add_epi8(_mm_shuffle_epi8(offsets, result), indices);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), result);
+}
+
+/**
+ * Decodes four character groups at once: reads exactly 16 base64 characters from 'in' and writes
+ * exactly 12 bytes to 'out'. Returns false without writing anything if any input character is
+ * outside the base64 alphabet ('=' included), so the caller can fall back to the scalar path and
+ * report the offending character.
+ */
+__attribute__((target("ssse3"))) bool decodeGroupsSsse3(const char* in, char* out) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const __m128i higherNibble = _mm_and_si128(_mm_srli_epi32(block, 4), _mm_set1_epi8(0x0f));
+    const __m128i lowerNibble = _mm_and_si128(block, _mm_set1_epi8(0x0f));
+
+    // For each character class (selected by its high nibble) the distance from ASCII to the
+    // sextet value, with '/' special-cased below since it shares a high nibble with '+'.
+    const __m128i shiftLut = _mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    // Bitsets describing which high nibbles are legal for each low nibble; a character is valid
+    // iff the bit for its high nibble is present.
+    const __m128i maskLut = _mm_setr_epi8(char(0xa8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf8),
+                                          char(0xf0),
+                                          char(0x54),
+                                          char(0x50),
+                                          char(0x50),
+                                          char(0x50),
+                                          char(0x54));
+    const __m128i bitposLut = _mm_setr_epi8(
+        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, char(0x80), 0, 0, 0, 0, 0, 0, 0, 0);
+
+    const __m128i sh = _mm_shuffle_epi8(shiftLut, higherNibble);
+    const __m128i eq2f = _mm_cmpeq_epi8(block, _mm_set1_epi8(0x2f));
+    const __m128i shift =
+        _mm_or_si128(_mm_andnot_si128(eq2f, sh), _mm_and_si128(eq2f, _mm_set1_epi8(16)));
+
+    const __m128i m = _mm_shuffle_epi8(maskLut, lowerNibble);
+    const __m128i bit = _mm_shuffle_epi8(bitposLut, higherNibble);
+    const __m128i nonMatch = _mm_cmpeq_epi8(_mm_and_si128(m, bit), _mm_setzero_si128());
+    if (_mm_movemask_epi8(nonMatch)) {
+        return false;
+    }
+
+    // Pack the sixteen sextets down to twelve octets.
+    const __m128i values = _mm_add_epi8(block, shift);
+    const __m128i mergedAbBc = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    const __m128i merged = _mm_madd_epi16(mergedAbBc, _mm_set1_epi32(0x00011000));
+    const __m128i packed = _mm_shuffle_epi8(
+        merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out), packed);
+    std::memcpy(out + 8, reinterpret_cast<const char*>(&packed) + 8, 4);
+    return true;
+}
+
+#endif  // MONGO_BASE64_SSSE3
+
 template <typename Writer>
 void encodeImpl(Writer&& write, StringData in) {
     const char* data = in.rawData();
@@ -75,10 +197,27 @@ void encodeImpl(Writer&& write, StringData in) {
     std::array<char, 512>::iterator p;
     std::uint32_t accum;
 
+#ifdef MONGO_BASE64_SSSE3
+    const char* end = in.rawData() + size;
+    const bool useSsse3 = ssse3Available();
+#endif
+
     for (std::size_t fullGroups = size / 3; fullGroups;) {
         std::size_t chunkGroups = std::min(fullGroups, sizeof(buf) / 4);
         fullGroups -= chunkGroups;
         p = buf.begin();
+#ifdef MONGO_BASE64_SSSE3
+        if (useSsse3) {
+            // The vector kernel loads 16 bytes but only consumes 12, so it must stop while at
+            // least 4 bytes of input remain beyond the groups being encoded.
+            while (chunkGroups >= 4 && end - data >= 16) {
+                encodeGroupsSsse3(data, &*p);
+                data += 12;
+                p += 16;
+                chunkGroups -= 4;
+            }
+        }
+#endif
         while (chunkGroups--) {
             accum = 0;
             accum |= readOctet() << (8 * (2 - 0));
@@ -143,6 +282,20 @@ void decodeImpl(const Writer& write, StringData in) {
         std::size_t chunkGroups = std::min(groups, buf.size() / 3);
         groups -= chunkGroups;
         p = buf.begin();
+#ifdef MONGO_BASE64_SSSE3
+        if (ssse3Available()) {
+            // Only full groups reach this loop, so exact 16-byte loads are in bounds. On an
+            // invalid character, drop to the scalar path so it raises the usual error.
+            while (chunkGroups >= 4) {
+                if (!decodeGroupsSsse3(data, &*p)) {
+                    break;
+                }
+                data += 16;
+                p += 12;
+                chunkGroups -= 4;
+            }
+        }
+#endif
         while (chunkGroups--) {
             accum = 0;
             accum |= decodeSextet(*data++) << (6 * (3 - 0));
@@ -0,0 +1,95 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/concurrency/admission_context.h"
+
+#include <vector>
+
+#include "mongo/db/operation_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/str.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+namespace {
+
+const auto getAdmissionContext = OperationContext::declareDecoration<AdmissionContext>();
+
+AdmissionStats gLowPriorityAdmissionStats;
+AdmissionStats gNormalPriorityAdmissionStats;
+
+// The parsed form of the lowPriorityAdmissionCommands server parameter. The parameter is empty by
+// default, so the common case is decided by the atomic alone and never takes the mutex.
+AtomicWord<bool> gHasLowPriorityAdmissionCommands{false};
+Mutex gLowPriorityAdmissionCommandsMutex =
+    MONGO_MAKE_LATCH("LowPriorityAdmissionCommandsMutex");
+StringSet gLowPriorityAdmissionCommands;
+
+}  // namespace
+
+AdmissionContext& AdmissionContext::get(OperationContext* opCtx) {
+    return getAdmissionContext(opCtx);
+}
+
+AdmissionStats& admissionStatsForPriority(AdmissionContext::Priority priority) {
+    return priority == AdmissionContext::Priority::kLow ? gLowPriorityAdmissionStats
+                                                        : gNormalPriorityAdmissionStats;
+}
+
+bool isLowPriorityAdmissionCommand(StringData commandName) {
+    if (!gHasLowPriorityAdmissionCommands.load()) {
+        return false;
+    }
+    stdx::lock_guard<Latch> lk(gLowPriorityAdmissionCommandsMutex);
+    return gLowPriorityAdmissionCommands.count(commandName) > 0;
+}
+
+Status onUpdateLowPriorityAdmissionCommands(const std::string& commandNames) {
+    StringSet commands;
+    std::vector<std::string> pieces;
+    str::splitStringDelim(commandNames, &pieces, ',');
+    for (auto&& piece : pieces) {
+        auto name = str::ltrim(piece);
+        while (name.endsWith(" ")) {
+            name = name.substr(0, name.size() - 1);
+        }
+        if (!name.empty()) {
+            commands.insert(name.toString());
+        }
+    }
+
+    stdx::lock_guard<Latch> lk(gLowPriorityAdmissionCommandsMutex);
+    gLowPriorityAdmissionCommands = std::move(commands);
+    gHasLowPriorityAdmissionCommands.store(!gLowPriorityAdmissionCommands.empty());
+    return Status::OK();
+}
+
+}  // namespace mongo
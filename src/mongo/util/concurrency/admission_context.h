@@ -0,0 +1,101 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "mongo/base/status.h"
+#include "mongo/base/string_data.h"
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+class OperationContext;
+
+/**
+ * Carries the admission priority of an operation, consulted when the operation asks the global
+ * ticket holders for a concurrency ticket.
+ *
+ * Operations default to Priority::kNormal and are admitted in arrival order. An operation marked
+ * Priority::kLow only takes a ticket that no normal priority operation is waiting for, so a burst
+ * of deprioritized work queues behind the regular workload instead of starving it, and is shed
+ * with a TemporarilyUnavailable error once it has queued for longer than
+ * lowPriorityAdmissionMaxQueueTimeMS.
+ *
+ * Decorates OperationContext. Commands are marked low priority by name through the
+ * lowPriorityAdmissionCommands server parameter.
+ */
+class AdmissionContext {
+public:
+    enum class Priority { kLow, kNormal };
+
+    static AdmissionContext& get(OperationContext* opCtx);
+
+    Priority getPriority() const {
+        return _priority;
+    }
+
+    void setPriority(Priority priority) {
+        _priority = priority;
+    }
+
+private:
+    Priority _priority = Priority::kNormal;
+};
+
+/**
+ * Ticket admission counters for one priority class, reported by the "admission" section of
+ * serverStatus.
+ */
+struct AdmissionStats {
+    AtomicWord<long long> admissions{0};
+    AtomicWord<long long> queueMicros{0};
+    AtomicWord<long long> shed{0};
+};
+
+/**
+ * Returns the admission counters for the given priority class. The returned reference is to a
+ * process-lifetime object and remains valid forever.
+ */
+AdmissionStats& admissionStatsForPriority(AdmissionContext::Priority priority);
+
+/**
+ * Returns true if the named command has been marked low priority through the
+ * lowPriorityAdmissionCommands server parameter.
+ */
+bool isLowPriorityAdmissionCommand(StringData commandName);
+
+/**
+ * Parses the comma-separated lowPriorityAdmissionCommands server parameter; invoked by the
+ * generated parameter code whenever the parameter is set.
+ */
+Status onUpdateLowPriorityAdmissionCommands(const std::string& commandNames);
+
+}  // namespace mongo
@@ -32,6 +32,7 @@
 #ifdef _WIN32
 #include "mongo/platform/windows_basic.h"
 #else
+#include <cerrno>
 #include <pthread.h>
 #endif
 
@@ -39,11 +40,11 @@
 
 namespace mongo {
 
-/** The concept with SimpleMutex is that it is a basic lock/unlock
- *  with no special functionality (such as try and try
- *  timeout).  Thus it can be implemented using OS-specific
- *  facilities in all environments (if desired).  On Windows,
- *  the implementation below is faster than boost mutex.
+/** The concept with SimpleMutex is that it is a basic lock/try_lock/unlock
+ *  with no special functionality (such as try timeout).  Thus it can be
+ *  implemented using OS-specific facilities in all environments (if
+ *  desired).  On Windows, the implementation below is faster than boost
+ *  mutex.
  */
 #if defined(_WIN32)
 
@@ -63,6 +64,9 @@ public:
     void lock() {
         EnterCriticalSection(&_cs);
     }
+    bool try_lock() {
+        return TryEnterCriticalSection(&_cs) != 0;
+    }
     void unlock() {
         LeaveCriticalSection(&_cs);
     }
@@ -90,6 +94,14 @@ public:
         verify(pthread_mutex_lock(&_lock) == 0);
     }
 
+    bool try_lock() {
+        int ret = pthread_mutex_trylock(&_lock);
+        if (ret == EBUSY)
+            return false;
+        verify(ret == 0);
+        return true;
+    }
+
     void unlock() {
         verify(pthread_mutex_unlock(&_lock) == 0);
     }
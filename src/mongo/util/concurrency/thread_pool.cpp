@@ -363,6 +363,14 @@ void ThreadPool::Impl::schedule(Task task) {
     if (_numIdleThreads <= _pendingTasks.size()) {
         _lastFullUtilizationDate = Date_t::now();
     }
+    if (_numIdleThreads == 0) {
+        // Every thread is running a task. Each will re-examine _pendingTasks under _mutex
+        // before going idle, so the new task cannot be missed, and a wakeup now would only
+        // make the busy threads and this one collide on _mutex.
+        return;
+    }
+    lk.unlock();
+    // Signal after releasing _mutex so the woken thread doesn't immediately block on it.
     _workAvailable.notify_one();
 }
 
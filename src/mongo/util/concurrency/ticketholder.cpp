@@ -130,6 +130,7 @@ bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
 }
 
 void TicketHolder::release() {
+    _numFinishedProcessing.fetchAndAddRelaxed(1);
     check(sem_post(&_sem));
 }
 
@@ -146,7 +147,9 @@ Status TicketHolder::resize(int newSize) {
                                     << "; given " << newSize);
 
     while (_outof.load() < newSize) {
-        release();
+        // Post the semaphore directly rather than through release() so that growing the pool is
+        // not mistaken for finished operations by throughput observers.
+        check(sem_post(&_sem));
         _outof.fetchAndAdd(1);
     }
 
@@ -207,6 +210,7 @@ bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
 }
 
 void TicketHolder::release() {
+    _numFinishedProcessing.fetchAndAddRelaxed(1);
     {
         stdx::lock_guard<Latch> lk(_mutex);
         _num++;
@@ -32,6 +32,8 @@
 #include <semaphore.h>
 #endif
 
+#include <cstdint>
+
 #include "mongo/db/operation_context.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
@@ -82,7 +84,18 @@ public:
 
     int outof() const;
 
+    /**
+     * Returns the number of tickets released over the holder's lifetime, i.e. the number of
+     * admitted operations that have finished. Admission controllers use the rate of change of this
+     * value as a throughput signal.
+     */
+    std::int64_t numFinishedProcessing() const {
+        return _numFinishedProcessing.loadRelaxed();
+    }
+
 private:
+    AtomicWord<std::int64_t> _numFinishedProcessing{0};
+
 #if defined(__linux__)
     mutable sem_t _sem;
 
@@ -37,6 +37,11 @@
 #include "mongo/base/error_codes.h"
 #include "mongo/util/ctype.h"
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <tmmintrin.h>
+#define MONGO_HEX_SSSE3 1
+#endif
+
 namespace mongo {
 
 namespace {
@@ -46,10 +51,52 @@ using namespace fmt::literals;
 constexpr StringData kHexUpper = "0123456789ABCDEF"_sd;
 constexpr StringData kHexLower = "0123456789abcdef"_sd;
 
+#ifdef MONGO_HEX_SSSE3
+
+/**
+ * Encodes 16 input bytes as 32 hex characters by splitting each byte into nibbles and mapping
+ * them through the 16-entry digit table with a shuffle. Compiled with a per-function target
+ * attribute and only selected when the CPU reports SSSE3 support at runtime.
+ */
+__attribute__((target("ssse3"))) void hexEncodeBlockSsse3(const char* in,
+                                                          char* out,
+                                                          const char* table) {
+    const __m128i lut = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    const __m128i hi = _mm_and_si128(_mm_srli_epi32(block, 4), _mm_set1_epi8(0x0f));
+    const __m128i lo = _mm_and_si128(block, _mm_set1_epi8(0x0f));
+    const __m128i hiChars = _mm_shuffle_epi8(lut, hi);
+    const __m128i loChars = _mm_shuffle_epi8(lut, lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(hiChars, loChars));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(hiChars, loChars));
+}
+
+bool hexSsse3Available() {
+    static const bool available = __builtin_cpu_supports("ssse3");
+    return available;
+}
+
+#endif  // MONGO_HEX_SSSE3
+
 std::string _hexPack(StringData data, StringData hexchars) {
     std::string out;
+    std::size_t i = 0;
+#ifdef MONGO_HEX_SSSE3
+    if (hexSsse3Available() && data.size() >= 16) {
+        out.resize(2 * data.size());
+        for (; i + 16 <= data.size(); i += 16)
+            hexEncodeBlockSsse3(data.rawData() + i, &out[2 * i], hexchars.rawData());
+        for (; i != data.size(); ++i) {
+            auto c = data[i];
+            out[2 * i] = hexchars[(c & 0xF0) >> 4];
+            out[2 * i + 1] = hexchars[(c & 0x0F)];
+        }
+        return out;
+    }
+#endif
     out.reserve(2 * data.size());
-    for (auto c : data) {
+    for (; i != data.size(); ++i) {
+        auto c = data[i];
         out.append({hexchars[(c & 0xF0) >> 4], hexchars[(c & 0x0F)]});
     }
     return out;
@@ -42,6 +42,30 @@
 #include "mongo/util/scopeguard.h"
 
 namespace mongo {
+namespace {
+
+// Jobs with coarse periods do not need their deadlines honored to the millisecond. Aligning
+// those deadlines to a shared boundary lets the job threads of an otherwise idle node wake in
+// one burst per quantum instead of scattering timed wakeups across the whole period, which
+// keeps the CPU in deeper idle states between bursts. Short-period jobs are left untouched,
+// since the added latency would be a meaningful fraction of their interval.
+constexpr Milliseconds kDeadlineCoalescingMinInterval{1000};
+constexpr Milliseconds kDeadlineCoalescingQuantum{100};
+
+Date_t coalesceDeadline(Date_t deadline, Milliseconds interval) {
+    if (interval < kDeadlineCoalescingMinInterval) {
+        return deadline;
+    }
+    auto millis = deadline.toMillisSinceEpoch();
+    auto quantum = durationCount<Milliseconds>(kDeadlineCoalescingQuantum);
+    auto remainder = millis % quantum;
+    if (remainder == 0) {
+        return deadline;
+    }
+    return Date_t::fromMillisSinceEpoch(millis + quantum - remainder);
+}
+
+}  // namespace
 
 PeriodicRunnerImpl::PeriodicRunnerImpl(ServiceContext* svc, ClockSource* clockSource)
     : _svc(svc), _clockSource(clockSource) {}
@@ -103,7 +127,9 @@ void PeriodicRunnerImpl::PeriodicJobImpl::_run() {
                 _job.job(client.get());
                 lk.lock();
 
-                auto getDeadlineFromInterval = [&] { return start + _job.interval; };
+                auto getDeadlineFromInterval = [&] {
+                    return coalesceDeadline(start + _job.interval, _job.interval);
+                };
 
                 do {
                     auto deadline = getDeadlineFromInterval();
@@ -80,6 +80,14 @@ public:
         return _buffer.capacity();
     }
 
+    /**
+     * Returns the underlying buffer, which may be shared with other fragments. Allows types that
+     * track buffer ownership (such as BSONObj) to keep the fragment's memory alive.
+     */
+    const SharedBuffer& underlyingBuffer() const {
+        return _buffer;
+    }
+
 private:
     SharedBuffer _buffer;
     ptrdiff_t _offset;
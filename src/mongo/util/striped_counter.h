@@ -0,0 +1,115 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/processinfo.h"
+#include "mongo/util/with_alignment.h"
+
+namespace mongo {
+
+/**
+ * A 64-bit statistics counter striped over multiple cache lines. Each increment is a relaxed
+ * atomic add to a slot chosen by the calling thread, so writers on different cores do not share
+ * a line; reading sums every slot and is comparatively expensive. Use for write-mostly,
+ * read-rarely counters such as opcounters, where the total is only materialized for reporting.
+ */
+class StripedCounter64 {
+public:
+    StripedCounter64() : _slots(new CacheAligned<AtomicWord<long long>>[numSlots()]) {}
+
+    StripedCounter64(const StripedCounter64&) = delete;
+    StripedCounter64& operator=(const StripedCounter64&) = delete;
+
+    /**
+     * Adds 'n' to the counter. Returns the previous value of the slot that absorbed the
+     * increment, not the counter's total; the return value is only useful for cheap high-water
+     * checks like the legacy wrap protection in OpCounters.
+     */
+    long long increment(long long n = 1) {
+        return _slots[_mySlot()].fetchAndAddRelaxed(n);
+    }
+
+    /**
+     * Returns the counter's total. Concurrent increments may or may not be visible.
+     */
+    long long sum() const {
+        long long total = 0;
+        for (size_t i = 0; i < numSlots(); i++) {
+            total += _slots[i].loadRelaxed();
+        }
+        return total;
+    }
+
+    /**
+     * Sets the total to 'value'. Not atomic with respect to concurrent increments, which may be
+     * lost; only suitable for wrap protection of values that are "just counters".
+     */
+    void reset(long long value = 0) {
+        _slots[0].store(value);
+        for (size_t i = 1; i < numSlots(); i++) {
+            _slots[i].store(0);
+        }
+    }
+
+    /**
+     * The number of slots shared by every StripedCounter64 in the process: the number of
+     * available cores rounded up to a power of two, capped at 64 to bound the memory and
+     * read-side cost on very large machines.
+     */
+    static size_t numSlots() {
+        static const size_t slots = [] {
+            const size_t cores = std::min<size_t>(ProcessInfo::getNumAvailableCores(), 64);
+            size_t n = 1;
+            while (n < cores) {
+                n <<= 1;
+            }
+            return n;
+        }();
+        return slots;
+    }
+
+private:
+    static size_t _mySlot() {
+        // Threads are dealt onto slots round-robin the first time they touch any counter, which
+        // spreads long-lived worker threads evenly without a per-increment hash.
+        static AtomicWord<unsigned long long> nextSlot;
+        static thread_local const size_t mySlot = nextSlot.fetchAndAdd(1) % numSlots();
+        return mySlot;
+    }
+
+    std::unique_ptr<CacheAligned<AtomicWord<long long>>[]> _slots;
+};
+
+}  // namespace mongo
@@ -31,6 +31,8 @@
 #define NVALGRIND
 #endif
 
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kControl
+
 #include "mongo/platform/basic.h"
 
 #include <algorithm>
@@ -42,6 +44,8 @@
 #include "mongo/base/status.h"
 #include "mongo/base/status_with.h"
 #include "mongo/db/jsobj.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/background.h"
 #include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 #include "mongo/util/tcmalloc_parameters_gen.h"
@@ -50,6 +54,7 @@ namespace mongo {
 namespace {
 constexpr auto kMaxTotalThreadCacheBytesPropertyName = "tcmalloc.max_total_thread_cache_bytes"_sd;
 constexpr auto kAggressiveMemoryDecommitPropertyName = "tcmalloc.aggressive_memory_decommit"_sd;
+constexpr auto kPageheapFreeBytesPropertyName = "tcmalloc.pageheap_free_bytes"_sd;
 
 StatusWith<size_t> getProperty(StringData propname) {
     size_t value;
@@ -141,6 +146,37 @@ MONGO_INITIALIZER_GENERAL(TcmallocConfigurationDefaults, (), ("BeginStartupOptio
     uassertStatusOK(setProperty(kMaxTotalThreadCacheBytesPropertyName, cacheSize));
 }
 
+/**
+ * Periodically returns the page heap's free memory to the operating system once it exceeds
+ * tcmallocReleaseFreeMemoryThresholdBytes. tcmalloc's release rate only sheds spans
+ * incrementally as subsequent frees occur, so after a workload spike large amounts of freed
+ * memory can otherwise stay resident indefinitely.
+ */
+class ReleaseUnusedMemoryTask : public PeriodicTask {
+public:
+    std::string taskName() const override {
+        return "TCMallocReleaseUnusedMemory";
+    }
+
+    void taskDoWork() override {
+        auto threshold = TCMallocReleaseFreeMemoryThresholdBytes.load();
+        if (threshold <= 0 || RUNNING_ON_VALGRIND) {
+            return;
+        }
+        auto swFreeBytes = getProperty(kPageheapFreeBytesPropertyName);
+        if (!swFreeBytes.isOK() ||
+            swFreeBytes.getValue() <= static_cast<size_t>(threshold)) {
+            return;
+        }
+        LOGV2_DEBUG(5837141,
+                    2,
+                    "Returning unused page heap memory to the operating system",
+                    "pageheapFreeBytes"_attr = static_cast<long long>(swFreeBytes.getValue()),
+                    "thresholdBytes"_attr = threshold);
+        MallocExtension::instance()->ReleaseFreeMemory();
+    }
+} releaseUnusedMemoryTask;
+
 }  // namespace
 
 // setParameter for tcmalloc_release_rate
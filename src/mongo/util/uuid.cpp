@@ -35,7 +35,6 @@
 #include <pcrecpp.h>
 
 #include "mongo/bson/bsonobjbuilder.h"
-#include "mongo/platform/mutex.h"
 #include "mongo/platform/random.h"
 #include "mongo/util/hex.h"
 #include "mongo/util/static_immortal.h"
@@ -46,9 +45,6 @@ namespace {
 
 using namespace fmt::literals;
 
-Mutex uuidGenMutex;
-SecureRandom uuidGen;
-
 }  // namespace
 
 StatusWith<UUID> UUID::parse(BSONElement from) {
@@ -102,11 +98,13 @@ bool UUID::isRFC4122v4() const {
 }
 
 UUID UUID::gen() {
+    // One generator per thread, so id-heavy paths (implicit logical sessions, index builds)
+    // never serialize on a process-wide CSPRNG mutex. Each generator buffers entropy internally
+    // and refills from the system source in bulk.
+    thread_local SecureRandom uuidGen;
+
     UUIDStorage randomBytes;
-    {
-        stdx::lock_guard<Latch> lk(uuidGenMutex);
-        uuidGen.fill(&randomBytes, sizeof(randomBytes));
-    }
+    uuidGen.fill(&randomBytes, sizeof(randomBytes));
 
     // Set version in high 4 bits of byte 6 and variant in high 2 bits of byte 8, see RFC 4122,
     // section 4.1.1, 4.1.2 and 4.1.3.